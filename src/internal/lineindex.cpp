@@ -0,0 +1,123 @@
+//
+//  lineindex.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include "lineindex.h"
+#include "strscan.h"
+
+namespace csoup {
+    namespace internal {
+        namespace {
+            size_t countCodePoints(const char* begin, const char* end) {
+                size_t n = 0;
+                for (const char* p = begin; p < end; ++ p) {
+                    n += (static_cast<unsigned char>(*p) & 0xC0) != 0x80;
+                }
+                return n;
+            }
+
+            // A line break is a LF, or a CR not followed by one (a CR at the end of the
+            // input so far counts). inputEnd bounds the look at the byte after a CR.
+            bool isLineBreak(const char* p, const char* inputEnd) {
+                return *p == '\n' || (*p == '\r' && (p + 1 == inputEnd || p[1] != '\n'));
+            }
+
+            size_t countLineBreaks(const char* begin, const char* end, const char* inputEnd) {
+                size_t n = countByte(begin, end, '\n');
+                for (const char* p = findByte(begin, end, '\r'); p < end; p = findByte(p + 1, end, '\r')) {
+                    n += isLineBreak(p, inputEnd);
+                }
+                return n;
+            }
+
+            const char* findLastLineBreak(const char* begin, const char* end, const char* inputEnd) {
+                for (const char* p = end; p > begin; -- p) {
+                    if (isLineBreak(p - 1, inputEnd)) return p - 1;
+                }
+                return NULL;
+            }
+        }
+
+        LineIndex::LineIndex(Allocator* allocator) : counts_(16, allocator), base_(0),
+                                                     baseLine_(0), baseColumn_(0), droppedCR_(false) {
+            counts_.push(0);
+        }
+
+        void LineIndex::clear() {
+            counts_.clear();
+            counts_.push(0);
+            base_ = baseLine_ = baseColumn_ = 0;
+            droppedCR_ = false;
+        }
+
+        void LineIndex::indexTo(const StringRef& input, size_t pos) {
+            size_t block = pos / kBlockSize;
+            const char* inputEnd = input.data() + input.size();
+            while (counts_.size() <= block) {
+                const char* begin = input.data() + (counts_.size() - 1) * kBlockSize;
+                // a CR ending the input may still be followed by a LF, keep such a block out
+                if (begin + kBlockSize >= inputEnd) break;
+                counts_.push(*counts_.back() + countLineBreaks(begin, begin + kBlockSize, inputEnd));
+            }
+        }
+
+        size_t LineIndex::breaksBefore(const StringRef& input, size_t block) const {
+            if (block < counts_.size()) return *counts_.at(block);
+
+            // only the block ending the input isn't kept
+            CSOUP_ASSERT(block == counts_.size());
+            const char* begin = input.data() + (block - 1) * kBlockSize;
+            return *counts_.back() + countLineBreaks(begin, begin + kBlockSize, input.data() + input.size());
+        }
+
+        void LineIndex::locate(const StringRef& input, size_t pos, size_t* line, size_t* column) {
+            CSOUP_ASSERT(pos <= input.size());
+            CSOUP_ASSERT(line != NULL && column != NULL);
+
+            indexTo(input, pos);
+            size_t block = pos / kBlockSize;
+            const char* data = input.data();
+            const char* inputEnd = data + input.size();
+            const char* blockStart = data + block * kBlockSize;
+
+            size_t breaks = breaksBefore(input, block);
+            *line = baseLine_ + breaks + countLineBreaks(blockStart, data + pos, inputEnd) + 1;
+            // the LF of a CR LF split by discard() was counted with the CR
+            if (droppedCR_ && pos > 0 && data[0] == '\n') -- *line;
+
+            // the line starts after the last line break before pos; only blocks that
+            // contain a line break need to be searched for it
+            const char* newline = findLastLineBreak(blockStart, data + pos, inputEnd);
+            for (size_t i = block; newline == NULL && i > 0; -- i) {
+                size_t previous = *counts_.at(i - 1);
+                if (breaks != previous) {
+                    newline = findLastLineBreak(data + (i - 1) * kBlockSize, data + i * kBlockSize, inputEnd);
+                }
+                breaks = previous;
+            }
+
+            if (newline == NULL) {
+                *column = baseColumn_ + countCodePoints(data, data + pos) + 1;
+            } else {
+                *column = countCodePoints(newline + 1, data + pos) + 1;
+            }
+        }
+
+        void LineIndex::discard(const StringRef& input, size_t n) {
+            size_t line, column;
+            locate(input, n, &line, &column);
+
+            baseLine_ = line - 1;
+            baseColumn_ = column - 1;
+            base_ += n;
+            // a CR ending the input was taken as a line break; a LF coming next isn't one
+            if (n > 0) droppedCR_ = n == input.size() && input.data()[n - 1] == '\r';
+            counts_.clear();
+            counts_.push(0);
+        }
+    } // namespace internal
+} // namespace csoup
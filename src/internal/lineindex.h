@@ -0,0 +1,61 @@
+//
+//  lineindex.h
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#ifndef CSOUP_INTERNAL_LINEINDEX_H_
+#define CSOUP_INTERNAL_LINEINDEX_H_
+
+#include "../util/common.h"
+#include "../util/stringref.h"
+#include "vector.h"
+
+namespace csoup {
+    namespace internal {
+        // Maps byte offsets of the parser input to 1-based line and column numbers.
+        // Lines end at a LF, a CR LF or a lone CR. Nothing is counted while parsing:
+        // the line breaks of each kBlockSize block are counted the first time a
+        // position at or after it is looked up, and only the per-block totals are kept. The input itself isn't stored; pass the same
+        // (possibly grown) input on every call.
+        class LineIndex {
+        public:
+            LineIndex(Allocator* allocator);
+
+            // Line and column of input[pos]. Columns count code points, not bytes.
+            void locate(const StringRef& input, size_t pos, size_t* line, size_t* column);
+
+            // Called when the first n bytes of the input are dropped (streaming input);
+            // later positions are relative to what remains, and lines keep counting on.
+            void discard(const StringRef& input, size_t n);
+
+            // Bytes dropped by discard() so far; add it to a position to get the offset
+            // into the whole input.
+            size_t base() const {
+                return base_;
+            }
+
+            void clear();
+
+            static const size_t kBlockSize = 4096;
+
+        private:
+            // extends counts_ so that it covers the block holding pos
+            void indexTo(const StringRef& input, size_t pos);
+
+            // line breaks in input[0, block * kBlockSize)
+            size_t breaksBefore(const StringRef& input, size_t block) const;
+
+            // counts_[i] is the number of line breaks in input[0, i * kBlockSize)
+            Vector<size_t> counts_;
+            size_t base_;
+            size_t baseLine_;   // lines before the remaining input
+            size_t baseColumn_; // code points on its first line that were dropped
+            bool droppedCR_;    // the dropped input ended with a CR
+        };
+    } // namespace internal
+} // namespace csoup
+
+#endif // CSOUP_INTERNAL_LINEINDEX_H_
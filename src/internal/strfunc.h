@@ -22,8 +22,8 @@
 #define CSOUP_INTERNAL_STRFUNC_H_
 
 #include <cstring>
-#include <cctype>
 #include "../util/common.h"
+#include "strscan.h"
 
 namespace csoup {
     namespace internal {
@@ -46,14 +46,18 @@ namespace csoup {
             return std::memcmp(sa, sb, sizeof(Ch) * len);
         }
             
-        // Be careful!! This is not an bad implementation!
+        // Case-insensitive in the HTML sense: only ASCII letters are folded.
         template <typename Ch>
         inline int strCmpIgnoreCase(const Ch* sa, const Ch* sb, const size_t len) {
             size_t i = 0;
-            while (i < len && std::tolower(sa[i]) == std::tolower(sb[i]))
+            while (i < len && asciiToLower(sa[i]) == asciiToLower(sb[i]))
                 i ++;
             
-            return i == len ? 0 : std::tolower(sa[i]) - std::tolower(sb[i]);
+            return i == len ? 0 : asciiToLower(sa[i]) - asciiToLower(sb[i]);
+        }
+        
+        inline int strCmpIgnoreCase(const char* sa, const char* sb, const size_t len) {
+            return compareIgnoreCase(sa, sb, len);
         }
             
         template <typename C1, typename C2>
@@ -0,0 +1,575 @@
+//
+//  strscan.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include <cstring>
+#include "strscan.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CSOUP_SCAN_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+    typedef const char* (*FindByteFunc)(const char*, const char*, char);
+    typedef const char* (*FindSubstringFunc)(const char*, const char*, const char*, size_t);
+    typedef const char* (*FindNonAsciiFunc)(const char*, const char*);
+    typedef const char* (*FindControlFunc)(const char*, const char*);
+    typedef size_t (*CountByteFunc)(const char*, const char*, char);
+    typedef int (*CompareIgnoreCaseFunc)(const char*, const char*, size_t);
+    typedef void (*CaseCopyFunc)(char*, const char*, size_t);
+    typedef size_t (*NarrowUtf16Func)(const char*, size_t, bool, char*);
+
+    struct ScanKernels {
+        FindByteFunc findByte;
+        FindSubstringFunc findSubstring;
+        FindNonAsciiFunc findNonAscii;
+        FindControlFunc findControlOrNonAscii;
+        CountByteFunc countByte;
+        CompareIgnoreCaseFunc compareIgnoreCase;
+        CaseCopyFunc lowerCopy;
+        CaseCopyFunc upperCopy;
+        NarrowUtf16Func narrowAsciiUtf16;
+        const char* name;
+    };
+
+    // strings shorter than this are folded inline instead of through the kernels
+    const size_t kShortCaseLength = 16;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // scalar
+
+    const char* findByteScalar(const char* begin, const char* end, char c) {
+        if (begin >= end) return end;
+        const void* p = std::memchr(begin, c, end - begin);
+        return p ? static_cast<const char*>(p) : end;
+    }
+
+    const char* findSubstringScalar(const char* begin, const char* end, const char* needle, size_t n) {
+        const char* last = end - n;
+        for (const char* p = begin; p <= last; ++ p) {
+            p = static_cast<const char*>(std::memchr(p, needle[0], last - p + 1));
+            if (p == NULL) break;
+            if (std::memcmp(p + 1, needle + 1, n - 1) == 0) return p;
+        }
+        return end;
+    }
+
+    const char* findNonAsciiScalar(const char* begin, const char* end) {
+        const char* p = begin;
+        while (p < end && static_cast<unsigned char>(*p) < 0x80) ++ p;
+        return p;
+    }
+
+    const char* findControlOrNonAsciiScalar(const char* begin, const char* end) {
+        const char* p = begin;
+        for (; p < end; ++ p) {
+            unsigned char b = static_cast<unsigned char>(*p);
+            if ((b < 0x20 && b != '\t' && b != '\n' && b != '\f') || b >= 0x7F) break;
+        }
+        return p;
+    }
+
+    size_t countByteScalar(const char* begin, const char* end, char c) {
+        size_t n = 0;
+        for (const char* p = begin; p < end; ++ p) {
+            n += (*p == c);
+        }
+        return n;
+    }
+
+    int compareIgnoreCaseScalar(const char* a, const char* b, size_t n) {
+        const unsigned char* ua = reinterpret_cast<const unsigned char*>(a);
+        const unsigned char* ub = reinterpret_cast<const unsigned char*>(b);
+        for (size_t i = 0; i < n; ++ i) {
+            int d = csoup::internal::kAsciiLowerTable[ua[i]] - csoup::internal::kAsciiLowerTable[ub[i]];
+            if (d) return d;
+        }
+        return 0;
+    }
+
+    void lowerCopyScalar(char* dst, const char* src, size_t n) {
+        for (size_t i = 0; i < n; ++ i) {
+            dst[i] = static_cast<char>(csoup::internal::kAsciiLowerTable[static_cast<unsigned char>(src[i])]);
+        }
+    }
+
+    void upperCopyScalar(char* dst, const char* src, size_t n) {
+        for (size_t i = 0; i < n; ++ i) {
+            dst[i] = static_cast<char>(csoup::internal::asciiToUpper(static_cast<unsigned char>(src[i])));
+        }
+    }
+
+    size_t narrowAsciiUtf16Scalar(const char* src, size_t units, bool bigEndian, char* dst) {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(src);
+        int hi = bigEndian ? 0 : 1;
+        size_t i = 0;
+        for (; i < units; ++ i) {
+            if (p[2 * i + hi] != 0 || p[2 * i + 1 - hi] >= 0x80) break;
+            dst[i] = static_cast<char>(p[2 * i + 1 - hi]);
+        }
+        return i;
+    }
+
+#ifdef CSOUP_SCAN_X86
+    ///////////////////////////////////////////////////////////////////////////
+    // sse2
+
+    __attribute__((target("sse2")))
+    const char* findByteSSE2(const char* begin, const char* end, char c) {
+        const __m128i needle = _mm_set1_epi8(c);
+        const char* p = begin;
+        for (; p + 16 <= end; p += 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+            if (mask) return p + __builtin_ctz(mask);
+        }
+        return findByteScalar(p, end, c);
+    }
+
+    // Two-byte anchor search: compare the first and the last byte of the needle
+    // at every offset of a block, and only memcmp() the candidates where both match.
+    __attribute__((target("sse2")))
+    const char* findSubstringSSE2(const char* begin, const char* end, const char* needle, size_t n) {
+        const __m128i first = _mm_set1_epi8(needle[0]);
+        const __m128i last = _mm_set1_epi8(needle[n - 1]);
+        const char* p = begin;
+        for (; p + n - 1 + 16 <= end; p += 16) {
+            __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + n - 1));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+                                _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last))));
+            while (mask) {
+                int bit = __builtin_ctz(mask);
+                if (std::memcmp(p + bit + 1, needle + 1, n - 2) == 0) return p + bit;
+                mask &= mask - 1;
+            }
+        }
+        return findSubstringScalar(p, end, needle, n);
+    }
+
+    __attribute__((target("sse2")))
+    const char* findNonAsciiSSE2(const char* begin, const char* end) {
+        const char* p = begin;
+        for (; p + 16 <= end; p += 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(block));
+            if (mask) return p + __builtin_ctz(mask);
+        }
+        return findNonAsciiScalar(p, end);
+    }
+
+    __attribute__((target("sse2")))
+    const char* findControlOrNonAsciiSSE2(const char* begin, const char* end) {
+        const __m128i space = _mm_set1_epi8(0x20);
+        const __m128i del = _mm_set1_epi8(0x7F);
+        const __m128i tab = _mm_set1_epi8('\t');
+        const __m128i lf = _mm_set1_epi8('\n');
+        const __m128i ff = _mm_set1_epi8('\f');
+        const char* p = begin;
+        for (; p + 16 <= end; p += 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            // the signed compare also takes in every byte >= 0x80
+            __m128i special = _mm_or_si128(_mm_cmplt_epi8(block, space), _mm_cmpeq_epi8(block, del));
+            __m128i allowed = _mm_or_si128(_mm_cmpeq_epi8(block, tab),
+                                           _mm_or_si128(_mm_cmpeq_epi8(block, lf), _mm_cmpeq_epi8(block, ff)));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_andnot_si128(allowed, special)));
+            if (mask) return p + __builtin_ctz(mask);
+        }
+        return findControlOrNonAsciiScalar(p, end);
+    }
+
+    __attribute__((target("sse2")))
+    size_t countByteSSE2(const char* begin, const char* end, char c) {
+        const __m128i needle = _mm_set1_epi8(c);
+        const char* p = begin;
+        size_t n = 0;
+        for (; p + 16 <= end; p += 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            n += __builtin_popcount(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle))));
+        }
+        return n + countByteScalar(p, end, c);
+    }
+
+    // Sets bit 0x20 of the bytes in [lo, lo + 26): shifting lo to -128 turns the
+    // range check into a single signed compare.
+    __attribute__((target("sse2")))
+    inline __m128i foldCaseSSE2(__m128i block, char lo, __m128i flip) {
+        __m128i shifted = _mm_add_epi8(block, _mm_set1_epi8(static_cast<char>(0x80 - lo)));
+        __m128i inRange = _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(0x80 + 26)));
+        return _mm_xor_si128(block, _mm_and_si128(inRange, flip));
+    }
+
+    __attribute__((target("sse2")))
+    int compareIgnoreCaseSSE2(const char* a, const char* b, size_t n) {
+        const __m128i flip = _mm_set1_epi8(0x20);
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m128i la = foldCaseSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)), 'A', flip);
+            __m128i lb = foldCaseSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)), 'A', flip);
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(la, lb))) ^ 0xFFFF;
+            if (mask) {
+                size_t at = i + __builtin_ctz(mask);
+                return compareIgnoreCaseScalar(a + at, b + at, 1);
+            }
+        }
+        return compareIgnoreCaseScalar(a + i, b + i, n - i);
+    }
+
+    __attribute__((target("sse2")))
+    void lowerCopySSE2(char* dst, const char* src, size_t n) {
+        const __m128i flip = _mm_set1_epi8(0x20);
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), foldCaseSSE2(block, 'A', flip));
+        }
+        lowerCopyScalar(dst + i, src + i, n - i);
+    }
+
+    __attribute__((target("sse2")))
+    void upperCopySSE2(char* dst, const char* src, size_t n) {
+        const __m128i flip = _mm_set1_epi8(0x20);
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), foldCaseSSE2(block, 'a', flip));
+        }
+        upperCopyScalar(dst + i, src + i, n - i);
+    }
+
+    // Eight code units per block: stop at the first block with a unit >= 0x80, the
+    // rest are packed to bytes with saturation (which never saturates here).
+    __attribute__((target("sse2")))
+    size_t narrowAsciiUtf16SSE2(const char* src, size_t units, bool bigEndian, char* dst) {
+        const __m128i nonAscii = _mm_set1_epi16(static_cast<short>(0xFF80));
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 8 <= units; i += 8) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i));
+            if (bigEndian) {
+                block = _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+            }
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, nonAscii), zero)) != 0xFFFF) break;
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(block, block));
+        }
+        return i + narrowAsciiUtf16Scalar(src + 2 * i, units - i, bigEndian, dst + i);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // avx2
+
+    __attribute__((target("avx2")))
+    const char* findByteAVX2(const char* begin, const char* end, char c) {
+        const __m256i needle = _mm256_set1_epi8(c);
+        const char* p = begin;
+        for (; p + 32 <= end; p += 32) {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+            if (mask) return p + __builtin_ctz(mask);
+        }
+        return findByteSSE2(p, end, c);
+    }
+
+    __attribute__((target("avx2")))
+    const char* findSubstringAVX2(const char* begin, const char* end, const char* needle, size_t n) {
+        const __m256i first = _mm256_set1_epi8(needle[0]);
+        const __m256i last = _mm256_set1_epi8(needle[n - 1]);
+        const char* p = begin;
+        for (; p + n - 1 + 32 <= end; p += 32) {
+            __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + n - 1));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+                                _mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first), _mm256_cmpeq_epi8(blockLast, last))));
+            while (mask) {
+                int bit = __builtin_ctz(mask);
+                if (std::memcmp(p + bit + 1, needle + 1, n - 2) == 0) return p + bit;
+                mask &= mask - 1;
+            }
+        }
+        return findSubstringSSE2(p, end, needle, n);
+    }
+
+    __attribute__((target("avx2")))
+    const char* findNonAsciiAVX2(const char* begin, const char* end) {
+        const char* p = begin;
+        for (; p + 32 <= end; p += 32) {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(block));
+            if (mask) return p + __builtin_ctz(mask);
+        }
+        return findNonAsciiSSE2(p, end);
+    }
+
+    __attribute__((target("avx2")))
+    const char* findControlOrNonAsciiAVX2(const char* begin, const char* end) {
+        const __m256i space = _mm256_set1_epi8(0x20);
+        const __m256i del = _mm256_set1_epi8(0x7F);
+        const __m256i tab = _mm256_set1_epi8('\t');
+        const __m256i lf = _mm256_set1_epi8('\n');
+        const __m256i ff = _mm256_set1_epi8('\f');
+        const char* p = begin;
+        for (; p + 32 <= end; p += 32) {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            __m256i special = _mm256_or_si256(_mm256_cmpgt_epi8(space, block), _mm256_cmpeq_epi8(block, del));
+            __m256i allowed = _mm256_or_si256(_mm256_cmpeq_epi8(block, tab),
+                                              _mm256_or_si256(_mm256_cmpeq_epi8(block, lf), _mm256_cmpeq_epi8(block, ff)));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_andnot_si256(allowed, special)));
+            if (mask) return p + __builtin_ctz(mask);
+        }
+        // the tail stays in VEX code: called on the short runs between tags, handing
+        // off to the SSE2 kernel costs more than the scan
+        if (p + 16 <= end) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i special = _mm_or_si128(_mm_cmplt_epi8(block, _mm256_castsi256_si128(space)),
+                                           _mm_cmpeq_epi8(block, _mm256_castsi256_si128(del)));
+            __m128i allowed = _mm_or_si128(_mm_cmpeq_epi8(block, _mm256_castsi256_si128(tab)),
+                                           _mm_or_si128(_mm_cmpeq_epi8(block, _mm256_castsi256_si128(lf)),
+                                                        _mm_cmpeq_epi8(block, _mm256_castsi256_si128(ff))));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_andnot_si128(allowed, special)));
+            if (mask) return p + __builtin_ctz(mask);
+            p += 16;
+        }
+        return findControlOrNonAsciiScalar(p, end);
+    }
+
+    __attribute__((target("avx2")))
+    size_t countByteAVX2(const char* begin, const char* end, char c) {
+        const __m256i needle = _mm256_set1_epi8(c);
+        const char* p = begin;
+        size_t n = 0;
+        for (; p + 32 <= end; p += 32) {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            n += __builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle))));
+        }
+        return n + countByteSSE2(p, end, c);
+    }
+
+    __attribute__((target("avx2")))
+    inline __m256i foldCaseAVX2(__m256i block, char lo, __m256i flip) {
+        __m256i shifted = _mm256_add_epi8(block, _mm256_set1_epi8(static_cast<char>(0x80 - lo)));
+        __m256i inRange = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(0x80 + 26)), shifted);
+        return _mm256_xor_si256(block, _mm256_and_si256(inRange, flip));
+    }
+
+    __attribute__((target("avx2")))
+    int compareIgnoreCaseAVX2(const char* a, const char* b, size_t n) {
+        const __m256i flip = _mm256_set1_epi8(0x20);
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            __m256i la = foldCaseAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)), 'A', flip);
+            __m256i lb = foldCaseAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)), 'A', flip);
+            unsigned mask = ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(la, lb)));
+            if (mask) {
+                size_t at = i + __builtin_ctz(mask);
+                return compareIgnoreCaseScalar(a + at, b + at, 1);
+            }
+        }
+        return compareIgnoreCaseSSE2(a + i, b + i, n - i);
+    }
+
+    __attribute__((target("avx2")))
+    void lowerCopyAVX2(char* dst, const char* src, size_t n) {
+        const __m256i flip = _mm256_set1_epi8(0x20);
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), foldCaseAVX2(block, 'A', flip));
+        }
+        lowerCopySSE2(dst + i, src + i, n - i);
+    }
+
+    __attribute__((target("avx2")))
+    void upperCopyAVX2(char* dst, const char* src, size_t n) {
+        const __m256i flip = _mm256_set1_epi8(0x20);
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), foldCaseAVX2(block, 'a', flip));
+        }
+        upperCopySSE2(dst + i, src + i, n - i);
+    }
+
+    __attribute__((target("avx2")))
+    size_t narrowAsciiUtf16AVX2(const char* src, size_t units, bool bigEndian, char* dst) {
+        const __m256i nonAscii = _mm256_set1_epi16(static_cast<short>(0xFF80));
+        const __m256i zero = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 16 <= units; i += 16) {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 2 * i));
+            if (bigEndian) {
+                block = _mm256_or_si256(_mm256_slli_epi16(block, 8), _mm256_srli_epi16(block, 8));
+            }
+            if (~_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(block, nonAscii), zero))) break;
+            // packus works within 128-bit lanes, so pack the two halves against each other
+            __m128i packed = _mm_packus_epi16(_mm256_castsi256_si128(block), _mm256_extracti128_si256(block, 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+        }
+        return i + narrowAsciiUtf16SSE2(src + 2 * i, units - i, bigEndian, dst + i);
+    }
+#endif // CSOUP_SCAN_X86
+
+    // the kernel set called name, if the CPU runs it
+    bool kernelsNamed(const char* name, ScanKernels* kernels) {
+#ifdef CSOUP_SCAN_X86
+        __builtin_cpu_init();
+        if (std::strcmp(name, "avx2") == 0 && __builtin_cpu_supports("avx2")) {
+            ScanKernels k = { findByteAVX2, findSubstringAVX2, findNonAsciiAVX2, findControlOrNonAsciiAVX2,
+                              countByteAVX2, compareIgnoreCaseAVX2, lowerCopyAVX2, upperCopyAVX2,
+                              narrowAsciiUtf16AVX2, "avx2" };
+            *kernels = k;
+            return true;
+        }
+        if (std::strcmp(name, "sse2") == 0 && __builtin_cpu_supports("sse2")) {
+            ScanKernels k = { findByteSSE2, findSubstringSSE2, findNonAsciiSSE2, findControlOrNonAsciiSSE2,
+                              countByteSSE2, compareIgnoreCaseSSE2, lowerCopySSE2, upperCopySSE2,
+                              narrowAsciiUtf16SSE2, "sse2" };
+            *kernels = k;
+            return true;
+        }
+#endif
+        if (std::strcmp(name, "scalar") == 0) {
+            ScanKernels k = { findByteScalar, findSubstringScalar, findNonAsciiScalar, findControlOrNonAsciiScalar,
+                              countByteScalar, compareIgnoreCaseScalar, lowerCopyScalar, upperCopyScalar,
+                              narrowAsciiUtf16Scalar, "scalar" };
+            *kernels = k;
+            return true;
+        }
+        return false;
+    }
+
+    // the widest kernel set the CPU runs
+    ScanKernels selectKernels() {
+        ScanKernels k;
+        if (!kernelsNamed("avx2", &k) && !kernelsNamed("sse2", &k)) {
+            kernelsNamed("scalar", &k);
+        }
+        return k;
+    }
+
+    // only setScanKernels() changes it
+    ScanKernels& activeKernels() {
+        static ScanKernels k = selectKernels();
+        return k;
+    }
+
+    const ScanKernels& kernels() {
+        return activeKernels();
+    }
+}
+
+namespace csoup {
+    namespace internal {
+#define CSOUP_LOWER_ROW(b) \
+        (b) + 0, (b) + 1, (b) + 2, (b) + 3, (b) + 4, (b) + 5, (b) + 6, (b) + 7, \
+        (b) + 8, (b) + 9, (b) + 10, (b) + 11, (b) + 12, (b) + 13, (b) + 14, (b) + 15
+        const unsigned char kAsciiLowerTable[256] = {
+            CSOUP_LOWER_ROW(0x00), CSOUP_LOWER_ROW(0x10), CSOUP_LOWER_ROW(0x20), CSOUP_LOWER_ROW(0x30),
+            // 'A'-'Z' map to 'a'-'z'
+            0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+            0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+            CSOUP_LOWER_ROW(0x60), CSOUP_LOWER_ROW(0x70),
+            CSOUP_LOWER_ROW(0x80), CSOUP_LOWER_ROW(0x90), CSOUP_LOWER_ROW(0xA0), CSOUP_LOWER_ROW(0xB0),
+            CSOUP_LOWER_ROW(0xC0), CSOUP_LOWER_ROW(0xD0), CSOUP_LOWER_ROW(0xE0), CSOUP_LOWER_ROW(0xF0)
+        };
+#undef CSOUP_LOWER_ROW
+
+        const char* findByte(const char* begin, const char* end, char c) {
+            return kernels().findByte(begin, end, c);
+        }
+
+        const char* findSubstring(const char* begin, const char* end, const char* needle, size_t n) {
+            if (n == 0) return begin;
+            if (begin >= end || static_cast<size_t>(end - begin) < n) return end;
+            if (n == 1) return kernels().findByte(begin, end, needle[0]);
+            return kernels().findSubstring(begin, end, needle, n);
+        }
+
+        const char* findNonAscii(const char* begin, const char* end) {
+            return kernels().findNonAscii(begin, end);
+        }
+
+        const char* findControlOrNonAscii(const char* begin, const char* end) {
+            if (begin >= end) return end;
+            return kernels().findControlOrNonAscii(begin, end);
+        }
+
+        size_t countByte(const char* begin, const char* end, char c) {
+            if (begin >= end) return 0;
+            return kernels().countByte(begin, end, c);
+        }
+
+        const char* validUtf8Prefix(const char* begin, const char* end) {
+            // ASCII runs are skipped with the vector kernel, multi-byte sequences are
+            // checked one at a time.
+            FindNonAsciiFunc skipAscii = kernels().findNonAscii;
+            const unsigned char* e = reinterpret_cast<const unsigned char*>(end);
+            const char* p = begin;
+            for (;;) {
+                p = skipAscii(p, end);
+                if (p >= end) return end;
+                
+                size_t n = utf8SequenceLength(reinterpret_cast<const unsigned char*>(p), e);
+                if (n == 0) return p;
+                p += n;
+            }
+        }
+
+        int compareIgnoreCase(const char* a, const char* b, size_t n) {
+            if (n < kShortCaseLength) return compareIgnoreCaseScalar(a, b, n);
+            return kernels().compareIgnoreCase(a, b, n);
+        }
+
+        void lowerCopy(char* dst, const char* src, size_t n) {
+            if (n < kShortCaseLength) lowerCopyScalar(dst, src, n);
+            else kernels().lowerCopy(dst, src, n);
+        }
+
+        void upperCopy(char* dst, const char* src, size_t n) {
+            if (n < kShortCaseLength) upperCopyScalar(dst, src, n);
+            else kernels().upperCopy(dst, src, n);
+        }
+
+        size_t normaliseNewlines(char* data, size_t n) {
+            char* end = data + n;
+            char* p = const_cast<char*>(kernels().findByte(data, end, '\r'));
+            char* out = p;
+            while (p < end) {
+                // p is at a CR; copy the run up to the next one behind the LF
+                *out ++ = '\n';
+                ++ p;
+                if (p < end && *p == '\n') ++ p;
+                
+                const char* next = kernels().findByte(p, end, '\r');
+                std::memmove(out, p, next - p);
+                out += next - p;
+                p = const_cast<char*>(next);
+            }
+            return out - data;
+        }
+
+        size_t narrowAsciiUtf16(const char* src, size_t units, bool bigEndian, char* dst) {
+            return kernels().narrowAsciiUtf16(src, units, bigEndian, dst);
+        }
+
+        unsigned int hashIgnoreCase(const char* p, size_t n) {
+            unsigned int h = 2166136261u;
+            for (size_t i = 0; i < n; ++ i) {
+                h = (h ^ kAsciiLowerTable[static_cast<unsigned char>(p[i])]) * 16777619u;
+            }
+            return h;
+        }
+
+        const char* scanKernelName() {
+            return kernels().name;
+        }
+
+        bool setScanKernels(const char* name) {
+            return kernelsNamed(name, &activeKernels());
+        }
+    } // namespace internal
+} // namespace csoup
@@ -0,0 +1,111 @@
+//
+//  strscan.h
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#ifndef CSOUP_INTERNAL_STRSCAN_H_
+#define CSOUP_INTERNAL_STRSCAN_H_
+
+#include "../util/common.h"
+
+namespace csoup {
+    namespace internal {
+        // Byte scanning kernels used by CharacterReader.
+        // The implementation is picked once at runtime: AVX2 or SSE2 on x86 when
+        // the CPU supports it, plain scalar code everywhere else.
+
+        //! Returns the first position of c in [begin, end), or end if not found.
+        const char* findByte(const char* begin, const char* end, char c);
+
+        //! Returns the first position of needle[0, n) in [begin, end), or end if not found.
+        const char* findSubstring(const char* begin, const char* end, const char* needle, size_t n);
+
+        //! Returns the first byte >= 0x80 in [begin, end), or end if the range is pure ASCII.
+        const char* findNonAscii(const char* begin, const char* end);
+
+        //! Returns the first byte in [begin, end) that is an ASCII control other than '\t',
+        //! '\n' and '\f', DEL or >= 0x80, or end if there is none. Text without such
+        //! bytes reads as is; the others go through the UTF-8 decoder.
+        const char* findControlOrNonAscii(const char* begin, const char* end);
+
+        //! Number of occurrences of c in [begin, end).
+        size_t countByte(const char* begin, const char* end, char c);
+
+        //! Length of the well-formed UTF-8 sequence at p, or 0 if it is malformed or cut off by end.
+        /*! Overlongs, surrogates and code points above U+10FFFF count as malformed
+            (the byte ranges of Unicode table 3-7).
+        */
+        inline size_t utf8SequenceLength(const unsigned char* p, const unsigned char* end) {
+            unsigned char b = p[0];
+            if (b < 0x80) return 1;
+            
+            size_t n;
+            if (b >= 0xC2 && b <= 0xDF) n = 2;
+            else if (b >= 0xE0 && b <= 0xEF) n = 3;
+            else if (b >= 0xF0 && b <= 0xF4) n = 4;
+            else return 0;
+            
+            if (static_cast<size_t>(end - p) < n) return 0;
+            
+            unsigned char b1 = p[1];
+            if ((b1 & 0xC0) != 0x80) return 0;
+            if ((b == 0xE0 && b1 < 0xA0) || (b == 0xED && b1 > 0x9F) ||
+                (b == 0xF0 && b1 < 0x90) || (b == 0xF4 && b1 > 0x8F)) return 0;
+            if (n >= 3 && (p[2] & 0xC0) != 0x80) return 0;
+            if (n == 4 && (p[3] & 0xC0) != 0x80) return 0;
+            return n;
+        }
+
+        //! Returns the end of the longest prefix of [begin, end) that is well-formed UTF-8.
+        /*! The prefix always ends on a code point boundary; a sequence cut off by end is
+            not part of it.
+        */
+        const char* validUtf8Prefix(const char* begin, const char* end);
+
+        // ASCII case folding. HTML only folds A-Z/a-z, so none of these depend on the
+        // C locale, and bytes >= 0x80 are left alone.
+        extern const unsigned char kAsciiLowerTable[256];
+
+        inline int asciiToLower(int c) {
+            return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+        }
+
+        inline int asciiToUpper(int c) {
+            return (c >= 'a' && c <= 'z') ? c - ('a' - 'A') : c;
+        }
+
+        inline bool isAsciiAlpha(int c) {
+            return (c | 0x20) >= 'a' && (c | 0x20) <= 'z';
+        }
+
+        //! Compares a[0, n) and b[0, n) ignoring ASCII case, like memcmp() on the lowercased bytes.
+        int compareIgnoreCase(const char* a, const char* b, size_t n);
+
+        //! Writes src[0, n) lowercased (or uppercased) to dst; dst may equal src.
+        void lowerCopy(char* dst, const char* src, size_t n);
+        void upperCopy(char* dst, const char* src, size_t n);
+
+        //! FNV-1a hash of the lowercased bytes, so names differing only in case hash alike.
+        unsigned int hashIgnoreCase(const char* p, size_t n);
+
+        //! Rewrites each CR LF pair and each lone CR in data[0, n) as one LF, in place,
+        //! and returns the new length (the newline step of HTML input preprocessing).
+        size_t normaliseNewlines(char* data, size_t n);
+
+        //! Copies the leading ASCII code units of the UTF-16 text src[0, 2 * units) to dst,
+        //! one byte each, and returns how many there were.
+        size_t narrowAsciiUtf16(const char* src, size_t units, bool bigEndian, char* dst);
+
+        //! Name of the kernel set in use ("avx2", "sse2" or "scalar"), for diagnostics.
+        const char* scanKernelName();
+
+        //! Switches to the kernel set named like scanKernelName() does, if the CPU runs it,
+        //! and returns whether it did. For tests; nothing may scan while it switches.
+        bool setScanKernels(const char* name);
+    } // namespace internal
+} // namespace csoup
+
+#endif // CSOUP_INTERNAL_STRSCAN_H_
@@ -0,0 +1,201 @@
+//
+//  structuralindex.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include <cstring>
+#include "structuralindex.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CSOUP_SCAN_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+    using csoup::internal::StructuralIndex;
+
+    // classifies the StructuralIndex::kBlockSize bytes at p into one mask per group
+    typedef void (*ClassifyFunc)(const char* p, uint64_t* masks);
+
+    // index of the group of b, or -1 for plain text
+    int groupIndex(unsigned char b) {
+        switch (b) {
+            case '<': case '&':
+                return 0;
+            case '>': case '/': case '\t': case '\n': case '\f': case ' ':
+                return 1;
+            case '"': case '\'': case '=': case '`': case '-':
+                return 2;
+            default:
+                return (b < 0x20 || b >= 0x7F) ? 3 : -1;
+        }
+    }
+
+    void classifyScalar(const char* p, uint64_t* masks) {
+        for (int i = 0; i < StructuralIndex::kGroupCount; ++ i) {
+            masks[i] = 0;
+        }
+        for (size_t j = 0; j < StructuralIndex::kBlockSize; ++ j) {
+            int group = groupIndex(static_cast<unsigned char>(p[j]));
+            if (group >= 0) {
+                masks[group] |= static_cast<uint64_t>(1) << j;
+            }
+        }
+    }
+
+#ifdef CSOUP_SCAN_X86
+    ///////////////////////////////////////////////////////////////////////////
+    // sse2
+
+    __attribute__((target("sse2")))
+    inline __m128i matchSSE2(__m128i v, char c) {
+        return _mm_cmpeq_epi8(v, _mm_set1_epi8(c));
+    }
+
+    __attribute__((target("sse2")))
+    inline uint64_t maskSSE2(__m128i m) {
+        return static_cast<uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(m)));
+    }
+
+    __attribute__((target("sse2")))
+    void classifySSE2(const char* p, uint64_t* masks) {
+        for (int i = 0; i < StructuralIndex::kGroupCount; ++ i) {
+            masks[i] = 0;
+        }
+        for (int k = 0; k < 4; ++ k) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * k));
+            __m128i space = _mm_or_si128(_mm_or_si128(matchSSE2(v, ' '), matchSSE2(v, '\t')),
+                                         _mm_or_si128(matchSSE2(v, '\n'), matchSSE2(v, '\f')));
+            __m128i markup = _mm_or_si128(matchSSE2(v, '<'), matchSSE2(v, '&'));
+            __m128i tag = _mm_or_si128(space, _mm_or_si128(matchSSE2(v, '>'), matchSSE2(v, '/')));
+            __m128i value = _mm_or_si128(_mm_or_si128(matchSSE2(v, '"'), matchSSE2(v, '\'')),
+                                         _mm_or_si128(_mm_or_si128(matchSSE2(v, '='), matchSSE2(v, '`')),
+                                                      matchSSE2(v, '-')));
+            // the signed compare also takes in every byte >= 0x80
+            __m128i special = _mm_andnot_si128(space, _mm_or_si128(_mm_cmplt_epi8(v, _mm_set1_epi8(0x20)),
+                                                                   matchSSE2(v, 0x7F)));
+            masks[0] |= maskSSE2(markup) << (16 * k);
+            masks[1] |= maskSSE2(tag) << (16 * k);
+            masks[2] |= maskSSE2(value) << (16 * k);
+            masks[3] |= maskSSE2(special) << (16 * k);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // avx2
+
+    __attribute__((target("avx2")))
+    inline __m256i matchAVX2(__m256i v, char c) {
+        return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c));
+    }
+
+    __attribute__((target("avx2")))
+    inline uint64_t maskAVX2(__m256i m) {
+        return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(m)));
+    }
+
+    __attribute__((target("avx2")))
+    void classifyAVX2(const char* p, uint64_t* masks) {
+        for (int i = 0; i < StructuralIndex::kGroupCount; ++ i) {
+            masks[i] = 0;
+        }
+        for (int k = 0; k < 2; ++ k) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32 * k));
+            __m256i space = _mm256_or_si256(_mm256_or_si256(matchAVX2(v, ' '), matchAVX2(v, '\t')),
+                                            _mm256_or_si256(matchAVX2(v, '\n'), matchAVX2(v, '\f')));
+            __m256i markup = _mm256_or_si256(matchAVX2(v, '<'), matchAVX2(v, '&'));
+            __m256i tag = _mm256_or_si256(space, _mm256_or_si256(matchAVX2(v, '>'), matchAVX2(v, '/')));
+            __m256i value = _mm256_or_si256(_mm256_or_si256(matchAVX2(v, '"'), matchAVX2(v, '\'')),
+                                            _mm256_or_si256(_mm256_or_si256(matchAVX2(v, '='), matchAVX2(v, '`')),
+                                                            matchAVX2(v, '-')));
+            __m256i special = _mm256_andnot_si256(space, _mm256_or_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(0x20), v),
+                                                                         matchAVX2(v, 0x7F)));
+            masks[0] |= maskAVX2(markup) << (32 * k);
+            masks[1] |= maskAVX2(tag) << (32 * k);
+            masks[2] |= maskAVX2(value) << (32 * k);
+            masks[3] |= maskAVX2(special) << (32 * k);
+        }
+    }
+#endif // CSOUP_SCAN_X86
+
+    struct Classifier {
+        ClassifyFunc classify;
+        const char* name;
+    };
+
+    Classifier selectClassifier() {
+#ifdef CSOUP_SCAN_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            Classifier c = { classifyAVX2, "avx2" };
+            return c;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            Classifier c = { classifySSE2, "sse2" };
+            return c;
+        }
+#endif
+        Classifier c = { classifyScalar, "scalar" };
+        return c;
+    }
+
+    const Classifier& classifier() {
+        static const Classifier c = selectClassifier();
+        return c;
+    }
+}
+
+namespace csoup {
+    namespace internal {
+        StructuralIndex::StructuralIndex(Allocator* allocator) : masks_(16, allocator), base_(NULL),
+                                                                 size_(0), blockCount_(0) {
+        }
+
+        void StructuralIndex::build(const StringRef& input) {
+            base_ = input.data();
+            size_ = input.size();
+            blockCount_ = (size_ + kBlockSize - 1) / kBlockSize;
+
+            masks_.clear();
+            masks_.reserve(blockCount_ * kGroupCount);
+
+            ClassifyFunc classify = classifier().classify;
+            uint64_t masks[kGroupCount];
+            for (size_t block = 0; block < blockCount_; ++ block) {
+                const char* p = base_ + block * kBlockSize;
+                size_t n = size_ - block * kBlockSize;
+                if (n >= kBlockSize) {
+                    classify(p, masks);
+                } else {
+                    // the last block is padded with plain text
+                    char tail[kBlockSize];
+                    std::memset(tail, 'a', kBlockSize);
+                    std::memcpy(tail, p, n);
+                    classify(tail, masks);
+                }
+
+                for (int i = 0; i < kGroupCount; ++ i) {
+                    masks_.push(masks[i]);
+                }
+            }
+        }
+
+        void StructuralIndex::clear() {
+            masks_.clear();
+            base_ = NULL;
+            size_ = blockCount_ = 0;
+        }
+
+        unsigned StructuralIndex::groupOf(unsigned char b) {
+            int group = groupIndex(b);
+            return group >= 0 ? 1u << group : 0;
+        }
+
+        const char* StructuralIndex::kernelName() {
+            return classifier().name;
+        }
+    } // namespace internal
+} // namespace csoup
@@ -0,0 +1,103 @@
+//
+//  structuralindex.h
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#ifndef CSOUP_INTERNAL_STRUCTURALINDEX_H_
+#define CSOUP_INTERNAL_STRUCTURALINDEX_H_
+
+#include "../util/common.h"
+#include "../util/stringref.h"
+#include "vector.h"
+
+namespace csoup {
+    namespace internal {
+        // A first pass over the whole input that classifies it in kBlockSize blocks,
+        // keeping one bitmask per block and group of the bytes the tokeniser stops at.
+        // CharacterReader::consumeToAny() then jumps from one candidate to the next
+        // instead of looking at every byte. The groups are disjoint and coarse, so a
+        // state may be shown a few bytes it doesn't stop at; every other ASCII byte is
+        // plain text to every tokeniser state.
+        class StructuralIndex {
+        public:
+            enum {
+                kMarkup = 1 << 0,   // '<', '&'
+                kTag = 1 << 1,      // '>', '/', '\t', '\n', '\f', ' '
+                kValue = 1 << 2,    // '"', '\'', '=', '`', '-'
+                kSpecial = 1 << 3   // NUL, CR, other controls, DEL and every byte >= 0x80
+            };
+
+            static const int kGroupCount = 4;
+            static const size_t kBlockSize = 64;
+
+            StructuralIndex(Allocator* allocator);
+
+            // Classifies input, which must stay where it is while the index is used.
+            void build(const StringRef& input);
+
+            void clear();
+
+            // whether the index was built over exactly [begin, end)
+            bool covers(const CharType* begin, const CharType* end) const {
+                return begin == base_ && end == base_ + size_;
+            }
+
+            // The first byte at or after p in one of groups, or the end of the input.
+            const CharType* nextStop(const CharType* p, unsigned groups) const {
+                CSOUP_ASSERT(p >= base_ && p < base_ + size_);
+
+                size_t offset = p - base_;
+                size_t block = offset / kBlockSize;
+                uint64_t bits = blockMask(block, groups) & (~static_cast<uint64_t>(0) << (offset % kBlockSize));
+                while (bits == 0) {
+                    if (++ block >= blockCount_) return base_ + size_;
+                    bits = blockMask(block, groups);
+                }
+                return base_ + block * kBlockSize + lowestBit(bits);
+            }
+
+            // the group of byte b, or 0 if it is plain text
+            static unsigned groupOf(unsigned char b);
+
+            //! Name of the classifier in use ("avx2", "sse2" or "scalar"), for diagnostics.
+            static const char* kernelName();
+
+        private:
+            uint64_t blockMask(size_t block, unsigned groups) const {
+                const uint64_t* masks = masks_.base() + block * kGroupCount;
+                uint64_t bits = 0;
+                for (int i = 0; i < kGroupCount; ++ i) {
+                    bits |= masks[i] & (static_cast<uint64_t>(0) - ((groups >> i) & 1));
+                }
+                return bits;
+            }
+
+            static size_t lowestBit(uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+                return __builtin_ctzll(bits);
+#else
+                size_t n = 0;
+                while ((bits & 1) == 0) {
+                    bits >>= 1;
+                    ++ n;
+                }
+                return n;
+#endif
+            }
+
+            // masks_[block * kGroupCount + i] holds group 1 << i of the block, bit j for byte j
+            Vector<uint64_t> masks_;
+            const CharType* base_;
+            size_t size_;
+            size_t blockCount_;
+
+            StructuralIndex(const StructuralIndex&);
+            StructuralIndex& operator=(const StructuralIndex&);
+        };
+    } // namespace internal
+} // namespace csoup
+
+#endif // CSOUP_INTERNAL_STRUCTURALINDEX_H_
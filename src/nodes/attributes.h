@@ -21,7 +21,8 @@ namespace csoup {
             allocator_->free(attributes_);
         }
         
-        Attributes(const Attributes& attrs, Allocator* allocator) : allocator_(allocator) {
+        Attributes(const Attributes& attrs, Allocator* allocator) : allocator_(allocator),
+                                                                    attributes_(NULL) {
             CSOUP_ASSERT(allocator != NULL);
             if (attrs.size() == 0) {
                 return ;
@@ -74,7 +75,8 @@ namespace csoup {
                           const StringRef& value) {
             if (!key.size()) return ;
             if (!attributes_) {
-                attributes_ = allocator_->malloc_t< internal::Vector<Attribute> >();
+                attributes_ = new (allocator_->malloc_t< internal::Vector<Attribute> >())
+                                        internal::Vector<Attribute>(4, allocator_);
             }
             
             // try to remove the attribute entry 
@@ -110,6 +112,11 @@ namespace csoup {
             return hasAttribute(CSOUP_ATTR_NAMESPACE_NONE, key);
         }
         
+        // removes all attributes but keeps the storage
+        void clear() {
+            if (attributes_) attributes_->clear();
+        }
+        
         size_t size() const {
             return attributes_ == NULL ? 0 : attributes_->size();
         }
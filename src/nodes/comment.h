@@ -8,7 +8,7 @@ namespace csoup {
     class CommentNode : public Node {
     public:
         CommentNode(const StringRef& comment, const StringRef& baseUri, Allocator* allocator) :
-            Node(CSOUP_NODE_COMMENT, NULL, 0, baseUri, allocator) {
+            Node(CSOUP_NODE_COMMENT, NULL, 0, baseUri, allocator), comment_(NULL) {
             setComment(comment);
         }
         
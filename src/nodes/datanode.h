@@ -3,13 +3,15 @@
 
 #include "node.h"
 #include "../util/csoup_string.h"
+#include "../util/stringbuffer.h"
 
 namespace csoup {
     class DataNode : public Node {
     public:
-        DataNode(const StringRef& data, const StringRef& baseUri, Allocator* allocator) :
-            Node(CSOUP_NODE_CDATA, NULL, 0, baseUri, allocator) {
-            setWholeData(data);
+        // With copy false the node refers to data, which must outlive it.
+        DataNode(const StringRef& data, const StringRef& baseUri, Allocator* allocator, bool copy = true) :
+            Node(CSOUP_NODE_CDATA, NULL, 0, baseUri, allocator), data_(NULL) {
+            setWholeData(data, copy);
         }
         
         DataNode(const StringRef& baseUri, Allocator* allocator) :
@@ -26,14 +28,28 @@ namespace csoup {
             }
         }
         
-        void setWholeData(const StringRef& data) {
+        void setWholeData(const StringRef& data, bool copy = true) {
             if (data_) {
                 data_->~String();
             } else {
                 data_ = allocator()->malloc_t<String>();
             }
          
-            new (data_) String(data, allocator());
+            if (copy)   new (data_) String(data, allocator());
+            else        new (data_) String(data);
+        }
+        
+        // Appends data, see TextNode::appendWholeText().
+        void appendWholeData(const StringRef& data, bool copy = true) {
+            StringRef whole = wholeData();
+            if (!copy && data_ != NULL && data_->isConst() && whole.data() + whole.size() == data.data()) {
+                setWholeData(StringRef(whole.data(), whole.size() + data.size()), false);
+            } else {
+                StringBuffer joined(allocator());
+                joined.appendString(whole);
+                joined.appendString(data);
+                setWholeData(joined.ref(), true);
+            }
         }
         
         StringRef wholeData() {
@@ -8,14 +8,19 @@
 
 #include "../util/stringref.h"
 #include "../util/csoup_string.h"
+#include "../util/mappedfile.h"
+#include "../util/stringbuffer.h"
+#include "../internal/lineindex.h"
 #include "token.h"
+#include "tag.h"
 #include "document.h"
 
 namespace csoup {
     Document::Document(const StringRef& baseUri, Allocator* allocator) :
-    Element(CSOUP_NODE_DOCUMENT, "html", baseUri, allocator ? allocator : new MemoryPoolAllocator()),
+    Element(CSOUP_NODE_DOCUMENT, Tag::valueOf(CSOUP_TAG_HTML), baseUri, allocator ? allocator : new MemoryPoolAllocator()),
     quirksMode_(CSOUP_DOCTYPE_NO_QUIRKS), ownAllocator_(NULL), publicIdentifier_(NULL),
-    systemIdentifier_(NULL), name_(NULL), baseUri_(NULL) {
+    systemIdentifier_(NULL), name_(NULL), baseUri_(NULL), source_(NULL),
+    decodedSource_(NULL), charset_(CSOUP_CHARSET_UTF8), lineIndex_(NULL), unknownTags_(NULL) {
         if (allocator == NULL) {
             ownAllocator_ = Element::allocator();
         }
@@ -24,9 +29,10 @@ namespace csoup {
     }
     
     Document::Document(const StringRef& baseUri, const Attributes& attributes, Allocator* allocator) :
-    Element(CSOUP_NODE_DOCUMENT, "html", attributes, baseUri, allocator ? allocator : new MemoryPoolAllocator()),
+    Element(CSOUP_NODE_DOCUMENT, Tag::valueOf(CSOUP_TAG_HTML), attributes, baseUri, allocator ? allocator : new MemoryPoolAllocator()),
     quirksMode_(CSOUP_DOCTYPE_NO_QUIRKS), ownAllocator_(NULL), publicIdentifier_(NULL),
-    systemIdentifier_(NULL), name_(NULL), baseUri_(NULL) {
+    systemIdentifier_(NULL), name_(NULL), baseUri_(NULL), source_(NULL),
+    decodedSource_(NULL), charset_(CSOUP_CHARSET_UTF8), lineIndex_(NULL), unknownTags_(NULL) {
         if (allocator == NULL) {
             ownAllocator_ = Element::allocator();
         }
@@ -38,11 +44,36 @@ namespace csoup {
         allocator()->deconstructAndFree(publicIdentifier_);
         allocator()->deconstructAndFree(systemIdentifier_);
         allocator()->deconstructAndFree(name_);
+        allocator()->deconstructAndFree(baseUri_);
+        allocator()->deconstructAndFree(source_);
+        allocator()->deconstructAndFree(decodedSource_);
+        allocator()->deconstructAndFree(lineIndex_);
+        allocator()->deconstructAndFree(unknownTags_);
+        
+        // the base destructors would run after an own allocator is gone
+        releaseContents();
+        allocator()->deconstructAndFree(Node::baseUri_);
+        Node::baseUri_ = NULL;
         
         // it's not necessary to check if ownAllocator_ is NULL or not;
         delete ownAllocator_;
     }
     
+    const Tag* Document::internTag(const StringRef& tagName) {
+        const Tag* tag = Tag::valueOf(tagName);
+        if (tag != NULL) return tag;
+        
+        if (unknownTags_ == NULL) {
+            unknownTags_ = CSOUP_NEW1(allocator(), UnknownTagSet, allocator());
+        }
+        return unknownTags_->valueOf(tagName);
+    }
+    
+    void Document::setSelfClosing(const Tag* tag) {
+        CSOUP_ASSERT(unknownTags_ != NULL);
+        unknownTags_->setSelfClosing(tag);
+    }
+    
     void Document::setSystemIdentifier(const csoup::StringRef &systemIdentifier) {
         CSOUP_DELETE(allocator(), systemIdentifier_);
         systemIdentifier_ = CSOUP_NEW2(allocator(), String, systemIdentifier, allocator());
@@ -57,4 +88,52 @@ namespace csoup {
         CSOUP_DELETE(allocator(), name_);
         name_ = CSOUP_NEW2(allocator(), String, name, allocator());
     }
-}
\ No newline at end of file
+    
+    void Document::adoptSource(MappedFile* source) {
+        CSOUP_ASSERT(source != NULL);
+        if (source_ == NULL) {
+            source_ = CSOUP_NEW(allocator(), MappedFile);
+        }
+        source_->swap(*source);
+        source->close();
+        
+        allocator()->deconstructAndFree(decodedSource_);
+        decodedSource_ = NULL;
+        if (lineIndex_ != NULL) {
+            lineIndex_->clear();
+        }
+    }
+    
+    void Document::adoptSource(StringBuffer* source) {
+        CSOUP_ASSERT(source != NULL && source->allocator() == allocator());
+        allocator()->deconstructAndFree(source_);
+        allocator()->deconstructAndFree(decodedSource_);
+        source_ = NULL;
+        decodedSource_ = source;
+        
+        if (lineIndex_ != NULL) {
+            lineIndex_->clear();
+        }
+    }
+    
+    StringRef Document::source() const {
+        if (decodedSource_ != NULL) {
+            return decodedSource_->ref();
+        }
+        return source_ != NULL && source_->isOpen() ? source_->ref() : StringRef("");
+    }
+    
+    bool Document::locate(size_t sourcePos, size_t* line, size_t* column) {
+        StringRef input = source();
+        if (sourcePos == kNoSourcePos || sourcePos > input.size()) {
+            return false;
+        }
+        
+        if (lineIndex_ == NULL) {
+            lineIndex_ = CSOUP_NEW1(allocator(), internal::LineIndex, allocator());
+        }
+        
+        lineIndex_->locate(input, sourcePos, line, column);
+        return true;
+    }
+}
@@ -2,8 +2,16 @@
 #define CSOUP_DOCUMENT_H_
 
 #include "element.h"
+#include "../parser/charset.h"
 
 namespace csoup {
+    class MappedFile;
+    class StringBuffer;
+    class UnknownTagSet;
+    namespace internal {
+        class LineIndex;
+    }
+    
     class Document : public Element {
     public:
         Document(const StringRef& baseUri, Allocator* allocator = NULL);
@@ -32,6 +40,15 @@ namespace csoup {
         
         // createElement
         
+        // The tag named tagName (lower case): the known one, or this document's own
+        // for a name Tag doesn't know. Elements of the document take their tags from
+        // here, so marking an unknown tag self closing stays within the document.
+        const Tag* internTag(const StringRef& tagName);
+
+        // Marks a tag of this document's own, from internTag() for an unknown name,
+        // as able to self close (<foo />).
+        void setSelfClosing(const Tag* tag);
+        
         // Moves any text content that is not in the body element into the body.
         // public Document normalise()
         
@@ -70,6 +87,30 @@ namespace csoup {
             return name_->ref();
         }
         
+        // Takes over the file the document was parsed from, so views into the
+        // input stay valid for the lifetime of the document.
+        void adoptSource(MappedFile* source);
+        
+        // Same, for input that was transcoded to UTF-8 before parsing. The buffer
+        // must come from the document's allocator; the document frees it.
+        void adoptSource(StringBuffer* source);
+        
+        // The encoding the input was read in.
+        CharsetEnum charset() const {
+            return charset_;
+        }
+        
+        void setCharset(CharsetEnum charset) {
+            charset_ = charset;
+        }
+        
+        // The input the document was parsed from, or an empty ref if it isn't kept.
+        StringRef source() const;
+        
+        // Line and column of a source position, see Node::sourcePos(). Returns false
+        // unless the document kept its input.
+        bool locate(size_t sourcePos, size_t* line, size_t* column);
+        
     private:
         QuirksModeEnum quirksMode_;
         String* publicIdentifier_;
@@ -77,6 +118,11 @@ namespace csoup {
         String* name_;
         String* baseUri_;
         bool hasDocType_;
+        MappedFile* source_;
+        StringBuffer* decodedSource_; // replaces source_ when the input wasn't UTF-8
+        CharsetEnum charset_;
+        internal::LineIndex* lineIndex_; // built on the first locate()
+        UnknownTagSet* unknownTags_; // made on the first unknown name
         
         Allocator* ownAllocator_;
     };
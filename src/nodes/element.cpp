@@ -7,9 +7,31 @@
 //
 
 #include "element.h"
+#include "document.h"
 #include "../selector/elementsref.h"
 
 namespace csoup {
+    Element::Element(Document* document, const StringRef& tagName, const Attributes& attributes, const StringRef& baseUri, Allocator* allocator) :
+    Node(CSOUP_NODE_ELEMENT, NULL, 0, baseUri, allocator) {
+        CSOUP_ASSERT(document != NULL);
+        init(document->internTag(tagName), &attributes);
+    }
+    
+    Element::Element(Document* document, const StringRef& tagName, const StringRef& baseUri, Allocator* allocator) :
+    Node(CSOUP_NODE_ELEMENT, NULL, 0, baseUri, allocator) {
+        CSOUP_ASSERT(document != NULL);
+        init(document->internTag(tagName), NULL);
+    }
+    
+    const Tag* Element::internTag(const StringRef& tagName) const {
+        const Tag* tag = Tag::valueOf(tagName);
+        if (tag != NULL) return tag;
+        
+        Document* document = ownerDocument();
+        CSOUP_ASSERT(document != NULL);
+        return document->internTag(tagName);
+    }
+    
     void Element::accumulateParents(csoup::Element *ele, csoup::ElementsRef *output) {
         Node* parNode = ele->parentNode();
         if (parNode == NULL) return ;
@@ -11,52 +11,54 @@
 #include "tag.h"
 
 namespace csoup {
+    class Document;
     class ElementsRef;
     
     class Element : public Node {
     public:
-        Element(const StringRef& tagName, const Attributes& attributes, const StringRef& baseUri, Allocator* allocator) :
-                Node(CSOUP_NODE_ELEMENT, NULL, 0, baseUri, allocator) {
-            CSOUP_ASSERT(Tag::isKnownTag(tagName));
-                    
-            tag_ = Tag::valueOf(tagName);
-            attributes_ = new (allocator->malloc_t<Attributes>()) Attributes(attributes, allocator);
-            childNodes_ =  NULL;
-            classes_ = NULL;
+        // The tag is document's for tagName, see Document::internTag(); any name will do.
+        Element(Document* document, const StringRef& tagName, const Attributes& attributes, const StringRef& baseUri, Allocator* allocator);
+        
+        Element(Document* document, const StringRef& tagName, const StringRef& baseUri, Allocator* allocator);
+        
+        Element(const Tag* tag, const Attributes& attributes, const StringRef& baseUri, Allocator* allocator) :
+        Node(CSOUP_NODE_ELEMENT, NULL, 0, baseUri, allocator) {
+            init(tag, &attributes);
         }
         
-        Element(const StringRef& tagName, const StringRef& baseUri, Allocator* allocator) :
+        Element(const Tag* tag, const StringRef& baseUri, Allocator* allocator) :
         Node(CSOUP_NODE_ELEMENT, NULL, 0, baseUri, allocator) {
-            CSOUP_ASSERT(Tag::isKnownTag(tagName));
-            
-            tag_ = Tag::valueOf(tagName);
-            attributes_ = NULL;
-            childNodes_ =  NULL;
-            classes_ = NULL;
+            init(tag, NULL);
         }
 
         ~Element() {
-            for (size_t i = 0; i < childNodes_->size(); ++ i) {
-                CSOUP_DELETE(allocator(), (*childNodes_->at(i)));
-            }
-            CSOUP_DELETE(allocator(), attributes_);
-            CSOUP_DELETE(allocator(), childNodes_);
-            CSOUP_DELETE(allocator(), classes_);
+            releaseContents();
         }
         
         //////////////////////////////////////////////////
         // Methods about element
         
-        Tag* tag() const {
+        const Tag* tag() const {
             return tag_;
         }
         
+        TagIdEnum tagId() const {
+            return tag_->id();
+        }
+        
         StringRef tagName() const {
             return tag_->tagName();
         }
         
+        // A name Tag doesn't know takes the tag of the owner document, so the element
+        // must be in one for it.
         void setTagName(const StringRef& tagName) {
-            tag_ = Tag::valueOf(tagName);
+            tag_ = internTag(tagName);
+        }
+        
+        void setTag(const Tag* tag) {
+            CSOUP_ASSERT(tag != NULL);
+            tag_ = tag;
         }
         
         /////////////////////////////////////////////////
@@ -105,6 +107,17 @@ namespace csoup {
             return attributes_;
         }
         
+        // The raw input of the content the parser skipped (see TreeBuilder::setSkippedTags()),
+        // kept when the document keeps its input; empty otherwise.
+        StringRef skippedContent() const {
+            return skippedData_ ? StringRef(skippedData_, skippedSize_) : StringRef("");
+        }
+        
+        void setSkippedContent(const StringRef& content) {
+            skippedData_ = content.data();
+            skippedSize_ = content.size();
+        }
+        
         void addAttribute(const StringRef& key, const StringRef& value) {
             addAttribute(CSOUP_ATTR_NAMESPACE_NONE, key, value);
         }
@@ -154,12 +167,15 @@ namespace csoup {
             CSOUP_ASSERT(index < childNodeSize());
             
             // the node in vector would be destroyed
+            Node* node = *childNodes_->at(index);
             if (del) {
-                CSOUP_DELETE(allocator(), *childNodes_->at(index));
+                CSOUP_DELETE(allocator(), node);
+            } else {
+                node->parent_ = NULL;
             }
             
             childNodes_->remove(index);
-            reindexChildren();
+            reindexChildren(index);
         }
         
         void removeChild(Node* node, bool del) {
@@ -193,50 +209,52 @@ namespace csoup {
         }
         
         void insertNode(size_t index, Node* node) {
+            node->setParentNode(this);
             *insert(index) = node;
             reindexChildren(index);
         }
         
         void appendNode(Node* node) {
+            node->setParentNode(this);
             *append() = node;
             reindexChildren(childNodes_->size() - 1);
         }
         
         Element* insertElement(size_t index, const StringRef& tagName, const Attributes& attributes) {
-            Element* ret = new (allocator()->malloc_t<Element>()) Element(tagName, attributes, baseUri(), allocator());
+            Element* ret = new (allocator()->malloc_t<Element>()) Element(internTag(tagName), attributes, baseUri(), allocator());
             ret->setParentNode(this);
             
-            childNodes_->insert(index, ret);
+            ensureChildNodes()->insert(index, ret);
             reindexChildren(index);
             
             return ret;
         }
         
         Element* insertElement(size_t index, const StringRef& tagName) {
-            Element* ret = new (allocator()->malloc_t<Element>()) Element(tagName, baseUri(), allocator());
+            Element* ret = new (allocator()->malloc_t<Element>()) Element(internTag(tagName), baseUri(), allocator());
             ret->setParentNode(this);
             
-            childNodes_->insert(index, ret);
+            ensureChildNodes()->insert(index, ret);
             reindexChildren(index);
             
             return ret;
         }
         
         Element* appendElement(const StringRef& tagName, const Attributes& attributes) {
-            Element* ret = new (allocator()->malloc_t<Element>()) Element(tagName, attributes, baseUri(), allocator());
+            Element* ret = new (allocator()->malloc_t<Element>()) Element(internTag(tagName), attributes, baseUri(), allocator());
             ret->setParentNode(this);
             
-            childNodes_->push(ret);
+            ensureChildNodes()->push(ret);
             ret->setSiblingIndex(childNodeSize() - 1);
             
             return ret;
         }
         
         Element* appendElement(const StringRef& tagName) {
-            Element* ret = new (allocator()->malloc_t<Element>()) Element(tagName, baseUri(), allocator());
+            Element* ret = new (allocator()->malloc_t<Element>()) Element(internTag(tagName), baseUri(), allocator());
             ret->setParentNode(this);
             
-            childNodes_->push(ret);
+            ensureChildNodes()->push(ret);
             ret->setSiblingIndex(childNodeSize() - 1);
             
             return ret;
@@ -247,7 +265,7 @@ namespace csoup {
         NodeTypeName* ret = allocator()->malloc_t<NodeTypeName>(); \
         new (ret) NodeTypeName(text, baseUri(), allocator()); \
         ret->setParentNode(this); \
-        childNodes_->insert(index, ret); \
+        ensureChildNodes()->insert(index, ret); \
         reindexChildren(index); \
         return ret; \
     } \
@@ -256,7 +274,7 @@ namespace csoup {
         NodeTypeName* ret = allocator()->malloc_t<NodeTypeName>(); \
         new (ret) NodeTypeName(text, baseUri(), allocator()); \
         ret->setParentNode(this); \
-        childNodes_->push(ret); \
+        ensureChildNodes()->push(ret); \
         ret->setSiblingIndex(childNodeSize() - 1); \
         return ret; \
     }
@@ -266,29 +284,53 @@ namespace csoup {
     CREATE_TEXT_BASED_NODE_METHOD(TextNode)
         
     protected:
-        Element(NodeTypeEnum nodeType, const StringRef& tagName, const StringRef& baseUri, Allocator* allocator) :
+        Element(NodeTypeEnum nodeType, const Tag* tag, const Attributes& attributes, const StringRef& baseUri, Allocator* allocator) :
         Node(nodeType, NULL, 0, baseUri, allocator) {
-            CSOUP_ASSERT(Tag::isKnownTag(tagName));
             CSOUP_ASSERT(nodeType == CSOUP_NODE_FORMELEMENT || nodeType == CSOUP_NODE_DOCUMENT);
-            
-            tag_ = Tag::valueOf(tagName);
-            attributes_ = NULL;
-            childNodes_ =  NULL;
-            classes_ = NULL;
+            init(tag, &attributes);
         }
         
-        Element(NodeTypeEnum nodeType, const StringRef& tagName, const Attributes& attributes, const StringRef& baseUri, Allocator* allocator) :
+        Element(NodeTypeEnum nodeType, const Tag* tag, const StringRef& baseUri, Allocator* allocator) :
         Node(nodeType, NULL, 0, baseUri, allocator) {
-            CSOUP_ASSERT(Tag::isKnownTag(tagName));
             CSOUP_ASSERT(nodeType == CSOUP_NODE_FORMELEMENT || nodeType == CSOUP_NODE_DOCUMENT);
+            init(tag, NULL);
+        }
+        
+        // Frees the children, attributes and classes; the element is left empty
+        // and doesn't touch the allocator again.
+        void releaseContents() {
+            if (childNodes_ != NULL) {
+                for (size_t i = 0; i < childNodes_->size(); ++ i) {
+                    CSOUP_DELETE(allocator(), (*childNodes_->at(i)));
+                }
+                CSOUP_DELETE(allocator(), childNodes_);
+                childNodes_ = NULL;
+            }
+            if (attributes_ != NULL) {
+                CSOUP_DELETE(allocator(), attributes_);
+                attributes_ = NULL;
+            }
+            if (classes_ != NULL) {
+                CSOUP_DELETE(allocator(), classes_);
+                classes_ = NULL;
+            }
+        }
+        
+    private:
+        // the known tag named tagName, or the owner document's own
+        const Tag* internTag(const StringRef& tagName) const;
+        
+        void init(const Tag* tag, const Attributes* attributes) {
+            CSOUP_ASSERT(tag != NULL);
             
-            tag_ = Tag::valueOf(tagName);
-            attributes_ = new (allocator->malloc_t<Attributes>()) Attributes(attributes, allocator);
+            tag_ = tag;
+            attributes_ = attributes ? new (allocator()->malloc_t<Attributes>()) Attributes(*attributes, allocator()) : NULL;
             childNodes_ =  NULL;
             classes_ = NULL;
+            skippedData_ = NULL;
+            skippedSize_ = 0;
         }
         
-    private:
         // to be conitnued;
         Node** insert(size_t index) {
             return ensureChildNodes()->insert(index);
@@ -339,11 +381,14 @@ namespace csoup {
         
         friend class Node;
     private:
-        Tag* tag_;
+        const Tag* tag_;
         internal::Vector<StringRef>* classes_;
         
         Attributes* attributes_;
         internal::Vector<Node*>* childNodes_;
+        
+        const CharType* skippedData_; // in the input the document keeps
+        size_t skippedSize_;
     };
     
 }
@@ -7,16 +7,33 @@ namespace csoup {
     class StringRef;
     class Allocator;
     
+    // A named character reference found by Entities::matchPrefix().
+    struct EntityMatch {
+        size_t length;      // bytes of the name, including the ';' if it has one
+        int codePoints[2];  // a few entities are two code points; the second is 0 otherwise
+        bool semicolon;     // the name ends with ';'
+    };
+    
     class Entities {
     public:
+        // Finds the longest entity name [begin, end) starts with, so that a named
+        // character reference is read in one pass. Names are those of the HTML spec,
+        // most of them ending with ';' and a few legacy ones also without it.
+        // *truncated is set if the input ended while a longer name could still match.
+        static bool matchPrefix(const CharType* begin, const CharType* end, EntityMatch* match, bool* truncated);
+        
+        // The lookups below take a name without the ';'. The allocator isn't used
+        // any more and is only kept for existing callers.
         static bool isNamedEntity(const StringRef& name, Allocator* allocator);
         
         static bool isNamedEntity(const CharType* name);
         
+        // true for the legacy names that are recognised without a ';'
         static bool isBaseNamedEntity(const StringRef& name, Allocator* allocator);
         
         static bool isBaseNamedEntity(const CharType* name);
         
+        // the (first) code point of the entity, or -1
         static int getCharacterByName(const StringRef& name, Allocator* allocator);
         
         static int getCharacterByName(const CharType* name);
@@ -25,4 +42,4 @@ namespace csoup {
     };
 }
 
-#endif // CSOUP_ENTITIES_H_
\ No newline at end of file
+#endif // CSOUP_ENTITIES_H_
@@ -0,0 +1,2335 @@
+//
+//  entitytrie.h
+//  csoup
+//
+//  Generated by tools/gen_entity_trie.py from the WHATWG named character
+//  references; don't edit.
+//
+
+#ifndef CSOUP_ENTITYTRIE_H_
+#define CSOUP_ENTITYTRIE_H_
+
+#include "../util/common.h"
+
+namespace csoup {
+    namespace internal {
+        // One node per name prefix, in breadth first order so that the children of
+        // a node are next to each other, sorted by label.
+        struct EntityTrieNode {
+            uint8_t label;          // byte on the edge into the node
+            uint8_t childCount;
+            uint16_t firstChild;    // index of the first child
+            uint16_t value;         // 1 + index in kEntityCodePoints of the name ending here, 0 if none
+        };
+
+        const size_t kEntityTrieSize = 9854;
+
+        const EntityTrieNode kEntityTrie[kEntityTrieSize] = {
+            {0, 52, 1, 0}, {'A', 16, 53, 0}, {'B', 8, 69, 0}, {'C', 14, 77, 0}, {'D', 11, 91, 0}, {'E', 16, 102, 0},
+            {'F', 5, 118, 0}, {'G', 12, 123, 0}, {'H', 8, 135, 0}, {'I', 14, 143, 0}, {'J', 5, 157, 0},
+            {'K', 7, 162, 0}, {'L', 11, 169, 0}, {'M', 8, 180, 0}, {'N', 9, 188, 0}, {'O', 14, 197, 0},
+            {'P', 9, 211, 0}, {'Q', 4, 220, 0}, {'R', 12, 224, 0}, {'S', 13, 236, 0}, {'T', 11, 249, 0},
+            {'U', 14, 260, 0}, {'V', 9, 274, 0}, {'W', 5, 283, 0}, {'X', 4, 288, 0}, {'Y', 9, 292, 0},
+            {'Z', 8, 301, 0}, {'a', 16, 309, 0}, {'b', 16, 325, 0}, {'c', 15, 341, 0}, {'d', 19, 356, 0},
+            {'e', 18, 375, 0}, {'f', 12, 393, 0}, {'g', 17, 405, 0}, {'h', 10, 422, 0}, {'i', 15, 432, 0},
+            {'j', 6, 447, 0}, {'k', 8, 453, 0}, {'l', 23, 461, 0}, {'m', 14, 484, 0}, {'n', 24, 498, 0},
+            {'o', 18, 522, 0}, {'p', 12, 540, 0}, {'q', 6, 552, 0}, {'r', 21, 558, 0}, {'s', 19, 579, 0},
+            {'t', 13, 598, 0}, {'u', 18, 611, 0}, {'v', 15, 629, 0}, {'w', 7, 644, 0}, {'x', 14, 651, 0},
+            {'y', 8, 665, 0}, {'z', 10, 673, 0}, {'E', 1, 683, 0}, {'M', 1, 684, 0}, {'a', 1, 685, 0},
+            {'b', 1, 686, 0}, {'c', 2, 687, 0}, {'f', 1, 689, 0}, {'g', 1, 690, 0}, {'l', 1, 691, 0},
+            {'m', 1, 692, 0}, {'n', 1, 693, 0}, {'o', 2, 694, 0}, {'p', 1, 696, 0}, {'r', 1, 697, 0},
+            {'s', 2, 698, 0}, {'t', 1, 700, 0}, {'u', 1, 701, 0}, {'a', 2, 702, 0}, {'c', 1, 704, 0},
+            {'e', 3, 705, 0}, {'f', 1, 708, 0}, {'o', 1, 709, 0}, {'r', 1, 710, 0}, {'s', 1, 711, 0},
+            {'u', 1, 712, 0}, {'H', 1, 713, 0}, {'O', 1, 714, 0}, {'a', 3, 715, 0}, {'c', 4, 718, 0},
+            {'d', 1, 722, 0}, {'e', 2, 723, 0}, {'f', 1, 725, 0}, {'h', 1, 726, 0}, {'i', 1, 727, 0},
+            {'l', 1, 728, 0}, {'o', 4, 729, 0}, {'r', 1, 733, 0}, {'s', 1, 734, 0}, {'u', 1, 735, 0},
+            {'D', 2, 736, 0}, {'J', 1, 738, 0}, {'S', 1, 739, 0}, {'Z', 1, 740, 0}, {'a', 3, 741, 0},
+            {'c', 2, 744, 0}, {'e', 1, 746, 0}, {'f', 1, 747, 0}, {'i', 2, 748, 0}, {'o', 4, 750, 0},
+            {'s', 2, 754, 0}, {'N', 1, 756, 0}, {'T', 1, 757, 0}, {'a', 1, 758, 0}, {'c', 3, 759, 0},
+            {'d', 1, 762, 0}, {'f', 1, 763, 0}, {'g', 1, 764, 0}, {'l', 1, 765, 0}, {'m', 2, 766, 0},
+            {'o', 2, 768, 0}, {'p', 1, 770, 0}, {'q', 1, 771, 0}, {'s', 2, 772, 0}, {'t', 1, 774, 0},
+            {'u', 1, 775, 0}, {'x', 2, 776, 0}, {'c', 1, 778, 0}, {'f', 1, 779, 0}, {'i', 1, 780, 0},
+            {'o', 3, 781, 0}, {'s', 1, 784, 0}, {'J', 1, 785, 0}, {'T', 1, 786, 1}, {'a', 1, 787, 0},
+            {'b', 1, 788, 0}, {'c', 3, 789, 0}, {'d', 1, 792, 0}, {'f', 1, 793, 0}, {'g', 1, 794, 0},
+            {'o', 1, 795, 0}, {'r', 1, 796, 0}, {'s', 1, 797, 0}, {'t', 1, 798, 0}, {'A', 1, 799, 0},
+            {'a', 2, 800, 0}, {'c', 1, 802, 0}, {'f', 1, 803, 0}, {'i', 1, 804, 0}, {'o', 2, 805, 0},
+            {'s', 2, 807, 0}, {'u', 1, 809, 0}, {'E', 1, 810, 0}, {'J', 1, 811, 0}, {'O', 1, 812, 0},
+            {'a', 1, 813, 0}, {'c', 2, 814, 0}, {'d', 1, 816, 0}, {'f', 1, 817, 0}, {'g', 1, 818, 0},
+            {'m', 3, 819, 0}, {'n', 2, 822, 0}, {'o', 3, 824, 0}, {'s', 1, 827, 0}, {'t', 1, 828, 0},
+            {'u', 2, 829, 0}, {'c', 2, 831, 0}, {'f', 1, 833, 0}, {'o', 1, 834, 0}, {'s', 2, 835, 0},
+            {'u', 1, 837, 0}, {'H', 1, 838, 0}, {'J', 1, 839, 0}, {'a', 1, 840, 0}, {'c', 2, 841, 0},
+            {'f', 1, 843, 0}, {'o', 1, 844, 0}, {'s', 1, 845, 0}, {'J', 1, 846, 0}, {'T', 1, 847, 2},
+            {'a', 5, 848, 0}, {'c', 3, 853, 0}, {'e', 2, 856, 0}, {'f', 1, 858, 0}, {'l', 2, 859, 0},
+            {'m', 1, 861, 0}, {'o', 3, 862, 0}, {'s', 3, 865, 0}, {'t', 1, 868, 0}, {'a', 1, 869, 0},
+            {'c', 1, 870, 0}, {'e', 2, 871, 0}, {'f', 1, 873, 0}, {'i', 1, 874, 0}, {'o', 1, 875, 0},
+            {'s', 1, 876, 0}, {'u', 1, 877, 0}, {'J', 1, 878, 0}, {'a', 1, 879, 0}, {'c', 3, 880, 0},
+            {'e', 3, 883, 0}, {'f', 1, 886, 0}, {'o', 4, 887, 0}, {'s', 1, 891, 0}, {'t', 1, 892, 0},
+            {'u', 1, 893, 0}, {'E', 1, 894, 0}, {'a', 1, 895, 0}, {'c', 2, 896, 0}, {'d', 1, 898, 0},
+            {'f', 1, 899, 0}, {'g', 1, 900, 0}, {'m', 3, 901, 0}, {'o', 1, 904, 0}, {'p', 1, 905, 0},
+            {'r', 1, 906, 0}, {'s', 2, 907, 0}, {'t', 1, 909, 0}, {'u', 1, 910, 0}, {'v', 1, 911, 0},
+            {'a', 1, 912, 0}, {'c', 1, 913, 0}, {'f', 1, 914, 0}, {'h', 1, 915, 0}, {'i', 1, 916, 0},
+            {'l', 1, 917, 0}, {'o', 2, 918, 0}, {'r', 4, 920, 0}, {'s', 2, 924, 0}, {'U', 1, 926, 0},
+            {'f', 1, 927, 0}, {'o', 1, 928, 0}, {'s', 1, 929, 0}, {'B', 1, 930, 0}, {'E', 1, 931, 0},
+            {'a', 3, 932, 0}, {'c', 3, 935, 0}, {'e', 2, 938, 0}, {'f', 1, 940, 0}, {'h', 1, 941, 0},
+            {'i', 1, 942, 0}, {'o', 2, 943, 0}, {'r', 1, 945, 0}, {'s', 2, 946, 0}, {'u', 1, 948, 0},
+            {'H', 2, 949, 0}, {'O', 1, 951, 0}, {'a', 1, 952, 0}, {'c', 5, 953, 0}, {'f', 1, 958, 0},
+            {'h', 1, 959, 0}, {'i', 1, 960, 0}, {'m', 1, 961, 0}, {'o', 1, 962, 0}, {'q', 2, 963, 0},
+            {'s', 1, 965, 0}, {'t', 1, 966, 0}, {'u', 4, 967, 0}, {'H', 1, 971, 0}, {'R', 1, 972, 0},
+            {'S', 2, 973, 0}, {'a', 2, 975, 0}, {'c', 3, 977, 0}, {'f', 1, 980, 0}, {'h', 2, 981, 0},
+            {'i', 1, 983, 0}, {'o', 1, 984, 0}, {'r', 1, 985, 0}, {'s', 2, 986, 0}, {'a', 2, 988, 0},
+            {'b', 1, 990, 0}, {'c', 2, 991, 0}, {'d', 1, 993, 0}, {'f', 1, 994, 0}, {'g', 1, 995, 0},
+            {'m', 1, 996, 0}, {'n', 2, 997, 0}, {'o', 2, 999, 0}, {'p', 8, 1001, 0}, {'r', 1, 1009, 0},
+            {'s', 1, 1010, 0}, {'t', 1, 1011, 0}, {'u', 1, 1012, 0}, {'D', 1, 1013, 0}, {'b', 1, 1014, 0},
+            {'c', 1, 1015, 0}, {'d', 1, 1016, 0}, {'e', 2, 1017, 0}, {'f', 1, 1019, 0}, {'o', 1, 1020, 0},
+            {'s', 1, 1021, 0}, {'v', 1, 1022, 0}, {'c', 1, 1023, 0}, {'e', 1, 1024, 0}, {'f', 1, 1025, 0},
+            {'o', 1, 1026, 0}, {'s', 1, 1027, 0}, {'f', 1, 1028, 0}, {'i', 1, 1029, 0}, {'o', 1, 1030, 0},
+            {'s', 1, 1031, 0}, {'A', 1, 1032, 0}, {'I', 1, 1033, 0}, {'U', 1, 1034, 0}, {'a', 1, 1035, 0},
+            {'c', 2, 1036, 0}, {'f', 1, 1038, 0}, {'o', 1, 1039, 0}, {'s', 1, 1040, 0}, {'u', 1, 1041, 0},
+            {'H', 1, 1042, 0}, {'a', 1, 1043, 0}, {'c', 2, 1044, 0}, {'d', 1, 1046, 0}, {'e', 2, 1047, 0},
+            {'f', 1, 1049, 0}, {'o', 1, 1050, 0}, {'s', 1, 1051, 0}, {'a', 1, 1052, 0}, {'b', 1, 1053, 0},
+            {'c', 6, 1054, 0}, {'e', 1, 1060, 0}, {'f', 2, 1061, 0}, {'g', 1, 1063, 0}, {'l', 2, 1064, 0},
+            {'m', 2, 1066, 0}, {'n', 2, 1068, 0}, {'o', 2, 1070, 0}, {'p', 7, 1072, 0}, {'r', 1, 1079, 0},
+            {'s', 3, 1080, 0}, {'t', 1, 1083, 0}, {'u', 1, 1084, 0}, {'w', 2, 1085, 0}, {'N', 1, 1087, 0},
+            {'a', 2, 1088, 0}, {'b', 1, 1090, 0}, {'c', 2, 1091, 0}, {'d', 1, 1093, 0}, {'e', 5, 1094, 0},
+            {'f', 1, 1099, 0}, {'i', 1, 1100, 0}, {'k', 1, 1101, 0}, {'l', 3, 1102, 0}, {'n', 2, 1105, 0},
+            {'o', 4, 1107, 0}, {'p', 1, 1111, 0}, {'r', 2, 1112, 0}, {'s', 4, 1114, 0}, {'u', 2, 1118, 0},
+            {'a', 3, 1120, 0}, {'c', 4, 1123, 0}, {'d', 1, 1127, 0}, {'e', 3, 1128, 0}, {'f', 1, 1131, 0},
+            {'h', 3, 1132, 0}, {'i', 1, 1135, 0}, {'l', 1, 1136, 0}, {'o', 4, 1137, 0}, {'r', 2, 1141, 0},
+            {'s', 2, 1143, 0}, {'t', 1, 1145, 0}, {'u', 7, 1146, 0}, {'w', 2, 1153, 0}, {'y', 1, 1155, 0},
+            {'A', 1, 1156, 0}, {'H', 1, 1157, 0}, {'a', 4, 1158, 0}, {'b', 2, 1162, 0}, {'c', 2, 1164, 0},
+            {'d', 3, 1166, 0}, {'e', 3, 1169, 0}, {'f', 2, 1172, 0}, {'h', 1, 1174, 0}, {'i', 5, 1175, 0},
+            {'j', 1, 1180, 0}, {'l', 1, 1181, 0}, {'o', 5, 1182, 0}, {'r', 2, 1187, 0}, {'s', 3, 1189, 0},
+            {'t', 2, 1192, 0}, {'u', 2, 1194, 0}, {'w', 1, 1196, 0}, {'z', 2, 1197, 0}, {'D', 2, 1199, 0},
+            {'a', 2, 1201, 0}, {'c', 4, 1203, 0}, {'d', 1, 1207, 0}, {'e', 1, 1208, 0}, {'f', 2, 1209, 0},
+            {'g', 3, 1211, 0}, {'l', 4, 1214, 0}, {'m', 3, 1218, 0}, {'n', 2, 1221, 0}, {'o', 2, 1223, 0},
+            {'p', 3, 1225, 0}, {'q', 4, 1228, 0}, {'r', 2, 1232, 0}, {'s', 3, 1234, 0}, {'t', 2, 1237, 0},
+            {'u', 2, 1239, 0}, {'x', 3, 1241, 0}, {'a', 1, 1244, 0}, {'c', 1, 1245, 0}, {'e', 1, 1246, 0},
+            {'f', 3, 1247, 0}, {'i', 1, 1250, 0}, {'j', 1, 1251, 0}, {'l', 3, 1252, 0}, {'n', 1, 1255, 0},
+            {'o', 2, 1256, 0}, {'p', 1, 1258, 0}, {'r', 2, 1259, 0}, {'s', 1, 1261, 0}, {'E', 2, 1262, 0},
+            {'a', 3, 1264, 0}, {'b', 1, 1267, 0}, {'c', 2, 1268, 0}, {'d', 1, 1270, 0}, {'e', 4, 1271, 0},
+            {'f', 1, 1275, 0}, {'g', 2, 1276, 0}, {'i', 1, 1278, 0}, {'j', 1, 1279, 0}, {'l', 4, 1280, 0},
+            {'n', 4, 1284, 0}, {'o', 1, 1288, 0}, {'r', 1, 1289, 0}, {'s', 2, 1290, 0}, {'t', 6, 1292, 3},
+            {'v', 2, 1298, 0}, {'A', 1, 1300, 0}, {'a', 4, 1301, 0}, {'b', 1, 1305, 0}, {'c', 1, 1306, 0},
+            {'e', 3, 1307, 0}, {'f', 1, 1310, 0}, {'k', 1, 1311, 0}, {'o', 5, 1312, 0}, {'s', 3, 1317, 0},
+            {'y', 2, 1320, 0}, {'a', 1, 1322, 0}, {'c', 3, 1323, 0}, {'e', 2, 1326, 0}, {'f', 2, 1328, 0},
+            {'g', 1, 1330, 0}, {'i', 4, 1331, 0}, {'j', 1, 1335, 0}, {'m', 3, 1336, 0}, {'n', 5, 1339, 0},
+            {'o', 4, 1344, 0}, {'p', 1, 1348, 0}, {'q', 1, 1349, 0}, {'s', 2, 1350, 0}, {'t', 2, 1352, 0},
+            {'u', 2, 1354, 0}, {'c', 2, 1356, 0}, {'f', 1, 1358, 0}, {'m', 1, 1359, 0}, {'o', 1, 1360, 0},
+            {'s', 2, 1361, 0}, {'u', 1, 1363, 0}, {'a', 1, 1364, 0}, {'c', 2, 1365, 0}, {'f', 1, 1367, 0},
+            {'g', 1, 1368, 0}, {'h', 1, 1369, 0}, {'j', 1, 1370, 0}, {'o', 1, 1371, 0}, {'s', 1, 1372, 0},
+            {'A', 3, 1373, 0}, {'B', 1, 1376, 0}, {'E', 2, 1377, 0}, {'H', 1, 1379, 0}, {'a', 9, 1380, 0},
+            {'b', 3, 1389, 0}, {'c', 4, 1392, 0}, {'d', 4, 1396, 0}, {'e', 5, 1400, 0}, {'f', 3, 1405, 0},
+            {'g', 2, 1408, 0}, {'h', 2, 1410, 0}, {'j', 1, 1412, 0}, {'l', 5, 1413, 0}, {'m', 2, 1418, 0},
+            {'n', 4, 1420, 0}, {'o', 8, 1424, 0}, {'p', 1, 1432, 0}, {'r', 5, 1433, 0}, {'s', 6, 1438, 0},
+            {'t', 8, 1444, 4}, {'u', 1, 1452, 0}, {'v', 2, 1453, 0}, {'D', 1, 1455, 0}, {'a', 4, 1456, 0},
+            {'c', 2, 1460, 0}, {'d', 1, 1462, 0}, {'e', 1, 1463, 0}, {'f', 1, 1464, 0}, {'h', 1, 1465, 0},
+            {'i', 3, 1466, 0}, {'l', 2, 1469, 0}, {'n', 1, 1471, 0}, {'o', 2, 1472, 0}, {'p', 1, 1474, 0},
+            {'s', 2, 1475, 0}, {'u', 3, 1477, 0}, {'G', 2, 1480, 0}, {'L', 3, 1482, 0}, {'R', 1, 1485, 0},
+            {'V', 2, 1486, 0}, {'a', 5, 1488, 0}, {'b', 2, 1493, 0}, {'c', 5, 1495, 0}, {'d', 1, 1500, 0},
+            {'e', 7, 1501, 0}, {'f', 1, 1508, 0}, {'g', 4, 1509, 0}, {'h', 3, 1513, 0}, {'i', 3, 1516, 0},
+            {'j', 1, 1519, 0}, {'l', 7, 1520, 0}, {'m', 1, 1527, 0}, {'o', 2, 1528, 0}, {'p', 3, 1530, 0},
+            {'r', 4, 1533, 0}, {'s', 7, 1537, 0}, {'t', 4, 1544, 0}, {'u', 2, 1548, 0}, {'v', 9, 1550, 0},
+            {'w', 3, 1559, 0}, {'S', 1, 1562, 0}, {'a', 2, 1563, 0}, {'c', 2, 1565, 0}, {'d', 5, 1567, 0},
+            {'e', 1, 1572, 0}, {'f', 2, 1573, 0}, {'g', 3, 1575, 0}, {'h', 2, 1578, 0}, {'i', 1, 1580, 0},
+            {'l', 4, 1581, 0}, {'m', 3, 1585, 0}, {'o', 1, 1588, 0}, {'p', 3, 1589, 0}, {'r', 7, 1592, 0},
+            {'s', 3, 1599, 0}, {'t', 1, 1602, 0}, {'u', 1, 1603, 0}, {'v', 1, 1604, 0}, {'a', 1, 1605, 0},
+            {'c', 1, 1606, 0}, {'e', 1, 1607, 0}, {'f', 1, 1608, 0}, {'h', 3, 1609, 0}, {'i', 3, 1612, 0},
+            {'l', 2, 1615, 0}, {'m', 1, 1617, 0}, {'o', 3, 1618, 0}, {'r', 10, 1621, 0}, {'s', 2, 1631, 0},
+            {'u', 1, 1633, 0}, {'f', 1, 1634, 0}, {'i', 1, 1635, 0}, {'o', 1, 1636, 0}, {'p', 1, 1637, 0},
+            {'s', 1, 1638, 0}, {'u', 3, 1639, 0}, {'A', 3, 1642, 0}, {'B', 1, 1645, 0}, {'H', 1, 1646, 0},
+            {'a', 7, 1647, 0}, {'b', 3, 1654, 0}, {'c', 4, 1657, 0}, {'d', 4, 1661, 0}, {'e', 3, 1665, 0},
+            {'f', 3, 1668, 0}, {'h', 2, 1671, 0}, {'i', 3, 1673, 0}, {'l', 3, 1676, 0}, {'m', 1, 1679, 0},
+            {'n', 1, 1680, 0}, {'o', 4, 1681, 0}, {'p', 2, 1685, 0}, {'r', 1, 1687, 0}, {'s', 4, 1688, 0},
+            {'t', 3, 1692, 0}, {'u', 1, 1695, 0}, {'x', 1, 1696, 0}, {'a', 1, 1697, 0}, {'b', 1, 1698, 0},
+            {'c', 10, 1699, 0}, {'d', 1, 1709, 0}, {'e', 7, 1710, 0}, {'f', 1, 1717, 0}, {'h', 4, 1718, 0},
+            {'i', 2, 1722, 0}, {'l', 1, 1724, 0}, {'m', 4, 1725, 0}, {'o', 3, 1729, 0}, {'p', 1, 1732, 0},
+            {'q', 3, 1733, 0}, {'r', 1, 1736, 0}, {'s', 4, 1737, 0}, {'t', 2, 1741, 0}, {'u', 5, 1743, 0},
+            {'w', 3, 1748, 0}, {'z', 1, 1751, 0}, {'a', 2, 1752, 0}, {'b', 1, 1754, 0}, {'c', 3, 1755, 0},
+            {'d', 1, 1758, 0}, {'e', 1, 1759, 0}, {'f', 1, 1760, 0}, {'h', 4, 1761, 0}, {'i', 3, 1765, 0},
+            {'o', 3, 1768, 0}, {'p', 1, 1771, 0}, {'r', 3, 1772, 0}, {'s', 3, 1775, 0}, {'w', 2, 1778, 0},
+            {'A', 1, 1780, 0}, {'H', 1, 1781, 0}, {'a', 2, 1782, 0}, {'b', 1, 1784, 0}, {'c', 2, 1785, 0},
+            {'d', 3, 1787, 0}, {'f', 2, 1790, 0}, {'g', 1, 1792, 0}, {'h', 2, 1793, 0}, {'l', 2, 1795, 0},
+            {'m', 2, 1797, 0}, {'o', 2, 1799, 0}, {'p', 6, 1801, 0}, {'r', 3, 1807, 0}, {'s', 1, 1810, 0},
+            {'t', 3, 1811, 0}, {'u', 2, 1814, 0}, {'w', 1, 1816, 0}, {'A', 1, 1817, 0}, {'B', 1, 1818, 0},
+            {'D', 1, 1819, 0}, {'a', 2, 1820, 0}, {'c', 1, 1822, 0}, {'d', 1, 1823, 0}, {'e', 3, 1824, 0},
+            {'f', 1, 1827, 0}, {'l', 1, 1828, 0}, {'n', 1, 1829, 0}, {'o', 1, 1830, 0}, {'p', 1, 1831, 0},
+            {'r', 1, 1832, 0}, {'s', 2, 1833, 0}, {'z', 1, 1835, 0}, {'c', 1, 1836, 0}, {'e', 2, 1837, 0},
+            {'f', 1, 1839, 0}, {'o', 1, 1840, 0}, {'p', 1, 1841, 0}, {'r', 2, 1842, 0}, {'s', 1, 1844, 0},
+            {'c', 3, 1845, 0}, {'d', 1, 1848, 0}, {'f', 1, 1849, 0}, {'h', 2, 1850, 0}, {'i', 1, 1852, 0},
+            {'l', 2, 1853, 0}, {'m', 1, 1855, 0}, {'n', 1, 1856, 0}, {'o', 3, 1857, 0}, {'r', 2, 1860, 0},
+            {'s', 2, 1862, 0}, {'u', 2, 1864, 0}, {'v', 1, 1866, 0}, {'w', 1, 1867, 0}, {'a', 1, 1868, 0},
+            {'c', 2, 1869, 0}, {'e', 1, 1871, 0}, {'f', 1, 1872, 0}, {'i', 1, 1873, 0}, {'o', 1, 1874, 0},
+            {'s', 1, 1875, 0}, {'u', 2, 1876, 0}, {'a', 1, 1878, 0}, {'c', 2, 1879, 0}, {'d', 1, 1881, 0},
+            {'e', 2, 1882, 0}, {'f', 1, 1884, 0}, {'h', 1, 1885, 0}, {'i', 1, 1886, 0}, {'o', 1, 1887, 0},
+            {'s', 1, 1888, 0}, {'w', 2, 1889, 0}, {'l', 1, 1891, 0}, {'P', 1, 1892, 5}, {'c', 1, 1893, 0},
+            {'r', 1, 1894, 0}, {'i', 1, 1895, 0}, {'y', 1, 1896, 0}, {'r', 1, 1897, 0}, {'r', 1, 1898, 0},
+            {'p', 1, 1899, 0}, {'a', 1, 1900, 0}, {'d', 1, 1901, 0}, {'g', 1, 1902, 0}, {'p', 1, 1903, 0},
+            {'p', 1, 1904, 0}, {'i', 1, 1905, 0}, {'c', 1, 1906, 0}, {'s', 1, 1907, 0}, {'i', 1, 1908, 0},
+            {'m', 1, 1909, 0}, {'c', 1, 1910, 0}, {'r', 2, 1911, 0}, {'y', 1, 1913, 0}, {'c', 1, 1914, 0},
+            {'r', 1, 1915, 0}, {'t', 1, 1916, 0}, {'r', 1, 1917, 0}, {'p', 1, 1918, 0}, {'e', 1, 1919, 0},
+            {'c', 1, 1920, 0}, {'m', 1, 1921, 0}, {'c', 1, 1922, 0}, {'P', 1, 1923, 0}, {'c', 1, 1924, 0},
+            {'p', 2, 1925, 0}, {'y', 1, 1927, 0}, {'a', 1, 1928, 0}, {'e', 1, 1929, 0}, {'i', 1, 1930, 0},
+            {'o', 1, 1931, 0}, {'o', 1, 1932, 0}, {'d', 1, 1933, 0}, {'n', 1, 1934, 0}, {'r', 1, 1935, 0},
+            {'i', 1, 1936, 0}, {'r', 1, 1937, 0}, {'o', 2, 1938, 0}, {'l', 1, 1940, 0}, {'n', 3, 1941, 0},
+            {'p', 2, 1944, 0}, {'u', 1, 1946, 0}, {'o', 1, 1947, 0}, {'c', 1, 1948, 0}, {'p', 2, 1949, 0},
+            {';', 0, 0, 6}, {'o', 1, 1951, 0}, {'c', 1, 1952, 0}, {'c', 1, 1953, 0}, {'c', 1, 1954, 0},
+            {'g', 1, 1955, 0}, {'r', 1, 1956, 0}, {'s', 1, 1957, 0}, {'a', 1, 1958, 0}, {'y', 1, 1959, 0},
+            {'l', 2, 1960, 0}, {'r', 1, 1962, 0}, {'a', 2, 1963, 0}, {'f', 1, 1965, 0}, {'p', 1, 1966, 0},
+            {'t', 3, 1967, 0}, {'u', 1, 1970, 0}, {'w', 1, 1971, 0}, {'c', 1, 1972, 0}, {'t', 1, 1973, 0},
+            {'G', 1, 1974, 0}, {'H', 1, 1975, 7}, {'c', 1, 1976, 0}, {'a', 1, 1977, 0}, {'i', 1, 1978, 0},
+            {'y', 1, 1979, 0}, {'o', 1, 1980, 0}, {'r', 1, 1981, 0}, {'r', 1, 1982, 0}, {'e', 1, 1983, 0},
+            {'a', 1, 1984, 0}, {'p', 1, 1985, 0}, {'g', 1, 1986, 0}, {'p', 1, 1987, 0}, {'s', 1, 1988, 0},
+            {'u', 2, 1989, 0}, {'c', 1, 1991, 0}, {'i', 1, 1992, 0}, {'a', 1, 1993, 0}, {'m', 1, 1994, 0},
+            {'i', 1, 1995, 0}, {'p', 1, 1996, 0}, {'y', 1, 1997, 0}, {'r', 1, 1998, 0}, {'l', 1, 1999, 0},
+            {'p', 1, 2000, 0}, {'r', 1, 2001, 0}, {'u', 1, 2002, 0}, {'c', 1, 2003, 0}, {'c', 1, 2004, 0},
+            {';', 0, 0, 8}, {'m', 1, 2005, 0}, {'r', 1, 2006, 0}, {'e', 1, 2007, 0}, {'i', 1, 2008, 0},
+            {'y', 1, 2009, 0}, {'o', 1, 2010, 0}, {'r', 1, 2011, 0}, {';', 0, 0, 9}, {'p', 1, 2012, 0},
+            {'e', 1, 2013, 0}, {'c', 1, 2014, 0}, {';', 0, 0, 10}, {'R', 1, 2015, 0}, {'c', 1, 2016, 0},
+            {'t', 1, 2017, 0}, {'i', 1, 2018, 0}, {'r', 1, 2019, 0}, {'l', 1, 2020, 0}, {'p', 1, 2021, 0},
+            {'r', 1, 2022, 0}, {'c', 1, 2023, 0}, {'t', 1, 2024, 0}, {'m', 1, 2025, 0}, {'c', 1, 2026, 0},
+            {'l', 1, 2027, 0}, {'c', 1, 2028, 0}, {'c', 1, 2029, 0}, {'i', 1, 2030, 0}, {'y', 1, 2031, 0},
+            {'o', 1, 2032, 0}, {'r', 1, 2033, 0}, {'r', 1, 2034, 0}, {';', 0, 0, 11}, {'a', 2, 2035, 0},
+            {'p', 1, 2037, 0}, {'t', 2, 2038, 0}, {'v', 1, 2040, 0}, {'g', 1, 2041, 0}, {'p', 1, 2042, 0},
+            {'t', 1, 2043, 0}, {'c', 1, 2044, 0}, {'i', 1, 2045, 0}, {'k', 1, 2046, 0}, {'m', 1, 2047, 0},
+            {'i', 1, 2048, 0}, {'y', 1, 2049, 0}, {'r', 1, 2050, 0}, {'p', 1, 2051, 0}, {'c', 1, 2052, 0},
+            {'e', 1, 2053, 0}, {'k', 1, 2054, 0}, {'c', 1, 2055, 0}, {'c', 1, 2056, 0}, {'p', 1, 2057, 0},
+            {'e', 1, 2058, 0}, {'y', 1, 2059, 0}, {'r', 1, 2060, 0}, {'p', 1, 2061, 0}, {'c', 1, 2062, 0},
+            {'c', 1, 2063, 0}, {';', 0, 0, 12}, {'c', 1, 2064, 0}, {'m', 1, 2065, 0}, {'n', 1, 2066, 0},
+            {'p', 1, 2067, 0}, {'r', 1, 2068, 0}, {'a', 1, 2069, 0}, {'e', 1, 2070, 0}, {'y', 1, 2071, 0},
+            {'f', 1, 2072, 0}, {'s', 1, 2073, 0}, {'r', 1, 2074, 0}, {';', 0, 0, 13}, {'e', 1, 2075, 0},
+            {'i', 1, 2076, 0}, {'n', 1, 2077, 0}, {'p', 1, 2078, 0}, {'w', 1, 2079, 0}, {'c', 1, 2080, 0},
+            {'h', 1, 2081, 0}, {'t', 1, 2082, 0}, {';', 0, 0, 14}, {'p', 1, 2083, 0}, {'y', 1, 2084, 0},
+            {'d', 1, 2085, 0}, {'l', 1, 2086, 0}, {'r', 1, 2087, 0}, {'n', 1, 2088, 0}, {'p', 1, 2089, 0},
+            {'c', 1, 2090, 0}, {';', 0, 0, 15}, {'c', 1, 2091, 0}, {'c', 1, 2092, 0}, {'a', 1, 2093, 0},
+            {'e', 1, 2094, 0}, {'y', 1, 2095, 0}, {'g', 1, 2096, 0}, {'s', 1, 2097, 0}, {'w', 1, 2098, 0},
+            {'r', 1, 2099, 0}, {'B', 1, 2100, 0}, {'n', 1, 2101, 0}, {'p', 1, 2102, 0}, {'t', 13, 2103, 0},
+            {'c', 1, 2116, 0}, {'i', 1, 2117, 0}, {';', 0, 0, 16}, {'l', 1, 2118, 0}, {'c', 1, 2119, 0},
+            {'i', 1, 2120, 0}, {'y', 1, 2121, 0}, {'b', 1, 2122, 0}, {'r', 1, 2123, 0}, {'r', 1, 2124, 0},
+            {'a', 1, 2125, 0}, {'e', 1, 2126, 0}, {'i', 1, 2127, 0}, {'p', 1, 2128, 0}, {'e', 1, 2129, 0},
+            {';', 0, 0, 17}, {'c', 1, 2130, 0}, {'l', 1, 2131, 0}, {'i', 2, 2132, 0}, {'m', 1, 2134, 0},
+            {'e', 1, 2135, 0}, {'r', 1, 2136, 0}, {'y', 1, 2137, 0}, {'r', 1, 2138, 0}, {'i', 1, 2139, 0},
+            {';', 0, 0, 18}, {'u', 1, 2140, 0}, {'i', 1, 2141, 0}, {'p', 1, 2142, 0}, {';', 0, 0, 19},
+            {'e', 1, 2143, 0}, {'i', 1, 2144, 0}, {'o', 2, 2145, 0}, {'c', 1, 2147, 0}, {'i', 1, 2148, 0},
+            {'O', 1, 2149, 0}, {'r', 1, 2150, 0}, {'p', 1, 2151, 0}, {'c', 1, 2152, 0}, {'a', 1, 2153, 0},
+            {'G', 1, 2154, 20}, {'c', 1, 2155, 0}, {'n', 1, 2156, 0}, {'r', 1, 2157, 0}, {'a', 1, 2158, 0},
+            {'e', 1, 2159, 0}, {'y', 1, 2160, 0}, {';', 0, 0, 21}, {'v', 1, 2161, 0}, {'r', 1, 2162, 0},
+            {'o', 1, 2163, 0}, {'g', 1, 2164, 0}, {'p', 1, 2165, 0}, {'u', 1, 2166, 0}, {'i', 1, 2167, 0},
+            {'c', 1, 2168, 0}, {'h', 1, 2169, 0}, {'l', 1, 2170, 0}, {'C', 1, 2171, 0}, {'c', 1, 2172, 0},
+            {'F', 1, 2173, 0}, {'c', 1, 2174, 0}, {';', 0, 0, 22}, {'a', 1, 2175, 0}, {'e', 1, 2176, 0},
+            {'i', 1, 2177, 0}, {'y', 1, 2178, 0}, {'r', 1, 2179, 0}, {'o', 1, 2180, 0}, {'g', 1, 2181, 0},
+            {'a', 1, 2182, 0}, {'p', 1, 2183, 0}, {'r', 1, 2184, 0}, {'u', 1, 2185, 0}, {'c', 1, 2186, 0},
+            {'a', 1, 2187, 0}, {'b', 2, 2188, 0}, {'c', 2, 2190, 0}, {'m', 1, 2192, 0}, {'p', 3, 2193, 0},
+            {'O', 1, 2196, 0}, {'A', 1, 2197, 0}, {'H', 1, 2198, 0}, {'c', 1, 2199, 0}, {'b', 1, 2200, 0},
+            {'u', 1, 2201, 0}, {'a', 1, 2202, 0}, {'e', 1, 2203, 0}, {'y', 1, 2204, 0}, {'r', 1, 2205, 0},
+            {'e', 2, 2206, 0}, {'i', 2, 2208, 0}, {'l', 1, 2210, 0}, {'p', 1, 2211, 0}, {'i', 1, 2212, 0},
+            {'c', 1, 2213, 0}, {'t', 1, 2214, 0}, {'c', 1, 2215, 0}, {'r', 1, 2216, 0}, {'r', 2, 2217, 0},
+            {'i', 1, 2219, 0}, {'y', 1, 2220, 0}, {'b', 1, 2221, 0}, {'r', 1, 2222, 0}, {'r', 1, 2223, 0},
+            {'a', 1, 2224, 0}, {'d', 1, 2225, 0}, {'i', 1, 2226, 0}, {'g', 1, 2227, 0}, {'p', 1, 2228, 0},
+            {'A', 1, 2229, 0}, {'D', 1, 2230, 0}, {'E', 1, 2231, 0}, {'T', 1, 2232, 0}, {'a', 1, 2233, 0},
+            {'d', 1, 2234, 0}, {'p', 1, 2235, 0}, {'s', 1, 2236, 0}, {'i', 1, 2237, 0}, {'c', 1, 2238, 0},
+            {'i', 1, 2239, 0}, {'m', 1, 2240, 0}, {'a', 1, 2241, 0}, {'a', 1, 2242, 0}, {'y', 1, 2243, 0},
+            {'a', 1, 2244, 0}, {'e', 1, 2245, 0}, {'r', 3, 2246, 0}, {'r', 1, 2249, 0}, {'p', 1, 2250, 0},
+            {'c', 1, 2251, 0}, {'d', 1, 2252, 0}, {'i', 1, 2253, 0}, {'d', 1, 2254, 0}, {'r', 1, 2255, 0},
+            {'p', 1, 2256, 0}, {'c', 1, 2257, 0}, {'r', 1, 2258, 0}, {';', 0, 0, 23}, {'p', 1, 2259, 0},
+            {'c', 1, 2260, 0}, {'c', 1, 2261, 0}, {'c', 1, 2262, 0}, {'c', 1, 2263, 0}, {'c', 1, 2264, 0},
+            {'i', 1, 2265, 0}, {'y', 1, 2266, 0}, {'r', 1, 2267, 0}, {'p', 1, 2268, 0}, {'c', 1, 2269, 0},
+            {'m', 1, 2270, 0}, {'c', 1, 2271, 0}, {'c', 1, 2272, 0}, {'a', 1, 2273, 0}, {'y', 1, 2274, 0},
+            {'o', 1, 2275, 0}, {'r', 1, 2276, 0}, {'t', 1, 2277, 0}, {'r', 1, 2278, 0}, {'p', 1, 2279, 0},
+            {'c', 1, 2280, 0}, {'c', 1, 2281, 0}, {'r', 1, 2282, 0}, {';', 0, 0, 24}, {'E', 1, 2283, 0},
+            {'d', 1, 2284, 0}, {'i', 1, 2285, 0}, {'u', 1, 2286, 0}, {'y', 1, 2287, 0}, {'l', 1, 2288, 0},
+            {';', 0, 0, 25}, {'r', 1, 2289, 0}, {'r', 1, 2290, 0}, {'e', 2, 2291, 0}, {'p', 1, 2293, 0},
+            {'a', 2, 2294, 0}, {'p', 1, 2296, 26}, {'d', 5, 2297, 0}, {'g', 7, 2302, 0}, {'g', 1, 2309, 0},
+            {'p', 1, 2310, 0}, {';', 0, 0, 27}, {'E', 1, 2311, 0}, {'a', 1, 2312, 0}, {'e', 1, 2313, 0},
+            {'i', 1, 2314, 0}, {'o', 1, 2315, 0}, {'p', 1, 2316, 0}, {'i', 1, 2317, 0}, {'c', 1, 2318, 0},
+            {'t', 1, 2319, 0}, {'y', 1, 2320, 0}, {'i', 1, 2321, 0}, {'m', 1, 2322, 0}, {'c', 1, 2323, 0},
+            {'i', 1, 2324, 0}, {'o', 1, 2325, 0}, {'c', 1, 2326, 0}, {'r', 2, 2327, 0}, {'r', 1, 2329, 0},
+            {'o', 1, 2330, 0}, {'y', 1, 2331, 0}, {'q', 1, 2332, 0}, {'c', 1, 2333, 0}, {'m', 1, 2334, 0},
+            {'p', 1, 2335, 0}, {'r', 1, 2336, 0}, {'t', 3, 2337, 0}, {'r', 1, 2340, 0}, {'g', 7, 2341, 0},
+            {'a', 1, 2348, 0}, {'a', 2, 2349, 0}, {'k', 2, 2351, 0}, {'o', 1, 2353, 0}, {'e', 2, 2354, 0},
+            {'o', 1, 2356, 0}, {'p', 1, 2357, 0}, {'t', 2, 2358, 0}, {'w', 1, 2360, 0}, {'x', 12, 2361, 0},
+            {'r', 1, 2373, 0}, {'e', 1, 2374, 0}, {'v', 1, 2375, 0}, {'c', 1, 2376, 0}, {'e', 1, 2377, 0},
+            {'i', 1, 2378, 0}, {'o', 1, 2379, 0}, {'l', 1, 2380, 0}, {'m', 1, 2381, 0}, {'c', 1, 2382, 0},
+            {'p', 6, 2383, 0}, {'r', 2, 2389, 0}, {'a', 2, 2391, 0}, {'e', 1, 2393, 0}, {'i', 1, 2394, 0},
+            {'u', 1, 2395, 0}, {'o', 1, 2396, 0}, {'d', 1, 2397, 0}, {'m', 1, 2398, 0}, {'n', 1, 2399, 0},
+            {'r', 1, 2400, 0}, {'c', 1, 2401, 0}, {'e', 1, 2402, 0}, {'i', 1, 2403, 0}, {'r', 7, 2404, 0},
+            {'u', 1, 2411, 0}, {'l', 1, 2412, 0}, {'m', 2, 2413, 0}, {'n', 2, 2415, 0}, {'p', 3, 2417, 0},
+            {'a', 1, 2420, 0}, {'o', 1, 2421, 0}, {'c', 1, 2422, 0}, {'u', 2, 2423, 0}, {'d', 1, 2425, 0},
+            {'d', 1, 2426, 0}, {'e', 2, 2427, 0}, {'l', 1, 2429, 0}, {'p', 6, 2430, 0}, {'r', 4, 2436, 0},
+            {'v', 1, 2440, 0}, {'w', 1, 2441, 0}, {'c', 1, 2442, 0}, {'i', 1, 2443, 0}, {'l', 1, 2444, 0},
+            {'r', 1, 2445, 0}, {'a', 1, 2446, 0}, {'g', 1, 2447, 0}, {'l', 1, 2448, 0}, {'r', 1, 2449, 0},
+            {'s', 1, 2450, 0}, {'k', 1, 2451, 0}, {'l', 1, 2452, 0}, {'a', 1, 2453, 0}, {'y', 1, 2454, 0},
+            {';', 0, 0, 28}, {'a', 2, 2455, 0}, {'o', 1, 2457, 0}, {'g', 1, 2458, 29}, {'l', 1, 2459, 0},
+            {'m', 1, 2460, 0}, {'i', 1, 2461, 0}, {'r', 1, 2462, 0}, {'a', 1, 2463, 0}, {'a', 1, 2464, 0},
+            {'e', 1, 2465, 0}, {'g', 1, 2466, 0}, {'s', 1, 2467, 0}, {'v', 3, 2468, 0}, {'c', 1, 2471, 0},
+            {'c', 2, 2472, 0}, {'l', 1, 2474, 0}, {'p', 1, 2475, 0}, {'t', 5, 2476, 0}, {'u', 1, 2481, 0},
+            {'w', 1, 2482, 0}, {'b', 1, 2483, 0}, {'c', 2, 2484, 0}, {'c', 2, 2486, 0}, {'o', 1, 2488, 0},
+            {'t', 1, 2489, 0}, {'d', 1, 2490, 0}, {'r', 1, 2491, 0}, {'a', 1, 2492, 0}, {'h', 1, 2493, 0},
+            {'a', 1, 2494, 0}, {'c', 1, 2495, 0}, {'i', 1, 2496, 0}, {'D', 1, 2497, 0}, {'o', 1, 2498, 0},
+            {'c', 1, 2499, 0}, {'s', 1, 2500, 0}, {'a', 1, 2501, 0}, {'i', 1, 2502, 0}, {'o', 1, 2503, 0},
+            {'y', 1, 2504, 0}, {'o', 1, 2505, 0}, {';', 0, 0, 30}, {'D', 1, 2506, 0}, {'r', 1, 2507, 0},
+            {';', 0, 0, 31}, {'r', 1, 2508, 0}, {'s', 2, 2509, 0}, {';', 0, 0, 32}, {'i', 1, 2511, 0},
+            {'l', 1, 2512, 0}, {'s', 2, 2513, 0}, {'a', 1, 2515, 0}, {'p', 1, 2516, 0}, {'s', 1, 2517, 0},
+            {'g', 1, 2518, 0}, {'s', 1, 2519, 0}, {'g', 1, 2520, 0}, {'p', 1, 2521, 0}, {'a', 1, 2522, 0},
+            {'l', 1, 2523, 0}, {'s', 1, 2524, 0}, {'c', 2, 2525, 0}, {'s', 2, 2527, 0}, {'u', 3, 2529, 0},
+            {'v', 1, 2532, 0}, {'D', 1, 2533, 0}, {'a', 1, 2534, 0}, {'c', 1, 2535, 0}, {'d', 1, 2536, 0},
+            {'i', 1, 2537, 0}, {'a', 1, 2538, 0}, {'h', 1, 2539, 33}, {'m', 1, 2540, 0}, {'r', 1, 2541, 0},
+            {'c', 1, 2542, 0}, {'i', 1, 2543, 0}, {'p', 2, 2544, 0}, {'l', 1, 2546, 0}, {'y', 1, 2547, 0},
+            {'m', 1, 2548, 0}, {'i', 1, 2549, 0}, {'l', 2, 2550, 0}, {'r', 1, 2552, 0}, {'l', 1, 2553, 0},
+            {'l', 1, 2554, 0}, {'a', 1, 2555, 0}, {'l', 1, 2556, 0}, {'t', 1, 2557, 0}, {'o', 1, 2558, 0},
+            {'p', 1, 2559, 0}, {'r', 2, 2560, 0}, {'a', 1, 2562, 0}, {'a', 2, 2563, 0}, {'o', 1, 2565, 0},
+            {'c', 1, 2566, 0}, {';', 0, 0, 34}, {'l', 1, 2567, 0}, {'c', 1, 2568, 0}, {'m', 1, 2569, 0},
+            {'p', 1, 2570, 0}, {'r', 1, 2571, 0}, {'i', 1, 2572, 0}, {'y', 1, 2573, 0}, {'o', 1, 2574, 0},
+            {';', 0, 0, 35}, {'l', 1, 2575, 0}, {'q', 3, 2576, 0}, {'s', 4, 2579, 0}, {'r', 1, 2583, 0},
+            {';', 0, 0, 36}, {'g', 1, 2584, 0}, {'m', 1, 2585, 0}, {'c', 1, 2586, 0}, {';', 0, 0, 37},
+            {'E', 1, 2587, 0}, {'a', 1, 2588, 0}, {'j', 1, 2589, 0}, {'E', 1, 2590, 0}, {'a', 1, 2591, 0},
+            {'e', 2, 2592, 0}, {'s', 1, 2594, 0}, {'p', 1, 2595, 0}, {'a', 1, 2596, 0}, {'c', 1, 2597, 0},
+            {'i', 1, 2598, 0}, {';', 0, 0, 38}, {'c', 2, 2599, 0}, {'d', 1, 2601, 0}, {'l', 1, 2602, 0},
+            {'q', 1, 2603, 0}, {'r', 5, 2604, 0}, {'e', 1, 2609, 0}, {'n', 1, 2610, 0}, {'r', 1, 2611, 0},
+            {'i', 1, 2612, 0}, {'l', 1, 2613, 0}, {'m', 1, 2614, 0}, {'r', 2, 2615, 0}, {'a', 1, 2617, 0},
+            {'i', 1, 2618, 0}, {'a', 1, 2619, 0}, {'l', 1, 2620, 0}, {'r', 1, 2621, 0}, {'r', 1, 2622, 0},
+            {'s', 2, 2623, 0}, {'a', 1, 2625, 0}, {'m', 1, 2626, 0}, {'o', 1, 2627, 0}, {'p', 1, 2628, 0},
+            {'r', 1, 2629, 0}, {'c', 1, 2630, 0}, {'l', 1, 2631, 0}, {'t', 1, 2632, 0}, {'b', 1, 2633, 0},
+            {'p', 1, 2634, 0}, {'c', 1, 2635, 0}, {';', 0, 0, 39}, {'i', 1, 2636, 0}, {'y', 1, 2637, 0},
+            {'c', 1, 2638, 0}, {'x', 1, 2639, 0}, {'f', 1, 2640, 0}, {'r', 1, 2641, 0}, {'r', 1, 2642, 0},
+            {';', 0, 0, 40}, {'i', 2, 2643, 0}, {'n', 1, 2645, 0}, {'o', 1, 2646, 0}, {'l', 1, 2647, 0},
+            {'a', 3, 2648, 0}, {'o', 1, 2651, 0}, {'p', 1, 2652, 0}, {';', 0, 0, 41}, {'c', 1, 2653, 0},
+            {'f', 1, 2654, 0}, {'o', 1, 2655, 0}, {'t', 5, 2656, 0}, {'c', 1, 2661, 0}, {'g', 1, 2662, 0},
+            {'p', 1, 2663, 0}, {'t', 1, 2664, 0}, {'r', 1, 2665, 0}, {'u', 1, 2666, 0}, {'c', 1, 2667, 0},
+            {'i', 1, 2668, 0}, {';', 0, 0, 42}, {'i', 1, 2669, 0}, {'k', 1, 2670, 0}, {'m', 1, 2671, 0},
+            {'i', 1, 2672, 0}, {'y', 1, 2673, 0}, {'r', 1, 2674, 0}, {'a', 1, 2675, 0}, {'p', 1, 2676, 0},
+            {'c', 1, 2677, 0}, {'e', 1, 2678, 0}, {'k', 1, 2679, 0}, {'p', 1, 2680, 0}, {'e', 1, 2681, 0},
+            {'y', 1, 2682, 0}, {'r', 1, 2683, 0}, {'r', 1, 2684, 0}, {'c', 1, 2685, 0}, {'c', 1, 2686, 0},
+            {'p', 1, 2687, 0}, {'c', 1, 2688, 0}, {'a', 1, 2689, 0}, {'r', 1, 2690, 0}, {'t', 1, 2691, 0},
+            {'a', 1, 2692, 0}, {';', 0, 0, 43}, {'g', 1, 2693, 0}, {'a', 1, 2694, 0}, {'c', 1, 2695, 0},
+            {'e', 1, 2696, 0}, {'g', 1, 2697, 0}, {'m', 1, 2698, 0}, {'n', 1, 2699, 0}, {'p', 1, 2700, 0},
+            {'q', 1, 2701, 0}, {'r', 1, 2702, 0}, {'t', 3, 2703, 0}, {'a', 1, 2706, 0}, {'b', 1, 2707, 0},
+            {'r', 2, 2708, 0}, {'a', 1, 2710, 0}, {'e', 2, 2711, 0}, {'u', 1, 2713, 0}, {'y', 1, 2714, 0},
+            {'c', 1, 2715, 0}, {'q', 1, 2716, 0}, {'r', 2, 2717, 0}, {'s', 1, 2719, 0}, {';', 0, 0, 44},
+            {'f', 1, 2720, 0}, {'g', 1, 2721, 0}, {'q', 3, 2722, 0}, {'s', 5, 2725, 0}, {'i', 1, 2730, 0},
+            {'l', 1, 2731, 0}, {'r', 1, 2732, 0}, {';', 0, 0, 45}, {'E', 1, 2733, 0}, {'a', 1, 2734, 0},
+            {'b', 1, 2735, 0}, {'c', 1, 2736, 0}, {';', 0, 0, 46}, {'a', 1, 2737, 0}, {'c', 1, 2738, 0},
+            {'h', 1, 2739, 0}, {'t', 1, 2740, 0}, {'i', 1, 2741, 0}, {'o', 1, 2742, 0}, {'E', 1, 2743, 0},
+            {'a', 1, 2744, 0}, {'e', 2, 2745, 0}, {'s', 1, 2747, 0}, {'a', 2, 2748, 0}, {'b', 1, 2750, 0},
+            {'n', 1, 2751, 0}, {'o', 1, 2752, 0}, {'p', 3, 2753, 0}, {'t', 1, 2756, 0}, {'w', 2, 2757, 0},
+            {'z', 3, 2759, 0}, {'a', 1, 2762, 0}, {'a', 1, 2763, 0}, {'c', 1, 2764, 0}, {'h', 1, 2765, 0},
+            {'m', 1, 2766, 0}, {'t', 1, 2767, 0}, {'a', 1, 2768, 0}, {'c', 1, 2769, 0}, {'h', 1, 2770, 0},
+            {'i', 1, 2771, 0}, {'q', 2, 2772, 0}, {'t', 1, 2774, 0}, {';', 0, 0, 47}, {'c', 2, 2775, 0},
+            {'d', 1, 2777, 0}, {'h', 1, 2778, 0}, {'i', 1, 2779, 0}, {'l', 1, 2780, 0}, {'q', 1, 2781, 0},
+            {'r', 2, 2782, 0}, {'r', 2, 2784, 0}, {'e', 1, 2786, 0}, {'n', 1, 2787, 0}, {'D', 1, 2788, 0},
+            {'c', 1, 2789, 0}, {'l', 2, 2790, 0}, {'p', 2, 2792, 0}, {'r', 1, 2794, 0}, {'o', 1, 2795, 0},
+            {'y', 1, 2796, 0}, {'a', 1, 2797, 0}, {'a', 1, 2798, 0}, {'r', 1, 2799, 0}, {'o', 1, 2800, 0},
+            {'c', 1, 2801, 0}, {'d', 4, 2802, 0}, {'n', 1, 2806, 0}, {'c', 1, 2807, 0}, {'d', 1, 2808, 0},
+            {'p', 1, 2809, 0}, {'d', 1, 2810, 0}, {'p', 1, 2811, 0}, {';', 0, 0, 48}, {'c', 1, 2812, 0},
+            {'t', 1, 2813, 0}, {';', 0, 0, 49}, {'l', 1, 2814, 0}, {'m', 1, 2815, 0}, {'g', 1, 2816, 0},
+            {'t', 2, 2817, 0}, {'e', 1, 2819, 0}, {'l', 1, 2820, 0}, {'t', 2, 2821, 0}, {'i', 1, 2823, 0},
+            {'D', 1, 2824, 0}, {'d', 1, 2825, 0}, {'b', 1, 2826, 0}, {'c', 1, 2827, 0}, {'n', 1, 2828, 0},
+            {'p', 5, 2829, 0}, {'t', 1, 2834, 0}, {'s', 1, 2835, 0}, {'u', 1, 2836, 0}, {'a', 2, 2837, 0},
+            {'e', 1, 2839, 0}, {'o', 1, 2840, 0}, {'u', 1, 2841, 0}, {'y', 1, 2842, 0}, {'a', 1, 2843, 0},
+            {';', 0, 0, 50}, {'A', 1, 2844, 0}, {'a', 1, 2845, 0}, {'d', 1, 2846, 0}, {'q', 1, 2847, 0},
+            {'s', 2, 2848, 0}, {'x', 1, 2850, 0}, {'r', 1, 2851, 0}, {'E', 1, 2852, 0}, {'e', 3, 2853, 0},
+            {'s', 1, 2856, 0}, {'t', 2, 2857, 0}, {'A', 1, 2859, 0}, {'a', 1, 2860, 0}, {'p', 1, 2861, 0},
+            {';', 0, 0, 51}, {'s', 2, 2862, 0}, {'v', 1, 2864, 0}, {'c', 1, 2865, 0}, {'A', 1, 2866, 0},
+            {'E', 1, 2867, 0}, {'a', 1, 2868, 0}, {'d', 1, 2869, 0}, {'e', 4, 2870, 0}, {'s', 1, 2874, 0},
+            {'t', 2, 2875, 0}, {'i', 1, 2877, 0}, {'p', 1, 2878, 0}, {'t', 3, 2879, 52}, {'a', 1, 2882, 0},
+            {'o', 1, 2883, 0}, {'r', 3, 2884, 0}, {'A', 1, 2887, 0}, {'a', 1, 2888, 0}, {'i', 1, 2889, 0},
+            {'t', 1, 2890, 0}, {'c', 4, 2891, 0}, {'h', 1, 2895, 0}, {'i', 1, 2896, 0}, {'m', 1, 2897, 0},
+            {'p', 1, 2898, 0}, {'q', 1, 2899, 0}, {'u', 3, 2900, 0}, {'g', 1, 2903, 0}, {'i', 1, 2904, 0},
+            {'l', 1, 2905, 0}, {'r', 1, 2906, 0}, {';', 0, 0, 53}, {'m', 3, 2907, 0}, {'D', 1, 2910, 0},
+            {'H', 1, 2911, 0}, {'a', 1, 2912, 0}, {'d', 1, 2913, 0}, {'g', 2, 2914, 0}, {'i', 1, 2916, 0},
+            {'l', 3, 2917, 0}, {'r', 2, 2920, 0}, {'s', 1, 2922, 0}, {'A', 1, 2923, 0}, {'a', 1, 2924, 0},
+            {'n', 1, 2925, 0}, {';', 0, 0, 54}, {'c', 1, 2926, 0}, {'s', 1, 2927, 0}, {'i', 1, 2928, 0},
+            {'y', 1, 2929, 0}, {'a', 1, 2930, 0}, {'b', 1, 2931, 0}, {'i', 1, 2932, 0}, {'o', 1, 2933, 0},
+            {'s', 1, 2934, 0}, {'l', 1, 2935, 0}, {'c', 1, 2936, 0}, {'r', 1, 2937, 0}, {'o', 1, 2938, 0},
+            {'r', 1, 2939, 0}, {'t', 1, 2940, 0}, {'b', 1, 2941, 0}, {'m', 1, 2942, 0}, {'n', 1, 2943, 0},
+            {'a', 1, 2944, 0}, {'c', 2, 2945, 0}, {'i', 1, 2947, 0}, {'t', 1, 2948, 0}, {'a', 1, 2949, 0},
+            {'e', 1, 2950, 0}, {'i', 3, 2951, 0}, {'p', 1, 2954, 0}, {'a', 1, 2955, 0}, {'e', 1, 2956, 0},
+            {'l', 1, 2957, 0}, {';', 0, 0, 55}, {'a', 1, 2958, 0}, {'d', 4, 2959, 0}, {'i', 1, 2963, 0},
+            {'o', 1, 2964, 0}, {'s', 1, 2965, 0}, {'v', 1, 2966, 0}, {'c', 1, 2967, 0}, {'l', 1, 2968, 0},
+            {'o', 1, 2969, 0}, {'i', 2, 2970, 0}, {'m', 1, 2972, 0}, {'b', 1, 2973, 0}, {'r', 4, 2974, 0},
+            {'y', 1, 2978, 0}, {'r', 5, 2979, 0}, {'r', 1, 2984, 0}, {'i', 2, 2985, 0}, {'m', 1, 2987, 0},
+            {'o', 1, 2988, 0}, {';', 0, 0, 56}, {'t', 1, 2989, 0}, {'v', 1, 2990, 0}, {'a', 1, 2991, 0},
+            {'u', 1, 2992, 0}, {';', 0, 0, 57}, {'i', 1, 2993, 0}, {'p', 1, 2994, 0}, {'u', 1, 2995, 0},
+            {';', 0, 0, 58}, {'E', 1, 2996, 0}, {'a', 1, 2997, 0}, {'c', 1, 2998, 0}, {'e', 2, 2999, 0},
+            {'i', 1, 3001, 0}, {'n', 3, 3002, 0}, {'o', 3, 3005, 0}, {'s', 1, 3008, 0}, {'u', 1, 3009, 0},
+            {'c', 1, 3010, 0}, {'i', 1, 3011, 0}, {'n', 1, 3012, 0}, {'r', 1, 3013, 0}, {'n', 1, 3014, 0},
+            {'p', 1, 3015, 0}, {'r', 1, 3016, 0}, {'c', 1, 3017, 0}, {'a', 1, 3018, 0}, {'e', 1, 3019, 0},
+            {'o', 1, 3020, 0}, {'a', 1, 3021, 0}, {'r', 1, 3022, 0}, {'t', 1, 3023, 0}, {'a', 1, 3024, 0},
+            {'a', 1, 3025, 0}, {'c', 2, 3026, 0}, {'d', 1, 3028, 0}, {'e', 1, 3029, 0}, {'n', 1, 3030, 0},
+            {'q', 1, 3031, 0}, {'r', 1, 3032, 0}, {'t', 2, 3033, 0}, {'a', 1, 3035, 0}, {'b', 1, 3036, 0},
+            {'r', 2, 3037, 0}, {'a', 1, 3039, 0}, {'e', 2, 3040, 0}, {'u', 1, 3042, 0}, {'y', 1, 3043, 0},
+            {'c', 1, 3044, 0}, {'l', 1, 3045, 0}, {'q', 1, 3046, 0}, {'s', 1, 3047, 0}, {'a', 1, 3048, 0},
+            {'c', 1, 3049, 0}, {'g', 1, 3050, 59}, {'i', 1, 3051, 0}, {'l', 1, 3052, 0}, {'r', 1, 3053, 0},
+            {'a', 1, 3054, 0}, {'o', 2, 3055, 0}, {'g', 1, 3057, 0}, {'n', 1, 3058, 0}, {'s', 1, 3059, 0},
+            {'a', 1, 3060, 0}, {'h', 1, 3061, 0}, {'m', 1, 3062, 0}, {'o', 1, 3063, 0}, {'m', 1, 3064, 0},
+            {'a', 2, 3065, 0}, {'b', 1, 3067, 0}, {'p', 3, 3068, 0}, {'t', 1, 3071, 0}, {'a', 1, 3072, 0},
+            {'p', 1, 3073, 0}, {'a', 1, 3074, 0}, {'a', 1, 3075, 0}, {'c', 1, 3076, 0}, {'h', 1, 3077, 0},
+            {'q', 2, 3078, 0}, {'h', 1, 3080, 0}, {'i', 1, 3081, 0}, {'r', 1, 3082, 0}, {'l', 1, 3083, 0},
+            {';', 0, 0, 60}, {'c', 1, 3084, 0}, {'q', 1, 3085, 0}, {';', 0, 0, 61}, {'E', 1, 3086, 0},
+            {'a', 2, 3087, 0}, {'c', 1, 3089, 0}, {'e', 2, 3090, 0}, {'i', 1, 3092, 0}, {'n', 3, 3093, 0},
+            {'p', 1, 3096, 0}, {'s', 1, 3097, 0}, {'y', 1, 3098, 0}, {'o', 1, 3099, 0}, {'A', 1, 3100, 0},
+            {'a', 1, 3101, 0}, {'c', 1, 3102, 0}, {'m', 1, 3103, 0}, {'s', 1, 3104, 0}, {'t', 1, 3105, 0},
+            {'x', 1, 3106, 0}, {'r', 2, 3107, 0}, {'a', 1, 3109, 0}, {'c', 2, 3110, 0}, {'o', 1, 3112, 0},
+            {'y', 1, 3113, 62}, {'g', 1, 3114, 0}, {'m', 8, 3115, 0}, {'a', 1, 3123, 0}, {'a', 2, 3124, 0},
+            {'e', 1, 3126, 0}, {'i', 2, 3127, 0}, {'t', 2, 3129, 0}, {'f', 1, 3131, 0}, {'l', 2, 3132, 0},
+            {'p', 1, 3134, 0}, {'a', 2, 3135, 0}, {'c', 2, 3137, 0}, {'s', 1, 3139, 0}, {'u', 3, 3140, 0},
+            {'a', 1, 3143, 0}, {'c', 1, 3144, 0}, {'e', 1, 3145, 0}, {'m', 1, 3146, 0}, {'t', 1, 3147, 0},
+            {'a', 1, 3148, 0}, {'r', 2, 3149, 0}, {'b', 9, 3151, 0}, {'c', 1, 3160, 0}, {'m', 1, 3161, 0},
+            {'n', 1, 3162, 0}, {'p', 13, 3163, 0}, {'A', 1, 3176, 0}, {'a', 1, 3177, 0}, {'n', 1, 3178, 0},
+            {'l', 1, 3179, 0}, {'r', 1, 3180, 0}, {'u', 1, 3181, 0}, {'r', 1, 3182, 0}, {'a', 1, 3183, 0},
+            {'e', 1, 3184, 0}, {'y', 1, 3185, 0}, {'o', 1, 3186, 0}, {'l', 1, 3187, 0}, {'r', 1, 3188, 0},
+            {'e', 2, 3189, 0}, {'i', 2, 3191, 0}, {'k', 2, 3193, 0}, {'o', 1, 3195, 0}, {'l', 1, 3196, 0},
+            {'m', 1, 3197, 0}, {'n', 1, 3198, 0}, {'e', 1, 3199, 0}, {'p', 4, 3200, 0}, {'s', 1, 3204, 0},
+            {'r', 1, 3205, 0}, {'a', 1, 3206, 0}, {'i', 7, 3207, 0}, {'p', 1, 3214, 0}, {'c', 2, 3215, 0},
+            {'h', 1, 3217, 0}, {'t', 1, 3218, 0}, {'i', 1, 3219, 0}, {'o', 1, 3220, 0}, {'r', 1, 3221, 0},
+            {'a', 1, 3222, 0}, {'c', 1, 3223, 0}, {'r', 1, 3224, 0}, {'r', 2, 3225, 0}, {'i', 1, 3227, 0},
+            {'y', 1, 3228, 0}, {'a', 1, 3229, 0}, {'b', 1, 3230, 0}, {'h', 1, 3231, 0}, {'i', 1, 3232, 0},
+            {'r', 1, 3233, 0}, {'r', 1, 3234, 0}, {'a', 1, 3235, 0}, {'b', 1, 3236, 0}, {'c', 2, 3237, 0},
+            {'t', 1, 3239, 0}, {'a', 1, 3240, 0}, {'l', 1, 3241, 63}, {'g', 1, 3242, 0}, {'p', 1, 3243, 0},
+            {'a', 1, 3244, 0}, {'d', 1, 3245, 0}, {'h', 1, 3246, 0}, {'l', 1, 3247, 0}, {'s', 1, 3248, 0},
+            {'u', 1, 3249, 0}, {'c', 2, 3250, 0}, {'i', 1, 3252, 0}, {'t', 1, 3253, 0}, {'c', 1, 3254, 0},
+            {'d', 1, 3255, 0}, {'i', 1, 3256, 0}, {'r', 1, 3257, 0}, {'a', 1, 3258, 0}, {'m', 1, 3259, 0},
+            {'a', 1, 3260, 0}, {'r', 1, 3261, 0}, {'a', 1, 3262, 0}, {'a', 1, 3263, 0}, {'n', 1, 3264, 0},
+            {'r', 7, 3265, 0}, {'y', 1, 3272, 0}, {'a', 1, 3273, 0}, {'e', 3, 3274, 0}, {'l', 1, 3277, 0},
+            {'r', 2, 3278, 0}, {'r', 1, 3280, 0}, {'t', 1, 3281, 0}, {'s', 1, 3282, 0}, {'p', 1, 3283, 0},
+            {'r', 1, 3284, 0}, {'t', 1, 3285, 0}, {'c', 1, 3286, 0}, {'u', 2, 3287, 0}, {'i', 1, 3289, 0},
+            {'i', 1, 3290, 0}, {'d', 2, 3291, 0}, {'i', 1, 3293, 0}, {'r', 1, 3294, 0}, {'p', 1, 3295, 0},
+            {';', 0, 0, 64}, {';', 0, 0, 65}, {'e', 1, 3296, 0}, {'c', 1, 3297, 0}, {'a', 1, 3298, 0},
+            {'i', 1, 3299, 0}, {'u', 1, 3300, 0}, {'t', 1, 3301, 0}, {'r', 1, 3302, 0}, {'A', 1, 3303, 0},
+            {'a', 1, 3304, 0}, {';', 0, 0, 66}, {'A', 1, 3305, 0}, {'a', 1, 3306, 0}, {'a', 1, 3307, 0},
+            {'i', 1, 3308, 0}, {'d', 1, 3309, 0}, {'p', 2, 3310, 0}, {'t', 1, 3312, 0}, {'A', 1, 3313, 0},
+            {'a', 1, 3314, 0}, {'c', 1, 3315, 0}, {'q', 1, 3316, 0}, {'p', 1, 3317, 0}, {'t', 1, 3318, 0},
+            {'e', 1, 3319, 0}, {'e', 1, 3320, 0}, {'c', 2, 3321, 0}, {'i', 1, 3323, 0}, {'y', 1, 3324, 0},
+            {'n', 1, 3325, 67}, {'r', 1, 3326, 0}, {'c', 1, 3327, 0}, {'p', 1, 3328, 0}, {'c', 1, 3329, 0},
+            {'c', 1, 3330, 0}, {'m', 1, 3331, 0}, {'c', 1, 3332, 0}, {'a', 1, 3333, 0}, {'y', 1, 3334, 0},
+            {'o', 1, 3335, 0}, {'e', 1, 3336, 0}, {'t', 1, 3337, 0}, {'r', 1, 3338, 0}, {'c', 1, 3339, 0},
+            {'g', 1, 3340, 0}, {'p', 1, 3341, 0}, {'c', 1, 3342, 0}, {'j', 1, 3343, 0}, {'n', 1, 3344, 0},
+            {'i', 1, 3345, 0}, {';', 0, 0, 68}, {'u', 1, 3346, 0}, {'e', 1, 3347, 0}, {'r', 1, 3348, 0},
+            {';', 0, 0, 69}, {';', 0, 0, 70}, {'a', 1, 3349, 0}, {'h', 1, 3350, 0}, {'c', 1, 3351, 0},
+            {';', 0, 0, 71}, {'o', 1, 3352, 0}, {'f', 1, 3353, 0}, {'l', 1, 3354, 0}, {'n', 1, 3355, 0},
+            {'r', 1, 3356, 0}, {'i', 1, 3357, 0}, {'l', 1, 3358, 0}, {'l', 1, 3359, 72}, {'k', 1, 3360, 0},
+            {'v', 1, 3361, 0}, {'w', 1, 3362, 0}, {';', 0, 0, 73}, {'a', 1, 3363, 0}, {'n', 1, 3364, 0},
+            {'a', 1, 3365, 0}, {';', 0, 0, 74}, {'f', 1, 3366, 0}, {'v', 1, 3367, 0}, {'r', 1, 3368, 0},
+            {'p', 1, 3369, 0}, {'y', 1, 3370, 0}, {'Y', 1, 3371, 75}, {'u', 1, 3372, 0}, {';', 0, 0, 76},
+            {'i', 1, 3373, 0}, {'l', 1, 3374, 0}, {'r', 1, 3375, 0}, {'d', 1, 3376, 0}, {'r', 1, 3377, 0},
+            {'n', 1, 3378, 0}, {'t', 1, 3379, 0}, {'i', 1, 3380, 0}, {'t', 1, 3381, 0}, {';', 0, 0, 77},
+            {';', 0, 0, 78}, {'c', 1, 3382, 0}, {'c', 1, 3383, 0}, {'s', 1, 3384, 0}, {'o', 1, 3385, 0},
+            {'g', 1, 3386, 0}, {'i', 1, 3387, 0}, {'t', 1, 3388, 0}, {'f', 1, 3389, 0}, {'r', 1, 3390, 0},
+            {'n', 1, 3391, 0}, {'s', 1, 3392, 0}, {'r', 1, 3393, 0}, {';', 0, 0, 79}, {'C', 1, 3394, 0},
+            {'t', 1, 3395, 0}, {'y', 1, 3396, 0}, {'y', 1, 3397, 0}, {'y', 1, 3398, 0}, {'g', 1, 3399, 0},
+            {'r', 1, 3400, 0}, {'h', 1, 3401, 0}, {'r', 1, 3402, 0}, {';', 0, 0, 80}, {';', 0, 0, 81},
+            {'t', 1, 3403, 0}, {';', 0, 0, 82}, {'c', 1, 3404, 0}, {'m', 1, 3405, 0}, {'f', 1, 3406, 0},
+            {'f', 1, 3407, 0}, {';', 0, 0, 83}, {'D', 1, 3408, 0}, {'E', 1, 3409, 0}, {'b', 1, 3410, 0},
+            {'n', 6, 3411, 0}, {'r', 1, 3417, 0}, {'r', 1, 3418, 0}, {';', 0, 0, 84}, {';', 0, 0, 85},
+            {'u', 1, 3419, 0}, {'r', 1, 3420, 0}, {'r', 1, 3421, 0}, {';', 0, 0, 86}, {'t', 1, 3422, 0},
+            {';', 0, 0, 87}, {'a', 1, 3423, 0}, {'m', 1, 3424, 0}, {'c', 1, 3425, 0}, {'t', 1, 3426, 0},
+            {'o', 1, 3427, 0}, {'f', 1, 3428, 0}, {'i', 1, 3429, 0}, {'a', 1, 3430, 0}, {'i', 1, 3431, 0},
+            {'r', 1, 3432, 0}, {'m', 1, 3433, 0}, {';', 0, 0, 88}, {'l', 1, 3434, 89}, {'s', 1, 3435, 0},
+            {'o', 1, 3436, 0}, {';', 0, 0, 90}, {';', 0, 0, 91}, {'l', 1, 3437, 0}, {'f', 1, 3438, 0},
+            {'A', 1, 3439, 0}, {'r', 1, 3440, 0}, {'r', 1, 3441, 0}, {'y', 1, 3442, 0}, {'m', 1, 3443, 0},
+            {'e', 1, 3444, 0}, {'d', 1, 3445, 0}, {'r', 1, 3446, 0}, {';', 0, 0, 92}, {'t', 1, 3447, 0},
+            {';', 0, 0, 93}, {'f', 1, 3448, 0}, {'a', 1, 3449, 0}, {'r', 1, 3450, 0}, {'D', 1, 3451, 0},
+            {'e', 1, 3452, 0}, {';', 0, 0, 94}, {'r', 1, 3453, 0}, {';', 0, 0, 95}, {'b', 1, 3454, 0},
+            {'f', 1, 3455, 0}, {'i', 1, 3456, 0}, {'r', 1, 3457, 0}, {'r', 1, 3458, 0}, {'p', 2, 3459, 0},
+            {'y', 1, 3461, 0}, {'i', 1, 3462, 0}, {'y', 1, 3463, 0}, {'u', 1, 3464, 0}, {'r', 1, 3465, 0},
+            {';', 0, 0, 96}, {'t', 1, 3466, 0}, {';', 0, 0, 97}, {'a', 1, 3467, 0}, {'c', 1, 3468, 0},
+            {'g', 1, 3469, 0}, {'l', 1, 3470, 0}, {';', 0, 0, 98}, {'e', 2, 3471, 0}, {'i', 1, 3473, 0},
+            {'o', 1, 3474, 0}, {'f', 1, 3475, 0}, {'a', 1, 3476, 0}, {'r', 1, 3477, 0}, {'l', 1, 3478, 0},
+            {'c', 1, 3479, 0}, {'l', 1, 3480, 99}, {'r', 1, 3481, 0}, {';', 0, 0, 100}, {';', 0, 0, 101},
+            {'f', 1, 3482, 0}, {'r', 1, 3483, 0}, {'r', 1, 3484, 0}, {'c', 1, 3485, 0}, {'y', 1, 3486, 0},
+            {'y', 1, 3487, 0}, {'p', 1, 3488, 0}, {'d', 1, 3489, 0}, {';', 0, 0, 102}, {';', 0, 0, 103},
+            {'f', 1, 3490, 0}, {'r', 1, 3491, 0}, {'y', 1, 3492, 0}, {'u', 1, 3493, 0}, {'b', 1, 3494, 0},
+            {'g', 1, 3495, 0}, {'l', 1, 3496, 0}, {'r', 1, 3497, 0}, {'r', 1, 3498, 0}, {'d', 1, 3499, 0},
+            {';', 0, 0, 104}, {'t', 10, 3500, 0}, {'s', 6, 3510, 0}, {';', 0, 0, 105}, {'f', 1, 3516, 0},
+            {'d', 1, 3517, 0}, {'g', 4, 3518, 0}, {'f', 1, 3522, 0}, {'e', 1, 3523, 0}, {'r', 1, 3524, 0},
+            {';', 0, 0, 106}, {'r', 1, 3525, 0}, {';', 0, 0, 107}, {';', 0, 0, 108}, {'i', 1, 3526, 0},
+            {'l', 1, 3527, 0}, {';', 0, 0, 109}, {'u', 1, 3528, 0}, {'f', 1, 3529, 0}, {'r', 1, 3530, 0},
+            {'y', 1, 3531, 0}, {'u', 1, 3532, 0}, {'r', 1, 3533, 0}, {'d', 1, 3534, 0}, {';', 0, 0, 110},
+            {'a', 1, 3535, 0}, {'t', 1, 3536, 0}, {'L', 1, 3537, 0}, {';', 0, 0, 111}, {'r', 1, 3538, 0},
+            {'B', 1, 3539, 0}, {'f', 1, 3540, 0}, {';', 0, 0, 112}, {'C', 2, 3541, 0}, {'D', 1, 3543, 0},
+            {'E', 3, 3544, 0}, {'G', 1, 3547, 0}, {'H', 1, 3548, 0}, {'L', 1, 3549, 0}, {'N', 1, 3550, 0},
+            {'P', 1, 3551, 0}, {'R', 2, 3552, 0}, {'S', 2, 3554, 0}, {'T', 1, 3556, 0}, {'V', 1, 3557, 0},
+            {'r', 1, 3558, 0}, {'l', 1, 3559, 0}, {'i', 1, 3560, 0}, {'u', 1, 3561, 0}, {'r', 1, 3562, 0},
+            {';', 0, 0, 113}, {'l', 1, 3563, 0}, {';', 0, 0, 114}, {'a', 1, 3564, 0}, {'c', 1, 3565, 0},
+            {'g', 1, 3566, 0}, {'c', 1, 3567, 0}, {'f', 1, 3568, 0}, {'n', 1, 3569, 0}, {'r', 1, 3570, 0},
+            {'a', 1, 3571, 0}, {'l', 1, 3572, 0}, {'m', 1, 3573, 0}, {'l', 1, 3574, 115}, {'r', 2, 3575, 0},
+            {'t', 1, 3577, 0}, {';', 0, 0, 116}, {';', 0, 0, 117}, {';', 0, 0, 118}, {'s', 1, 3578, 0},
+            {'n', 1, 3579, 0}, {'f', 1, 3580, 0}, {'c', 1, 3581, 0}, {'m', 1, 3582, 0}, {'d', 1, 3583, 0},
+            {'p', 1, 3584, 0}, {'r', 1, 3585, 0}, {';', 0, 0, 119}, {'T', 1, 3586, 120}, {';', 0, 0, 121},
+            {'f', 1, 3587, 0}, {'r', 1, 3588, 0}, {'r', 1, 3589, 0}, {';', 0, 0, 122}, {'u', 1, 3590, 0},
+            {'g', 1, 3591, 0}, {'r', 2, 3592, 0}, {'r', 1, 3594, 0}, {'d', 1, 3595, 0}, {';', 0, 0, 123},
+            {'e', 1, 3596, 0}, {';', 0, 0, 124}, {';', 0, 0, 125}, {'h', 1, 3597, 0}, {'f', 1, 3598, 0},
+            {'n', 1, 3599, 0}, {'g', 1, 3600, 0}, {'r', 1, 3601, 0}, {';', 0, 0, 126}, {'e', 1, 3602, 0},
+            {'H', 1, 3603, 0}, {'y', 1, 3604, 0}, {'T', 1, 3605, 0}, {'u', 1, 3606, 0}, {'r', 1, 3607, 0},
+            {'d', 1, 3608, 0}, {'r', 1, 3609, 0}, {';', 0, 0, 127}, {';', 0, 0, 128}, {'r', 1, 3610, 0},
+            {'m', 1, 3611, 0}, {'l', 1, 3612, 0}, {'f', 1, 3613, 0}, {'t', 1, 3614, 0}, {'a', 1, 3615, 0},
+            {'r', 1, 3616, 0}, {'r', 1, 3617, 0}, {';', 0, 0, 129}, {'s', 1, 3618, 0}, {'c', 1, 3619, 0},
+            {'h', 1, 3620, 0}, {';', 0, 0, 130}, {';', 0, 0, 131}, {'e', 1, 3621, 0}, {'s', 1, 3622, 0},
+            {'R', 1, 3623, 0}, {'D', 1, 3624, 0}, {'c', 1, 3625, 0}, {'y', 1, 3626, 0}, {';', 0, 0, 132},
+            {';', 0, 0, 133}, {'r', 1, 3627, 0}, {'d', 1, 3628, 0}, {';', 0, 0, 134}, {';', 0, 0, 135},
+            {'r', 1, 3629, 0}, {'t', 1, 3630, 0}, {'c', 1, 3631, 0}, {'n', 1, 3632, 0}, {'d', 1, 3633, 0},
+            {'f', 1, 3634, 0}, {'p', 1, 3635, 0}, {'r', 1, 3636, 0}, {'r', 1, 3637, 0}, {'u', 1, 3638, 0},
+            {'r', 2, 3639, 0}, {'c', 1, 3641, 0}, {'e', 1, 3642, 0}, {'r', 1, 3643, 0}, {';', 0, 0, 136},
+            {'l', 1, 3644, 0}, {';', 0, 0, 137}, {'a', 1, 3645, 0}, {'c', 1, 3646, 0}, {'e', 1, 3647, 0},
+            {'o', 1, 3648, 0}, {'o', 1, 3649, 0}, {'f', 1, 3650, 0}, {'r', 1, 3651, 0}, {'o', 1, 3652, 0},
+            {'q', 1, 3653, 0}, {'e', 1, 3654, 0}, {'r', 1, 3655, 0}, {'o', 1, 3656, 0}, {'e', 1, 3657, 0},
+            {'i', 2, 3658, 0}, {'n', 1, 3660, 0}, {'r', 1, 3661, 0}, {'l', 1, 3662, 0}, {'l', 1, 3663, 138},
+            {'s', 1, 3664, 0}, {'r', 1, 3665, 0}, {';', 0, 0, 139}, {'s', 1, 3666, 0}, {';', 0, 0, 140},
+            {'b', 1, 3667, 0}, {'t', 2, 3668, 0}, {'y', 1, 3670, 0}, {';', 0, 0, 141}, {'f', 1, 3671, 0},
+            {'r', 1, 3672, 0}, {'a', 1, 3673, 0}, {'r', 1, 3674, 0}, {'g', 1, 3675, 0}, {';', 0, 0, 142},
+            {'f', 1, 3676, 0}, {'r', 1, 3677, 0}, {';', 0, 0, 143}, {'f', 1, 3678, 0}, {'r', 1, 3679, 0},
+            {'y', 1, 3680, 0}, {'y', 1, 3681, 0}, {'y', 1, 3682, 0}, {'u', 1, 3683, 0}, {'r', 1, 3684, 0},
+            {';', 0, 0, 144}, {';', 0, 0, 145}, {'f', 1, 3685, 0}, {'r', 1, 3686, 0}, {'l', 1, 3687, 0},
+            {'y', 1, 3688, 0}, {'u', 1, 3689, 0}, {'r', 1, 3690, 0}, {';', 0, 0, 146}, {'t', 1, 3691, 0},
+            {'o', 1, 3692, 0}, {'a', 1, 3693, 0}, {';', 0, 0, 147}, {'f', 1, 3694, 0}, {'r', 1, 3695, 0},
+            {'u', 1, 3696, 0}, {'e', 1, 3697, 0}, {';', 0, 0, 148}, {';', 0, 0, 149}, {'r', 1, 3698, 0},
+            {'t', 1, 3699, 0}, {';', 0, 0, 150}, {'i', 1, 3700, 0}, {';', 0, 0, 151}, {'a', 1, 3701, 0},
+            {'f', 1, 3702, 0}, {'p', 1, 3703, 0}, {'h', 1, 3704, 0}, {'c', 1, 3705, 0}, {'l', 1, 3706, 0},
+            {';', 0, 0, 152}, {';', 0, 0, 153}, {'a', 1, 3707, 0}, {'d', 1, 3708, 0}, {'s', 1, 3709, 0},
+            {'v', 1, 3710, 0}, {';', 0, 0, 154}, {'e', 1, 3711, 0}, {'l', 1, 3712, 0}, {'m', 1, 3713, 0},
+            {'r', 1, 3714, 0}, {'s', 2, 3715, 0}, {'z', 1, 3717, 0}, {'o', 1, 3718, 0}, {'f', 1, 3719, 0},
+            {';', 0, 0, 155}, {'c', 1, 3720, 0}, {';', 0, 0, 156}, {'d', 1, 3721, 0}, {'s', 1, 3722, 0},
+            {'r', 1, 3723, 0}, {'n', 1, 3724, 0}, {'r', 1, 3725, 0}, {';', 0, 0, 157}, {'m', 1, 3726, 0},
+            {'l', 1, 3727, 0}, {'l', 1, 3728, 158}, {'o', 1, 3729, 0}, {'n', 1, 3730, 0}, {'t', 1, 3731, 0},
+            {'k', 4, 3732, 0}, {'v', 1, 3736, 0}, {'w', 1, 3737, 0}, {'k', 2, 3738, 0}, {'n', 1, 3740, 0},
+            {';', 0, 0, 159}, {'u', 1, 3741, 0}, {'a', 1, 3742, 0}, {'p', 1, 3743, 0}, {'s', 1, 3744, 0},
+            {'n', 1, 3745, 0}, {'a', 1, 3746, 0}, {'h', 1, 3747, 0}, {'w', 1, 3748, 0}, {';', 0, 0, 160},
+            {'c', 3, 3749, 0}, {'o', 3, 3752, 0}, {'s', 2, 3755, 0}, {'t', 1, 3757, 0}, {'u', 1, 3758, 0},
+            {'v', 1, 3759, 0}, {'w', 1, 3760, 0}, {'r', 1, 3761, 0}, {'c', 1, 3762, 0}, {'n', 1, 3763, 0},
+            {'1', 2, 3764, 0}, {'3', 1, 3766, 0}, {'c', 1, 3767, 0}, {';', 0, 0, 161}, {'q', 1, 3768, 0},
+            {'t', 1, 3769, 0}, {'f', 1, 3770, 0}, {';', 0, 0, 162}, {'t', 1, 3771, 0}, {'t', 1, 3772, 0},
+            {'D', 4, 3773, 0}, {'H', 5, 3777, 0}, {'U', 4, 3782, 0}, {'V', 7, 3786, 0}, {'b', 1, 3793, 0},
+            {'d', 4, 3794, 0}, {'h', 5, 3798, 0}, {'m', 1, 3803, 0}, {'p', 1, 3804, 0}, {'t', 1, 3805, 0},
+            {'u', 4, 3806, 0}, {'v', 7, 3810, 0}, {'i', 1, 3817, 0}, {'v', 1, 3818, 0}, {'b', 1, 3819, 0},
+            {'r', 1, 3820, 0}, {'m', 1, 3821, 0}, {'m', 2, 3822, 0}, {'l', 3, 3824, 0}, {'l', 2, 3827, 0},
+            {'p', 3, 3829, 0}, {'u', 1, 3832, 0}, {';', 0, 0, 163}, {'a', 1, 3833, 0}, {'b', 1, 3834, 0},
+            {'c', 2, 3835, 0}, {'d', 1, 3837, 0}, {'s', 1, 3838, 0}, {'e', 1, 3839, 0}, {'o', 1, 3840, 0},
+            {'p', 1, 3841, 0}, {'r', 1, 3842, 0}, {'d', 1, 3843, 0}, {'r', 1, 3844, 0}, {'p', 1, 3845, 0},
+            {'t', 1, 3846, 0}, {'i', 1, 3847, 0}, {'p', 1, 3848, 0}, {'t', 2, 3849, 164}, {';', 0, 0, 165},
+            {'y', 1, 3851, 0}, {'c', 1, 3852, 0}, {';', 0, 0, 166}, {';', 0, 0, 167}, {'E', 1, 3853, 0},
+            {'c', 3, 3854, 0}, {'e', 1, 3857, 0}, {'f', 1, 3858, 0}, {'m', 1, 3859, 0}, {'s', 1, 3860, 0},
+            {'b', 1, 3861, 0}, {'o', 1, 3862, 0}, {'m', 1, 3863, 0}, {'p', 3, 3864, 0}, {'g', 2, 3867, 0},
+            {'i', 1, 3869, 0}, {'f', 1, 3870, 0}, {'r', 1, 3871, 0}, {'y', 2, 3872, 168}, {'r', 1, 3874, 0},
+            {'s', 1, 3875, 0}, {'r', 1, 3876, 0}, {'b', 2, 3877, 0}, {'p', 2, 3879, 0}, {'o', 1, 3881, 0},
+            {'a', 1, 3882, 0}, {'p', 1, 3883, 0}, {'s', 1, 3884, 0}, {'a', 1, 3885, 0}, {';', 0, 0, 169},
+            {'b', 1, 3886, 0}, {'c', 2, 3887, 0}, {'d', 1, 3889, 0}, {'o', 1, 3890, 0}, {'s', 1, 3891, 0},
+            {'a', 1, 3892, 0}, {'l', 1, 3893, 0}, {'r', 1, 3894, 0}, {'v', 1, 3895, 0}, {'e', 1, 3896, 0},
+            {'e', 1, 3897, 0}, {'o', 1, 3898, 0}, {'n', 1, 3899, 0}, {'c', 1, 3900, 0}, {'r', 1, 3901, 0},
+            {'r', 1, 3902, 0}, {'g', 1, 3903, 0}, {'e', 1, 3904, 0}, {'r', 1, 3905, 0}, {'h', 2, 3906, 0},
+            {'a', 1, 3908, 0}, {'a', 1, 3909, 0}, {'r', 1, 3910, 0}, {';', 0, 0, 170}, {'g', 1, 3911, 0},
+            {'r', 1, 3912, 0}, {'t', 1, 3913, 0}, {';', 0, 0, 171}, {'t', 1, 3914, 0}, {'p', 1, 3915, 0},
+            {'s', 1, 3916, 0}, {';', 0, 0, 172}, {'r', 2, 3917, 0}, {'m', 3, 3919, 0}, {';', 0, 0, 173},
+            {'a', 1, 3922, 0}, {'i', 1, 3923, 0}, {';', 0, 0, 174}, {'i', 1, 3924, 0}, {'o', 1, 3925, 0},
+            {'y', 1, 3926, 0}, {'o', 1, 3927, 0}, {'r', 1, 3928, 0}, {'l', 1, 3929, 0}, {'f', 1, 3930, 0},
+            {';', 0, 0, 175}, {'e', 1, 3931, 0}, {'m', 1, 3932, 0}, {'p', 1, 3933, 0}, {'s', 1, 3934, 0},
+            {'b', 1, 3935, 0}, {'n', 3, 3936, 0}, {'k', 1, 3939, 0}, {'o', 1, 3940, 0}, {'r', 1, 3941, 0},
+            {'r', 1, 3942, 0}, {'y', 1, 3943, 0}, {'l', 1, 3944, 0}, {'r', 1, 3945, 0}, {'o', 1, 3946, 0},
+            {'i', 2, 3947, 0}, {'r', 1, 3949, 0}, {'a', 1, 3950, 0}, {'n', 1, 3951, 0}, {'y', 1, 3952, 0},
+            {'g', 1, 3953, 0}, {'o', 1, 3954, 0}, {'t', 1, 3955, 0}, {'u', 1, 3956, 0}, {'t', 1, 3957, 0},
+            {'r', 1, 3958, 0}, {'r', 2, 3959, 0}, {'l', 1, 3961, 0}, {';', 0, 0, 176}, {'t', 1, 3962, 0},
+            {'o', 1, 3963, 0}, {';', 0, 0, 177}, {'a', 1, 3964, 0}, {';', 0, 0, 178}, {'d', 1, 3965, 0},
+            {'n', 1, 3966, 0}, {';', 0, 0, 179}, {';', 0, 0, 180}, {'d', 1, 3967, 0}, {'c', 1, 3968, 0},
+            {'t', 1, 3969, 0}, {'p', 2, 3970, 0}, {';', 0, 0, 181}, {'p', 1, 3972, 0}, {'o', 1, 3973, 0},
+            {'f', 1, 3974, 0}, {'r', 2, 3975, 0}, {'u', 1, 3977, 0}, {'i', 3, 3978, 0}, {'i', 1, 3981, 0},
+            {'o', 1, 3982, 0}, {'i', 1, 3983, 0}, {'l', 1, 3984, 0}, {'a', 1, 3985, 0}, {'e', 1, 3986, 0},
+            {'i', 1, 3987, 0}, {'p', 1, 3988, 0}, {'o', 1, 3989, 0}, {'r', 1, 3990, 0}, {'r', 1, 3991, 0},
+            {'o', 1, 3992, 0}, {'m', 1, 3993, 0}, {';', 0, 0, 182}, {';', 0, 0, 183}, {'l', 1, 3994, 184},
+            {'o', 1, 3995, 0}, {'l', 1, 3996, 0}, {'s', 1, 3997, 0}, {'e', 1, 3998, 0}, {'o', 1, 3999, 0},
+            {'l', 1, 4000, 0}, {';', 0, 0, 185}, {'a', 1, 4001, 0}, {'l', 1, 4002, 0}, {'i', 1, 4003, 0},
+            {'l', 1, 4004, 0}, {';', 0, 0, 186}, {'i', 1, 4005, 0}, {'i', 1, 4006, 0}, {'t', 1, 4007, 0},
+            {'i', 1, 4008, 0}, {'n', 1, 4009, 0}, {'f', 1, 4010, 0}, {'f', 1, 4011, 0}, {'a', 1, 4012, 0},
+            {'k', 2, 4013, 0}, {'r', 1, 4015, 0}, {'c', 6, 4016, 0}, {'s', 1, 4022, 0}, {'w', 1, 4023, 0},
+            {'r', 1, 4024, 0}, {';', 0, 0, 187}, {'u', 1, 4025, 0}, {'m', 1, 4026, 0}, {';', 0, 0, 188},
+            {'e', 1, 4027, 0}, {'r', 1, 4028, 0}, {';', 0, 0, 189}, {'t', 1, 4029, 0}, {';', 0, 0, 190},
+            {';', 0, 0, 191}, {'q', 1, 4030, 0}, {'s', 1, 4031, 0}, {';', 0, 0, 192}, {'c', 1, 4032, 0},
+            {'d', 1, 4033, 0}, {'l', 2, 4034, 0}, {';', 0, 0, 193}, {';', 0, 0, 194}, {'e', 1, 4036, 0},
+            {'y', 1, 4037, 0}, {';', 0, 0, 195}, {';', 0, 0, 196}, {';', 0, 0, 197}, {';', 0, 0, 198},
+            {'p', 2, 4038, 0}, {';', 0, 0, 199}, {'q', 2, 4040, 0}, {'i', 1, 4042, 0}, {'f', 1, 4043, 0},
+            {'v', 1, 4044, 0}, {'r', 1, 4045, 0}, {'m', 3, 4046, 0}, {'c', 1, 4049, 0}, {'i', 1, 4050, 0},
+            {'o', 1, 4051, 0}, {'P', 1, 4052, 0}, {'u', 1, 4053, 0}, {'a', 2, 4054, 0}, {'d', 1, 4056, 0},
+            {'e', 1, 4057, 0}, {'l', 1, 4058, 0}, {'s', 1, 4059, 0}, {'r', 1, 4060, 0}, {'E', 1, 4061, 0},
+            {'r', 1, 4062, 0}, {'r', 1, 4063, 0}, {'f', 1, 4064, 0}, {'i', 1, 4065, 0}, {'d', 1, 4066, 0},
+            {'r', 3, 4067, 0}, {'r', 1, 4070, 0}, {'r', 1, 4071, 0}, {'r', 1, 4072, 0}, {'l', 1, 4073, 0},
+            {'c', 1, 4074, 0}, {';', 0, 0, 200}, {'e', 1, 4075, 0}, {'w', 1, 4076, 0}, {'r', 1, 4077, 0},
+            {'t', 1, 4078, 0}, {'k', 2, 4079, 0}, {'f', 1, 4081, 0}, {'b', 1, 4082, 0}, {'r', 1, 4083, 0},
+            {'a', 1, 4084, 0}, {'r', 1, 4085, 0}, {'u', 1, 4086, 0}, {'h', 1, 4087, 0}, {'u', 1, 4088, 0},
+            {'r', 1, 4089, 0}, {';', 0, 0, 201}, {'y', 1, 4090, 0}, {'c', 1, 4091, 0}, {';', 0, 0, 202},
+            {';', 0, 0, 203}, {'a', 1, 4092, 0}, {'i', 1, 4093, 0}, {'n', 1, 4094, 0}, {'f', 1, 4095, 0},
+            {'t', 1, 4096, 0}, {'i', 1, 4097, 0}, {'c', 1, 4098, 0}, {'g', 3, 4099, 0}, {'t', 1, 4102, 0},
+            {'f', 1, 4103, 0}, {'e', 1, 4104, 0}, {'a', 1, 4105, 0}, {'i', 1, 4106, 0}, {'d', 1, 4107, 0},
+            {';', 0, 0, 204}, {'c', 1, 4108, 0}, {'e', 2, 4109, 0}, {'l', 1, 4111, 0}, {'p', 1, 4112, 0},
+            {'y', 1, 4113, 0}, {'o', 1, 4114, 0}, {'f', 1, 4115, 0}, {'a', 1, 4116, 0}, {'o', 1, 4117, 0},
+            {'e', 1, 4118, 0}, {'r', 1, 4119, 0}, {'n', 5, 4120, 0}, {'l', 1, 4125, 0}, {'c', 1, 4126, 0},
+            {'l', 1, 4127, 205}, {'r', 1, 4128, 0}, {';', 0, 0, 206}, {';', 0, 0, 207}, {'t', 1, 4129, 0},
+            {'f', 1, 4130, 0}, {'r', 1, 4131, 0}, {'r', 1, 4132, 0}, {'c', 1, 4133, 0}, {'p', 1, 4134, 0},
+            {'d', 1, 4135, 0}, {';', 0, 0, 208}, {';', 0, 0, 209}, {'e', 1, 4136, 0}, {'y', 1, 4137, 0},
+            {'y', 1, 4138, 0}, {'f', 1, 4139, 0}, {'r', 1, 4140, 0}, {'r', 1, 4141, 0}, {'r', 1, 4142, 0},
+            {'a', 1, 4143, 0}, {'r', 1, 4144, 0}, {';', 0, 0, 210}, {'r', 1, 4145, 0}, {'u', 1, 4146, 0},
+            {'m', 1, 4147, 0}, {'r', 1, 4148, 0}, {'b', 1, 4149, 0}, {'g', 3, 4150, 0}, {';', 0, 0, 211},
+            {'u', 1, 4153, 0}, {'r', 8, 4154, 0}, {';', 0, 0, 212}, {'a', 1, 4162, 0}, {'e', 2, 4163, 0},
+            {'r', 1, 4165, 0}, {'r', 1, 4166, 0}, {'a', 1, 4167, 0}, {'k', 2, 4168, 0}, {'r', 1, 4170, 0},
+            {'d', 1, 4171, 0}, {'i', 1, 4172, 0}, {'b', 1, 4173, 0}, {';', 0, 0, 213}, {'a', 1, 4174, 0},
+            {'u', 1, 4175, 0}, {'d', 1, 4176, 0}, {'u', 1, 4177, 0}, {'h', 1, 4178, 0}, {'t', 5, 4179, 0},
+            {';', 0, 0, 214}, {';', 0, 0, 215}, {'q', 1, 4184, 0}, {'s', 1, 4185, 0}, {';', 0, 0, 216},
+            {'c', 1, 4186, 0}, {'d', 1, 4187, 0}, {'g', 2, 4188, 0}, {'s', 5, 4190, 0}, {'s', 1, 4195, 0},
+            {'o', 1, 4196, 0}, {';', 0, 0, 217}, {';', 0, 0, 218}, {'r', 2, 4197, 0}, {'l', 1, 4199, 0},
+            {'y', 1, 4200, 0}, {'r', 1, 4201, 0}, {'o', 1, 4202, 0}, {'a', 1, 4203, 0}, {'r', 1, 4204, 0},
+            {'d', 1, 4205, 0}, {'u', 1, 4206, 0}, {';', 0, 0, 219}, {'p', 2, 4207, 0}, {';', 0, 0, 220},
+            {'q', 2, 4209, 0}, {'i', 1, 4211, 0}, {'n', 1, 4212, 0}, {'r', 1, 4213, 0}, {'r', 1, 4214, 0},
+            {'g', 3, 4215, 0}, {'p', 1, 4218, 0}, {'a', 1, 4219, 0}, {'f', 1, 4220, 0}, {'l', 1, 4221, 0},
+            {'i', 1, 4222, 0}, {'a', 1, 4223, 0}, {'b', 1, 4224, 0}, {';', 0, 0, 221}, {'e', 1, 4225, 0},
+            {'f', 1, 4226, 0}, {'r', 2, 4227, 0}, {'r', 1, 4229, 0}, {'o', 1, 4230, 0}, {'a', 1, 4231, 0},
+            {';', 0, 0, 222}, {'r', 1, 4232, 0}, {'q', 1, 4233, 0}, {'r', 1, 4234, 0}, {';', 0, 0, 223},
+            {'m', 3, 4235, 0}, {'b', 1, 4238, 0}, {'u', 1, 4239, 0}, {'r', 1, 4240, 0}, {'c', 1, 4241, 0},
+            {'i', 1, 4242, 0}, {'o', 1, 4243, 0}, {'r', 1, 4244, 0}, {'m', 1, 4245, 0}, {'a', 1, 4246, 0},
+            {'u', 1, 4247, 0}, {'P', 1, 4248, 0}, {'i', 3, 4249, 0}, {'d', 1, 4252, 0}, {'u', 1, 4253, 0},
+            {'r', 1, 4254, 0}, {'E', 1, 4255, 0}, {'o', 1, 4256, 0}, {'r', 1, 4257, 224}, {'e', 1, 4258, 0},
+            {'t', 2, 4259, 0}, {';', 0, 0, 225}, {'s', 1, 4261, 0}, {'k', 1, 4262, 0}, {'m', 1, 4263, 0},
+            {';', 0, 0, 226}, {'s', 1, 4264, 0}, {'s', 1, 4265, 0}, {';', 0, 0, 227}, {';', 0, 0, 228},
+            {'r', 1, 4266, 0}, {';', 0, 0, 229}, {'a', 1, 4267, 0}, {'c', 1, 4268, 0}, {'d', 1, 4269, 0},
+            {'u', 1, 4270, 0}, {'p', 1, 4271, 0}, {'r', 1, 4272, 0}, {'l', 1, 4273, 0}, {'e', 1, 4274, 0},
+            {'f', 1, 4275, 0}, {'r', 1, 4276, 0}, {'p', 1, 4277, 0}, {'t', 1, 4278, 0}, {'a', 1, 4279, 0},
+            {';', 0, 0, 230}, {';', 0, 0, 231}, {'v', 1, 4280, 0}, {'f', 1, 4281, 0}, {';', 0, 0, 232},
+            {';', 0, 0, 233}, {'v', 1, 4282, 0}, {'g', 1, 4283, 0}, {'a', 1, 4284, 0}, {'a', 1, 4285, 0},
+            {'l', 1, 4286, 0}, {'u', 1, 4287, 0}, {'g', 1, 4288, 0}, {';', 0, 0, 234}, {'E', 1, 4289, 0},
+            {'i', 1, 4290, 0}, {'o', 1, 4291, 0}, {'p', 1, 4292, 0}, {'u', 1, 4293, 0}, {'p', 1, 4294, 235},
+            {'m', 1, 4295, 0}, {'p', 1, 4296, 0}, {'r', 1, 4297, 0}, {'d', 1, 4298, 0}, {'n', 1, 4299, 0},
+            {'p', 1, 4300, 0}, {';', 0, 0, 236}, {'s', 1, 4301, 0}, {'r', 1, 4302, 0}, {'r', 2, 4303, 0},
+            {'o', 1, 4305, 0}, {'u', 1, 4306, 0}, {'e', 1, 4307, 0}, {'i', 1, 4308, 0}, {'i', 1, 4309, 0},
+            {';', 0, 0, 237}, {';', 0, 0, 238}, {';', 0, 0, 239}, {'q', 3, 4310, 0}, {'s', 1, 4313, 0},
+            {'i', 1, 4314, 0}, {';', 0, 0, 240}, {'r', 1, 4315, 0}, {'r', 1, 4316, 0}, {'r', 1, 4317, 0},
+            {'a', 1, 4318, 0}, {';', 0, 0, 241}, {'d', 1, 4319, 0}, {';', 0, 0, 242}, {'y', 1, 4320, 0},
+            {'r', 1, 4321, 0}, {';', 0, 0, 243}, {'r', 1, 4322, 0}, {'r', 1, 4323, 0}, {';', 0, 0, 244},
+            {'f', 1, 4324, 0}, {'q', 3, 4325, 0}, {'s', 2, 4328, 0}, {'i', 1, 4330, 0}, {';', 0, 0, 245},
+            {'r', 1, 4331, 0}, {'d', 1, 4332, 0}, {'f', 1, 4333, 0}, {';', 0, 0, 246}, {'i', 1, 4334, 0},
+            {'n', 1, 4335, 0}, {'r', 4, 4336, 0}, {'l', 1, 4340, 0}, {';', 0, 0, 247}, {'c', 1, 4341, 0},
+            {'e', 2, 4342, 0}, {'r', 1, 4344, 0}, {'r', 1, 4345, 0}, {'g', 1, 4346, 0}, {'r', 1, 4347, 0},
+            {';', 0, 0, 248}, {'c', 1, 4348, 0}, {'e', 1, 4349, 0}, {'r', 1, 4350, 0}, {'o', 1, 4351, 0},
+            {'m', 2, 4352, 0}, {'i', 1, 4354, 0}, {'a', 1, 4355, 0}, {'s', 1, 4356, 0}, {'b', 4, 4357, 0},
+            {'c', 1, 4361, 0}, {'p', 4, 4362, 0}, {'l', 1, 4366, 0}, {'l', 1, 4367, 0}, {'g', 1, 4368, 0},
+            {'i', 1, 4369, 0}, {';', 0, 0, 249}, {'e', 1, 4370, 0}, {'s', 1, 4371, 0}, {'a', 1, 4372, 0},
+            {'a', 1, 4373, 0}, {'p', 1, 4374, 0}, {'a', 1, 4375, 0}, {'e', 1, 4376, 0}, {'t', 1, 4377, 0},
+            {'n', 1, 4378, 0}, {'A', 1, 4379, 0}, {'e', 1, 4380, 0}, {'t', 2, 4381, 0}, {'A', 1, 4383, 0},
+            {'t', 1, 4384, 0}, {'i', 1, 4385, 0}, {'r', 1, 4386, 0}, {'r', 2, 4387, 0}, {'e', 1, 4389, 0},
+            {'u', 1, 4390, 0}, {'t', 1, 4391, 0}, {'r', 2, 4392, 0}, {';', 0, 0, 250}, {'s', 1, 4394, 0},
+            {'l', 1, 4395, 0}, {'v', 1, 4396, 0}, {'t', 1, 4397, 0}, {'o', 1, 4398, 0}, {'i', 1, 4399, 0},
+            {'i', 1, 4400, 0}, {';', 0, 0, 251}, {'n', 1, 4401, 0}, {'a', 1, 4402, 0}, {';', 0, 0, 252},
+            {'a', 1, 4403, 0}, {';', 0, 0, 253}, {'t', 1, 4404, 0}, {'r', 1, 4405, 0}, {'i', 1, 4406, 0},
+            {'r', 1, 4407, 0}, {'n', 1, 4408, 0}, {';', 0, 0, 254}, {'c', 1, 4409, 0}, {'g', 1, 4410, 0},
+            {'c', 1, 4411, 0}, {'d', 1, 4412, 0}, {'n', 1, 4413, 0}, {'f', 1, 4414, 0}, {'r', 1, 4415, 0},
+            {'r', 1, 4416, 0}, {'u', 1, 4417, 0}, {'r', 1, 4418, 0}, {';', 0, 0, 255}, {'e', 1, 4419, 0},
+            {'f', 1, 4420, 256}, {'m', 1, 4421, 257}, {'g', 1, 4422, 0}, {'r', 1, 4423, 0}, {'l', 1, 4424, 0},
+            {';', 0, 0, 258}, {'r', 1, 4425, 0}, {'a', 1, 4426, 0}, {'l', 1, 4427, 0}, {'l', 1, 4428, 0},
+            {'m', 1, 4429, 0}, {'l', 1, 4430, 259}, {'a', 1, 4431, 0}, {';', 0, 0, 260}, {'a', 2, 4432, 261},
+            {'s', 2, 4434, 0}, {'t', 1, 4436, 0}, {';', 0, 0, 262}, {'c', 1, 4437, 0}, {'i', 1, 4438, 0},
+            {'m', 1, 4439, 0}, {'p', 1, 4440, 0}, {'t', 1, 4441, 0}, {';', 0, 0, 263}, {';', 0, 0, 264},
+            {'v', 1, 4442, 0}, {'m', 1, 4443, 0}, {'n', 1, 4444, 0}, {'c', 1, 4445, 0}, {';', 0, 0, 265},
+            {'n', 2, 4446, 0}, {'s', 9, 4448, 0}, {'n', 1, 4457, 0}, {'f', 1, 4458, 0}, {'n', 1, 4459, 0},
+            {';', 0, 0, 266}, {'p', 1, 4460, 0}, {'u', 1, 4461, 0}, {';', 0, 0, 267}, {'c', 6, 4462, 0},
+            {'m', 1, 4468, 0}, {'E', 1, 4469, 0}, {'a', 1, 4470, 0}, {'s', 1, 4471, 0}, {'d', 1, 4472, 0},
+            {'f', 3, 4473, 0}, {'p', 2, 4476, 0}, {'i', 1, 4478, 0}, {'r', 1, 4479, 0}, {'r', 1, 4480, 0},
+            {';', 0, 0, 268}, {'c', 1, 4481, 0}, {';', 0, 0, 269}, {'t', 1, 4482, 0}, {'f', 1, 4483, 0},
+            {'i', 1, 4484, 0}, {'r', 1, 4485, 0}, {'t', 2, 4486, 0}, {'s', 1, 4488, 0}, {'t', 1, 4489, 270},
+            {'r', 1, 4490, 0}, {'r', 1, 4491, 0}, {'a', 1, 4492, 0}, {'r', 1, 4493, 0}, {'r', 1, 4494, 0},
+            {'e', 1, 4495, 0}, {'u', 1, 4496, 0}, {'i', 1, 4497, 0}, {'m', 1, 4498, 0}, {'g', 4, 4499, 0},
+            {'u', 1, 4503, 0}, {'r', 11, 4504, 0}, {'a', 1, 4515, 0}, {'i', 1, 4516, 0}, {'r', 1, 4517, 0},
+            {'r', 1, 4518, 0}, {'a', 1, 4519, 0}, {'k', 2, 4520, 0}, {'r', 1, 4522, 0}, {'d', 1, 4523, 0},
+            {'i', 1, 4524, 0}, {'b', 1, 4525, 0}, {';', 0, 0, 271}, {'a', 1, 4526, 0}, {'d', 1, 4527, 0},
+            {'u', 1, 4528, 0}, {'h', 1, 4529, 0}, {'l', 4, 4530, 0}, {'t', 1, 4534, 0}, {';', 0, 0, 272},
+            {'s', 1, 4535, 0}, {'o', 1, 4536, 0}, {';', 0, 0, 273}, {'r', 2, 4537, 0}, {';', 0, 0, 274},
+            {'v', 1, 4539, 0}, {'h', 1, 4540, 0}, {'g', 1, 4541, 0}, {'i', 1, 4542, 0}, {'r', 1, 4543, 0},
+            {'a', 1, 4544, 0}, {';', 0, 0, 275}, {'u', 1, 4545, 0}, {'i', 1, 4546, 0}, {'n', 1, 4547, 0},
+            {'r', 1, 4548, 0}, {'r', 1, 4549, 0}, {'a', 1, 4550, 0}, {'f', 1, 4551, 0}, {'l', 1, 4552, 0},
+            {'i', 1, 4553, 0}, {'r', 2, 4554, 0}, {'o', 1, 4556, 0}, {'r', 1, 4557, 0}, {'q', 1, 4558, 0},
+            {'r', 1, 4559, 0}, {';', 0, 0, 276}, {'b', 1, 4560, 0}, {'u', 1, 4561, 0}, {'r', 1, 4562, 0},
+            {'m', 1, 4563, 0}, {'i', 4, 4564, 0}, {'u', 1, 4568, 0}, {'u', 1, 4569, 0}, {'u', 1, 4570, 0},
+            {';', 0, 0, 277}, {'p', 1, 4571, 0}, {'r', 1, 4572, 0}, {'u', 1, 4573, 0}, {';', 0, 0, 278},
+            {'d', 1, 4574, 0}, {'r', 1, 4575, 0}, {'E', 1, 4576, 0}, {'a', 1, 4577, 0}, {'s', 1, 4578, 0},
+            {'o', 1, 4579, 0}, {'i', 1, 4580, 0}, {';', 0, 0, 279}, {'t', 3, 4581, 0}, {'r', 1, 4584, 0},
+            {'r', 2, 4585, 0}, {'t', 1, 4587, 280}, {'i', 1, 4588, 0}, {'w', 1, 4589, 0}, {'m', 2, 4590, 0},
+            {'t', 1, 4592, 0}, {';', 0, 0, 281}, {'o', 1, 4593, 0}, {'r', 1, 4594, 0}, {'h', 1, 4595, 0},
+            {'y', 1, 4596, 0}, {'r', 1, 4597, 0}, {';', 0, 0, 282}, {'m', 1, 4598, 0}, {';', 0, 0, 283},
+            {'d', 1, 4599, 0}, {'e', 2, 4600, 0}, {'g', 2, 4602, 0}, {'l', 2, 4604, 0}, {'n', 1, 4606, 0},
+            {'p', 1, 4607, 0}, {'r', 1, 4608, 0}, {'r', 1, 4609, 0}, {'l', 1, 4610, 0}, {'s', 1, 4611, 0},
+            {'p', 1, 4612, 0}, {'d', 1, 4613, 0}, {'l', 1, 4614, 0}, {';', 0, 0, 284}, {'e', 2, 4615, 0},
+            {'t', 1, 4617, 0}, {';', 0, 0, 285}, {'b', 2, 4618, 0}, {'f', 1, 4620, 0}, {'d', 1, 4621, 0},
+            {'r', 1, 4622, 0}, {'a', 1, 4623, 0}, {'u', 1, 4624, 0}, {'u', 2, 4625, 0}, {';', 0, 0, 286},
+            {'a', 1, 4627, 0}, {'f', 1, 4628, 0}, {'r', 1, 4629, 0}, {'r', 1, 4630, 0}, {'t', 1, 4631, 0},
+            {'i', 1, 4632, 0}, {'a', 1, 4633, 0}, {'r', 2, 4634, 0}, {'a', 1, 4636, 0}, {'n', 1, 4637, 0},
+            {';', 0, 0, 287}, {'E', 1, 4638, 0}, {'d', 1, 4639, 0}, {'e', 2, 4640, 0}, {'m', 1, 4642, 0},
+            {'n', 2, 4643, 0}, {'p', 1, 4645, 0}, {'r', 1, 4646, 0}, {'s', 3, 4647, 0}, {'c', 6, 4650, 0},
+            {';', 0, 0, 288}, {'g', 1, 4656, 0}, {'1', 1, 4657, 289}, {'2', 1, 4658, 290}, {'3', 1, 4659, 291},
+            {';', 0, 0, 292}, {'E', 1, 4660, 0}, {'d', 2, 4661, 0}, {'e', 2, 4663, 0}, {'h', 1, 4665, 0},
+            {'l', 1, 4666, 0}, {'m', 1, 4667, 0}, {'n', 2, 4668, 0}, {'p', 1, 4670, 0}, {'s', 3, 4671, 0},
+            {'r', 1, 4674, 0}, {'r', 2, 4675, 0}, {'w', 1, 4677, 0}, {'i', 1, 4678, 0}, {'g', 1, 4679, 0},
+            {';', 0, 0, 293}, {'k', 1, 4680, 0}, {'r', 1, 4681, 0}, {'d', 1, 4682, 0}, {';', 0, 0, 294},
+            {'t', 1, 4683, 0}, {'r', 1, 4684, 0}, {';', 0, 0, 295}, {'r', 1, 4685, 0}, {'t', 1, 4686, 0},
+            {'c', 1, 4687, 0}, {'n', 1, 4688, 0}, {'a', 1, 4689, 0}, {'s', 1, 4690, 0}, {'r', 1, 4691, 0},
+            {'d', 1, 4692, 0}, {'e', 1, 4693, 0}, {'t', 1, 4694, 0}, {'a', 1, 4695, 0}, {';', 0, 0, 296},
+            {'b', 1, 4696, 0}, {'c', 1, 4697, 0}, {'f', 2, 4698, 0}, {'a', 1, 4700, 0}, {'i', 1, 4701, 0},
+            {'d', 1, 4702, 0}, {'a', 1, 4703, 0}, {'d', 1, 4704, 0}, {'e', 1, 4705, 0}, {'m', 1, 4706, 0},
+            {'p', 1, 4707, 0}, {'s', 1, 4708, 0}, {'t', 1, 4709, 0}, {'e', 1, 4710, 0}, {'r', 1, 4711, 0},
+            {'y', 1, 4712, 0}, {'c', 1, 4713, 0}, {'r', 1, 4714, 0}, {'x', 1, 4715, 0}, {'h', 1, 4716, 0},
+            {'r', 1, 4717, 0}, {'r', 1, 4718, 0}, {'u', 1, 4719, 0}, {'r', 1, 4720, 0}, {'c', 1, 4721, 0},
+            {'e', 1, 4722, 0}, {'r', 1, 4723, 0}, {';', 0, 0, 297}, {'r', 1, 4724, 0}, {'l', 1, 4725, 0},
+            {'a', 1, 4726, 0}, {'s', 1, 4727, 0}, {';', 0, 0, 298}, {'a', 1, 4728, 0}, {'r', 2, 4729, 0},
+            {'l', 1, 4731, 0}, {'o', 1, 4732, 0}, {'r', 1, 4733, 0}, {'r', 1, 4734, 0}, {'c', 1, 4735, 0},
+            {';', 0, 0, 299}, {'o', 1, 4736, 0}, {'f', 1, 4737, 0}, {'r', 1, 4738, 0}, {'o', 1, 4739, 0},
+            {'a', 1, 4740, 0}, {'u', 1, 4741, 0}, {'i', 3, 4742, 0}, {'p', 1, 4745, 0}, {'o', 1, 4746, 0},
+            {'r', 1, 4747, 0}, {'n', 1, 4748, 0}, {'r', 1, 4749, 0}, {'r', 1, 4750, 0}, {'o', 1, 4751, 0},
+            {'l', 1, 4752, 0}, {'i', 2, 4753, 0}, {'r', 1, 4755, 0}, {'l', 1, 4756, 300}, {'n', 1, 4757, 0},
+            {'r', 1, 4758, 0}, {'r', 2, 4759, 0}, {'s', 1, 4761, 0}, {'g', 1, 4762, 0}, {'e', 1, 4763, 0},
+            {'k', 1, 4764, 0}, {'n', 1, 4765, 0}, {'p', 3, 4766, 0}, {'r', 2, 4769, 0}, {'s', 2, 4771, 0},
+            {'t', 2, 4773, 0}, {';', 0, 0, 301}, {'s', 1, 4775, 0}, {';', 0, 0, 302}, {'b', 1, 4776, 0},
+            {'e', 1, 4777, 0}, {'l', 1, 4778, 0}, {'b', 1, 4779, 0}, {'t', 1, 4780, 0}, {';', 0, 0, 303},
+            {'r', 1, 4781, 0}, {'u', 2, 4782, 0}, {'f', 1, 4784, 0}, {'o', 1, 4785, 0}, {'r', 1, 4786, 0},
+            {'r', 1, 4787, 0}, {'b', 1, 4788, 0}, {'p', 1, 4789, 0}, {'g', 1, 4790, 0}, {'r', 1, 4791, 0},
+            {'b', 1, 4792, 0}, {'g', 1, 4793, 0}, {'e', 1, 4794, 0}, {';', 0, 0, 304}, {'f', 1, 4795, 0},
+            {'a', 1, 4796, 0}, {'r', 1, 4797, 0}, {'p', 1, 4798, 0}, {'r', 1, 4799, 0}, {'p', 1, 4800, 0},
+            {'r', 1, 4801, 0}, {';', 0, 0, 305}, {'r', 1, 4802, 0}, {'r', 1, 4803, 0}, {'r', 1, 4804, 0},
+            {'r', 1, 4805, 0}, {'p', 1, 4806, 0}, {'s', 1, 4807, 0}, {'o', 1, 4808, 0}, {'f', 1, 4809, 0},
+            {'l', 1, 4810, 0}, {'i', 1, 4811, 0}, {'r', 1, 4812, 0}, {'r', 1, 4813, 0}, {'r', 1, 4814, 0},
+            {'c', 1, 4815, 0}, {'l', 1, 4816, 0}, {'r', 1, 4817, 0}, {'e', 1, 4818, 0}, {'d', 1, 4819, 0},
+            {'u', 1, 4820, 0}, {'y', 1, 4821, 0}, {'r', 1, 4822, 0}, {';', 0, 0, 306}, {';', 0, 0, 307},
+            {';', 0, 0, 308}, {'y', 1, 4823, 0}, {'f', 1, 4824, 0}, {'r', 1, 4825, 0}, {'y', 1, 4826, 0},
+            {'l', 1, 4827, 309}, {'u', 1, 4828, 0}, {'r', 1, 4829, 0}, {';', 0, 0, 310}, {'t', 1, 4830, 0},
+            {'t', 1, 4831, 0}, {'a', 1, 4832, 0}, {';', 0, 0, 311}, {'y', 1, 4833, 0}, {'r', 1, 4834, 0},
+            {'f', 1, 4835, 0}, {'r', 1, 4836, 0}, {';', 0, 0, 312}, {'j', 1, 4837, 0}, {'g', 1, 4838, 313},
+            {'t', 1, 4839, 0}, {'v', 1, 4840, 0}, {'c', 1, 4841, 314}, {'v', 1, 4842, 0}, {'a', 1, 4843, 0},
+            {'r', 1, 4844, 0}, {'n', 1, 4845, 0}, {';', 0, 0, 315}, {'y', 1, 4846, 0}, {'g', 1, 4847, 316},
+            {';', 0, 0, 317}, {'g', 1, 4848, 0}, {'d', 1, 4849, 0}, {';', 0, 0, 318}, {'s', 1, 4850, 0},
+            {';', 0, 0, 319}, {'e', 1, 4851, 0}, {'u', 1, 4852, 0}, {'o', 1, 4853, 0}, {';', 0, 0, 320},
+            {';', 0, 0, 321}, {'e', 1, 4854, 0}, {';', 0, 0, 322}, {'e', 1, 4855, 0}, {';', 0, 0, 323},
+            {';', 0, 0, 324}, {'t', 1, 4856, 0}, {'t', 1, 4857, 0}, {'e', 1, 4858, 0}, {'o', 1, 4859, 0},
+            {'i', 1, 4860, 0}, {'c', 1, 4861, 0}, {'i', 1, 4862, 0}, {';', 0, 0, 325}, {'l', 1, 4863, 0},
+            {'e', 1, 4864, 0}, {'l', 1, 4865, 0}, {'k', 1, 4866, 0}, {'e', 1, 4867, 0}, {'n', 2, 4868, 0},
+            {'r', 1, 4870, 0}, {'n', 1, 4871, 0}, {'o', 1, 4872, 0}, {';', 0, 0, 326}, {'o', 1, 4873, 0},
+            {'t', 1, 4874, 0}, {'s', 1, 4875, 0}, {';', 0, 0, 327}, {'a', 1, 4876, 0}, {'r', 1, 4877, 0},
+            {';', 0, 0, 328}, {';', 0, 0, 329}, {';', 0, 0, 330}, {'e', 1, 4878, 0}, {';', 0, 0, 331},
+            {'v', 1, 4879, 0}, {'o', 1, 4880, 0}, {'a', 1, 4881, 0}, {'r', 1, 4882, 0}, {'o', 1, 4883, 0},
+            {'e', 1, 4884, 0}, {';', 0, 0, 332}, {'o', 1, 4885, 0}, {'q', 1, 4886, 0}, {'l', 1, 4887, 0},
+            {'A', 1, 4888, 0}, {'B', 1, 4889, 0}, {'L', 1, 4890, 0}, {'R', 1, 4891, 0}, {'T', 1, 4892, 0},
+            {'a', 1, 4893, 0}, {';', 0, 0, 333}, {'o', 1, 4894, 0}, {'t', 1, 4895, 0}, {'o', 1, 4896, 0},
+            {'c', 1, 4897, 334}, {';', 0, 0, 335}, {'v', 1, 4898, 0}, {'e', 1, 4899, 0}, {'r', 1, 4900, 0},
+            {'y', 2, 4901, 0}, {'n', 1, 4903, 0}, {';', 0, 0, 336}, {'l', 1, 4904, 0}, {'l', 2, 4905, 0},
+            {'l', 1, 4907, 0}, {';', 0, 0, 337}, {';', 0, 0, 338}, {';', 0, 0, 339}, {'t', 1, 4908, 0},
+            {'n', 1, 4909, 0}, {'e', 1, 4910, 0}, {';', 0, 0, 340}, {'l', 1, 4911, 0}, {'i', 1, 4912, 0},
+            {';', 0, 0, 341}, {';', 0, 0, 342}, {'a', 2, 4913, 0}, {'v', 1, 4915, 0}, {'i', 1, 4916, 0},
+            {'c', 1, 4917, 0}, {';', 0, 0, 343}, {';', 0, 0, 344}, {'t', 1, 4918, 0}, {';', 0, 0, 345},
+            {'c', 1, 4919, 0}, {'k', 1, 4920, 0}, {'c', 1, 4921, 0}, {'e', 1, 4922, 0}, {';', 0, 0, 346},
+            {'z', 1, 4923, 0}, {';', 0, 0, 347}, {'o', 1, 4924, 0}, {'D', 1, 4925, 0}, {'E', 1, 4926, 0},
+            {';', 0, 0, 348}, {'g', 1, 4927, 0}, {';', 0, 0, 349}, {'t', 1, 4928, 0}, {'c', 1, 4929, 350},
+            {';', 0, 0, 351}, {'v', 1, 4930, 0}, {'r', 1, 4931, 0}, {'i', 1, 4932, 0}, {'i', 1, 4933, 0},
+            {'g', 1, 4934, 0}, {'r', 1, 4935, 0}, {'s', 1, 4936, 0}, {'n', 1, 4937, 0}, {';', 0, 0, 352},
+            {';', 0, 0, 353}, {';', 0, 0, 354}, {'d', 1, 4938, 0}, {'y', 1, 4939, 0}, {';', 0, 0, 355},
+            {'c', 1, 4940, 0}, {';', 0, 0, 356}, {';', 0, 0, 357}, {'c', 1, 4941, 0}, {'y', 1, 4942, 0},
+            {';', 0, 0, 358}, {';', 0, 0, 359}, {'a', 1, 4943, 0}, {'i', 1, 4944, 0}, {';', 0, 0, 360},
+            {';', 0, 0, 361}, {';', 0, 0, 362}, {'t', 1, 4945, 0}, {'d', 1, 4946, 0}, {';', 0, 0, 363},
+            {'a', 1, 4947, 0}, {';', 0, 0, 364}, {'o', 1, 4948, 0}, {'i', 1, 4949, 0}, {'A', 2, 4950, 0},
+            {'C', 1, 4952, 0}, {'D', 1, 4953, 0}, {'F', 1, 4954, 0}, {'R', 1, 4955, 0}, {'T', 2, 4956, 0},
+            {'U', 1, 4958, 0}, {'V', 1, 4959, 0}, {'a', 1, 4960, 0}, {'r', 1, 4961, 0}, {'E', 1, 4962, 0},
+            {'F', 1, 4963, 0}, {'G', 1, 4964, 0}, {'L', 1, 4965, 0}, {'S', 1, 4966, 0}, {'T', 1, 4967, 0},
+            {'t', 1, 4968, 0}, {'o', 1, 4969, 0}, {'L', 1, 4970, 0}, {'R', 1, 4971, 0}, {'l', 1, 4972, 0},
+            {'r', 1, 4973, 0}, {';', 0, 0, 365}, {'r', 2, 4974, 0}, {';', 0, 0, 366}, {'o', 1, 4976, 0},
+            {'u', 1, 4977, 0}, {'i', 1, 4978, 0}, {'s', 1, 4979, 0}, {';', 0, 0, 367}, {';', 0, 0, 368},
+            {';', 0, 0, 369}, {'t', 1, 4980, 0}, {'o', 1, 4981, 0}, {'i', 1, 4982, 0}, {'t', 1, 4983, 0},
+            {'e', 1, 4984, 0}, {'i', 1, 4985, 0}, {'e', 1, 4986, 0}, {'r', 1, 4987, 0}, {';', 0, 0, 370},
+            {'o', 1, 4988, 0}, {'u', 1, 4989, 0}, {'o', 1, 4990, 0}, {'l', 1, 4991, 0}, {'q', 1, 4992, 0},
+            {'x', 1, 4993, 0}, {'r', 1, 4994, 0}, {'u', 1, 4995, 0}, {'e', 2, 4996, 0}, {'e', 1, 4998, 0},
+            {'r', 1, 4999, 0}, {'e', 1, 5000, 0}, {'i', 1, 5001, 0}, {'q', 1, 5002, 0}, {'u', 3, 5003, 0},
+            {'i', 1, 5006, 0}, {'e', 1, 5007, 0}, {';', 0, 0, 371}, {'d', 1, 5008, 0}, {'g', 1, 5009, 0},
+            {'t', 1, 5010, 0}, {'c', 1, 5011, 372}, {'a', 1, 5012, 0}, {'v', 1, 5013, 0}, {'r', 1, 5014, 0},
+            {'a', 1, 5015, 0}, {'r', 1, 5016, 0}, {';', 0, 0, 373}, {'C', 1, 5017, 0}, {';', 0, 0, 374},
+            {'s', 1, 5018, 0}, {'d', 1, 5019, 0}, {'e', 1, 5020, 0}, {';', 0, 0, 375}, {'B', 2, 5021, 0},
+            {'P', 1, 5023, 0}, {'i', 1, 5024, 0}, {'M', 1, 5025, 0}, {'c', 1, 5026, 0}, {';', 0, 0, 376},
+            {'e', 1, 5027, 0}, {'e', 1, 5028, 0}, {'u', 1, 5029, 0}, {'o', 1, 5030, 0}, {';', 0, 0, 377},
+            {';', 0, 0, 378}, {';', 0, 0, 379}, {';', 0, 0, 380}, {'r', 1, 5031, 0}, {'t', 1, 5032, 0},
+            {';', 0, 0, 381}, {';', 0, 0, 382}, {'t', 1, 5033, 0}, {'o', 1, 5034, 0}, {'i', 1, 5035, 0},
+            {'r', 1, 5036, 0}, {'t', 8, 5037, 0}, {';', 0, 0, 383}, {'d', 1, 5045, 0}, {'h', 1, 5046, 0},
+            {';', 0, 0, 384}, {'D', 1, 5047, 0}, {'c', 1, 5048, 0}, {';', 0, 0, 385}, {'c', 1, 5049, 0},
+            {'t', 1, 5050, 0}, {'o', 1, 5051, 0}, {'i', 1, 5052, 0}, {'c', 1, 5053, 0}, {'t', 4, 5054, 0},
+            {'a', 1, 5058, 0}, {'l', 1, 5059, 0}, {';', 0, 0, 386}, {';', 0, 0, 387}, {'r', 1, 5060, 0},
+            {';', 0, 0, 388}, {';', 0, 0, 389}, {'e', 1, 5061, 0}, {'e', 1, 5062, 0}, {'T', 1, 5063, 0},
+            {'r', 1, 5064, 0}, {'e', 1, 5065, 0}, {'N', 1, 5066, 390}, {'E', 1, 5067, 0}, {'y', 1, 5068, 0},
+            {';', 0, 0, 391}, {'o', 1, 5069, 0}, {'i', 1, 5070, 0}, {'e', 1, 5071, 0}, {'a', 1, 5072, 0},
+            {'k', 1, 5073, 0}, {'S', 1, 5074, 0}, {'e', 4, 5075, 0}, {';', 0, 0, 392}, {'l', 1, 5079, 0},
+            {';', 0, 0, 393}, {'o', 1, 5080, 0}, {'t', 1, 5081, 0}, {';', 0, 0, 394}, {'o', 1, 5082, 0},
+            {'y', 1, 5083, 0}, {'v', 1, 5084, 0}, {'c', 1, 5085, 395}, {'a', 1, 5086, 0}, {'v', 1, 5087, 0},
+            {'r', 1, 5088, 0}, {'r', 2, 5089, 0}, {'n', 2, 5091, 0}, {'n', 1, 5093, 0}, {';', 0, 0, 396},
+            {'r', 1, 5094, 0}, {'w', 1, 5095, 0}, {'u', 1, 5096, 0}, {'e', 2, 5097, 0}, {'r', 1, 5099, 0},
+            {'w', 1, 5100, 0}, {'r', 2, 5101, 0}, {';', 0, 0, 397}, {'l', 1, 5103, 0}, {'g', 1, 5104, 0},
+            {';', 0, 0, 398}, {'d', 1, 5105, 0}, {';', 0, 0, 399}, {'h', 1, 5106, 0}, {';', 0, 0, 400},
+            {'h', 2, 5107, 0}, {'a', 1, 5109, 0}, {';', 0, 0, 401}, {'i', 1, 5110, 0}, {'T', 1, 5111, 0},
+            {';', 0, 0, 402}, {';', 0, 0, 403}, {'s', 1, 5112, 0}, {'c', 1, 5113, 0}, {'e', 1, 5114, 0},
+            {';', 0, 0, 404}, {';', 0, 0, 405}, {';', 0, 0, 406}, {';', 0, 0, 407}, {';', 0, 0, 408},
+            {';', 0, 0, 409}, {';', 0, 0, 410}, {'t', 1, 5115, 0}, {'c', 1, 5116, 0}, {';', 0, 0, 411},
+            {';', 0, 0, 412}, {';', 0, 0, 413}, {';', 0, 0, 414}, {'t', 1, 5117, 0}, {'o', 1, 5118, 0},
+            {';', 0, 0, 415}, {'W', 1, 5119, 0}, {';', 0, 0, 416}, {';', 0, 0, 417}, {';', 0, 0, 418},
+            {'t', 1, 5120, 0}, {'v', 1, 5121, 0}, {'c', 1, 5122, 419}, {'e', 1, 5123, 420}, {'g', 1, 5124, 421},
+            {'v', 1, 5125, 0}, {'s', 1, 5126, 0}, {'h', 1, 5127, 0}, {'a', 1, 5128, 0}, {'r', 1, 5129, 0},
+            {'g', 1, 5130, 0}, {'n', 1, 5131, 0}, {';', 0, 0, 422}, {'l', 1, 5132, 0}, {';', 0, 0, 423},
+            {';', 0, 0, 424}, {'e', 1, 5133, 0}, {'s', 1, 5134, 0}, {'t', 2, 5135, 0}, {'p', 1, 5137, 0},
+            {'t', 1, 5138, 0}, {'a', 1, 5139, 0}, {'n', 1, 5140, 0}, {';', 0, 0, 425}, {'i', 1, 5141, 0},
+            {';', 0, 0, 426}, {';', 0, 0, 427}, {'o', 1, 5142, 0}, {'g', 1, 5143, 428}, {';', 0, 0, 429},
+            {'p', 2, 5144, 0}, {'d', 1, 5146, 0}, {';', 0, 0, 430}, {'n', 1, 5147, 0}, {'t', 1, 5148, 0},
+            {';', 0, 0, 431}, {'c', 1, 5149, 0}, {'e', 1, 5150, 0}, {'p', 1, 5151, 0}, {'s', 1, 5152, 0},
+            {'e', 1, 5153, 0}, {'e', 1, 5154, 0}, {';', 0, 0, 432}, {'t', 1, 5155, 0}, {'g', 1, 5156, 0},
+            {'o', 1, 5157, 0}, {'u', 1, 5158, 0}, {'t', 1, 5159, 0}, {'i', 1, 5160, 0}, {'o', 1, 5161, 0},
+            {';', 0, 0, 433}, {';', 0, 0, 434}, {'e', 1, 5162, 0}, {'a', 1, 5163, 0}, {'i', 1, 5164, 0},
+            {'u', 1, 5165, 0}, {'d', 1, 5166, 0}, {'p', 1, 5167, 0}, {'t', 1, 5168, 0}, {'q', 1, 5169, 0},
+            {'t', 1, 5170, 0}, {'r', 1, 5171, 0}, {'p', 1, 5172, 0}, {'e', 1, 5173, 0}, {'e', 1, 5174, 0},
+            {'o', 1, 5175, 0}, {'k', 3, 5176, 0}, {'k', 1, 5179, 0}, {'2', 1, 5180, 0}, {'4', 1, 5181, 0},
+            {'4', 1, 5182, 0}, {'k', 1, 5183, 0}, {'u', 1, 5184, 0}, {';', 0, 0, 435}, {';', 0, 0, 436},
+            {'o', 1, 5185, 0}, {'i', 1, 5186, 0}, {'L', 1, 5187, 0}, {'R', 1, 5188, 0}, {'l', 1, 5189, 0},
+            {'r', 1, 5190, 0}, {';', 0, 0, 437}, {'D', 1, 5191, 0}, {'U', 1, 5192, 0}, {'d', 1, 5193, 0},
+            {'u', 1, 5194, 0}, {'L', 1, 5195, 0}, {'R', 1, 5196, 0}, {'l', 1, 5197, 0}, {'r', 1, 5198, 0},
+            {';', 0, 0, 438}, {'H', 1, 5199, 0}, {'L', 1, 5200, 0}, {'R', 1, 5201, 0}, {'h', 1, 5202, 0},
+            {'l', 1, 5203, 0}, {'r', 1, 5204, 0}, {'o', 1, 5205, 0}, {'L', 1, 5206, 0}, {'R', 1, 5207, 0},
+            {'l', 1, 5208, 0}, {'r', 1, 5209, 0}, {';', 0, 0, 439}, {'D', 1, 5210, 0}, {'U', 1, 5211, 0},
+            {'d', 1, 5212, 0}, {'u', 1, 5213, 0}, {'i', 1, 5214, 0}, {'l', 1, 5215, 0}, {'i', 1, 5216, 0},
+            {'L', 1, 5217, 0}, {'R', 1, 5218, 0}, {'l', 1, 5219, 0}, {'r', 1, 5220, 0}, {';', 0, 0, 440},
+            {'H', 1, 5221, 0}, {'L', 1, 5222, 0}, {'R', 1, 5223, 0}, {'h', 1, 5224, 0}, {'l', 1, 5225, 0},
+            {'r', 1, 5226, 0}, {'m', 1, 5227, 0}, {'e', 1, 5228, 0}, {'a', 1, 5229, 0}, {';', 0, 0, 441},
+            {'i', 1, 5230, 0}, {';', 0, 0, 442}, {'e', 1, 5231, 0}, {';', 0, 0, 443}, {'b', 1, 5232, 0},
+            {'h', 1, 5233, 0}, {';', 0, 0, 444}, {'e', 1, 5234, 0}, {';', 0, 0, 445}, {'E', 1, 5235, 0},
+            {'e', 2, 5236, 0}, {'t', 1, 5238, 0}, {'n', 1, 5239, 0}, {'r', 1, 5240, 0}, {'a', 1, 5241, 0},
+            {'u', 1, 5242, 0}, {'o', 1, 5243, 0}, {';', 0, 0, 446}, {'t', 1, 5244, 0}, {'n', 1, 5245, 0},
+            {'s', 1, 5246, 0}, {'o', 1, 5247, 0}, {'i', 1, 5248, 0}, {'c', 1, 5249, 0}, {'s', 2, 5250, 0},
+            {';', 0, 0, 447}, {'l', 1, 5252, 448}, {'t', 1, 5253, 0}, {';', 0, 0, 449}, {'e', 1, 5254, 0},
+            {';', 0, 0, 450}, {'k', 2, 5255, 0}, {';', 0, 0, 451}, {';', 0, 0, 452}, {'e', 1, 5257, 0},
+            {'l', 1, 5258, 0}, {';', 0, 0, 453}, {'n', 1, 5259, 0}, {'i', 1, 5260, 0}, {'c', 1, 5261, 0},
+            {'s', 2, 5262, 0}, {'n', 2, 5264, 0}, {'a', 2, 5266, 0}, {';', 0, 0, 454}, {'f', 1, 5268, 0},
+            {'l', 1, 5269, 0}, {';', 0, 0, 455}, {'d', 1, 5270, 0}, {'n', 1, 5271, 0}, {';', 0, 0, 456},
+            {'o', 1, 5272, 0}, {';', 0, 0, 457}, {'s', 1, 5273, 0}, {'r', 1, 5274, 0}, {'s', 1, 5275, 0},
+            {';', 0, 0, 458}, {';', 0, 0, 459}, {'e', 1, 5276, 0}, {';', 0, 0, 460}, {'e', 1, 5277, 0},
+            {'t', 1, 5278, 0}, {'r', 1, 5279, 0}, {'r', 1, 5280, 0}, {'c', 1, 5281, 0}, {'r', 1, 5282, 0},
+            {'r', 1, 5283, 0}, {'a', 1, 5284, 0}, {'u', 1, 5285, 0}, {'o', 1, 5286, 0}, {'r', 1, 5287, 0},
+            {';', 0, 0, 461}, {'r', 1, 5288, 0}, {'y', 3, 5289, 0}, {'e', 1, 5292, 0}, {'e', 1, 5293, 0},
+            {'e', 1, 5294, 0}, {'d', 1, 5295, 0}, {'n', 1, 5296, 0}, {'t', 1, 5297, 0}, {'t', 1, 5298, 0},
+            {';', 0, 0, 462}, {';', 0, 0, 463}, {'e', 1, 5299, 0}, {'t', 1, 5300, 0}, {';', 0, 0, 464},
+            {';', 0, 0, 465}, {'v', 1, 5301, 0}, {'r', 1, 5302, 0}, {'c', 1, 5303, 0}, {'o', 1, 5304, 0},
+            {'g', 1, 5305, 0}, {'r', 1, 5306, 0}, {'s', 1, 5307, 0}, {'a', 1, 5308, 0}, {'t', 1, 5309, 0},
+            {'h', 1, 5310, 0}, {'l', 1, 5311, 0}, {'r', 1, 5312, 0}, {';', 0, 0, 466}, {'o', 1, 5313, 0},
+            {'s', 1, 5314, 0}, {'m', 1, 5315, 0}, {'n', 1, 5316, 0}, {'d', 1, 5317, 0}, {'n', 1, 5318, 0},
+            {';', 0, 0, 467}, {'r', 1, 5319, 0}, {'o', 1, 5320, 0}, {'a', 1, 5321, 0}, {';', 0, 0, 468},
+            {'q', 2, 5322, 0}, {'i', 1, 5324, 0}, {'l', 1, 5325, 0}, {'q', 1, 5326, 0}, {'l', 1, 5327, 0},
+            {'a', 1, 5328, 0}, {'d', 1, 5329, 0}, {'h', 1, 5330, 0}, {'a', 1, 5331, 0}, {'r', 1, 5332, 0},
+            {'o', 1, 5333, 0}, {';', 0, 0, 469}, {';', 0, 0, 470}, {';', 0, 0, 471}, {'o', 1, 5334, 0},
+            {'t', 1, 5335, 0}, {';', 0, 0, 472}, {'f', 1, 5336, 0}, {'r', 1, 5337, 0}, {'r', 1, 5338, 0},
+            {'g', 1, 5339, 0}, {';', 0, 0, 473}, {'r', 1, 5340, 0}, {'t', 1, 5341, 0}, {';', 0, 0, 474},
+            {'t', 1, 5342, 0}, {'e', 1, 5343, 0}, {'o', 1, 5344, 0}, {';', 0, 0, 475}, {'c', 1, 5345, 476},
+            {'o', 1, 5346, 0}, {';', 0, 0, 477}, {'t', 1, 5347, 0}, {'v', 1, 5348, 0}, {'o', 1, 5349, 0},
+            {'t', 1, 5350, 0}, {'o', 1, 5351, 0}, {'r', 1, 5352, 0}, {'y', 3, 5353, 0}, {'1', 2, 5356, 0},
+            {';', 0, 0, 478}, {';', 0, 0, 479}, {'n', 1, 5358, 0}, {';', 0, 0, 480}, {';', 0, 0, 481},
+            {'s', 1, 5359, 0}, {'s', 1, 5360, 0}, {';', 0, 0, 482}, {'l', 1, 5361, 0}, {'v', 1, 5362, 0},
+            {'r', 1, 5363, 0}, {'l', 1, 5364, 0}, {'m', 1, 5365, 0}, {'a', 1, 5366, 0}, {'l', 1, 5367, 0},
+            {'s', 1, 5368, 0}, {'v', 2, 5369, 0}, {'a', 1, 5371, 0}, {'t', 1, 5372, 0}, {'r', 1, 5373, 0},
+            {';', 0, 0, 483}, {'t', 1, 5374, 0}, {';', 0, 0, 484}, {';', 0, 0, 485}, {';', 0, 0, 486},
+            {';', 0, 0, 487}, {'t', 1, 5375, 0}, {'c', 1, 5376, 0}, {'n', 1, 5377, 0}, {'i', 1, 5378, 0},
+            {'l', 1, 5379, 0}, {'i', 1, 5380, 0}, {'g', 1, 5381, 0}, {'i', 1, 5382, 0}, {'g', 1, 5383, 0},
+            {'g', 1, 5384, 0}, {';', 0, 0, 488}, {'g', 1, 5385, 0}, {'s', 1, 5386, 0}, {';', 0, 0, 489},
+            {';', 0, 0, 490}, {'l', 1, 5387, 0}, {';', 0, 0, 491}, {'v', 1, 5388, 0}, {'t', 1, 5389, 0},
+            {'1', 6, 5390, 0}, {'2', 2, 5396, 0}, {'3', 3, 5398, 0}, {'4', 1, 5401, 0}, {'5', 2, 5402, 0},
+            {'7', 1, 5404, 0}, {'l', 1, 5405, 0}, {'n', 1, 5406, 0}, {';', 0, 0, 492}, {'t', 1, 5407, 0},
+            {'a', 2, 5408, 0}, {'v', 1, 5410, 0}, {'c', 1, 5411, 0}, {';', 0, 0, 493}, {';', 0, 0, 494},
+            {'l', 1, 5412, 0}, {'c', 1, 5413, 0}, {'o', 1, 5414, 0}, {';', 0, 0, 495}, {'e', 1, 5415, 0},
+            {'l', 1, 5416, 0}, {';', 0, 0, 496}, {';', 0, 0, 497}, {'p', 1, 5417, 0}, {';', 0, 0, 498},
+            {'q', 1, 5418, 0}, {'m', 1, 5419, 0}, {';', 0, 0, 499}, {'e', 1, 5420, 0}, {';', 0, 0, 500},
+            {';', 0, 0, 501}, {'e', 1, 5421, 0}, {'l', 1, 5422, 0}, {';', 0, 0, 502}, {'r', 1, 5423, 0},
+            {'t', 1, 5424, 0}, {'a', 1, 5425, 0}, {'e', 1, 5426, 0}, {'p', 1, 5427, 0}, {'r', 1, 5428, 0},
+            {'o', 1, 5429, 0}, {'q', 2, 5430, 0}, {'e', 1, 5432, 0}, {'i', 1, 5433, 0}, {'t', 1, 5434, 0},
+            {';', 0, 0, 503}, {';', 0, 0, 504}, {'s', 1, 5435, 0}, {';', 0, 0, 505}, {'l', 1, 5436, 0},
+            {'c', 1, 5437, 0}, {';', 0, 0, 506}, {'c', 1, 5438, 0}, {'w', 1, 5439, 0}, {';', 0, 0, 507},
+            {'c', 1, 5440, 0}, {'t', 1, 5441, 0}, {'i', 1, 5442, 0}, {'o', 1, 5443, 0}, {'a', 1, 5444, 0},
+            {'a', 1, 5445, 0}, {'r', 1, 5446, 0}, {'h', 1, 5447, 0}, {'l', 1, 5448, 0}, {'r', 1, 5449, 0},
+            {';', 0, 0, 508}, {'a', 1, 5450, 0}, {';', 0, 0, 509}, {'s', 1, 5451, 0}, {'o', 1, 5452, 0},
+            {'l', 1, 5453, 0}, {'e', 1, 5454, 0}, {'t', 1, 5455, 0}, {'c', 1, 5456, 510}, {';', 0, 0, 511},
+            {'l', 1, 5457, 512}, {'v', 1, 5458, 0}, {'n', 1, 5459, 0}, {'t', 1, 5460, 0}, {'i', 1, 5461, 0},
+            {'a', 1, 5462, 0}, {'g', 1, 5463, 0}, {'r', 1, 5464, 0}, {'e', 1, 5465, 0}, {'l', 1, 5466, 0},
+            {'p', 1, 5467, 0}, {'h', 1, 5468, 0}, {';', 0, 0, 513}, {'d', 1, 5469, 0}, {'r', 1, 5470, 0},
+            {'n', 2, 5471, 0}, {'o', 1, 5473, 0}, {'a', 1, 5474, 0}, {'g', 1, 5475, 0}, {'r', 1, 5476, 0},
+            {'a', 1, 5477, 0}, {'r', 1, 5478, 0}, {';', 0, 0, 514}, {'n', 1, 5479, 0}, {';', 0, 0, 515},
+            {';', 0, 0, 516}, {'d', 1, 5480, 0}, {'s', 1, 5481, 0}, {';', 0, 0, 517}, {';', 0, 0, 518},
+            {'E', 1, 5482, 0}, {'d', 1, 5483, 0}, {'s', 2, 5484, 0}, {'v', 1, 5486, 0}, {'d', 1, 5487, 0},
+            {'y', 1, 5488, 0}, {';', 0, 0, 519}, {'c', 1, 5489, 0}, {'h', 1, 5490, 0}, {';', 0, 0, 520},
+            {';', 0, 0, 521}, {'c', 1, 5491, 0}, {'y', 1, 5492, 0}, {'a', 2, 5493, 0}, {'i', 1, 5495, 0},
+            {'e', 1, 5496, 0}, {';', 0, 0, 522}, {';', 0, 0, 523}, {';', 0, 0, 524}, {';', 0, 0, 525},
+            {'r', 1, 5497, 0}, {';', 0, 0, 526}, {'i', 1, 5498, 0}, {'r', 1, 5499, 0}, {';', 0, 0, 527},
+            {'t', 1, 5500, 0}, {'p', 1, 5501, 0}, {'a', 1, 5502, 0}, {'d', 1, 5503, 0}, {';', 0, 0, 528},
+            {'d', 1, 5504, 0}, {'l', 1, 5505, 0}, {'o', 1, 5506, 529}, {';', 0, 0, 530}, {'b', 2, 5507, 0},
+            {'f', 1, 5509, 0}, {'h', 1, 5510, 0}, {'l', 1, 5511, 0}, {'p', 1, 5512, 0}, {'s', 1, 5513, 0},
+            {'t', 1, 5514, 0}, {'i', 1, 5515, 0}, {';', 0, 0, 531}, {'s', 1, 5516, 0}, {'r', 1, 5517, 0},
+            {'k', 1, 5518, 0}, {'c', 2, 5519, 0}, {'e', 1, 5521, 0}, {'s', 1, 5522, 0}, {'o', 1, 5523, 0},
+            {'i', 1, 5524, 0}, {'l', 1, 5525, 0}, {';', 0, 0, 532}, {';', 0, 0, 533}, {'o', 2, 5526, 0},
+            {'h', 1, 5528, 0}, {'s', 1, 5529, 0}, {';', 0, 0, 534}, {'a', 1, 5530, 0}, {'h', 1, 5531, 0},
+            {'l', 1, 5532, 0}, {'r', 1, 5533, 0}, {'t', 1, 5534, 0}, {';', 0, 0, 535}, {'l', 1, 5535, 0},
+            {'c', 1, 5536, 0}, {'o', 1, 5537, 0}, {';', 0, 0, 536}, {'e', 1, 5538, 0}, {'a', 1, 5539, 0},
+            {'d', 1, 5540, 0}, {'e', 1, 5541, 0}, {'g', 1, 5542, 0}, {'s', 1, 5543, 0}, {'h', 1, 5544, 0},
+            {'o', 1, 5545, 0}, {'d', 1, 5546, 0}, {'u', 2, 5547, 0}, {'k', 1, 5549, 0}, {';', 0, 0, 537},
+            {'r', 1, 5550, 0}, {'r', 1, 5551, 0}, {'r', 1, 5552, 0}, {'i', 1, 5553, 0}, {'o', 1, 5554, 0},
+            {'s', 1, 5555, 0}, {';', 0, 0, 538}, {'p', 1, 5556, 0}, {';', 0, 0, 539}, {'q', 1, 5557, 0},
+            {'m', 1, 5558, 0}, {'g', 1, 5559, 0}, {'r', 1, 5560, 0}, {'k', 1, 5561, 0}, {'l', 1, 5562, 0},
+            {'m', 1, 5563, 0}, {'r', 1, 5564, 0}, {'a', 1, 5565, 0}, {'r', 1, 5566, 0}, {';', 0, 0, 540},
+            {'u', 1, 5567, 0}, {'m', 1, 5568, 0}, {'s', 1, 5569, 0}, {'a', 1, 5570, 0}, {'n', 1, 5571, 0},
+            {';', 0, 0, 541}, {';', 0, 0, 542}, {'l', 1, 5572, 0}, {'r', 1, 5573, 0}, {'r', 1, 5574, 0},
+            {'r', 2, 5575, 0}, {'i', 1, 5577, 0}, {'u', 1, 5578, 0}, {';', 0, 0, 543}, {';', 0, 0, 544},
+            {'e', 1, 5579, 0}, {'g', 1, 5580, 0}, {';', 0, 0, 545}, {'o', 2, 5581, 0}, {'o', 1, 5583, 0},
+            {';', 0, 0, 546}, {'r', 1, 5584, 0}, {'t', 1, 5585, 0}, {'e', 1, 5586, 0}, {'e', 1, 5587, 0},
+            {'r', 1, 5588, 0}, {'e', 1, 5589, 0}, {'a', 1, 5590, 0}, {';', 0, 0, 547}, {'e', 1, 5591, 0},
+            {'f', 1, 5592, 0}, {'s', 1, 5593, 0}, {'h', 1, 5594, 0}, {'t', 1, 5595, 0}, {';', 0, 0, 548},
+            {'t', 1, 5596, 0}, {';', 0, 0, 549}, {';', 0, 0, 550}, {';', 0, 0, 551}, {'e', 1, 5597, 0},
+            {'t', 1, 5598, 0}, {'e', 1, 5599, 0}, {'m', 1, 5600, 0}, {'h', 1, 5601, 0}, {'u', 1, 5602, 0},
+            {'o', 1, 5603, 552}, {'s', 1, 5604, 0}, {'i', 1, 5605, 0}, {'o', 1, 5606, 0}, {'s', 3, 5607, 0},
+            {';', 0, 0, 553}, {';', 0, 0, 554}, {'u', 1, 5610, 0}, {'l', 1, 5611, 0}, {';', 0, 0, 555},
+            {';', 0, 0, 556}, {'o', 1, 5612, 0}, {'i', 1, 5613, 0}, {'p', 1, 5614, 0}, {';', 0, 0, 557},
+            {'t', 2, 5615, 0}, {';', 0, 0, 558}, {'h', 1, 5617, 0}, {'s', 1, 5618, 0}, {'s', 1, 5619, 0},
+            {'a', 1, 5620, 0}, {'t', 1, 5621, 0}, {';', 0, 0, 559}, {';', 0, 0, 560}, {'d', 1, 5622, 0},
+            {'s', 1, 5623, 0}, {'r', 1, 5624, 0}, {'r', 2, 5625, 0}, {';', 0, 0, 561}, {'p', 2, 5627, 0},
+            {';', 0, 0, 562}, {'o', 1, 5629, 0}, {'i', 1, 5630, 0}, {'g', 2, 5631, 0}, {';', 0, 0, 563},
+            {'h', 1, 5633, 0}, {'r', 1, 5634, 0}, {'h', 1, 5635, 0}, {'r', 2, 5636, 0}, {'t', 1, 5638, 0},
+            {'i', 1, 5639, 0}, {'a', 1, 5640, 0}, {'m', 1, 5641, 0}, {'s', 1, 5642, 0}, {';', 0, 0, 564},
+            {'q', 1, 5643, 0}, {'s', 1, 5644, 0}, {';', 0, 0, 565}, {'m', 1, 5645, 0}, {';', 0, 0, 566},
+            {'r', 1, 5646, 0}, {'r', 1, 5647, 0}, {'r', 1, 5648, 0}, {';', 0, 0, 567}, {';', 0, 0, 568},
+            {'r', 1, 5649, 0}, {'r', 1, 5650, 0}, {';', 0, 0, 569}, {'t', 2, 5651, 0}, {';', 0, 0, 570},
+            {'q', 1, 5653, 0}, {'s', 1, 5654, 0}, {';', 0, 0, 571}, {'s', 1, 5655, 0}, {'m', 1, 5656, 0},
+            {'i', 2, 5657, 0}, {';', 0, 0, 572}, {';', 0, 0, 573}, {'n', 4, 5659, 0}, {'i', 2, 5663, 0},
+            {';', 0, 0, 574}, {'a', 1, 5665, 0}, {'s', 1, 5666, 0}, {'t', 1, 5667, 0}, {'i', 1, 5668, 0},
+            {'u', 1, 5669, 0}, {';', 0, 0, 575}, {'c', 2, 5670, 0}, {'r', 1, 5672, 0}, {'r', 3, 5673, 0},
+            {'h', 1, 5676, 0}, {'i', 2, 5677, 0}, {'u', 1, 5679, 0}, {';', 0, 0, 576}, {';', 0, 0, 577},
+            {'r', 1, 5680, 0}, {';', 0, 0, 578}, {'e', 2, 5681, 0}, {'d', 1, 5683, 0}, {'r', 1, 5684, 0},
+            {'u', 2, 5685, 0}, {';', 0, 0, 579}, {'E', 1, 5687, 0}, {'e', 1, 5688, 0}, {'s', 1, 5689, 0},
+            {'c', 2, 5690, 0}, {';', 0, 0, 580}, {'E', 1, 5692, 0}, {'e', 1, 5693, 0}, {'s', 1, 5694, 0},
+            {';', 0, 0, 581}, {'d', 1, 5695, 0}, {';', 0, 0, 582}, {'a', 1, 5696, 0}, {'r', 1, 5697, 0},
+            {'p', 1, 5698, 0}, {'s', 1, 5699, 0}, {'r', 1, 5700, 0}, {';', 0, 0, 583}, {'s', 1, 5701, 0},
+            {';', 0, 0, 584}, {';', 0, 0, 585}, {'f', 1, 5702, 0}, {'r', 1, 5703, 0}, {';', 0, 0, 586},
+            {';', 0, 0, 587}, {'r', 1, 5704, 0}, {'r', 1, 5705, 0}, {'r', 1, 5706, 0}, {'m', 1, 5707, 0},
+            {'r', 1, 5708, 0}, {'h', 1, 5709, 0}, {'r', 2, 5710, 0}, {'a', 1, 5712, 0}, {'t', 1, 5713, 0},
+            {';', 0, 0, 588}, {';', 0, 0, 589}, {'c', 1, 5714, 590}, {'h', 1, 5715, 0}, {'a', 1, 5716, 0},
+            {';', 0, 0, 591}, {';', 0, 0, 592}, {'l', 1, 5717, 0}, {'g', 1, 5718, 0}, {'r', 1, 5719, 0},
+            {';', 0, 0, 593}, {'v', 1, 5720, 0}, {'r', 1, 5721, 0}, {';', 0, 0, 594}, {'r', 1, 5722, 0},
+            {'r', 1, 5723, 0}, {'o', 1, 5724, 0}, {'e', 1, 5725, 0}, {'r', 1, 5726, 0}, {'a', 1, 5727, 0},
+            {'r', 1, 5728, 0}, {';', 0, 0, 595}, {'u', 1, 5729, 0}, {';', 0, 0, 596}, {';', 0, 0, 597},
+            {'p', 1, 5730, 0}, {'s', 1, 5731, 0}, {'r', 1, 5732, 0}, {'r', 2, 5733, 0}, {';', 0, 0, 598},
+            {';', 0, 0, 599}, {'o', 1, 5735, 0}, {';', 0, 0, 600}, {'o', 1, 5736, 0}, {';', 0, 0, 601},
+            {'s', 1, 5737, 0}, {';', 0, 0, 602}, {'d', 1, 5738, 0}, {'e', 1, 5739, 0}, {';', 0, 0, 603},
+            {'r', 1, 5740, 0}, {';', 0, 0, 604}, {'l', 1, 5741, 0}, {'i', 1, 5742, 0}, {'l', 1, 5743, 0},
+            {';', 0, 0, 605}, {'n', 1, 5744, 0}, {'o', 1, 5745, 0}, {'i', 1, 5746, 0}, {';', 0, 0, 606},
+            {'e', 1, 5747, 0}, {';', 0, 0, 607}, {'a', 1, 5748, 0}, {'e', 1, 5749, 0}, {'h', 1, 5750, 0},
+            {'c', 1, 5751, 0}, {'k', 1, 5752, 0}, {';', 0, 0, 608}, {'a', 1, 5753, 0}, {'b', 1, 5754, 0},
+            {'c', 1, 5755, 0}, {'d', 2, 5756, 0}, {'e', 1, 5758, 0}, {'m', 1, 5759, 0}, {'s', 1, 5760, 0},
+            {'t', 1, 5761, 0}, {'t', 1, 5762, 0}, {';', 0, 0, 609}, {'d', 1, 5763, 610}, {';', 0, 0, 611},
+            {'e', 1, 5764, 0}, {';', 0, 0, 612}, {'a', 1, 5765, 0}, {'c', 1, 5766, 0}, {'e', 1, 5767, 0},
+            {'n', 3, 5768, 0}, {'s', 1, 5771, 0}, {'e', 2, 5772, 0}, {';', 0, 0, 613}, {'p', 1, 5774, 0},
+            {'i', 1, 5775, 0}, {';', 0, 0, 614}, {'a', 1, 5776, 0}, {'l', 1, 5777, 0}, {'s', 1, 5778, 0},
+            {';', 0, 0, 615}, {'t', 1, 5779, 0}, {'m', 1, 5780, 0}, {'e', 1, 5781, 0}, {';', 0, 0, 616},
+            {'s', 1, 5782, 0}, {';', 0, 0, 617}, {';', 0, 0, 618}, {'m', 1, 5783, 0}, {';', 0, 0, 619},
+            {'e', 1, 5784, 0}, {'i', 1, 5785, 0}, {'t', 2, 5786, 0}, {';', 0, 0, 620}, {'r', 1, 5788, 0},
+            {';', 0, 0, 621}, {'i', 1, 5789, 0}, {'r', 1, 5790, 0}, {';', 0, 0, 622}, {';', 0, 0, 623},
+            {'t', 1, 5791, 0}, {'c', 1, 5792, 0}, {'p', 1, 5793, 0}, {';', 0, 0, 624}, {'d', 1, 5794, 0},
+            {'e', 1, 5795, 0}, {'l', 1, 5796, 0}, {'o', 1, 5797, 625}, {';', 0, 0, 626}, {'a', 1, 5798, 0},
+            {'b', 2, 5799, 0}, {'c', 1, 5801, 0}, {'f', 1, 5802, 0}, {'h', 1, 5803, 0}, {'l', 1, 5804, 0},
+            {'p', 1, 5805, 0}, {'s', 1, 5806, 0}, {'t', 1, 5807, 0}, {'w', 1, 5808, 0}, {'i', 1, 5809, 0},
+            {'o', 2, 5810, 0}, {'r', 1, 5812, 0}, {'k', 1, 5813, 0}, {'c', 2, 5814, 0}, {'e', 1, 5816, 0},
+            {'s', 1, 5817, 0}, {'o', 1, 5818, 0}, {'i', 1, 5819, 0}, {'l', 1, 5820, 0}, {';', 0, 0, 627},
+            {';', 0, 0, 628}, {'h', 1, 5821, 0}, {'o', 2, 5822, 0}, {';', 0, 0, 629}, {';', 0, 0, 630},
+            {'i', 1, 5824, 0}, {'p', 1, 5825, 0}, {'s', 1, 5826, 0}, {';', 0, 0, 631}, {'h', 1, 5827, 0},
+            {'o', 1, 5828, 0}, {'d', 1, 5829, 0}, {'u', 2, 5830, 0}, {';', 0, 0, 632}, {'t', 6, 5832, 0},
+            {';', 0, 0, 633}, {'n', 1, 5838, 0}, {'r', 1, 5839, 0}, {'r', 1, 5840, 0}, {'s', 1, 5841, 0},
+            {'d', 1, 5842, 0}, {'g', 1, 5843, 0}, {'r', 1, 5844, 0}, {'k', 1, 5845, 0}, {'r', 1, 5846, 0},
+            {';', 0, 0, 634}, {'u', 1, 5847, 0}, {'m', 1, 5848, 0}, {';', 0, 0, 635}, {'g', 1, 5849, 0},
+            {'l', 1, 5850, 0}, {'r', 1, 5851, 0}, {'u', 1, 5852, 0}, {';', 0, 0, 636}, {';', 0, 0, 637},
+            {'o', 2, 5853, 0}, {'e', 1, 5855, 0}, {'e', 1, 5856, 0}, {';', 0, 0, 638}, {'e', 1, 5857, 0},
+            {'f', 1, 5858, 0}, {'l', 1, 5859, 0}, {'h', 1, 5860, 0}, {'t', 1, 5861, 0}, {'o', 1, 5862, 0},
+            {';', 0, 0, 639}, {'o', 1, 5863, 0}, {'e', 1, 5864, 0}, {'i', 1, 5865, 0}, {'c', 1, 5866, 0},
+            {';', 0, 0, 640}, {'p', 1, 5867, 0}, {'i', 1, 5868, 0}, {'l', 1, 5869, 0}, {'m', 1, 5870, 0},
+            {';', 0, 0, 641}, {'b', 1, 5871, 0}, {'e', 1, 5872, 0}, {'r', 1, 5873, 0}, {'h', 1, 5874, 0},
+            {'r', 2, 5875, 0}, {';', 0, 0, 642}, {';', 0, 0, 643}, {'a', 1, 5877, 0}, {'i', 1, 5878, 0},
+            {'n', 1, 5879, 0}, {';', 0, 0, 644}, {'w', 1, 5880, 0}, {'p', 1, 5881, 0}, {'c', 1, 5882, 0},
+            {';', 0, 0, 645}, {'t', 2, 5883, 0}, {'a', 3, 5885, 0}, {'o', 1, 5888, 0}, {';', 0, 0, 646},
+            {'q', 1, 5889, 0}, {';', 0, 0, 647}, {'E', 1, 5890, 0}, {';', 0, 0, 648}, {'E', 1, 5891, 0},
+            {'e', 1, 5892, 0}, {'l', 1, 5893, 0}, {'a', 1, 5894, 0}, {'r', 1, 5895, 0}, {'l', 1, 5896, 0},
+            {'h', 1, 5897, 0}, {'a', 1, 5898, 0}, {';', 0, 0, 649}, {'e', 1, 5899, 0}, {';', 0, 0, 650},
+            {'s', 1, 5900, 0}, {'c', 1, 5901, 0}, {';', 0, 0, 651}, {'a', 1, 5902, 0}, {';', 0, 0, 652},
+            {'e', 1, 5903, 0}, {';', 0, 0, 653}, {'p', 2, 5904, 0}, {'p', 2, 5906, 0}, {'b', 3, 5908, 0},
+            {'p', 3, 5911, 0}, {'r', 2, 5914, 0}, {';', 0, 0, 654}, {'r', 1, 5916, 0}, {';', 0, 0, 655},
+            {'m', 1, 5917, 0}, {'l', 1, 5918, 0}, {'r', 1, 5919, 0}, {';', 0, 0, 656}, {'f', 1, 5920, 0},
+            {'i', 1, 5921, 0}, {'s', 1, 5922, 0}, {';', 0, 0, 657}, {'o', 1, 5923, 0}, {';', 0, 0, 658},
+            {'d', 1, 5924, 0}, {'u', 1, 5925, 0}, {'E', 1, 5926, 0}, {'e', 1, 5927, 0}, {'l', 1, 5928, 0},
+            {'a', 1, 5929, 0}, {'e', 1, 5930, 0}, {'i', 1, 5931, 0}, {'u', 2, 5932, 0}, {';', 0, 0, 659},
+            {'a', 1, 5934, 0}, {'c', 1, 5935, 0}, {'e', 1, 5936, 0}, {'n', 3, 5937, 0}, {'s', 1, 5940, 0},
+            {';', 0, 0, 660}, {';', 0, 0, 661}, {';', 0, 0, 662}, {';', 0, 0, 663}, {';', 0, 0, 664},
+            {'o', 1, 5941, 0}, {'s', 1, 5942, 0}, {';', 0, 0, 665}, {'d', 1, 5943, 0}, {'s', 2, 5944, 0},
+            {'a', 1, 5946, 0}, {'u', 1, 5947, 0}, {'E', 1, 5948, 0}, {'e', 1, 5949, 0}, {'l', 1, 5950, 0},
+            {'e', 1, 5951, 0}, {'i', 1, 5952, 0}, {'u', 2, 5953, 0}, {'r', 1, 5955, 0}, {'h', 1, 5956, 0},
+            {'r', 2, 5957, 0}, {'a', 1, 5959, 0}, {'g', 1, 5960, 666}, {'e', 1, 5961, 0}, {';', 0, 0, 667},
+            {'o', 1, 5962, 0}, {'i', 1, 5963, 0}, {';', 0, 0, 668}, {'e', 1, 5964, 0}, {'e', 2, 5965, 0},
+            {'a', 3, 5967, 0}, {'k', 2, 5970, 0}, {'s', 1, 5972, 0}, {'p', 1, 5973, 0}, {'i', 1, 5974, 0},
+            {'n', 1, 5975, 669}, {'e', 1, 5976, 0}, {'s', 3, 5977, 670}, {';', 0, 0, 671}, {';', 0, 0, 672},
+            {'o', 1, 5980, 0}, {'i', 1, 5981, 0}, {';', 0, 0, 673}, {'o', 1, 5982, 0}, {';', 0, 0, 674},
+            {'m', 1, 5983, 0}, {'e', 1, 5984, 0}, {'n', 1, 5985, 0}, {'o', 1, 5986, 0}, {';', 0, 0, 675},
+            {'i', 1, 5987, 0}, {'l', 1, 5988, 0}, {'b', 1, 5989, 0}, {'i', 1, 5990, 0}, {'z', 1, 5991, 0},
+            {';', 0, 0, 676}, {';', 0, 0, 677}, {'y', 1, 5992, 0}, {'o', 1, 5993, 0}, {'t', 1, 5994, 0},
+            {'e', 1, 5995, 0}, {';', 0, 0, 678}, {';', 0, 0, 679}, {'t', 1, 5996, 0}, {';', 0, 0, 680},
+            {'y', 1, 5997, 0}, {'v', 1, 5998, 0}, {'c', 1, 5999, 681}, {'r', 1, 6000, 0}, {'a', 1, 6001, 0},
+            {'r', 1, 6002, 0}, {'h', 1, 6003, 0}, {'v', 1, 6004, 0}, {'l', 1, 6005, 0}, {'r', 1, 6006, 0},
+            {'k', 1, 6007, 0}, {'r', 1, 6008, 0}, {'o', 1, 6009, 0}, {'i', 1, 6010, 0}, {'r', 1, 6011, 0},
+            {'n', 1, 6012, 0}, {';', 0, 0, 682}, {'r', 1, 6013, 0}, {'w', 1, 6014, 0}, {'r', 1, 6015, 0},
+            {'s', 1, 6016, 0}, {';', 0, 0, 683}, {'h', 1, 6017, 0}, {'l', 1, 6018, 0}, {'a', 1, 6019, 0},
+            {'r', 1, 6020, 0}, {'o', 1, 6021, 0}, {'g', 1, 6022, 0}, {'i', 1, 6023, 0}, {';', 0, 0, 684},
+            {'t', 1, 6024, 0}, {'d', 1, 6025, 0}, {';', 0, 0, 685}, {'f', 1, 6026, 0}, {'r', 1, 6027, 0},
+            {';', 0, 0, 686}, {'g', 1, 6028, 0}, {';', 0, 0, 687}, {';', 0, 0, 688}, {'v', 1, 6029, 0},
+            {'h', 1, 6030, 0}, {'r', 1, 6031, 0}, {'p', 1, 6032, 0}, {'a', 1, 6033, 0}, {'o', 1, 6034, 0},
+            {'h', 1, 6035, 0}, {'i', 1, 6036, 0}, {'r', 1, 6037, 0}, {';', 0, 0, 689}, {'h', 1, 6038, 0},
+            {'i', 1, 6039, 0}, {'u', 2, 6040, 0}, {'h', 1, 6042, 0}, {'r', 1, 6043, 0}, {'h', 1, 6044, 0},
+            {'a', 1, 6045, 0}, {'q', 1, 6046, 0}, {'i', 1, 6047, 0}, {'a', 1, 6048, 0}, {';', 0, 0, 690},
+            {'i', 1, 6049, 0}, {'b', 1, 6050, 0}, {'p', 1, 6051, 0}, {';', 0, 0, 691}, {'p', 1, 6052, 0},
+            {'i', 1, 6053, 0}, {';', 0, 0, 692}, {'n', 2, 6054, 0}, {'n', 2, 6056, 0}, {'z', 1, 6058, 0},
+            {'c', 1, 6059, 0}, {'a', 1, 6060, 0}, {'e', 2, 6061, 0}, {'r', 1, 6063, 0}, {';', 0, 0, 693},
+            {'t', 1, 6064, 0}, {';', 0, 0, 694}, {';', 0, 0, 695}, {'c', 1, 6065, 0}, {';', 0, 0, 696},
+            {'i', 1, 6066, 0}, {'r', 1, 6067, 0}, {'r', 1, 6068, 0}, {'r', 1, 6069, 0}, {'r', 1, 6070, 0},
+            {';', 0, 0, 697}, {';', 0, 0, 698}, {'t', 1, 6071, 0}, {';', 0, 0, 699}, {'u', 1, 6072, 0},
+            {'m', 1, 6073, 0}, {'r', 1, 6074, 0}, {'r', 1, 6075, 0}, {';', 0, 0, 700}, {'u', 1, 6076, 0},
+            {'u', 1, 6077, 0}, {'i', 1, 6078, 0}, {';', 0, 0, 701}, {'g', 1, 6079, 0}, {'t', 1, 6080, 0},
+            {';', 0, 0, 702}, {'c', 1, 6081, 0}, {';', 0, 0, 703}, {';', 0, 0, 704}, {';', 0, 0, 705},
+            {';', 0, 0, 706}, {';', 0, 0, 707}, {'t', 1, 6082, 0}, {'o', 1, 6083, 0}, {';', 0, 0, 708},
+            {'r', 1, 6084, 0}, {';', 0, 0, 709}, {';', 0, 0, 710}, {'a', 1, 6085, 0}, {';', 0, 0, 711},
+            {';', 0, 0, 712}, {';', 0, 0, 713}, {';', 0, 0, 714}, {'e', 1, 6086, 715}, {'e', 1, 6087, 0},
+            {';', 0, 0, 716}, {'e', 1, 6088, 717}, {';', 0, 0, 718}, {';', 0, 0, 719}, {';', 0, 0, 720},
+            {'F', 1, 6089, 0}, {';', 0, 0, 721}, {'n', 1, 6090, 0}, {'e', 1, 6091, 722}, {'l', 1, 6092, 0},
+            {'d', 1, 6093, 0}, {'s', 1, 6094, 0}, {'u', 1, 6095, 0}, {';', 0, 0, 723}, {'q', 1, 6096, 0},
+            {'e', 1, 6097, 0}, {'a', 1, 6098, 0}, {'y', 1, 6099, 0}, {'n', 1, 6100, 0}, {'l', 1, 6101, 724},
+            {';', 0, 0, 725}, {'n', 1, 6102, 0}, {'l', 1, 6103, 0}, {'r', 1, 6104, 0}, {'e', 4, 6105, 0},
+            {'w', 1, 6109, 0}, {'C', 1, 6110, 0}, {';', 0, 0, 726}, {'e', 1, 6111, 0}, {'u', 1, 6112, 0},
+            {'t', 1, 6113, 0}, {'u', 1, 6114, 0}, {'d', 1, 6115, 0}, {'e', 1, 6116, 0}, {';', 0, 0, 727},
+            {'p', 1, 6117, 0}, {'a', 1, 6118, 0}, {'r', 1, 6119, 0}, {';', 0, 0, 728}, {'n', 1, 6120, 0},
+            {';', 0, 0, 729}, {'i', 1, 6121, 0}, {'n', 1, 6122, 0}, {'r', 1, 6123, 0}, {'t', 1, 6124, 0},
+            {'u', 1, 6125, 0}, {'e', 6, 6126, 0}, {'r', 1, 6132, 0}, {'r', 1, 6133, 0}, {'e', 1, 6134, 0},
+            {'i', 1, 6135, 0}, {'e', 1, 6136, 0}, {'r', 1, 6137, 0}, {'k', 1, 6138, 0}, {'e', 1, 6139, 730},
+            {'n', 1, 6140, 0}, {';', 0, 0, 731}, {'e', 1, 6141, 732}, {'n', 1, 6142, 0}, {';', 0, 0, 733},
+            {'S', 1, 6143, 0}, {'V', 1, 6144, 0}, {';', 0, 0, 734}, {'o', 1, 6145, 0}, {';', 0, 0, 735},
+            {'T', 1, 6146, 0}, {'i', 1, 6147, 0}, {'s', 1, 6148, 0}, {'e', 1, 6149, 0}, {'d', 2, 6150, 0},
+            {'l', 1, 6152, 0}, {'e', 1, 6153, 0}, {';', 0, 0, 736}, {'d', 1, 6154, 0}, {'e', 1, 6155, 0},
+            {'l', 1, 6156, 0}, {';', 0, 0, 737}, {'e', 1, 6157, 0}, {'y', 1, 6158, 0}, {';', 0, 0, 738},
+            {';', 0, 0, 739}, {'r', 1, 6159, 0}, {'o', 1, 6160, 0}, {'k', 1, 6161, 0}, {'o', 1, 6162, 0},
+            {'q', 1, 6163, 0}, {';', 0, 0, 740}, {'e', 1, 6164, 741}, {';', 0, 0, 742}, {'e', 1, 6165, 743},
+            {';', 0, 0, 744}, {'n', 1, 6166, 0}, {'e', 1, 6167, 0}, {'r', 1, 6168, 0}, {'s', 1, 6169, 0},
+            {'i', 1, 6170, 0}, {';', 0, 0, 745}, {'e', 1, 6171, 0}, {';', 0, 0, 746}, {';', 0, 0, 747},
+            {'y', 1, 6172, 0}, {';', 0, 0, 748}, {';', 0, 0, 749}, {'l', 1, 6173, 0}, {'e', 1, 6174, 0},
+            {'a', 1, 6175, 0}, {'c', 1, 6176, 0}, {'n', 1, 6177, 0}, {'l', 1, 6178, 0}, {'n', 1, 6179, 0},
+            {'r', 1, 6180, 0}, {'e', 1, 6181, 0}, {'o', 2, 6182, 0}, {'l', 1, 6184, 0}, {'i', 1, 6185, 0},
+            {'e', 1, 6186, 0}, {'r', 1, 6187, 0}, {'p', 3, 6188, 0}, {'e', 1, 6191, 0}, {'r', 1, 6192, 0},
+            {'i', 1, 6193, 0}, {'q', 1, 6194, 0}, {'u', 1, 6195, 0}, {'r', 1, 6196, 0}, {'e', 1, 6197, 0},
+            {'l', 1, 6198, 0}, {'i', 1, 6199, 0}, {'a', 1, 6200, 0}, {'t', 1, 6201, 0}, {'e', 1, 6202, 0},
+            {'i', 1, 6203, 0}, {'e', 1, 6204, 0}, {'i', 1, 6205, 0}, {'L', 1, 6206, 0}, {'R', 1, 6207, 0},
+            {'k', 1, 6208, 0}, {'m', 1, 6209, 0}, {'n', 1, 6210, 0}, {'P', 1, 6211, 0}, {'e', 1, 6212, 0},
+            {'n', 1, 6213, 0}, {'l', 1, 6214, 0}, {'i', 1, 6215, 0}, {'d', 2, 6216, 0}, {'n', 1, 6218, 0},
+            {'a', 1, 6219, 0}, {'e', 1, 6220, 0}, {'n', 1, 6221, 0}, {'p', 1, 6222, 0}, {'u', 1, 6223, 0},
+            {'e', 1, 6224, 0}, {'u', 1, 6225, 0}, {'i', 1, 6226, 0}, {'e', 1, 6227, 0}, {'m', 1, 6228, 0},
+            {'f', 1, 6229, 0}, {'s', 1, 6230, 0}, {'s', 1, 6231, 0}, {'e', 1, 6232, 0}, {'v', 1, 6233, 0},
+            {'g', 1, 6234, 0}, {'u', 1, 6235, 0}, {'b', 1, 6236, 0}, {'c', 1, 6237, 0}, {'p', 1, 6238, 0},
+            {'l', 1, 6239, 0}, {'r', 1, 6240, 0}, {'e', 1, 6241, 750}, {';', 0, 0, 751}, {'e', 1, 6242, 752},
+            {';', 0, 0, 753}, {'c', 1, 6243, 0}, {'e', 1, 6244, 754}, {';', 0, 0, 755}, {';', 0, 0, 756},
+            {'o', 1, 6245, 0}, {'u', 1, 6246, 0}, {'h', 1, 6247, 757}, {'e', 1, 6248, 758}, {'s', 1, 6249, 0},
+            {'a', 1, 6250, 0}, {'r', 1, 6251, 0}, {'a', 1, 6252, 0}, {'a', 1, 6253, 0}, {'i', 1, 6254, 0},
+            {'a', 1, 6255, 0}, {'d', 1, 6256, 0}, {';', 0, 0, 759}, {'c', 1, 6257, 0}, {'r', 1, 6258, 0},
+            {';', 0, 0, 760}, {'e', 1, 6259, 0}, {'l', 1, 6260, 0}, {'n', 1, 6261, 0}, {'l', 1, 6262, 0},
+            {'s', 1, 6263, 0}, {'A', 2, 6264, 0}, {'C', 1, 6266, 0}, {'D', 1, 6267, 0}, {'F', 1, 6268, 0},
+            {'T', 2, 6269, 0}, {'U', 1, 6271, 0}, {'V', 1, 6272, 0}, {'a', 1, 6273, 0}, {'I', 1, 6274, 0},
+            {'t', 1, 6275, 0}, {'e', 1, 6276, 0}, {'y', 1, 6277, 0}, {'y', 1, 6278, 0}, {'e', 1, 6279, 0},
+            {'n', 1, 6280, 0}, {'l', 1, 6281, 0}, {';', 0, 0, 761}, {'D', 1, 6282, 0}, {'L', 1, 6283, 0},
+            {'R', 1, 6284, 0}, {'U', 1, 6285, 0}, {';', 0, 0, 762}, {'C', 1, 6286, 0}, {'e', 4, 6287, 0},
+            {'t', 2, 6291, 0}, {'e', 1, 6293, 0}, {'h', 1, 6294, 0}, {'s', 1, 6295, 0}, {'t', 1, 6296, 0},
+            {';', 0, 0, 763}, {';', 0, 0, 764}, {';', 0, 0, 765}, {'n', 1, 6297, 0}, {'l', 1, 6298, 0},
+            {'f', 1, 6299, 0}, {';', 0, 0, 766}, {'S', 1, 6300, 0}, {'p', 1, 6301, 0}, {';', 0, 0, 767},
+            {'E', 1, 6302, 0}, {'F', 1, 6303, 0}, {'T', 1, 6304, 0}, {'e', 1, 6305, 0}, {'k', 1, 6306, 0},
+            {'e', 1, 6307, 768}, {'c', 1, 6308, 0}, {';', 0, 0, 769}, {'e', 1, 6309, 0}, {';', 0, 0, 770},
+            {'c', 1, 6310, 0}, {'e', 1, 6311, 771}, {';', 0, 0, 772}, {'B', 2, 6312, 0}, {'P', 1, 6314, 0},
+            {';', 0, 0, 773}, {'P', 1, 6315, 0}, {';', 0, 0, 774}, {'o', 1, 6316, 0}, {'n', 1, 6317, 0},
+            {'i', 1, 6318, 0}, {';', 0, 0, 775}, {'A', 1, 6319, 0}, {'o', 1, 6320, 0}, {'n', 1, 6321, 0},
+            {'L', 1, 6322, 0}, {'R', 1, 6323, 0}, {'o', 1, 6324, 0}, {';', 0, 0, 776}, {'e', 1, 6325, 0},
+            {';', 0, 0, 777}, {';', 0, 0, 778}, {'l', 1, 6326, 0}, {'r', 1, 6327, 0}, {'c', 1, 6328, 0},
+            {'h', 1, 6329, 0}, {'h', 1, 6330, 0}, {';', 0, 0, 779}, {';', 0, 0, 780}, {'e', 1, 6331, 781},
+            {';', 0, 0, 782}, {'e', 1, 6332, 0}, {'n', 1, 6333, 0}, {'i', 1, 6334, 0}, {'e', 1, 6335, 783},
+            {'e', 1, 6336, 0}, {';', 0, 0, 784}, {';', 0, 0, 785}, {';', 0, 0, 786}, {'e', 1, 6337, 787},
+            {'y', 1, 6338, 0}, {';', 0, 0, 788}, {';', 0, 0, 789}, {';', 0, 0, 790}, {';', 0, 0, 791},
+            {'d', 1, 6339, 0}, {'o', 1, 6340, 0}, {';', 0, 0, 792}, {'d', 2, 6341, 0}, {';', 0, 0, 793},
+            {'v', 1, 6343, 0}, {'h', 1, 6344, 0}, {';', 0, 0, 794}, {'r', 1, 6345, 0}, {';', 0, 0, 795},
+            {'r', 1, 6346, 0}, {'x', 2, 6347, 0}, {';', 0, 0, 796}, {';', 0, 0, 797}, {'e', 1, 6349, 0},
+            {'e', 1, 6350, 798}, {'i', 1, 6351, 0}, {';', 0, 0, 799}, {'o', 1, 6352, 0}, {'p', 1, 6353, 0},
+            {'r', 1, 6354, 0}, {'i', 1, 6355, 0}, {'e', 1, 6356, 0}, {'d', 2, 6357, 0}, {'b', 1, 6359, 0},
+            {';', 0, 0, 800}, {';', 0, 0, 801}, {'s', 2, 6360, 0}, {'y', 1, 6362, 0}, {';', 0, 0, 802},
+            {'u', 1, 6363, 0}, {'e', 1, 6364, 0}, {'p', 1, 6365, 0}, {'r', 1, 6366, 0}, {'p', 1, 6367, 0},
+            {'o', 1, 6368, 0}, {'l', 1, 6369, 0}, {'i', 1, 6370, 0}, {'c', 1, 6371, 0}, {'a', 1, 6372, 0},
+            {'i', 1, 6373, 0}, {'l', 1, 6374, 0}, {'e', 1, 6375, 0}, {'d', 1, 6376, 0}, {'w', 1, 6377, 0},
+            {'l', 1, 6378, 0}, {'s', 1, 6379, 0}, {'t', 1, 6380, 0}, {';', 0, 0, 803}, {';', 0, 0, 804},
+            {';', 0, 0, 805}, {';', 0, 0, 806}, {';', 0, 0, 807}, {'i', 1, 6381, 0}, {'m', 1, 6382, 0},
+            {'e', 1, 6383, 0}, {';', 0, 0, 808}, {';', 0, 0, 809}, {';', 0, 0, 810}, {';', 0, 0, 811},
+            {';', 0, 0, 812}, {';', 0, 0, 813}, {';', 0, 0, 814}, {';', 0, 0, 815}, {';', 0, 0, 816},
+            {';', 0, 0, 817}, {';', 0, 0, 818}, {';', 0, 0, 819}, {';', 0, 0, 820}, {';', 0, 0, 821},
+            {';', 0, 0, 822}, {';', 0, 0, 823}, {';', 0, 0, 824}, {';', 0, 0, 825}, {'x', 1, 6384, 0},
+            {';', 0, 0, 826}, {';', 0, 0, 827}, {';', 0, 0, 828}, {';', 0, 0, 829}, {';', 0, 0, 830},
+            {';', 0, 0, 831}, {';', 0, 0, 832}, {';', 0, 0, 833}, {'n', 1, 6385, 0}, {'u', 1, 6386, 0},
+            {'m', 1, 6387, 0}, {';', 0, 0, 834}, {';', 0, 0, 835}, {';', 0, 0, 836}, {';', 0, 0, 837},
+            {';', 0, 0, 838}, {';', 0, 0, 839}, {';', 0, 0, 840}, {';', 0, 0, 841}, {';', 0, 0, 842},
+            {';', 0, 0, 843}, {'e', 1, 6388, 0}, {';', 0, 0, 844}, {'r', 1, 6389, 845}, {';', 0, 0, 846},
+            {';', 0, 0, 847}, {';', 0, 0, 848}, {'s', 1, 6390, 0}, {'t', 1, 6391, 0}, {';', 0, 0, 849},
+            {';', 0, 0, 850}, {'q', 1, 6392, 0}, {'e', 1, 6393, 0}, {'d', 1, 6394, 0}, {'c', 1, 6395, 0},
+            {'p', 1, 6396, 0}, {'p', 1, 6397, 0}, {'t', 1, 6398, 0}, {';', 0, 0, 851}, {';', 0, 0, 852},
+            {';', 0, 0, 853}, {'n', 1, 6399, 0}, {'l', 1, 6400, 854}, {';', 0, 0, 855}, {';', 0, 0, 856},
+            {'s', 1, 6401, 0}, {';', 0, 0, 857}, {'y', 1, 6402, 0}, {'r', 1, 6403, 0}, {';', 0, 0, 858},
+            {'m', 1, 6404, 0}, {'q', 1, 6405, 0}, {'e', 2, 6406, 0}, {'i', 1, 6408, 0}, {'d', 1, 6409, 0},
+            {'i', 1, 6410, 0}, {';', 0, 0, 859}, {'u', 1, 6411, 0}, {';', 0, 0, 860}, {'e', 2, 6412, 0},
+            {';', 0, 0, 861}, {'t', 1, 6414, 0}, {'n', 1, 6415, 0}, {'e', 2, 6416, 0}, {'o', 1, 6418, 0},
+            {'t', 1, 6419, 0}, {'d', 1, 6420, 0}, {'r', 1, 6421, 0}, {';', 0, 0, 862}, {';', 0, 0, 863},
+            {';', 0, 0, 864}, {';', 0, 0, 865}, {';', 0, 0, 866}, {'r', 2, 6422, 0}, {';', 0, 0, 867},
+            {';', 0, 0, 868}, {'r', 2, 6424, 0}, {'c', 1, 6426, 0}, {'p', 1, 6427, 0}, {'p', 1, 6428, 0},
+            {'t', 1, 6429, 0}, {';', 0, 0, 869}, {'r', 2, 6430, 0}, {'e', 1, 6432, 0}, {'v', 1, 6433, 0},
+            {'w', 1, 6434, 0}, {'n', 1, 6435, 870}, {'a', 1, 6436, 0}, {';', 0, 0, 871}, {';', 0, 0, 872},
+            {'i', 1, 6437, 0}, {';', 0, 0, 873}, {'y', 1, 6438, 0}, {'r', 1, 6439, 0}, {'h', 1, 6440, 0},
+            {';', 0, 0, 874}, {'o', 1, 6441, 0}, {';', 0, 0, 875}, {'n', 1, 6442, 0}, {'e', 1, 6443, 0},
+            {';', 0, 0, 876}, {'e', 1, 6444, 0}, {';', 0, 0, 877}, {'y', 1, 6445, 0}, {'t', 1, 6446, 0},
+            {';', 0, 0, 878}, {';', 0, 0, 879}, {'n', 1, 6447, 0}, {';', 0, 0, 880}, {'m', 1, 6448, 0},
+            {';', 0, 0, 881}, {'e', 2, 6449, 882}, {'x', 1, 6451, 0}, {'n', 1, 6452, 0}, {'p', 1, 6453, 0},
+            {'r', 1, 6454, 0}, {';', 0, 0, 883}, {'d', 1, 6455, 0}, {'n', 1, 6456, 0}, {'u', 1, 6457, 0},
+            {'u', 1, 6458, 0}, {'e', 1, 6459, 0}, {'r', 1, 6460, 0}, {'o', 1, 6461, 0}, {'a', 1, 6462, 0},
+            {'r', 1, 6463, 0}, {'n', 1, 6464, 0}, {'p', 1, 6465, 0}, {'k', 1, 6466, 0}, {';', 0, 0, 884},
+            {';', 0, 0, 885}, {';', 0, 0, 886}, {';', 0, 0, 887}, {'l', 1, 6467, 0}, {'a', 1, 6468, 0},
+            {';', 0, 0, 888}, {'e', 1, 6469, 889}, {'r', 1, 6470, 0}, {'n', 1, 6471, 0}, {';', 0, 0, 890},
+            {'n', 1, 6472, 0}, {';', 0, 0, 891}, {'e', 1, 6473, 892}, {'t', 1, 6474, 0}, {'e', 1, 6475, 0},
+            {'t', 1, 6476, 0}, {';', 0, 0, 893}, {';', 0, 0, 894}, {'s', 1, 6477, 0}, {'v', 1, 6478, 0},
+            {'3', 1, 6479, 0}, {'4', 1, 6480, 0}, {';', 0, 0, 895}, {'l', 1, 6481, 0}, {';', 0, 0, 896},
+            {'o', 1, 6482, 0}, {';', 0, 0, 897}, {'c', 1, 6483, 0}, {'o', 1, 6484, 0}, {';', 0, 0, 898},
+            {'n', 1, 6485, 0}, {'s', 1, 6486, 0}, {'t', 1, 6487, 0}, {';', 0, 0, 899}, {'D', 1, 6488, 0},
+            {'r', 1, 6489, 0}, {';', 0, 0, 900}, {';', 0, 0, 901}, {';', 0, 0, 902}, {';', 0, 0, 903},
+            {'t', 1, 6490, 0}, {'e', 1, 6491, 0}, {'n', 1, 6492, 0}, {'e', 1, 6493, 0}, {'g', 1, 6494, 0},
+            {';', 0, 0, 904}, {'g', 1, 6495, 0}, {';', 0, 0, 905}, {';', 0, 0, 906}, {';', 0, 0, 907},
+            {';', 0, 0, 908}, {'l', 1, 6496, 0}, {';', 0, 0, 909}, {'i', 1, 6497, 0}, {'2', 1, 6498, 910},
+            {'3', 1, 6499, 0}, {'4', 1, 6500, 911}, {'5', 1, 6501, 0}, {'6', 1, 6502, 0}, {'8', 1, 6503, 0},
+            {'3', 1, 6504, 0}, {'5', 1, 6505, 0}, {'4', 1, 6506, 912}, {'5', 1, 6507, 0}, {'8', 1, 6508, 0},
+            {'5', 1, 6509, 0}, {'6', 1, 6510, 0}, {'8', 1, 6511, 0}, {'8', 1, 6512, 0}, {';', 0, 0, 913},
+            {';', 0, 0, 914}, {'e', 1, 6513, 0}, {';', 0, 0, 915}, {'d', 1, 6514, 0}, {'e', 1, 6515, 0},
+            {';', 0, 0, 916}, {'a', 1, 6516, 0}, {';', 0, 0, 917}, {'t', 2, 6517, 0}, {'s', 1, 6519, 0},
+            {';', 0, 0, 918}, {'r', 1, 6520, 0}, {';', 0, 0, 919}, {';', 0, 0, 920}, {';', 0, 0, 921},
+            {';', 0, 0, 922}, {';', 0, 0, 923}, {';', 0, 0, 924}, {';', 0, 0, 925}, {'r', 1, 6521, 0},
+            {'s', 1, 6522, 0}, {'p', 1, 6523, 0}, {'r', 1, 6524, 0}, {'t', 1, 6525, 0}, {'l', 1, 6526, 0},
+            {'q', 1, 6527, 0}, {'s', 1, 6528, 0}, {'m', 1, 6529, 0}, {'n', 1, 6530, 0}, {'p', 1, 6531, 0},
+            {'t', 1, 6532, 0}, {'y', 1, 6533, 0}, {'i', 1, 6534, 0}, {';', 0, 0, 926}, {';', 0, 0, 927},
+            {'s', 2, 6535, 0}, {'p', 1, 6537, 0}, {'n', 1, 6538, 0}, {'r', 1, 6539, 0}, {'r', 1, 6540, 0},
+            {';', 0, 0, 928}, {'t', 1, 6541, 0}, {'e', 1, 6542, 0}, {'i', 1, 6543, 0}, {'r', 1, 6544, 0},
+            {'h', 1, 6545, 0}, {'k', 1, 6546, 0}, {'l', 1, 6547, 0}, {'n', 1, 6548, 0}, {'e', 1, 6549, 929},
+            {';', 0, 0, 930}, {';', 0, 0, 931}, {'e', 1, 6550, 932}, {'t', 1, 6551, 0}, {';', 0, 0, 933},
+            {'n', 1, 6552, 0}, {';', 0, 0, 934}, {';', 0, 0, 935}, {';', 0, 0, 936}, {';', 0, 0, 937},
+            {'i', 1, 6553, 0}, {'a', 1, 6554, 0}, {';', 0, 0, 938}, {';', 0, 0, 939}, {'e', 1, 6555, 0},
+            {';', 0, 0, 940}, {'t', 1, 6556, 0}, {'t', 1, 6557, 0}, {'l', 1, 6558, 0}, {'e', 1, 6559, 0},
+            {'c', 1, 6560, 0}, {'r', 1, 6561, 0}, {'o', 1, 6562, 0}, {';', 0, 0, 941}, {';', 0, 0, 942},
+            {'t', 1, 6563, 943}, {';', 0, 0, 944}, {'o', 1, 6564, 0}, {';', 0, 0, 945}, {'v', 1, 6565, 0},
+            {';', 0, 0, 946}, {'e', 1, 6566, 0}, {';', 0, 0, 947}, {';', 0, 0, 948}, {';', 0, 0, 949},
+            {'y', 1, 6567, 0}, {';', 0, 0, 950}, {';', 0, 0, 951}, {'v', 1, 6568, 0}, {'l', 1, 6569, 0},
+            {'n', 1, 6570, 0}, {';', 0, 0, 952}, {'l', 1, 6571, 0}, {';', 0, 0, 953}, {'e', 1, 6572, 0},
+            {'t', 1, 6573, 0}, {'n', 1, 6574, 0}, {'a', 1, 6575, 0}, {';', 0, 0, 954}, {'e', 1, 6576, 0},
+            {';', 0, 0, 955}, {';', 0, 0, 956}, {'f', 1, 6577, 0}, {'s', 1, 6578, 0}, {'k', 1, 6579, 0},
+            {'p', 1, 6580, 0}, {'l', 1, 6581, 0}, {'i', 1, 6582, 0}, {'l', 1, 6583, 0}, {'l', 1, 6584, 0},
+            {';', 0, 0, 957}, {';', 0, 0, 958}, {';', 0, 0, 959}, {'e', 1, 6585, 0}, {'k', 1, 6586, 0},
+            {';', 0, 0, 960}, {'l', 2, 6587, 0}, {'n', 1, 6589, 0}, {'l', 1, 6590, 0}, {';', 0, 0, 961},
+            {';', 0, 0, 962}, {'r', 1, 6591, 0}, {'a', 1, 6592, 0}, {'h', 1, 6593, 0}, {'r', 1, 6594, 0},
+            {'a', 1, 6595, 0}, {'e', 1, 6596, 0}, {'i', 1, 6597, 0}, {'h', 1, 6598, 0}, {'a', 1, 6599, 0},
+            {';', 0, 0, 963}, {'t', 2, 6600, 0}, {'s', 1, 6602, 0}, {'p', 1, 6603, 0}, {'o', 1, 6604, 0},
+            {'q', 2, 6605, 0}, {'t', 1, 6607, 0}, {'i', 1, 6608, 0}, {'t', 1, 6609, 0}, {'r', 1, 6610, 0},
+            {';', 0, 0, 964}, {';', 0, 0, 965}, {'l', 1, 6611, 0}, {';', 0, 0, 966}, {';', 0, 0, 967},
+            {'n', 1, 6612, 0}, {'d', 1, 6613, 0}, {';', 0, 0, 968}, {'t', 1, 6614, 0}, {'t', 2, 6615, 0},
+            {'r', 1, 6617, 0}, {';', 0, 0, 969}, {';', 0, 0, 970}, {';', 0, 0, 971}, {';', 0, 0, 972},
+            {';', 0, 0, 973}, {'e', 1, 6618, 0}, {'a', 1, 6619, 0}, {'i', 1, 6620, 0}, {'r', 1, 6621, 0},
+            {';', 0, 0, 974}, {'s', 1, 6622, 0}, {'e', 1, 6623, 0}, {'t', 1, 6624, 0}, {'r', 1, 6625, 0},
+            {'g', 1, 6626, 0}, {'t', 1, 6627, 0}, {';', 0, 0, 975}, {'n', 1, 6628, 0}, {';', 0, 0, 976},
+            {'d', 1, 6629, 0}, {';', 0, 0, 977}, {'o', 1, 6630, 0}, {';', 0, 0, 978}, {';', 0, 0, 979},
+            {';', 0, 0, 980}, {'r', 1, 6631, 0}, {'k', 1, 6632, 0}, {';', 0, 0, 981}, {';', 0, 0, 982},
+            {'e', 1, 6633, 0}, {'s', 1, 6634, 0}, {'r', 1, 6635, 0}, {'s', 1, 6636, 0}, {'r', 1, 6637, 0},
+            {';', 0, 0, 983}, {';', 0, 0, 984}, {'h', 1, 6638, 0}, {'a', 1, 6639, 0}, {'n', 1, 6640, 0},
+            {';', 0, 0, 985}, {'s', 1, 6641, 0}, {'o', 4, 6642, 0}, {'r', 1, 6646, 0}, {'a', 1, 6647, 0},
+            {';', 0, 0, 986}, {'r', 1, 6648, 0}, {';', 0, 0, 987}, {'t', 1, 6649, 0}, {'r', 1, 6650, 0},
+            {'t', 1, 6651, 988}, {';', 0, 0, 989}, {'b', 1, 6652, 0}, {'d', 2, 6653, 0}, {'s', 1, 6655, 0},
+            {'s', 1, 6656, 0}, {'s', 1, 6657, 0}, {'m', 1, 6658, 0}, {';', 0, 0, 990}, {'a', 1, 6659, 0},
+            {'r', 1, 6660, 0}, {'t', 1, 6661, 0}, {'h', 1, 6662, 0}, {'h', 1, 6663, 0}, {';', 0, 0, 991},
+            {'e', 1, 6664, 0}, {';', 0, 0, 992}, {';', 0, 0, 993}, {'o', 1, 6665, 0}, {';', 0, 0, 994},
+            {'a', 1, 6666, 0}, {';', 0, 0, 995}, {'e', 1, 6667, 0}, {'n', 1, 6668, 0}, {'l', 1, 6669, 0},
+            {';', 0, 0, 996}, {'d', 1, 6670, 0}, {';', 0, 0, 997}, {';', 0, 0, 998}, {'k', 1, 6671, 0},
+            {';', 0, 0, 999}, {'o', 1, 6672, 0}, {';', 0, 0, 1000}, {'v', 1, 6673, 0}, {'r', 1, 6674, 0},
+            {';', 0, 0, 1001}, {'t', 2, 6675, 0}, {';', 0, 0, 1002}, {'l', 1, 6677, 0}, {';', 0, 0, 1003},
+            {';', 0, 0, 1004}, {';', 0, 0, 1005}, {';', 0, 0, 1006}, {';', 0, 0, 1007}, {';', 0, 0, 1008},
+            {'a', 1, 6678, 0}, {'r', 1, 6679, 0}, {';', 0, 0, 1009}, {'l', 1, 6680, 0}, {';', 0, 0, 1010},
+            {';', 0, 0, 1011}, {';', 0, 0, 1012}, {'e', 1, 6681, 0}, {';', 0, 0, 1013}, {'E', 1, 6682, 0},
+            {'d', 1, 6683, 0}, {'v', 3, 6684, 0}, {';', 0, 0, 1014}, {'v', 3, 6687, 0}, {'l', 1, 6690, 0},
+            {'l', 1, 6691, 0}, {';', 0, 0, 1015}, {'n', 1, 6692, 0}, {'e', 1, 6693, 0}, {';', 0, 0, 1016},
+            {'e', 1, 6694, 0}, {';', 0, 0, 1017}, {';', 0, 0, 1018}, {'c', 1, 6695, 0}, {'w', 1, 6696, 0},
+            {'t', 1, 6697, 0}, {';', 0, 0, 1019}, {'e', 1, 6698, 0}, {'e', 1, 6699, 0}, {'t', 2, 6700, 0},
+            {';', 0, 0, 1020}, {'q', 1, 6702, 0}, {';', 0, 0, 1021}, {';', 0, 0, 1022}, {'b', 1, 6703, 0},
+            {'p', 1, 6704, 0}, {';', 0, 0, 1023}, {';', 0, 0, 1024}, {'e', 1, 6705, 0}, {';', 0, 0, 1025},
+            {'e', 1, 6706, 0}, {';', 0, 0, 1026}, {';', 0, 0, 1027}, {'e', 1, 6707, 0}, {'e', 1, 6708, 1028},
+            {'n', 1, 6709, 0}, {'o', 1, 6710, 0}, {';', 0, 0, 1029}, {'h', 1, 6711, 0}, {'r', 1, 6712, 0},
+            {'h', 1, 6713, 0}, {'i', 1, 6714, 0}, {'r', 1, 6715, 0}, {'i', 1, 6716, 0}, {'r', 1, 6717, 0},
+            {'i', 1, 6718, 0}, {';', 0, 0, 1030}, {';', 0, 0, 1031}, {'k', 1, 6719, 0}, {';', 0, 0, 1032},
+            {'o', 1, 6720, 0}, {'r', 1, 6721, 0}, {'e', 1, 6722, 1033}, {';', 0, 0, 1034}, {';', 0, 0, 1035},
+            {'c', 1, 6723, 0}, {'d', 1, 6724, 0}, {';', 0, 0, 1036}, {';', 0, 0, 1037}, {'e', 1, 6725, 1038},
+            {';', 0, 0, 1039}, {';', 0, 0, 1040}, {';', 0, 0, 1041}, {'s', 1, 6726, 0}, {';', 0, 0, 1042},
+            {';', 0, 0, 1043}, {';', 0, 0, 1044}, {'o', 1, 6727, 0}, {'s', 1, 6728, 0}, {';', 0, 0, 1045},
+            {';', 0, 0, 1046}, {';', 0, 0, 1047}, {';', 0, 0, 1048}, {'o', 1, 6729, 0}, {'f', 1, 6730, 0},
+            {'p', 1, 6731, 0}, {'h', 1, 6732, 1049}, {'e', 1, 6733, 1050}, {'s', 2, 6734, 0}, {';', 0, 0, 1051},
+            {'l', 1, 6736, 0}, {'m', 1, 6737, 0}, {';', 0, 0, 1052}, {'t', 1, 6738, 0}, {'d', 1, 6739, 0},
+            {'l', 1, 6740, 0}, {'n', 1, 6741, 0}, {'t', 1, 6742, 0}, {';', 0, 0, 1053}, {'f', 1, 6743, 0},
+            {'k', 2, 6744, 0}, {'v', 1, 6746, 0}, {'c', 1, 6747, 0}, {';', 0, 0, 1054}, {'i', 1, 6748, 0},
+            {'o', 1, 6749, 0}, {'u', 1, 6750, 0}, {';', 0, 0, 1055}, {'n', 1, 6751, 1056}, {'i', 1, 6752, 0},
+            {'w', 1, 6753, 0}, {'i', 1, 6754, 0}, {';', 0, 0, 1057}, {';', 0, 0, 1058}, {'p', 1, 6755, 0},
+            {'u', 1, 6756, 0}, {'q', 1, 6757, 0}, {'a', 1, 6758, 0}, {'e', 1, 6759, 0}, {'s', 1, 6760, 0},
+            {'i', 1, 6761, 0}, {';', 0, 0, 1059}, {'s', 1, 6762, 0}, {';', 0, 0, 1060}, {'m', 1, 6763, 0},
+            {'l', 1, 6764, 0}, {'i', 1, 6765, 0}, {'u', 1, 6766, 0}, {'o', 1, 6767, 0}, {';', 0, 0, 1061},
+            {'l', 1, 6768, 0}, {'p', 1, 6769, 0}, {'e', 1, 6770, 0}, {'r', 1, 6771, 0}, {'n', 1, 6772, 0},
+            {';', 0, 0, 1062}, {'e', 1, 6773, 0}, {';', 0, 0, 1063}, {'l', 1, 6774, 0}, {';', 0, 0, 1064},
+            {'e', 1, 6775, 0}, {';', 0, 0, 1065}, {'t', 1, 6776, 0}, {';', 0, 0, 1066}, {';', 0, 0, 1067},
+            {'e', 1, 6777, 0}, {';', 0, 0, 1068}, {'p', 1, 6778, 0}, {';', 0, 0, 1069}, {'f', 1, 6779, 0},
+            {';', 0, 0, 1070}, {'s', 1, 6780, 0}, {'k', 1, 6781, 0}, {'p', 1, 6782, 0}, {'l', 1, 6783, 0},
+            {'i', 1, 6784, 0}, {'l', 1, 6785, 0}, {';', 0, 0, 1071}, {'l', 1, 6786, 0}, {';', 0, 0, 1072},
+            {'n', 1, 6787, 0}, {';', 0, 0, 1073}, {';', 0, 0, 1074}, {'e', 1, 6788, 0}, {'k', 1, 6789, 0},
+            {';', 0, 0, 1075}, {'l', 2, 6790, 0}, {'n', 1, 6792, 0}, {'l', 1, 6793, 0}, {';', 0, 0, 1076},
+            {'a', 1, 6794, 0}, {';', 0, 0, 1077}, {'r', 1, 6795, 0}, {'n', 1, 6796, 0}, {'a', 1, 6797, 0},
+            {';', 0, 0, 1078}, {'t', 1, 6798, 0}, {'r', 1, 6799, 0}, {';', 0, 0, 1079}, {';', 0, 0, 1080},
+            {'l', 1, 6800, 0}, {'a', 1, 6801, 0}, {'h', 1, 6802, 0}, {'l', 1, 6803, 0}, {'r', 1, 6804, 0},
+            {'s', 1, 6805, 0}, {'t', 1, 6806, 0}, {'g', 1, 6807, 0}, {';', 0, 0, 1081}, {';', 0, 0, 1082},
+            {'t', 2, 6808, 0}, {';', 0, 0, 1083}, {';', 0, 0, 1084}, {';', 0, 0, 1085}, {';', 0, 0, 1086},
+            {';', 0, 0, 1087}, {'s', 1, 6810, 0}, {'e', 1, 6811, 0}, {'t', 1, 6812, 0}, {'i', 1, 6813, 0},
+            {';', 0, 0, 1088}, {'o', 1, 6814, 0}, {';', 0, 0, 1089}, {'r', 1, 6815, 0}, {'e', 1, 6816, 0},
+            {'s', 1, 6817, 0}, {';', 0, 0, 1090}, {';', 0, 0, 1091}, {'t', 1, 6818, 0}, {'a', 1, 6819, 0},
+            {'e', 1, 6820, 0}, {';', 0, 0, 1092}, {'n', 1, 6821, 0}, {';', 0, 0, 1093}, {'l', 1, 6822, 0},
+            {';', 0, 0, 1094}, {';', 0, 0, 1095}, {'m', 1, 6823, 0}, {'i', 1, 6824, 0}, {';', 0, 0, 1096},
+            {';', 0, 0, 1097}, {';', 0, 0, 1098}, {';', 0, 0, 1099}, {'k', 1, 6825, 0}, {';', 0, 0, 1100},
+            {'o', 1, 6826, 0}, {'r', 1, 6827, 0}, {'n', 1, 6828, 0}, {';', 0, 0, 1101}, {'n', 1, 6829, 0},
+            {';', 0, 0, 1102}, {'y', 1, 6830, 0}, {'m', 1, 6831, 0}, {'p', 1, 6832, 0}, {';', 0, 0, 1103},
+            {'f', 1, 6833, 0}, {'v', 1, 6834, 0}, {'t', 1, 6835, 0}, {';', 0, 0, 1104}, {';', 0, 0, 1105},
+            {';', 0, 0, 1106}, {';', 0, 0, 1107}, {'u', 1, 6836, 0}, {'r', 1, 6837, 0}, {';', 0, 0, 1108},
+            {'s', 1, 6838, 0}, {'p', 1, 6839, 0}, {'r', 1, 6840, 0}, {';', 0, 0, 1109}, {';', 0, 0, 1110},
+            {'y', 1, 6841, 0}, {'r', 1, 6842, 0}, {'s', 2, 6843, 0}, {';', 0, 0, 1111}, {'s', 1, 6845, 0},
+            {';', 0, 0, 1112}, {'s', 1, 6846, 0}, {';', 0, 0, 1113}, {'e', 1, 6847, 0}, {'s', 1, 6848, 0},
+            {';', 0, 0, 1114}, {'e', 1, 6849, 0}, {'s', 1, 6850, 0}, {'e', 1, 6851, 0}, {'f', 1, 6852, 0},
+            {';', 0, 0, 1115}, {'n', 1, 6853, 0}, {'e', 1, 6854, 0}, {'f', 1, 6855, 0}, {';', 0, 0, 1116},
+            {'g', 1, 6856, 0}, {';', 0, 0, 1117}, {'t', 1, 6857, 0}, {'o', 1, 6858, 0}, {'l', 1, 6859, 0},
+            {';', 0, 0, 1118}, {';', 0, 0, 1119}, {'u', 1, 6860, 0}, {'r', 1, 6861, 0}, {'t', 3, 6862, 0},
+            {'m', 1, 6865, 0}, {'b', 1, 6866, 0}, {'p', 1, 6867, 0}, {'p', 1, 6868, 0}, {'u', 1, 6869, 0},
+            {'q', 1, 6870, 0}, {'a', 1, 6871, 0}, {'e', 1, 6872, 0}, {'s', 1, 6873, 0}, {'i', 1, 6874, 0},
+            {'t', 1, 6875, 0}, {'u', 1, 6876, 0}, {'o', 1, 6877, 0}, {'o', 1, 6878, 0}, {'u', 1, 6879, 0},
+            {'r', 1, 6880, 0}, {'l', 1, 6881, 0}, {';', 0, 0, 1120}, {';', 0, 0, 1121}, {'u', 1, 6882, 0},
+            {'t', 3, 6883, 0}, {'m', 1, 6886, 0}, {'b', 1, 6887, 0}, {'p', 1, 6888, 0}, {';', 0, 0, 1122},
+            {'k', 1, 6889, 0}, {';', 0, 0, 1123}, {'o', 1, 6890, 0}, {'r', 1, 6891, 0}, {';', 0, 0, 1124},
+            {'t', 1, 6892, 0}, {'n', 1, 6893, 0}, {'l', 1, 6894, 0}, {'c', 1, 6895, 0}, {'4', 1, 6896, 0},
+            {'f', 1, 6897, 0}, {';', 0, 0, 1125}, {'s', 1, 6898, 0}, {'v', 1, 6899, 0}, {'a', 1, 6900, 0},
+            {'s', 1, 6901, 0}, {'p', 1, 6902, 0}, {';', 0, 0, 1126}, {'m', 1, 6903, 0}, {';', 0, 0, 1127},
+            {';', 0, 0, 1128}, {';', 0, 0, 1129}, {'b', 2, 6904, 0}, {'d', 1, 6906, 0}, {'t', 1, 6907, 0},
+            {'r', 1, 6908, 0}, {'r', 1, 6909, 0}, {'e', 1, 6910, 0}, {';', 0, 0, 1130}, {'g', 1, 6911, 0},
+            {'t', 1, 6912, 0}, {'n', 1, 6913, 0}, {'u', 1, 6914, 0}, {';', 0, 0, 1131}, {'m', 1, 6915, 0},
+            {'i', 1, 6916, 0}, {';', 0, 0, 1132}, {'k', 1, 6917, 0}, {';', 0, 0, 1133}, {'a', 1, 6918, 0},
+            {'e', 1, 6919, 1134}, {';', 0, 0, 1135}, {'e', 1, 6920, 0}, {';', 0, 0, 1136}, {';', 0, 0, 1137},
+            {'c', 1, 6921, 0}, {';', 0, 0, 1138}, {'t', 1, 6922, 0}, {'e', 1, 6923, 1139}, {';', 0, 0, 1140},
+            {';', 0, 0, 1141}, {';', 0, 0, 1142}, {'n', 2, 6924, 0}, {'p', 1, 6926, 0}, {';', 0, 0, 1143},
+            {';', 0, 0, 1144}, {';', 0, 0, 1145}, {'o', 1, 6927, 0}, {'n', 1, 6928, 0}, {'p', 1, 6929, 0},
+            {';', 0, 0, 1146}, {';', 0, 0, 1147}, {'o', 1, 6930, 0}, {'r', 1, 6931, 0}, {'n', 2, 6932, 0},
+            {'p', 1, 6934, 0}, {';', 0, 0, 1148}, {';', 0, 0, 1149}, {';', 0, 0, 1150}, {'e', 1, 6935, 0},
+            {';', 0, 0, 1151}, {';', 0, 0, 1152}, {'l', 1, 6936, 0}, {';', 0, 0, 1153}, {';', 0, 0, 1154},
+            {'t', 1, 6937, 0}, {'s', 1, 6938, 0}, {'p', 1, 6939, 0}, {'t', 1, 6940, 0}, {'i', 1, 6941, 0},
+            {';', 0, 0, 1155}, {'o', 1, 6942, 0}, {'o', 1, 6943, 0}, {'g', 1, 6944, 0}, {'b', 1, 6945, 0},
+            {'p', 1, 6946, 0}, {'e', 1, 6947, 0}, {'i', 1, 6948, 0}, {';', 0, 0, 1156}, {'r', 1, 6949, 0},
+            {';', 0, 0, 1157}, {'p', 1, 6950, 0}, {'r', 1, 6951, 0}, {';', 0, 0, 1158}, {';', 0, 0, 1159},
+            {';', 0, 0, 1160}, {';', 0, 0, 1161}, {';', 0, 0, 1162}, {'E', 1, 6952, 0}, {'e', 1, 6953, 0},
+            {'E', 1, 6954, 0}, {'e', 1, 6955, 0}, {'a', 1, 6956, 0}, {';', 0, 0, 1163}, {'r', 1, 6957, 0},
+            {';', 0, 0, 1164}, {'q', 1, 6958, 0}, {'p', 1, 6959, 0}, {'h', 1, 6960, 0}, {';', 0, 0, 1165},
+            {';', 0, 0, 1166}, {';', 0, 0, 1167}, {';', 0, 0, 1168}, {';', 0, 0, 1169}, {';', 0, 0, 1170},
+            {';', 0, 0, 1171}, {'s', 1, 6961, 0}, {'e', 1, 6962, 0}, {';', 0, 0, 1172}, {';', 0, 0, 1173},
+            {'p', 1, 6963, 0}, {'s', 1, 6964, 0}, {';', 0, 0, 1174}, {'e', 1, 6965, 0}, {'e', 1, 6966, 1175},
+            {';', 0, 0, 1176}, {'e', 1, 6967, 0}, {'n', 1, 6968, 0}, {'f', 1, 6969, 0}, {'r', 1, 6970, 0},
+            {';', 0, 0, 1177}, {';', 0, 0, 1178}, {';', 0, 0, 1179}, {'u', 1, 6971, 0}, {';', 0, 0, 1180},
+            {';', 0, 0, 1181}, {'a', 1, 6972, 0}, {';', 0, 0, 1182}, {'e', 1, 6973, 0}, {'l', 1, 6974, 0},
+            {';', 0, 0, 1183}, {';', 0, 0, 1184}, {'l', 1, 6975, 0}, {'s', 1, 6976, 0}, {';', 0, 0, 1185},
+            {';', 0, 0, 1186}, {'t', 1, 6977, 0}, {'a', 1, 6978, 0}, {'D', 1, 6979, 0}, {'D', 1, 6980, 0},
+            {'M', 1, 6981, 0}, {'P', 1, 6982, 0}, {'T', 1, 6983, 0}, {'i', 1, 6984, 0}, {'u', 1, 6985, 0},
+            {';', 0, 0, 1187}, {'e', 1, 6986, 0}, {';', 0, 0, 1188}, {'r', 1, 6987, 0}, {'u', 1, 6988, 0},
+            {'r', 1, 6989, 0}, {';', 0, 0, 1189}, {'h', 1, 6990, 0}, {';', 0, 0, 1190}, {';', 0, 0, 1191},
+            {'t', 1, 6991, 0}, {'d', 1, 6992, 0}, {'e', 1, 6993, 0}, {';', 0, 0, 1192}, {'a', 1, 6994, 0},
+            {'C', 1, 6995, 0}, {'D', 1, 6996, 0}, {'L', 2, 6997, 0}, {'R', 1, 6999, 0}, {'U', 1, 7000, 0},
+            {'V', 1, 7001, 0}, {'r', 1, 7002, 0}, {'e', 1, 7003, 0}, {'f', 1, 7004, 0}, {'g', 1, 7005, 0},
+            {'e', 2, 7006, 0}, {'r', 1, 7008, 0}, {';', 0, 0, 1193}, {';', 0, 0, 1194}, {';', 0, 0, 1195},
+            {';', 0, 0, 1196}, {'t', 1, 7009, 0}, {'m', 1, 7010, 0}, {'e', 1, 7011, 0}, {'n', 1, 7012, 0},
+            {'i', 1, 7013, 0}, {'b', 1, 7014, 0}, {';', 0, 0, 1197}, {'n', 1, 7015, 0}, {'S', 1, 7016, 0},
+            {'V', 1, 7017, 0}, {';', 0, 0, 1198}, {'r', 1, 7018, 0}, {';', 0, 0, 1199}, {';', 0, 0, 1200},
+            {';', 0, 0, 1201}, {'r', 6, 7019, 0}, {';', 0, 0, 1202}, {'t', 1, 7025, 0}, {'n', 1, 7026, 0},
+            {';', 0, 0, 1203}, {'w', 1, 7027, 0}, {'u', 1, 7028, 0}, {';', 0, 0, 1204}, {';', 0, 0, 1205},
+            {'a', 1, 7029, 0}, {'s', 1, 7030, 0}, {'a', 1, 7031, 0}, {'e', 1, 7032, 0}, {'b', 1, 7033, 0},
+            {';', 0, 0, 1206}, {';', 0, 0, 1207}, {';', 0, 0, 1208}, {';', 0, 0, 1209}, {';', 0, 0, 1210},
+            {'e', 1, 7034, 0}, {';', 0, 0, 1211}, {';', 0, 0, 1212}, {'g', 1, 7035, 0}, {'r', 1, 7036, 0},
+            {'i', 1, 7037, 0}, {'u', 1, 7038, 0}, {'w', 1, 7039, 0}, {'o', 1, 7040, 0}, {'g', 1, 7041, 0},
+            {'e', 3, 7042, 0}, {'i', 1, 7045, 0}, {'D', 1, 7046, 0}, {'T', 1, 7047, 0}, {'V', 1, 7048, 0},
+            {'c', 1, 7049, 0}, {'r', 1, 7050, 0}, {'g', 1, 7051, 0}, {'u', 1, 7052, 0}, {'l', 1, 7053, 0},
+            {'e', 1, 7054, 0}, {'s', 1, 7055, 0}, {'a', 1, 7056, 0}, {'l', 1, 7057, 0}, {'r', 1, 7058, 0},
+            {';', 0, 0, 1213}, {'f', 1, 7059, 0}, {'g', 1, 7060, 0}, {'f', 1, 7061, 0}, {'g', 1, 7062, 0},
+            {'e', 1, 7063, 0}, {'i', 1, 7064, 0}, {';', 0, 0, 1214}, {'S', 1, 7065, 0}, {'t', 1, 7066, 0},
+            {'l', 1, 7067, 0}, {';', 0, 0, 1215}, {';', 0, 0, 1216}, {';', 0, 0, 1217}, {'v', 1, 7068, 0},
+            {'G', 1, 7069, 0}, {'L', 1, 7070, 0}, {'e', 1, 7071, 0}, {'k', 1, 7072, 0}, {'a', 1, 7073, 0},
+            {'g', 1, 7074, 0}, {'C', 1, 7075, 0}, {'b', 1, 7076, 0}, {'m', 1, 7077, 0}, {'a', 1, 7078, 0},
+            {'s', 1, 7079, 0}, {'a', 1, 7080, 0}, {'p', 2, 7081, 0}, {'t', 1, 7083, 0}, {'s', 6, 7084, 0},
+            {'t', 1, 7090, 0}, {'c', 1, 7091, 0}, {'e', 1, 7092, 0}, {'h', 1, 7093, 0}, {'a', 1, 7094, 0},
+            {'s', 1, 7095, 0}, {'c', 1, 7096, 0}, {'e', 1, 7097, 0}, {'d', 1, 7098, 0}, {'t', 1, 7099, 0},
+            {';', 0, 0, 1218}, {';', 0, 0, 1219}, {';', 0, 0, 1220}, {';', 0, 0, 1221}, {'n', 1, 7100, 0},
+            {'r', 1, 7101, 0}, {';', 0, 0, 1222}, {';', 0, 0, 1223}, {';', 0, 0, 1224}, {'r', 1, 7102, 0},
+            {'a', 1, 7103, 0}, {'r', 1, 7104, 0}, {'l', 1, 7105, 0}, {'n', 1, 7106, 0}, {'r', 1, 7107, 0},
+            {'e', 1, 7108, 0}, {'t', 1, 7109, 0}, {'t', 1, 7110, 0}, {';', 0, 0, 1225}, {';', 0, 0, 1226},
+            {';', 0, 0, 1227}, {';', 0, 0, 1228}, {'e', 2, 7111, 0}, {'n', 1, 7113, 0}, {'r', 1, 7114, 0},
+            {'e', 1, 7115, 0}, {'o', 2, 7116, 0}, {'l', 1, 7118, 0}, {'e', 1, 7119, 0}, {'r', 1, 7120, 0},
+            {'p', 3, 7121, 0}, {'e', 1, 7124, 0}, {'r', 1, 7125, 0}, {'m', 1, 7126, 0}, {'a', 1, 7127, 0},
+            {'l', 1, 7128, 0}, {';', 0, 0, 1229}, {';', 0, 0, 1230}, {';', 0, 0, 1231}, {';', 0, 0, 1232},
+            {';', 0, 0, 1233}, {'o', 1, 7129, 0}, {'e', 1, 7130, 0}, {'i', 1, 7131, 0}, {'p', 1, 7132, 0},
+            {'i', 1, 7133, 0}, {';', 0, 0, 1234}, {'I', 1, 7134, 0}, {'S', 1, 7135, 0}, {'U', 1, 7136, 0},
+            {';', 0, 0, 1235}, {'E', 1, 7137, 0}, {'d', 1, 7138, 0}, {'a', 1, 7139, 0}, {'e', 1, 7140, 0},
+            {';', 0, 0, 1236}, {';', 0, 0, 1237}, {';', 0, 0, 1238}, {'o', 1, 7141, 0}, {'p', 1, 7142, 0},
+            {'a', 1, 7143, 0}, {'q', 1, 7144, 0}, {'u', 1, 7145, 0}, {'i', 1, 7146, 0}, {'D', 1, 7147, 0},
+            {';', 0, 0, 1239}, {';', 0, 0, 1240}, {'i', 1, 7148, 0}, {';', 0, 0, 1241}, {';', 0, 0, 1242},
+            {';', 0, 0, 1243}, {'a', 1, 7149, 0}, {'r', 1, 7150, 0}, {'a', 1, 7151, 0}, {'l', 1, 7152, 0},
+            {'w', 3, 7153, 0}, {'A', 1, 7156, 0}, {'l', 1, 7157, 0}, {'r', 1, 7158, 0}, {'w', 1, 7159, 0},
+            {'a', 1, 7160, 0}, {'e', 1, 7161, 0}, {'i', 1, 7162, 0}, {'n', 1, 7163, 0}, {';', 0, 0, 1244},
+            {';', 0, 0, 1245}, {';', 0, 0, 1246}, {'a', 1, 7164, 0}, {'i', 1, 7165, 0}, {';', 0, 0, 1247},
+            {';', 0, 0, 1248}, {';', 0, 0, 1249}, {';', 0, 0, 1250}, {'d', 1, 7166, 0}, {';', 0, 0, 1251},
+            {';', 0, 0, 1252}, {';', 0, 0, 1253}, {'m', 1, 7167, 0}, {';', 0, 0, 1254}, {'p', 1, 7168, 0},
+            {';', 0, 0, 1255}, {'a', 8, 7169, 0}, {'b', 2, 7177, 0}, {';', 0, 0, 1256}, {'r', 1, 7179, 0},
+            {';', 0, 0, 1257}, {';', 0, 0, 1258}, {'e', 1, 7180, 0}, {'q', 1, 7181, 0}, {';', 0, 0, 1259},
+            {'n', 1, 7182, 0}, {'n', 1, 7183, 0}, {'s', 1, 7184, 0}, {'i', 1, 7185, 0}, {'m', 2, 7186, 0},
+            {';', 0, 0, 1260}, {';', 0, 0, 1261}, {'g', 1, 7188, 0}, {'r', 1, 7189, 0}, {';', 0, 0, 1262},
+            {'e', 1, 7190, 0}, {'v', 1, 7191, 0}, {';', 0, 0, 1263}, {'n', 1, 7192, 0}, {';', 0, 0, 1264},
+            {'c', 1, 7193, 0}, {';', 0, 0, 1265}, {'t', 1, 7194, 0}, {'u', 1, 7195, 0}, {'m', 1, 7196, 0},
+            {'u', 1, 7197, 0}, {'r', 1, 7198, 0}, {'a', 1, 7199, 0}, {'u', 1, 7200, 0}, {';', 0, 0, 1266},
+            {'g', 1, 7201, 0}, {';', 0, 0, 1267}, {'o', 1, 7202, 0}, {'q', 1, 7203, 0}, {'r', 1, 7204, 0},
+            {'v', 1, 7205, 0}, {';', 0, 0, 1268}, {';', 0, 0, 1269}, {';', 0, 0, 1270}, {'u', 1, 7206, 0},
+            {'s', 1, 7207, 0}, {'e', 1, 7208, 0}, {';', 0, 0, 1271}, {';', 0, 0, 1272}, {'u', 1, 7209, 0},
+            {';', 0, 0, 1273}, {';', 0, 0, 1274}, {';', 0, 0, 1275}, {';', 0, 0, 1276}, {'u', 1, 7210, 0},
+            {';', 0, 0, 1277}, {';', 0, 0, 1278}, {';', 0, 0, 1279}, {';', 0, 0, 1280}, {';', 0, 0, 1281},
+            {'m', 1, 7211, 0}, {'v', 1, 7212, 0}, {'d', 1, 7213, 0}, {'a', 1, 7214, 0}, {';', 0, 0, 1282},
+            {'a', 1, 7215, 0}, {'d', 5, 7216, 0}, {'n', 1, 7221, 0}, {';', 0, 0, 1283}, {'r', 1, 7222, 0},
+            {'i', 1, 7223, 0}, {';', 0, 0, 1284}, {'q', 1, 7224, 0}, {';', 0, 0, 1285}, {';', 0, 0, 1286},
+            {'m', 1, 7225, 0}, {'x', 1, 7226, 0}, {'t', 1, 7227, 0}, {';', 0, 0, 1287}, {';', 0, 0, 1288},
+            {';', 0, 0, 1289}, {'l', 1, 7228, 0}, {'r', 1, 7229, 0}, {';', 0, 0, 1290}, {'p', 1, 7230, 0},
+            {'a', 1, 7231, 0}, {';', 0, 0, 1291}, {';', 0, 0, 1292}, {';', 0, 0, 1293}, {';', 0, 0, 1294},
+            {'m', 1, 7232, 0}, {'q', 2, 7233, 0}, {'e', 1, 7235, 0}, {'e', 1, 7236, 0}, {';', 0, 0, 1295},
+            {'r', 1, 7237, 0}, {'n', 1, 7238, 0}, {';', 0, 0, 1296}, {';', 0, 0, 1297}, {';', 0, 0, 1298},
+            {'w', 1, 7239, 0}, {';', 0, 0, 1299}, {'r', 1, 7240, 0}, {'q', 1, 7241, 0}, {'v', 1, 7242, 0},
+            {';', 0, 0, 1300}, {'d', 2, 7243, 0}, {'a', 1, 7245, 0}, {';', 0, 0, 1301}, {'o', 1, 7246, 0},
+            {';', 0, 0, 1302}, {';', 0, 0, 1303}, {';', 0, 0, 1304}, {';', 0, 0, 1305}, {'o', 1, 7247, 0},
+            {'u', 1, 7248, 0}, {'s', 1, 7249, 0}, {'a', 1, 7250, 0}, {'b', 1, 7251, 0}, {'r', 1, 7252, 0},
+            {'w', 1, 7253, 0}, {'r', 1, 7254, 0}, {'o', 1, 7255, 0}, {';', 0, 0, 1306}, {';', 0, 0, 1307},
+            {';', 0, 0, 1308}, {'e', 1, 7256, 0}, {'r', 1, 7257, 0}, {';', 0, 0, 1309}, {';', 0, 0, 1310},
+            {';', 0, 0, 1311}, {';', 0, 0, 1312}, {';', 0, 0, 1313}, {';', 0, 0, 1314}, {'r', 1, 7258, 0},
+            {';', 0, 0, 1315}, {'e', 1, 7259, 0}, {';', 0, 0, 1316}, {';', 0, 0, 1317}, {';', 0, 0, 1318},
+            {';', 0, 0, 1319}, {'n', 1, 7260, 0}, {';', 0, 0, 1320}, {'n', 1, 7261, 0}, {'t', 2, 7262, 0},
+            {';', 0, 0, 1321}, {';', 0, 0, 1322}, {'D', 1, 7264, 0}, {'s', 1, 7265, 0}, {'a', 1, 7266, 0},
+            {'n', 1, 7267, 0}, {'g', 1, 7268, 0}, {';', 0, 0, 1323}, {';', 0, 0, 1324}, {';', 0, 0, 1325},
+            {';', 0, 0, 1326}, {'n', 1, 7269, 0}, {';', 0, 0, 1327}, {';', 0, 0, 1328}, {';', 0, 0, 1329},
+            {';', 0, 0, 1330}, {';', 0, 0, 1331}, {';', 0, 0, 1332}, {';', 0, 0, 1333}, {';', 0, 0, 1334},
+            {';', 0, 0, 1335}, {';', 0, 0, 1336}, {';', 0, 0, 1337}, {';', 0, 0, 1338}, {';', 0, 0, 1339},
+            {';', 0, 0, 1340}, {';', 0, 0, 1341}, {';', 0, 0, 1342}, {';', 0, 0, 1343}, {';', 0, 0, 1344},
+            {'n', 1, 7270, 0}, {';', 0, 0, 1345}, {'o', 2, 7271, 0}, {';', 0, 0, 1346}, {'o', 1, 7273, 0},
+            {';', 0, 0, 1347}, {'t', 1, 7274, 0}, {'r', 1, 7275, 0}, {';', 0, 0, 1348}, {';', 0, 0, 1349},
+            {'e', 1, 7276, 0}, {'l', 1, 7277, 0}, {'s', 1, 7278, 0}, {';', 0, 0, 1350}, {'e', 1, 7279, 0},
+            {';', 0, 0, 1351}, {';', 0, 0, 1352}, {';', 0, 0, 1353}, {'r', 1, 7280, 0}, {';', 0, 0, 1354},
+            {'u', 1, 7281, 0}, {';', 0, 0, 1355}, {';', 0, 0, 1356}, {'o', 1, 7282, 0}, {'o', 1, 7283, 0},
+            {';', 0, 0, 1357}, {'f', 1, 7284, 0}, {'g', 1, 7285, 0}, {';', 0, 0, 1358}, {';', 0, 0, 1359},
+            {';', 0, 0, 1360}, {';', 0, 0, 1361}, {';', 0, 0, 1362}, {';', 0, 0, 1363}, {';', 0, 0, 1364},
+            {';', 0, 0, 1365}, {';', 0, 0, 1366}, {'n', 1, 7286, 0}, {'r', 1, 7287, 0}, {';', 0, 0, 1367},
+            {'i', 1, 7288, 0}, {';', 0, 0, 1368}, {';', 0, 0, 1369}, {'r', 1, 7289, 0}, {'a', 1, 7290, 0},
+            {'h', 1, 7291, 0}, {'d', 1, 7292, 0}, {';', 0, 0, 1370}, {'t', 1, 7293, 0}, {';', 0, 0, 1371},
+            {';', 0, 0, 1372}, {';', 0, 0, 1373}, {';', 0, 0, 1374}, {';', 0, 0, 1375}, {';', 0, 0, 1376},
+            {';', 0, 0, 1377}, {';', 0, 0, 1378}, {'y', 1, 7294, 0}, {';', 0, 0, 1379}, {';', 0, 0, 1380},
+            {';', 0, 0, 1381}, {'s', 1, 7295, 0}, {';', 0, 0, 1382}, {';', 0, 0, 1383}, {';', 0, 0, 1384},
+            {';', 0, 0, 1385}, {'m', 1, 7296, 0}, {';', 0, 0, 1386}, {';', 0, 0, 1387}, {';', 0, 0, 1388},
+            {';', 0, 0, 1389}, {'d', 1, 7297, 0}, {'u', 1, 7298, 0}, {';', 0, 0, 1390}, {';', 0, 0, 1391},
+            {';', 0, 0, 1392}, {'r', 1, 7299, 0}, {'a', 1, 7300, 0}, {'r', 1, 7301, 0}, {'r', 1, 7302, 0},
+            {'f', 1, 7303, 0}, {'g', 1, 7304, 0}, {'r', 1, 7305, 0}, {'n', 1, 7306, 0}, {';', 0, 0, 1393},
+            {'o', 2, 7307, 0}, {';', 0, 0, 1394}, {'p', 1, 7309, 0}, {'t', 1, 7310, 0}, {'g', 1, 7311, 0},
+            {'q', 1, 7312, 0}, {'r', 1, 7313, 0}, {'m', 1, 7314, 0}, {';', 0, 0, 1395}, {';', 0, 0, 1396},
+            {';', 0, 0, 1397}, {'e', 1, 7315, 0}, {';', 0, 0, 1398}, {';', 0, 0, 1399}, {';', 0, 0, 1400},
+            {'a', 1, 7316, 0}, {'o', 1, 7317, 0}, {'f', 1, 7318, 0}, {'p', 1, 7319, 0}, {'g', 1, 7320, 0},
+            {'r', 1, 7321, 0}, {';', 0, 0, 1401}, {'s', 1, 7322, 0}, {';', 0, 0, 1402}, {';', 0, 0, 1403},
+            {'e', 1, 7323, 0}, {';', 0, 0, 1404}, {'e', 1, 7324, 0}, {';', 0, 0, 1405}, {';', 0, 0, 1406},
+            {';', 0, 0, 1407}, {';', 0, 0, 1408}, {';', 0, 0, 1409}, {';', 0, 0, 1410}, {';', 0, 0, 1411},
+            {'t', 1, 7325, 0}, {';', 0, 0, 1412}, {'a', 1, 7326, 0}, {'r', 1, 7327, 0}, {'e', 1, 7328, 0},
+            {'e', 1, 7329, 0}, {';', 0, 0, 1413}, {'d', 1, 7330, 0}, {'l', 1, 7331, 0}, {'u', 1, 7332, 0},
+            {';', 0, 0, 1414}, {';', 0, 0, 1415}, {'e', 1, 7333, 0}, {';', 0, 0, 1416}, {';', 0, 0, 1417},
+            {';', 0, 0, 1418}, {';', 0, 0, 1419}, {';', 0, 0, 1420}, {'u', 1, 7334, 0}, {';', 0, 0, 1421},
+            {';', 0, 0, 1422}, {';', 0, 0, 1423}, {'a', 1, 7335, 0}, {'r', 1, 7336, 0}, {'i', 1, 7337, 0},
+            {'a', 1, 7338, 0}, {';', 0, 0, 1424}, {';', 0, 0, 1425}, {';', 0, 0, 1426}, {'x', 1, 7339, 0},
+            {'l', 2, 7340, 0}, {';', 0, 0, 1427}, {';', 0, 0, 1428}, {';', 0, 0, 1429}, {'o', 1, 7342, 0},
+            {';', 0, 0, 1430}, {'w', 1, 7343, 0}, {';', 0, 0, 1431}, {';', 0, 0, 1432}, {';', 0, 0, 1433},
+            {'s', 1, 7344, 0}, {'a', 1, 7345, 0}, {'r', 1, 7346, 0}, {'i', 1, 7347, 0}, {'a', 1, 7348, 0},
+            {';', 0, 0, 1434}, {';', 0, 0, 1435}, {'o', 1, 7349, 0}, {'a', 1, 7350, 0}, {'b', 1, 7351, 0},
+            {'c', 1, 7352, 0}, {'a', 1, 7353, 0}, {'b', 1, 7354, 0}, {'c', 1, 7355, 0}, {'l', 1, 7356, 0},
+            {';', 0, 0, 1436}, {'t', 1, 7357, 0}, {';', 0, 0, 1437}, {'q', 1, 7358, 0}, {';', 0, 0, 1438},
+            {';', 0, 0, 1439}, {'a', 1, 7359, 0}, {';', 0, 0, 1440}, {';', 0, 0, 1441}, {'m', 1, 7360, 0},
+            {'p', 1, 7361, 0}, {';', 0, 0, 1442}, {'e', 1, 7362, 0}, {'e', 1, 7363, 0}, {'t', 2, 7364, 0},
+            {'q', 1, 7366, 0}, {'t', 2, 7367, 0}, {';', 0, 0, 1443}, {'g', 1, 7369, 0}, {';', 0, 0, 1444},
+            {';', 0, 0, 1445}, {';', 0, 0, 1446}, {';', 0, 0, 1447}, {'n', 1, 7370, 0}, {';', 0, 0, 1448},
+            {'e', 1, 7371, 0}, {';', 0, 0, 1449}, {'e', 1, 7372, 0}, {';', 0, 0, 1450}, {'w', 1, 7373, 0},
+            {';', 0, 0, 1451}, {';', 0, 0, 1452}, {';', 0, 0, 1453}, {';', 0, 0, 1454}, {';', 0, 0, 1455},
+            {'s', 1, 7374, 0}, {'n', 1, 7375, 0}, {';', 0, 0, 1456}, {'f', 1, 7376, 0}, {';', 0, 0, 1457},
+            {'e', 1, 7377, 0}, {';', 0, 0, 1458}, {';', 0, 0, 1459}, {';', 0, 0, 1460}, {'a', 1, 7378, 0},
+            {'e', 1, 7379, 0}, {';', 0, 0, 1461}, {';', 0, 0, 1462}, {';', 0, 0, 1463}, {';', 0, 0, 1464},
+            {'k', 1, 7380, 0}, {';', 0, 0, 1465}, {'o', 1, 7381, 0}, {';', 0, 0, 1466}, {'h', 1, 7382, 0},
+            {';', 0, 0, 1467}, {'i', 1, 7383, 0}, {'r', 1, 7384, 0}, {';', 0, 0, 1468}, {';', 0, 0, 1469},
+            {';', 0, 0, 1470}, {'m', 1, 7385, 0}, {'o', 1, 7386, 0}, {'n', 1, 7387, 0}, {'p', 1, 7388, 0},
+            {'r', 1, 7389, 0}, {';', 0, 0, 1471}, {'p', 1, 7390, 0}, {'q', 1, 7391, 0}, {'i', 1, 7392, 0},
+            {'m', 1, 7393, 0}, {';', 0, 0, 1472}, {';', 0, 0, 1473}, {'a', 1, 7394, 0}, {'n', 1, 7395, 0},
+            {'r', 1, 7396, 0}, {';', 0, 0, 1474}, {';', 0, 0, 1475}, {';', 0, 0, 1476}, {';', 0, 0, 1477},
+            {'n', 1, 7397, 0}, {'t', 1, 7398, 0}, {'q', 1, 7399, 0}, {';', 0, 0, 1478}, {';', 0, 0, 1479},
+            {'y', 1, 7400, 0}, {';', 0, 0, 1480}, {';', 0, 0, 1481}, {'s', 1, 7401, 0}, {';', 0, 0, 1482},
+            {';', 0, 0, 1483}, {';', 0, 0, 1484}, {';', 0, 0, 1485}, {'m', 1, 7402, 0}, {';', 0, 0, 1486},
+            {';', 0, 0, 1487}, {'a', 1, 7403, 0}, {';', 0, 0, 1488}, {';', 0, 0, 1489}, {'d', 1, 7404, 0},
+            {'u', 1, 7405, 0}, {';', 0, 0, 1490}, {';', 0, 0, 1491}, {'r', 1, 7406, 0}, {';', 0, 0, 1492},
+            {'e', 1, 7407, 0}, {'r', 1, 7408, 0}, {';', 0, 0, 1493}, {';', 0, 0, 1494}, {';', 0, 0, 1495},
+            {'r', 1, 7409, 0}, {'a', 1, 7410, 0}, {'e', 1, 7411, 0}, {'i', 1, 7412, 0}, {'q', 1, 7413, 0},
+            {'h', 1, 7414, 0}, {'d', 1, 7415, 0}, {';', 0, 0, 1496}, {'a', 1, 7416, 0}, {';', 0, 0, 1497},
+            {'s', 1, 7417, 0}, {';', 0, 0, 1498}, {'n', 1, 7418, 0}, {';', 0, 0, 1499}, {';', 0, 0, 1500},
+            {';', 0, 0, 1501}, {';', 0, 0, 1502}, {'r', 1, 7419, 0}, {'r', 1, 7420, 0}, {';', 0, 0, 1503},
+            {';', 0, 0, 1504}, {';', 0, 0, 1505}, {';', 0, 0, 1506}, {'n', 1, 7421, 0}, {';', 0, 0, 1507},
+            {'w', 1, 7422, 0}, {';', 0, 0, 1508}, {'u', 1, 7423, 0}, {';', 0, 0, 1509}, {';', 0, 0, 1510},
+            {'i', 1, 7424, 0}, {'a', 1, 7425, 0}, {';', 0, 0, 1511}, {';', 0, 0, 1512}, {';', 0, 0, 1513},
+            {'s', 1, 7426, 0}, {'r', 1, 7427, 0}, {'e', 1, 7428, 0}, {';', 0, 0, 1514}, {'s', 1, 7429, 0},
+            {';', 0, 0, 1515}, {';', 0, 0, 1516}, {';', 0, 0, 1517}, {'u', 1, 7430, 0}, {';', 0, 0, 1518},
+            {';', 0, 0, 1519}, {';', 0, 0, 1520}, {'e', 1, 7431, 0}, {';', 0, 0, 1521}, {'e', 1, 7432, 0},
+            {';', 0, 0, 1522}, {';', 0, 0, 1523}, {';', 0, 0, 1524}, {';', 0, 0, 1525}, {';', 0, 0, 1526},
+            {'h', 1, 7433, 0}, {';', 0, 0, 1527}, {'t', 1, 7434, 0}, {'t', 1, 7435, 0}, {'s', 1, 7436, 0},
+            {'r', 1, 7437, 0}, {';', 0, 0, 1528}, {'e', 1, 7438, 0}, {'n', 1, 7439, 0}, {';', 0, 0, 1529},
+            {';', 0, 0, 1530}, {';', 0, 0, 1531}, {'p', 1, 7440, 0}, {'r', 1, 7441, 0}, {';', 0, 0, 1532},
+            {'p', 1, 7442, 0}, {'q', 1, 7443, 0}, {'i', 1, 7444, 0}, {'m', 1, 7445, 0}, {';', 0, 0, 1533},
+            {'b', 1, 7446, 0}, {'t', 1, 7447, 0}, {'l', 1, 7448, 0}, {'b', 1, 7449, 0}, {'r', 1, 7450, 0},
+            {'t', 1, 7451, 0}, {'s', 1, 7452, 0}, {';', 0, 0, 1534}, {'e', 1, 7453, 0}, {'n', 1, 7454, 0},
+            {';', 0, 0, 1535}, {';', 0, 0, 1536}, {';', 0, 0, 1537}, {';', 0, 0, 1538}, {'w', 1, 7455, 0},
+            {';', 0, 0, 1539}, {';', 0, 0, 1540}, {';', 0, 0, 1541}, {';', 0, 0, 1542}, {';', 0, 0, 1543},
+            {';', 0, 0, 1544}, {'o', 1, 7456, 0}, {'y', 1, 7457, 0}, {';', 0, 0, 1545}, {'p', 1, 7458, 0},
+            {'i', 1, 7459, 0}, {';', 0, 0, 1546}, {';', 0, 0, 1547}, {';', 0, 0, 1548}, {'a', 1, 7460, 0},
+            {';', 0, 0, 1549}, {';', 0, 0, 1550}, {';', 0, 0, 1551}, {'k', 1, 7461, 0}, {';', 0, 0, 1552},
+            {'l', 1, 7462, 0}, {';', 0, 0, 1553}, {'u', 1, 7463, 0}, {'s', 1, 7464, 0}, {'e', 1, 7465, 0},
+            {'u', 1, 7466, 0}, {';', 0, 0, 1554}, {'d', 2, 7467, 0}, {';', 0, 0, 1555}, {';', 0, 0, 1556},
+            {';', 0, 0, 1557}, {';', 0, 0, 1558}, {';', 0, 0, 1559}, {';', 0, 0, 1560}, {'e', 1, 7469, 0},
+            {';', 0, 0, 1561}, {'w', 1, 7470, 0}, {'a', 1, 7471, 0}, {'o', 1, 7472, 0}, {'n', 1, 7473, 0},
+            {'r', 1, 7474, 0}, {';', 0, 0, 1562}, {'e', 1, 7475, 0}, {';', 0, 0, 1563}, {';', 0, 0, 1564},
+            {'e', 1, 7476, 0}, {';', 0, 0, 1565}, {'i', 1, 7477, 0}, {'p', 1, 7478, 0}, {'h', 1, 7479, 0},
+            {';', 0, 0, 1566}, {'p', 1, 7480, 0}, {';', 0, 0, 1567}, {'m', 1, 7481, 0}, {'s', 1, 7482, 0},
+            {'s', 1, 7483, 0}, {'t', 1, 7484, 0}, {'a', 1, 7485, 0}, {';', 0, 0, 1568}, {';', 0, 0, 1569},
+            {';', 0, 0, 1570}, {';', 0, 0, 1571}, {';', 0, 0, 1572}, {';', 0, 0, 1573}, {';', 0, 0, 1574},
+            {'g', 1, 7486, 0}, {';', 0, 0, 1575}, {';', 0, 0, 1576}, {';', 0, 0, 1577}, {';', 0, 0, 1578},
+            {';', 0, 0, 1579}, {';', 0, 0, 1580}, {';', 0, 0, 1581}, {';', 0, 0, 1582}, {';', 0, 0, 1583},
+            {';', 0, 0, 1584}, {';', 0, 0, 1585}, {';', 0, 0, 1586}, {';', 0, 0, 1587}, {'r', 1, 7487, 0},
+            {'n', 1, 7488, 0}, {'s', 1, 7489, 0}, {';', 0, 0, 1588}, {'l', 1, 7490, 0}, {'D', 1, 7491, 0},
+            {';', 0, 0, 1589}, {';', 0, 0, 1590}, {';', 0, 0, 1591}, {'o', 1, 7492, 0}, {'o', 1, 7493, 0},
+            {'i', 1, 7494, 0}, {'l', 1, 7495, 0}, {'i', 1, 7496, 0}, {'s', 1, 7497, 0}, {'r', 1, 7498, 0},
+            {'n', 1, 7499, 0}, {'I', 1, 7500, 0}, {'c', 1, 7501, 0}, {'C', 1, 7502, 0}, {'d', 1, 7503, 0},
+            {'i', 1, 7504, 0}, {';', 0, 0, 1592}, {'n', 1, 7505, 0}, {'l', 1, 7506, 0}, {'o', 1, 7507, 0},
+            {'o', 2, 7508, 0}, {'e', 1, 7510, 0}, {'o', 1, 7511, 0}, {'i', 1, 7512, 0}, {'p', 2, 7513, 0},
+            {'e', 1, 7515, 0}, {'o', 1, 7516, 0}, {'v', 1, 7517, 0}, {'t', 3, 7518, 0}, {'h', 1, 7521, 0},
+            {';', 0, 0, 1593}, {'A', 1, 7522, 0}, {'o', 1, 7523, 0}, {';', 0, 0, 1594}, {'a', 1, 7524, 0},
+            {'r', 1, 7525, 0}, {';', 0, 0, 1595}, {'l', 1, 7526, 0}, {'r', 1, 7527, 0}, {'t', 1, 7528, 0},
+            {'m', 1, 7529, 0}, {'e', 1, 7530, 0}, {'t', 1, 7531, 0}, {'E', 1, 7532, 0}, {'F', 1, 7533, 0},
+            {'G', 1, 7534, 0}, {'L', 1, 7535, 0}, {'S', 1, 7536, 0}, {'T', 1, 7537, 0}, {'S', 1, 7538, 0},
+            {'t', 1, 7539, 0}, {'n', 1, 7540, 0}, {'a', 1, 7541, 0}, {'r', 1, 7542, 0}, {';', 0, 0, 1596},
+            {'l', 1, 7543, 0}, {'c', 1, 7544, 0}, {'l', 1, 7545, 0}, {'t', 1, 7546, 0}, {'l', 1, 7547, 0},
+            {'o', 1, 7548, 0}, {'l', 1, 7549, 0}, {'b', 1, 7550, 0}, {'n', 2, 7551, 0}, {'o', 1, 7553, 0},
+            {'h', 1, 7554, 0}, {';', 0, 0, 1597}, {'A', 1, 7555, 0}, {'V', 1, 7556, 0}, {'a', 1, 7557, 0},
+            {'o', 1, 7558, 0}, {'e', 1, 7559, 0}, {'e', 1, 7560, 0}, {'t', 1, 7561, 0}, {'o', 1, 7562, 0},
+            {'h', 1, 7563, 0}, {'a', 1, 7564, 0}, {'l', 1, 7565, 0}, {'a', 1, 7566, 0}, {'s', 1, 7567, 0},
+            {'n', 1, 7568, 0}, {'d', 1, 7569, 0}, {'r', 1, 7570, 0}, {'t', 2, 7571, 0}, {'h', 1, 7573, 0},
+            {'t', 2, 7574, 0}, {'h', 1, 7576, 0}, {'f', 1, 7577, 0}, {'g', 1, 7578, 0}, {'p', 1, 7579, 0},
+            {'r', 1, 7580, 0}, {'u', 1, 7581, 0}, {'e', 3, 7582, 0}, {'r', 1, 7585, 0}, {'e', 1, 7586, 0},
+            {';', 0, 0, 1598}, {';', 0, 0, 1599}, {'k', 1, 7587, 0}, {'r', 1, 7588, 0}, {'a', 1, 7589, 0},
+            {'l', 1, 7590, 0}, {'e', 1, 7591, 0}, {'l', 2, 7592, 0}, {'t', 1, 7594, 0}, {'t', 1, 7595, 0},
+            {'D', 1, 7596, 0}, {'E', 1, 7597, 0}, {'T', 1, 7598, 0}, {';', 0, 0, 1600}, {'E', 1, 7599, 0},
+            {'G', 1, 7600, 0}, {'L', 1, 7601, 0}, {'S', 1, 7602, 0}, {'T', 1, 7603, 0}, {'e', 1, 7604, 0},
+            {'e', 1, 7605, 0}, {'r', 1, 7606, 0}, {'t', 1, 7607, 0}, {'r', 1, 7608, 0}, {'e', 1, 7609, 0},
+            {'e', 1, 7610, 0}, {'r', 1, 7611, 0}, {'e', 4, 7612, 0}, {'i', 1, 7616, 0}, {';', 0, 0, 1601},
+            {'l', 1, 7617, 0}, {';', 0, 0, 1602}, {'c', 2, 7618, 0}, {'e', 1, 7620, 0}, {'D', 1, 7621, 0},
+            {'u', 1, 7622, 0}, {'e', 1, 7623, 0}, {'s', 4, 7624, 0}, {';', 0, 0, 1603}, {'i', 1, 7628, 0},
+            {'E', 2, 7629, 0}, {'U', 1, 7631, 0}, {'g', 1, 7632, 0}, {'r', 1, 7633, 0}, {'i', 1, 7634, 0},
+            {'u', 1, 7635, 0}, {'w', 1, 7636, 0}, {'o', 1, 7637, 0}, {'e', 3, 7638, 0}, {'i', 1, 7641, 0},
+            {'D', 1, 7642, 0}, {'T', 1, 7643, 0}, {'V', 1, 7644, 0}, {'c', 1, 7645, 0}, {'r', 1, 7646, 0},
+            {'p', 1, 7647, 0}, {'r', 1, 7648, 0}, {'a', 1, 7649, 0}, {'w', 1, 7650, 0}, {'f', 1, 7651, 0},
+            {'g', 1, 7652, 0}, {'A', 1, 7653, 0}, {'r', 1, 7654, 0}, {'n', 1, 7655, 0}, {'u', 2, 7656, 0},
+            {'n', 1, 7658, 0}, {'q', 1, 7659, 0}, {'s', 4, 7660, 0}, {'t', 1, 7664, 0}, {'t', 2, 7665, 0},
+            {'r', 1, 7667, 0}, {'a', 1, 7668, 0}, {'c', 1, 7669, 0}, {'u', 1, 7670, 0}, {'l', 1, 7671, 0},
+            {'l', 1, 7672, 0}, {'o', 1, 7673, 0}, {'r', 1, 7674, 0}, {'r', 1, 7675, 0}, {'a', 1, 7676, 0},
+            {'r', 1, 7677, 0}, {'u', 1, 7678, 0}, {';', 0, 0, 1604}, {'B', 1, 7679, 0}, {'D', 1, 7680, 0},
+            {'r', 1, 7681, 0}, {'i', 1, 7682, 0}, {'r', 1, 7683, 0}, {';', 0, 0, 1605}, {'r', 1, 7684, 0},
+            {'f', 1, 7685, 0}, {'g', 1, 7686, 0}, {';', 0, 0, 1606}, {'l', 4, 7687, 0}, {'n', 1, 7691, 0},
+            {'t', 1, 7692, 0}, {';', 0, 0, 1607}, {'e', 1, 7693, 0}, {'a', 1, 7694, 0}, {'b', 1, 7695, 0},
+            {'c', 1, 7696, 0}, {'d', 1, 7697, 0}, {'e', 1, 7698, 0}, {'f', 1, 7699, 0}, {'g', 1, 7700, 0},
+            {'h', 1, 7701, 0}, {';', 0, 0, 1608}, {'d', 1, 7702, 0}, {';', 0, 0, 1609}, {'q', 1, 7703, 0},
+            {';', 0, 0, 1610}, {'t', 1, 7704, 0}, {'g', 1, 7705, 0}, {'i', 1, 7706, 0}, {'m', 1, 7707, 0},
+            {';', 0, 0, 1611}, {'e', 1, 7708, 0}, {'e', 1, 7709, 0}, {'k', 1, 7710, 0}, {';', 0, 0, 1612},
+            {';', 0, 0, 1613}, {';', 0, 0, 1614}, {';', 0, 0, 1615}, {';', 0, 0, 1616}, {'s', 1, 7711, 0},
+            {'e', 1, 7712, 0}, {'p', 1, 7713, 0}, {';', 0, 0, 1617}, {'n', 1, 7714, 0}, {'s', 1, 7715, 0},
+            {'e', 1, 7716, 0}, {'z', 1, 7717, 0}, {'u', 1, 7718, 0}, {'i', 1, 7719, 0}, {';', 0, 0, 1618},
+            {'s', 1, 7720, 0}, {';', 0, 0, 1619}, {'s', 1, 7721, 0}, {'b', 1, 7722, 0}, {'p', 1, 7723, 0},
+            {';', 0, 0, 1620}, {';', 0, 0, 1621}, {'o', 1, 7724, 0}, {'r', 1, 7725, 0}, {'r', 1, 7726, 0},
+            {'R', 1, 7727, 0}, {'S', 1, 7728, 0}, {'a', 1, 7729, 0}, {'c', 1, 7730, 0}, {'d', 1, 7731, 0},
+            {'t', 1, 7732, 0}, {';', 0, 0, 1622}, {'t', 1, 7733, 0}, {';', 0, 0, 1623}, {'e', 1, 7734, 0},
+            {'e', 1, 7735, 0}, {';', 0, 0, 1624}, {';', 0, 0, 1625}, {';', 0, 0, 1626}, {';', 0, 0, 1627},
+            {'p', 1, 7736, 0}, {';', 0, 0, 1628}, {'p', 1, 7737, 0}, {'s', 1, 7738, 0}, {'e', 1, 7739, 0},
+            {'d', 1, 7740, 0}, {'r', 1, 7741, 0}, {'t', 1, 7742, 0}, {';', 0, 0, 1629}, {';', 0, 0, 1630},
+            {';', 0, 0, 1631}, {';', 0, 0, 1632}, {';', 0, 0, 1633}, {'s', 1, 7743, 0}, {';', 0, 0, 1634},
+            {'n', 1, 7744, 0}, {'t', 1, 7745, 0}, {'s', 1, 7746, 0}, {';', 0, 0, 1635}, {'r', 1, 7747, 0},
+            {'a', 1, 7748, 0}, {'o', 1, 7749, 0}, {'n', 1, 7750, 0}, {'p', 1, 7751, 0}, {'w', 1, 7752, 0},
+            {';', 0, 0, 1636}, {'r', 1, 7753, 0}, {'s', 1, 7754, 0}, {'t', 1, 7755, 0}, {';', 0, 0, 1637},
+            {';', 0, 0, 1638}, {'g', 1, 7756, 0}, {'l', 1, 7757, 0}, {';', 0, 0, 1639}, {'l', 1, 7758, 0},
+            {'t', 1, 7759, 0}, {'t', 1, 7760, 0}, {'d', 1, 7761, 0}, {'t', 1, 7762, 0}, {'t', 1, 7763, 0},
+            {';', 0, 0, 1640}, {'l', 1, 7764, 0}, {'x', 1, 7765, 0}, {';', 0, 0, 1641}, {'o', 1, 7766, 0},
+            {'s', 1, 7767, 0}, {'e', 1, 7768, 0}, {';', 0, 0, 1642}, {'q', 1, 7769, 0}, {';', 0, 0, 1643},
+            {'i', 1, 7770, 0}, {'w', 1, 7771, 0}, {'w', 1, 7772, 0}, {'t', 1, 7773, 0}, {'h', 1, 7774, 0},
+            {'e', 1, 7775, 0}, {'t', 1, 7776, 0}, {'e', 1, 7777, 0}, {'s', 1, 7778, 0}, {'l', 1, 7779, 0},
+            {'k', 1, 7780, 0}, {';', 0, 0, 1644}, {';', 0, 0, 1645}, {'v', 1, 7781, 0}, {';', 0, 0, 1646},
+            {';', 0, 0, 1647}, {';', 0, 0, 1648}, {';', 0, 0, 1649}, {';', 0, 0, 1650}, {'r', 1, 7782, 0},
+            {'o', 1, 7783, 0}, {'p', 1, 7784, 0}, {'t', 1, 7785, 0}, {'h', 1, 7786, 0}, {'e', 1, 7787, 0},
+            {'t', 1, 7788, 0}, {';', 0, 0, 1651}, {'r', 1, 7789, 0}, {'r', 1, 7790, 0}, {';', 0, 0, 1652},
+            {'t', 1, 7791, 0}, {'g', 1, 7792, 0}, {';', 0, 0, 1653}, {';', 0, 0, 1654}, {'r', 1, 7793, 0},
+            {'c', 1, 7794, 0}, {'x', 1, 7795, 0}, {'t', 2, 7796, 0}, {'s', 1, 7798, 0}, {'h', 1, 7799, 0},
+            {'o', 1, 7800, 0}, {';', 0, 0, 1655}, {';', 0, 0, 1656}, {'r', 1, 7801, 0}, {';', 0, 0, 1657},
+            {'r', 1, 7802, 0}, {';', 0, 0, 1658}, {'q', 1, 7803, 0}, {';', 0, 0, 1659}, {'o', 1, 7804, 0},
+            {'e', 1, 7805, 0}, {'p', 1, 7806, 0}, {'d', 1, 7807, 0}, {';', 0, 0, 1660}, {'p', 1, 7808, 0},
+            {'r', 1, 7809, 0}, {'g', 1, 7810, 0}, {'r', 1, 7811, 0}, {';', 0, 0, 1661}, {';', 0, 0, 1662},
+            {'s', 1, 7812, 0}, {'t', 1, 7813, 0}, {';', 0, 0, 1663}, {';', 0, 0, 1664}, {'n', 1, 7814, 0},
+            {'r', 1, 7815, 0}, {'g', 1, 7816, 0}, {'n', 1, 7817, 0}, {'t', 1, 7818, 0}, {';', 0, 0, 1665},
+            {';', 0, 0, 1666}, {';', 0, 0, 1667}, {';', 0, 0, 1668}, {';', 0, 0, 1669}, {';', 0, 0, 1670},
+            {'e', 1, 7819, 0}, {';', 0, 0, 1671}, {';', 0, 0, 1672}, {'r', 1, 7820, 0}, {'i', 1, 7821, 0},
+            {'a', 1, 7822, 0}, {';', 0, 0, 1673}, {';', 0, 0, 1674}, {';', 0, 0, 1675}, {'e', 1, 7823, 0},
+            {';', 0, 0, 1676}, {';', 0, 0, 1677}, {'e', 1, 7824, 0}, {'l', 1, 7825, 0}, {';', 0, 0, 1678},
+            {';', 0, 0, 1679}, {';', 0, 0, 1680}, {';', 0, 0, 1681}, {';', 0, 0, 1682}, {';', 0, 0, 1683},
+            {';', 0, 0, 1684}, {';', 0, 0, 1685}, {'s', 1, 7826, 0}, {'l', 1, 7827, 0}, {';', 0, 0, 1686},
+            {'r', 1, 7828, 0}, {';', 0, 0, 1687}, {'r', 1, 7829, 0}, {';', 0, 0, 1688}, {';', 0, 0, 1689},
+            {';', 0, 0, 1690}, {'t', 1, 7830, 0}, {'r', 1, 7831, 0}, {'l', 1, 7832, 0}, {'p', 1, 7833, 0},
+            {'q', 1, 7834, 0}, {'m', 1, 7835, 0}, {';', 0, 0, 1691}, {'r', 1, 7836, 0}, {'e', 1, 7837, 0},
+            {'f', 1, 7838, 0}, {'i', 1, 7839, 0}, {';', 0, 0, 1692}, {';', 0, 0, 1693}, {'v', 1, 7840, 0},
+            {';', 0, 0, 1694}, {';', 0, 0, 1695}, {'l', 1, 7841, 0}, {';', 0, 0, 1696}, {';', 0, 0, 1697},
+            {';', 0, 0, 1698}, {';', 0, 0, 1699}, {'t', 1, 7842, 0}, {'r', 1, 7843, 0}, {'r', 1, 7844, 0},
+            {'f', 1, 7845, 0}, {'g', 1, 7846, 0}, {'u', 1, 7847, 0}, {'r', 1, 7848, 0}, {'o', 1, 7849, 0},
+            {'c', 1, 7850, 0}, {';', 0, 0, 1700}, {'t', 1, 7851, 0}, {'i', 1, 7852, 0}, {';', 0, 0, 1701},
+            {'t', 1, 7853, 0}, {';', 0, 0, 1702}, {'s', 1, 7854, 0}, {'d', 1, 7855, 0}, {'r', 1, 7856, 0},
+            {';', 0, 0, 1703}, {';', 0, 0, 1704}, {'t', 1, 7857, 0}, {'l', 1, 7858, 0}, {'i', 1, 7859, 0},
+            {'t', 2, 7860, 0}, {'t', 2, 7862, 0}, {'t', 2, 7864, 0}, {';', 0, 0, 1705}, {';', 0, 0, 1706},
+            {';', 0, 0, 1707}, {';', 0, 0, 1708}, {'q', 2, 7866, 0}, {'e', 1, 7868, 0}, {'r', 1, 7869, 0},
+            {'l', 1, 7870, 0}, {'p', 1, 7871, 0}, {'q', 1, 7872, 0}, {'m', 1, 7873, 0}, {';', 0, 0, 1709},
+            {';', 0, 0, 1710}, {';', 0, 0, 1711}, {';', 0, 0, 1712}, {';', 0, 0, 1713}, {';', 0, 0, 1714},
+            {';', 0, 0, 1715}, {';', 0, 0, 1716}, {'q', 2, 7874, 0}, {'e', 1, 7876, 0}, {';', 0, 0, 1717},
+            {'r', 1, 7877, 0}, {'m', 1, 7878, 0}, {'p', 1, 7879, 0}, {'m', 1, 7880, 0}, {'r', 1, 7881, 0},
+            {';', 0, 0, 1718}, {'e', 5, 7882, 0}, {'s', 1, 7887, 0}, {';', 0, 0, 1719}, {';', 0, 0, 1720},
+            {'m', 1, 7888, 0}, {'l', 1, 7889, 0}, {'r', 1, 7890, 0}, {'r', 1, 7891, 0}, {';', 0, 0, 1721},
+            {'r', 1, 7892, 0}, {'o', 1, 7893, 0}, {';', 0, 0, 1722}, {'o', 1, 7894, 0}, {'r', 1, 7895, 0},
+            {';', 0, 0, 1723}, {'l', 1, 7896, 0}, {'a', 1, 7897, 0}, {'i', 1, 7898, 0}, {'t', 1, 7899, 0},
+            {'a', 1, 7900, 0}, {'e', 1, 7901, 0}, {'e', 1, 7902, 0}, {'a', 1, 7903, 0}, {'n', 1, 7904, 0},
+            {';', 0, 0, 1724}, {';', 0, 0, 1725}, {'c', 1, 7905, 0}, {'h', 1, 7906, 0}, {'i', 1, 7907, 0},
+            {'i', 1, 7908, 0}, {'t', 1, 7909, 0}, {'t', 1, 7910, 0}, {'n', 1, 7911, 0}, {'u', 1, 7912, 0},
+            {'m', 1, 7913, 0}, {'e', 1, 7914, 0}, {'l', 1, 7915, 0}, {'t', 1, 7916, 0}, {'n', 1, 7917, 0},
+            {'t', 1, 7918, 0}, {'l', 1, 7919, 0}, {';', 0, 0, 1726}, {'c', 1, 7920, 0}, {'t', 1, 7921, 0},
+            {';', 0, 0, 1727}, {'n', 1, 7922, 0}, {'t', 1, 7923, 0}, {'w', 1, 7924, 0}, {'f', 1, 7925, 0},
+            {'n', 1, 7926, 0}, {'g', 1, 7927, 0}, {'A', 1, 7928, 0}, {'D', 1, 7929, 0}, {'r', 1, 7930, 0},
+            {'w', 3, 7931, 0}, {'e', 1, 7934, 0}, {'R', 1, 7935, 0}, {'T', 1, 7936, 0}, {'V', 1, 7937, 0},
+            {'t', 2, 7938, 0}, {'r', 1, 7940, 0}, {'w', 1, 7941, 0}, {'l', 1, 7942, 0}, {'y', 1, 7943, 0},
+            {'d', 1, 7944, 0}, {'i', 1, 7945, 0}, {'i', 1, 7946, 0}, {'a', 1, 7947, 0}, {'r', 1, 7948, 0},
+            {'r', 1, 7949, 0}, {'q', 1, 7950, 0}, {'u', 1, 7951, 0}, {'r', 1, 7952, 0}, {'e', 1, 7953, 0},
+            {'l', 1, 7954, 0}, {'i', 1, 7955, 0}, {'p', 1, 7956, 0}, {'a', 1, 7957, 0}, {'H', 1, 7958, 0},
+            {'l', 1, 7959, 0}, {'y', 1, 7960, 0}, {';', 0, 0, 1728}, {'t', 1, 7961, 0}, {'e', 2, 7962, 0},
+            {'r', 1, 7964, 0}, {'e', 1, 7965, 0}, {'w', 3, 7966, 0}, {'i', 1, 7969, 0}, {'l', 1, 7970, 0},
+            {'T', 1, 7971, 0}, {'V', 1, 7972, 0}, {'r', 1, 7973, 0}, {'t', 2, 7974, 0}, {'r', 1, 7976, 0},
+            {'e', 1, 7977, 0}, {'n', 1, 7978, 0}, {'w', 1, 7979, 0}, {'e', 1, 7980, 0}, {'c', 1, 7981, 0},
+            {'o', 1, 7982, 0}, {'w', 1, 7983, 0}, {'t', 1, 7984, 0}, {'l', 1, 7985, 0}, {'E', 1, 7986, 0},
+            {'t', 1, 7987, 0}, {';', 0, 0, 1729}, {'t', 1, 7988, 0}, {'e', 1, 7989, 0}, {'o', 1, 7990, 0},
+            {'A', 1, 7991, 0}, {'R', 1, 7992, 0}, {'t', 1, 7993, 0}, {'a', 1, 7994, 0}, {'r', 1, 7995, 0},
+            {'t', 1, 7996, 0}, {'t', 1, 7997, 0}, {'h', 1, 7998, 0}, {'a', 1, 7999, 0}, {'f', 1, 8000, 0},
+            {'s', 1, 8001, 0}, {'M', 1, 8002, 0}, {'T', 1, 8003, 0}, {'V', 1, 8004, 0}, {'e', 1, 8005, 0},
+            {'s', 1, 8006, 0}, {'i', 1, 8007, 0}, {'u', 1, 8008, 0}, {'p', 1, 8009, 0}, {'e', 1, 8010, 0},
+            {'n', 1, 8011, 0}, {';', 0, 0, 1730}, {'T', 1, 8012, 0}, {'s', 1, 8013, 0}, {'e', 1, 8014, 0},
+            {'o', 1, 8015, 0}, {'q', 1, 8016, 0}, {'r', 1, 8017, 0}, {'q', 1, 8018, 0}, {'r', 1, 8019, 0},
+            {'e', 1, 8020, 0}, {'l', 1, 8021, 0}, {'i', 1, 8022, 0}, {'d', 2, 8023, 0}, {'d', 1, 8025, 0},
+            {'s', 1, 8026, 0}, {'T', 1, 8027, 0}, {'e', 1, 8028, 0}, {'t', 2, 8029, 0}, {'e', 1, 8031, 0},
+            {'s', 1, 8032, 0}, {';', 0, 0, 1731}, {'E', 1, 8033, 0}, {'F', 1, 8034, 0}, {'T', 1, 8035, 0},
+            {'c', 1, 8036, 0}, {'y', 2, 8037, 0}, {'e', 1, 8039, 0}, {'k', 1, 8040, 0}, {'n', 1, 8041, 0},
+            {';', 0, 0, 1732}, {'s', 1, 8042, 0}, {'p', 1, 8043, 0}, {';', 0, 0, 1733}, {'E', 1, 8044, 0},
+            {'S', 1, 8045, 0}, {'T', 1, 8046, 0}, {'o', 1, 8047, 0}, {'l', 1, 8048, 0}, {'q', 1, 8049, 0},
+            {'p', 1, 8050, 0}, {'l', 1, 8051, 0}, {'o', 1, 8052, 0}, {'l', 1, 8053, 0}, {'b', 1, 8054, 0},
+            {'n', 2, 8055, 0}, {'o', 1, 8057, 0}, {';', 0, 0, 1734}, {'A', 1, 8058, 0}, {'V', 1, 8059, 0},
+            {'a', 1, 8060, 0}, {'o', 1, 8061, 0}, {'e', 1, 8062, 0}, {'e', 1, 8063, 0}, {'t', 1, 8064, 0},
+            {'o', 1, 8065, 0}, {'l', 1, 8066, 0}, {'r', 1, 8067, 0}, {'y', 1, 8068, 0}, {'n', 1, 8069, 0},
+            {'t', 1, 8070, 0}, {'h', 1, 8071, 0}, {'r', 1, 8072, 0}, {'c', 1, 8073, 0}, {'t', 1, 8074, 0},
+            {'b', 1, 8075, 0}, {'p', 1, 8076, 0}, {'i', 1, 8077, 0}, {'u', 1, 8078, 0}, {';', 0, 0, 1735},
+            {'E', 1, 8079, 0}, {'S', 1, 8080, 0}, {'T', 1, 8081, 0}, {';', 0, 0, 1736}, {';', 0, 0, 1737},
+            {'E', 1, 8082, 0}, {'e', 1, 8083, 0}, {'c', 1, 8084, 0}, {'e', 1, 8085, 0}, {'a', 1, 8086, 0},
+            {'l', 1, 8087, 0}, {'d', 1, 8088, 0}, {'t', 1, 8089, 0}, {';', 0, 0, 1738}, {';', 0, 0, 1739},
+            {'c', 2, 8090, 0}, {'e', 1, 8092, 0}, {'s', 1, 8093, 0}, {'a', 1, 8094, 0}, {'o', 1, 8095, 0},
+            {'r', 1, 8096, 0}, {'b', 1, 8097, 0}, {'o', 1, 8098, 0}, {'r', 1, 8099, 0}, {'t', 1, 8100, 0},
+            {'h', 1, 8101, 0}, {'B', 1, 8102, 0}, {'L', 1, 8103, 0}, {'S', 1, 8104, 0}, {'T', 1, 8105, 0},
+            {'S', 1, 8106, 0}, {'h', 1, 8107, 0}, {';', 0, 0, 1740}, {';', 0, 0, 1741}, {';', 0, 0, 1742},
+            {';', 0, 0, 1743}, {';', 0, 0, 1744}, {';', 0, 0, 1745}, {';', 0, 0, 1746}, {';', 0, 0, 1747},
+            {';', 0, 0, 1748}, {';', 0, 0, 1749}, {';', 0, 0, 1750}, {';', 0, 0, 1751}, {';', 0, 0, 1752},
+            {'l', 1, 8108, 0}, {'e', 1, 8109, 0}, {'q', 1, 8110, 0}, {';', 0, 0, 1753}, {';', 0, 0, 1754},
+            {';', 0, 0, 1755}, {'s', 1, 8111, 0}, {';', 0, 0, 1756}, {'g', 1, 8112, 0}, {';', 0, 0, 1757},
+            {';', 0, 0, 1758}, {'e', 1, 8113, 0}, {'a', 1, 8114, 0}, {'a', 1, 8115, 0}, {';', 0, 0, 1759},
+            {';', 0, 0, 1760}, {';', 0, 0, 1761}, {';', 0, 0, 1762}, {'t', 1, 8116, 0}, {'k', 1, 8117, 0},
+            {'r', 1, 8118, 0}, {';', 0, 0, 1763}, {';', 0, 0, 1764}, {'s', 1, 8119, 0}, {'i', 1, 8120, 0},
+            {'a', 1, 8121, 0}, {';', 0, 0, 1765}, {';', 0, 0, 1766}, {'n', 1, 8122, 0}, {'s', 1, 8123, 0},
+            {';', 0, 0, 1767}, {'r', 1, 8124, 0}, {'u', 1, 8125, 0}, {';', 0, 0, 1768}, {'g', 1, 8126, 0},
+            {'o', 1, 8127, 0}, {';', 0, 0, 1769}, {'u', 1, 8128, 0}, {'t', 1, 8129, 0}, {';', 0, 0, 1770},
+            {';', 0, 0, 1771}, {'e', 1, 8130, 0}, {'r', 1, 8131, 0}, {'w', 1, 8132, 0}, {'a', 1, 8133, 0},
+            {'o', 1, 8134, 0}, {';', 0, 0, 1772}, {';', 0, 0, 1773}, {';', 0, 0, 1774}, {';', 0, 0, 1775},
+            {'t', 1, 8135, 0}, {'e', 1, 8136, 0}, {';', 0, 0, 1776}, {'i', 1, 8137, 0}, {'i', 1, 8138, 0},
+            {'o', 1, 8139, 0}, {';', 0, 0, 1777}, {';', 0, 0, 1778}, {';', 0, 0, 1779}, {';', 0, 0, 1780},
+            {'x', 1, 8140, 0}, {'s', 1, 8141, 0}, {'s', 1, 8142, 0}, {'q', 1, 8143, 0}, {'t', 1, 8144, 0},
+            {';', 0, 0, 1781}, {';', 0, 0, 1782}, {'a', 1, 8145, 0}, {'t', 1, 8146, 0}, {';', 0, 0, 1783},
+            {';', 0, 0, 1784}, {';', 0, 0, 1785}, {';', 0, 0, 1786}, {';', 0, 0, 1787}, {';', 0, 0, 1788},
+            {';', 0, 0, 1789}, {';', 0, 0, 1790}, {'w', 2, 8147, 0}, {'o', 1, 8149, 0}, {'a', 1, 8150, 0},
+            {'t', 3, 8151, 0}, {'e', 1, 8154, 0}, {';', 0, 0, 1791}, {';', 0, 0, 1792}, {'o', 1, 8155, 0},
+            {'r', 1, 8156, 0}, {'t', 1, 8157, 0}, {';', 0, 0, 1793}, {'h', 1, 8158, 0}, {';', 0, 0, 1794},
+            {'a', 1, 8159, 0}, {'r', 1, 8160, 0}, {'t', 1, 8161, 0}, {'t', 1, 8162, 0}, {'w', 2, 8163, 0},
+            {';', 0, 0, 1795}, {';', 0, 0, 1796}, {'q', 1, 8165, 0}, {'w', 1, 8166, 0}, {'f', 1, 8167, 0},
+            {';', 0, 0, 1797}, {'a', 1, 8168, 0}, {';', 0, 0, 1798}, {'o', 1, 8169, 0}, {'h', 1, 8170, 0},
+            {'r', 1, 8171, 0}, {';', 0, 0, 1799}, {';', 0, 0, 1800}, {'t', 1, 8172, 0}, {'o', 1, 8173, 0},
+            {'h', 1, 8174, 0}, {'t', 1, 8175, 0}, {';', 0, 0, 1801}, {'l', 1, 8176, 0}, {'r', 1, 8177, 0},
+            {'d', 1, 8178, 0}, {'r', 1, 8179, 0}, {'q', 2, 8180, 0}, {'q', 2, 8182, 0}, {'e', 2, 8184, 0},
+            {';', 0, 0, 1802}, {';', 0, 0, 1803}, {'k', 1, 8186, 0}, {';', 0, 0, 1804}, {';', 0, 0, 1805},
+            {'o', 1, 8187, 0}, {'y', 1, 8188, 0}, {'r', 1, 8189, 0}, {';', 0, 0, 1806}, {';', 0, 0, 1807},
+            {';', 0, 0, 1808}, {';', 0, 0, 1809}, {';', 0, 0, 1810}, {'o', 1, 8190, 0}, {';', 0, 0, 1811},
+            {'s', 1, 8191, 0}, {';', 0, 0, 1812}, {'o', 1, 8192, 0}, {'p', 1, 8193, 0}, {'t', 2, 8194, 0},
+            {'h', 1, 8196, 0}, {'i', 1, 8197, 0}, {'e', 1, 8198, 0}, {'t', 1, 8199, 0}, {'h', 1, 8200, 0},
+            {';', 0, 0, 1813}, {';', 0, 0, 1814}, {';', 0, 0, 1815}, {';', 0, 0, 1816}, {';', 0, 0, 1817},
+            {'a', 1, 8201, 0}, {'m', 1, 8202, 0}, {';', 0, 0, 1818}, {'t', 1, 8203, 0}, {';', 0, 0, 1819},
+            {'e', 1, 8204, 0}, {';', 0, 0, 1820}, {'e', 1, 8205, 0}, {'e', 1, 8206, 0}, {'p', 1, 8207, 0},
+            {';', 0, 0, 1821}, {'q', 1, 8208, 0}, {'q', 2, 8209, 0}, {'o', 1, 8211, 0}, {'y', 1, 8212, 0},
+            {'r', 1, 8213, 0}, {';', 0, 0, 1822}, {';', 0, 0, 1823}, {';', 0, 0, 1824}, {'q', 1, 8214, 0},
+            {'q', 2, 8215, 0}, {'e', 1, 8217, 0}, {';', 0, 0, 1825}, {'r', 1, 8218, 0}, {';', 0, 0, 1826},
+            {';', 0, 0, 1827}, {';', 0, 0, 1828}, {'d', 1, 8219, 0}, {'l', 1, 8220, 0}, {'q', 1, 8221, 0},
+            {'r', 1, 8222, 0}, {';', 0, 0, 1829}, {';', 0, 0, 1830}, {'e', 1, 8223, 0}, {'i', 1, 8224, 0},
+            {';', 0, 0, 1831}, {'r', 1, 8225, 0}, {'n', 2, 8226, 0}, {'w', 1, 8228, 0}, {';', 0, 0, 1832},
+            {'o', 1, 8229, 0}, {';', 0, 0, 1833}, {'n', 1, 8230, 0}, {'o', 1, 8231, 0}, {';', 0, 0, 1834},
+            {'t', 1, 8232, 0}, {'t', 1, 8233, 0}, {';', 0, 0, 1835}, {'g', 1, 8234, 0}, {'t', 1, 8235, 0},
+            {';', 0, 0, 1836}, {'s', 1, 8236, 0}, {'f', 1, 8237, 0}, {';', 0, 0, 1837}, {';', 0, 0, 1838},
+            {'u', 1, 8238, 0}, {'s', 1, 8239, 0}, {'e', 1, 8240, 0}, {'C', 1, 8241, 0}, {'y', 2, 8242, 0},
+            {';', 0, 0, 1839}, {'t', 1, 8244, 0}, {';', 0, 0, 1840}, {'o', 1, 8245, 0}, {'a', 1, 8246, 0},
+            {'i', 1, 8247, 0}, {'t', 1, 8248, 0}, {';', 0, 0, 1841}, {'n', 1, 8249, 0}, {'t', 3, 8250, 0},
+            {'g', 2, 8253, 0}, {'h', 1, 8255, 0}, {'r', 1, 8256, 0}, {'o', 1, 8257, 0}, {'t', 1, 8258, 0},
+            {';', 0, 0, 1842}, {'B', 1, 8259, 0}, {'U', 1, 8260, 0}, {';', 0, 0, 1843}, {'i', 1, 8261, 0},
+            {'e', 1, 8262, 0}, {'e', 1, 8263, 0}, {'T', 1, 8264, 0}, {'V', 1, 8265, 0}, {'r', 1, 8266, 0},
+            {';', 0, 0, 1844}, {'l', 1, 8267, 0}, {'S', 1, 8268, 0}, {'e', 1, 8269, 0}, {'u', 1, 8270, 0},
+            {'a', 1, 8271, 0}, {'l', 1, 8272, 0}, {'y', 1, 8273, 0}, {'f', 1, 8274, 0}, {'u', 1, 8275, 0},
+            {'l', 1, 8276, 0}, {'e', 1, 8277, 0}, {'s', 1, 8278, 0}, {'a', 1, 8279, 0}, {'l', 1, 8280, 0},
+            {'a', 1, 8281, 0}, {'l', 1, 8282, 0}, {'u', 1, 8283, 0}, {';', 0, 0, 1845}, {'I', 1, 8284, 0},
+            {'i', 1, 8285, 0}, {'C', 1, 8286, 0}, {'T', 1, 8287, 0}, {'f', 1, 8288, 0}, {'B', 1, 8289, 0},
+            {';', 0, 0, 1846}, {'B', 1, 8290, 0}, {'R', 1, 8291, 0}, {'n', 1, 8292, 0}, {'e', 1, 8293, 0},
+            {'e', 1, 8294, 0}, {'e', 1, 8295, 0}, {';', 0, 0, 1847}, {'A', 1, 8296, 0}, {'V', 1, 8297, 0},
+            {'r', 1, 8298, 0}, {'c', 1, 8299, 0}, {'g', 1, 8300, 0}, {'n', 1, 8301, 0}, {'V', 1, 8302, 0},
+            {'t', 1, 8303, 0}, {'r', 2, 8304, 0}, {';', 0, 0, 1848}, {'a', 1, 8306, 0}, {'G', 1, 8307, 0},
+            {'q', 1, 8308, 0}, {'e', 1, 8309, 0}, {'E', 1, 8310, 0}, {';', 0, 0, 1849}, {'w', 1, 8311, 0},
+            {'r', 1, 8312, 0}, {'i', 1, 8313, 0}, {'A', 1, 8314, 0}, {'r', 1, 8315, 0}, {'i', 1, 8316, 0},
+            {'a', 1, 8317, 0}, {'A', 1, 8318, 0}, {'t', 1, 8319, 0}, {'c', 1, 8320, 0}, {';', 0, 0, 1850},
+            {';', 0, 0, 1851}, {'e', 1, 8321, 0}, {'h', 1, 8322, 0}, {'e', 1, 8323, 0}, {'a', 1, 8324, 0},
+            {'s', 1, 8325, 0}, {'n', 1, 8326, 0}, {'e', 1, 8327, 0}, {';', 0, 0, 1852}, {'V', 1, 8328, 0},
+            {'t', 1, 8329, 0}, {'i', 1, 8330, 0}, {';', 0, 0, 1853}, {'r', 7, 8331, 0}, {'w', 1, 8338, 0},
+            {'u', 1, 8339, 0}, {'i', 1, 8340, 0}, {'u', 1, 8341, 0}, {'e', 1, 8342, 0}, {'s', 1, 8343, 0},
+            {'a', 1, 8344, 0}, {'l', 1, 8345, 0}, {'G', 1, 8346, 0}, {'L', 1, 8347, 0}, {'e', 1, 8348, 0},
+            {'e', 1, 8349, 0}, {'r', 1, 8350, 0}, {'S', 1, 8351, 0}, {';', 0, 0, 1854}, {'E', 1, 8352, 0},
+            {'d', 1, 8353, 0}, {'e', 1, 8354, 0}, {'q', 1, 8355, 0}, {'u', 1, 8356, 0}, {'i', 1, 8357, 0},
+            {'a', 1, 8358, 0}, {'D', 1, 8359, 0}, {'Q', 1, 8360, 0}, {';', 0, 0, 1855}, {'e', 1, 8361, 0},
+            {'t', 1, 8362, 0}, {';', 0, 0, 1856}, {'l', 1, 8363, 0}, {'q', 1, 8364, 0}, {'l', 1, 8365, 0},
+            {'i', 1, 8366, 0}, {'n', 2, 8367, 0}, {'e', 1, 8369, 0}, {'u', 1, 8370, 0}, {'E', 1, 8371, 0},
+            {'e', 1, 8372, 0}, {'w', 3, 8373, 0}, {'i', 1, 8376, 0}, {'l', 1, 8377, 0}, {'T', 1, 8378, 0},
+            {'V', 1, 8379, 0}, {'r', 1, 8380, 0}, {'r', 1, 8381, 0}, {'e', 1, 8382, 0}, {'n', 1, 8383, 0},
+            {'w', 1, 8384, 0}, {'e', 1, 8385, 0}, {'c', 1, 8386, 0}, {'o', 1, 8387, 0}, {'w', 1, 8388, 0},
+            {'i', 1, 8389, 0}, {'o', 1, 8390, 0}, {'e', 1, 8391, 0}, {'A', 1, 8392, 0}, {'A', 1, 8393, 0},
+            {'t', 1, 8394, 0}, {'r', 1, 8395, 0}, {'l', 1, 8396, 0}, {'e', 1, 8397, 0}, {'s', 1, 8398, 0},
+            {'e', 1, 8399, 0}, {'o', 1, 8400, 0}, {'a', 1, 8401, 0}, {'q', 1, 8402, 0}, {'l', 1, 8403, 0},
+            {'i', 1, 8404, 0}, {'q', 1, 8405, 0}, {';', 0, 0, 1857}, {'e', 1, 8406, 0}, {';', 0, 0, 1858},
+            {'l', 1, 8407, 0}, {'E', 1, 8408, 0}, {'e', 1, 8409, 0}, {';', 0, 0, 1859}, {'e', 1, 8410, 0},
+            {'k', 1, 8411, 0}, {'n', 1, 8412, 0}, {';', 0, 0, 1860}, {'r', 1, 8413, 0}, {'w', 1, 8414, 0},
+            {'o', 1, 8415, 0}, {'r', 1, 8416, 0}, {'w', 1, 8417, 0}, {'o', 1, 8418, 0}, {'A', 1, 8419, 0},
+            {'t', 1, 8420, 0}, {'a', 1, 8421, 0}, {'i', 1, 8422, 0}, {'e', 1, 8423, 0}, {'i', 1, 8424, 0},
+            {'p', 1, 8425, 0}, {'S', 1, 8426, 0}, {'o', 1, 8427, 0}, {';', 0, 0, 1861}, {';', 0, 0, 1862},
+            {';', 0, 0, 1863}, {'l', 1, 8428, 0}, {'n', 1, 8429, 0}, {'r', 1, 8430, 0}, {'n', 1, 8431, 0},
+            {';', 0, 0, 1864}, {';', 0, 0, 1865}, {'o', 1, 8432, 0}, {'t', 1, 8433, 0}, {'r', 1, 8434, 0},
+            {'s', 1, 8435, 0}, {'t', 1, 8436, 0}, {';', 0, 0, 1866}, {'e', 1, 8437, 0}, {'c', 1, 8438, 0},
+            {'e', 1, 8439, 0}, {'w', 2, 8440, 0}, {'i', 1, 8442, 0}, {'i', 1, 8443, 0}, {';', 0, 0, 1867},
+            {'w', 1, 8444, 0}, {';', 0, 0, 1868}, {'r', 1, 8445, 0}, {'o', 1, 8446, 0}, {'r', 1, 8447, 0},
+            {'s', 1, 8448, 0}, {'o', 1, 8449, 0}, {'a', 1, 8450, 0}, {'t', 1, 8451, 0}, {';', 0, 0, 1869},
+            {';', 0, 0, 1870}, {'s', 1, 8452, 0}, {';', 0, 0, 1871}, {';', 0, 0, 1872}, {'r', 1, 8453, 0},
+            {'a', 1, 8454, 0}, {';', 0, 0, 1873}, {'t', 1, 8455, 0}, {'o', 1, 8456, 0}, {'r', 1, 8457, 0},
+            {'a', 1, 8458, 0}, {'h', 1, 8459, 0}, {'s', 1, 8460, 0}, {'t', 1, 8461, 0}, {'x', 1, 8462, 0},
+            {';', 0, 0, 1874}, {'r', 1, 8463, 0}, {'e', 1, 8464, 0}, {'r', 1, 8465, 0}, {'i', 1, 8466, 0},
+            {'o', 1, 8467, 0}, {'a', 1, 8468, 0}, {'l', 1, 8469, 0}, {'r', 1, 8470, 0}, {';', 0, 0, 1875},
+            {'n', 1, 8471, 0}, {'t', 1, 8472, 0}, {'n', 1, 8473, 0}, {'w', 1, 8474, 0}, {'t', 1, 8475, 0},
+            {'o', 1, 8476, 0}, {';', 0, 0, 1876}, {'w', 1, 8477, 0}, {'t', 1, 8478, 0}, {';', 0, 0, 1877},
+            {';', 0, 0, 1878}, {'o', 1, 8479, 0}, {';', 0, 0, 1879}, {'a', 1, 8480, 0}, {';', 0, 0, 1880},
+            {'q', 1, 8481, 0}, {';', 0, 0, 1881}, {'q', 1, 8482, 0}, {'l', 1, 8483, 0}, {'r', 1, 8484, 0},
+            {';', 0, 0, 1882}, {'x', 1, 8485, 0}, {'e', 1, 8486, 0}, {'o', 1, 8487, 0}, {'n', 1, 8488, 0},
+            {';', 0, 0, 1883}, {'w', 2, 8489, 0}, {'o', 1, 8491, 0}, {'a', 1, 8492, 0}, {'h', 1, 8493, 0},
+            {'t', 1, 8494, 0}, {'g', 1, 8495, 0}, {'e', 1, 8496, 0}, {'s', 1, 8497, 0}, {'e', 1, 8498, 0},
+            {'l', 1, 8499, 0}, {'i', 1, 8500, 0}, {';', 0, 0, 1884}, {'q', 1, 8501, 0}, {'q', 1, 8502, 0},
+            {'p', 1, 8503, 0}, {'h', 1, 8504, 0}, {';', 0, 0, 1885}, {';', 0, 0, 1886}, {'q', 1, 8505, 0},
+            {'x', 1, 8506, 0}, {'e', 1, 8507, 0}, {'o', 1, 8508, 0}, {';', 0, 0, 1887}, {';', 0, 0, 1888},
+            {'q', 1, 8509, 0}, {';', 0, 0, 1889}, {'o', 1, 8510, 0}, {'o', 1, 8511, 0}, {'e', 1, 8512, 0},
+            {';', 0, 0, 1890}, {'i', 1, 8513, 0}, {'f', 1, 8514, 0}, {'g', 1, 8515, 0}, {'o', 1, 8516, 0},
+            {'l', 1, 8517, 0}, {'r', 1, 8518, 0}, {'s', 1, 8519, 0}, {'n', 1, 8520, 0}, {'g', 1, 8521, 0},
+            {';', 0, 0, 1891}, {'n', 1, 8522, 0}, {'n', 1, 8523, 0}, {'l', 1, 8524, 0}, {'i', 1, 8525, 0},
+            {';', 0, 0, 1892}, {'f', 1, 8526, 0}, {'s', 1, 8527, 0}, {';', 0, 0, 1893}, {'s', 1, 8528, 0},
+            {'o', 1, 8529, 0}, {'D', 1, 8530, 0}, {'Q', 1, 8531, 0}, {'e', 1, 8532, 0}, {'c', 1, 8533, 0},
+            {'l', 4, 8534, 0}, {'a', 1, 8538, 0}, {'o', 1, 8539, 0}, {'A', 1, 8540, 0}, {'A', 1, 8541, 0},
+            {'R', 1, 8542, 0}, {'T', 1, 8543, 0}, {'L', 1, 8544, 0}, {'R', 1, 8545, 0}, {'t', 2, 8546, 0},
+            {'r', 1, 8548, 0}, {'w', 1, 8549, 0}, {'i', 1, 8550, 0}, {'a', 1, 8551, 0}, {'p', 1, 8552, 0},
+            {'g', 1, 8553, 0}, {'e', 1, 8554, 0}, {'c', 1, 8555, 0}, {'e', 1, 8556, 0}, {'e', 1, 8557, 0},
+            {'o', 1, 8558, 0}, {'S', 1, 8559, 0}, {'m', 1, 8560, 0}, {';', 0, 0, 1894}, {'m', 1, 8561, 0},
+            {'l', 1, 8562, 0}, {'l', 1, 8563, 0}, {'S', 1, 8564, 0}, {';', 0, 0, 1895}, {'a', 1, 8565, 0},
+            {'l', 1, 8566, 0}, {'a', 1, 8567, 0}, {'s', 1, 8568, 0}, {'n', 1, 8569, 0}, {'d', 1, 8570, 0},
+            {'c', 1, 8571, 0}, {'L', 1, 8572, 0}, {'m', 1, 8573, 0}, {';', 0, 0, 1896}, {'o', 1, 8574, 0},
+            {'o', 1, 8575, 0}, {'i', 1, 8576, 0}, {';', 0, 0, 1897}, {'r', 1, 8577, 0}, {'a', 1, 8578, 0},
+            {'i', 1, 8579, 0}, {'g', 1, 8580, 0}, {'B', 1, 8581, 0}, {'e', 1, 8582, 0}, {'c', 1, 8583, 0},
+            {'r', 1, 8584, 0}, {'e', 1, 8585, 0}, {'o', 1, 8586, 0}, {'t', 1, 8587, 0}, {'l', 1, 8588, 0},
+            {'V', 1, 8589, 0}, {'e', 1, 8590, 0}, {'o', 1, 8591, 0}, {';', 0, 0, 1898}, {'B', 1, 8592, 0},
+            {'r', 1, 8593, 0}, {'r', 1, 8594, 0}, {'u', 1, 8595, 0}, {'r', 1, 8596, 0}, {'q', 1, 8597, 0},
+            {';', 0, 0, 1899}, {'r', 1, 8598, 0}, {'g', 1, 8599, 0}, {'r', 1, 8600, 0}, {'r', 1, 8601, 0},
+            {'g', 1, 8602, 0}, {'r', 1, 8603, 0}, {'r', 1, 8604, 0}, {'A', 1, 8605, 0}, {'e', 1, 8606, 0},
+            {'d', 1, 8607, 0}, {'i', 2, 8608, 0}, {'r', 1, 8610, 0}, {'t', 1, 8611, 0}, {'L', 1, 8612, 0},
+            {'g', 1, 8613, 0}, {'n', 1, 8614, 0}, {'e', 1, 8615, 0}, {';', 0, 0, 1900}, {'l', 1, 8616, 0},
+            {';', 0, 0, 1901}, {'E', 1, 8617, 0}, {'F', 1, 8618, 0}, {'G', 1, 8619, 0}, {'L', 1, 8620, 0},
+            {'S', 1, 8621, 0}, {'T', 1, 8622, 0}, {'n', 1, 8623, 0}, {'a', 1, 8624, 0}, {'a', 1, 8625, 0},
+            {'a', 1, 8626, 0}, {'a', 1, 8627, 0}, {'s', 1, 8628, 0}, {'n', 1, 8629, 0}, {'d', 1, 8630, 0},
+            {'r', 1, 8631, 0}, {'e', 1, 8632, 0}, {'s', 3, 8633, 0}, {'E', 1, 8636, 0}, {'i', 1, 8637, 0},
+            {'u', 2, 8638, 0}, {'q', 1, 8640, 0}, {'s', 4, 8641, 0}, {'t', 2, 8645, 0}, {'u', 1, 8647, 0},
+            {'l', 1, 8648, 0}, {'l', 1, 8649, 0}, {'l', 1, 8650, 0}, {'o', 1, 8651, 0}, {'u', 1, 8652, 0},
+            {'t', 1, 8653, 0}, {'h', 1, 8654, 0}, {'a', 1, 8655, 0}, {'u', 1, 8656, 0}, {'a', 1, 8657, 0},
+            {'l', 1, 8658, 0}, {';', 0, 0, 1902}, {'a', 1, 8659, 0}, {'m', 1, 8660, 0}, {'i', 1, 8661, 0},
+            {'q', 1, 8662, 0}, {'B', 1, 8663, 0}, {';', 0, 0, 1903}, {'B', 1, 8664, 0}, {'L', 1, 8665, 0},
+            {'n', 1, 8666, 0}, {'e', 1, 8667, 0}, {'e', 1, 8668, 0}, {'e', 1, 8669, 0}, {';', 0, 0, 1904},
+            {'r', 1, 8670, 0}, {'c', 1, 8671, 0}, {'g', 1, 8672, 0}, {'n', 1, 8673, 0}, {'V', 1, 8674, 0},
+            {'t', 1, 8675, 0}, {'r', 2, 8676, 0}, {';', 0, 0, 1905}, {'e', 1, 8678, 0}, {'w', 1, 8679, 0},
+            {'d', 1, 8680, 0}, {'r', 1, 8681, 0}, {'r', 1, 8682, 0}, {'A', 1, 8683, 0}, {'o', 1, 8684, 0},
+            {'e', 1, 8685, 0}, {'r', 1, 8686, 0}, {'e', 1, 8687, 0}, {'r', 1, 8688, 0}, {'n', 1, 8689, 0},
+            {'l', 1, 8690, 0}, {'u', 1, 8691, 0}, {'a', 1, 8692, 0}, {'l', 1, 8693, 0}, {'u', 1, 8694, 0},
+            {';', 0, 0, 1906}, {';', 0, 0, 1907}, {'q', 1, 8695, 0}, {';', 0, 0, 1908}, {';', 0, 0, 1909},
+            {'e', 1, 8696, 0}, {'t', 1, 8697, 0}, {';', 0, 0, 1910}, {'n', 1, 8698, 0}, {'w', 1, 8699, 0},
+            {'i', 1, 8700, 0}, {';', 0, 0, 1911}, {'w', 1, 8701, 0}, {'r', 1, 8702, 0}, {'A', 1, 8703, 0},
+            {'r', 1, 8704, 0}, {'n', 1, 8705, 0}, {'p', 1, 8706, 0}, {'l', 1, 8707, 0}, {'a', 1, 8708, 0},
+            {'p', 1, 8709, 0}, {'n', 1, 8710, 0}, {'e', 2, 8711, 0}, {'g', 1, 8713, 0}, {'e', 1, 8714, 0},
+            {'g', 1, 8715, 0}, {'w', 2, 8716, 0}, {';', 0, 0, 1912}, {'c', 1, 8718, 0}, {'h', 1, 8719, 0},
+            {';', 0, 0, 1913}, {'c', 1, 8720, 0}, {'c', 1, 8721, 0}, {';', 0, 0, 1914}, {'l', 1, 8722, 0},
+            {'r', 1, 8723, 0}, {'t', 1, 8724, 0}, {'m', 1, 8725, 0}, {'e', 1, 8726, 0}, {'r', 1, 8727, 0},
+            {'n', 2, 8728, 0}, {';', 0, 0, 1915}, {'s', 1, 8730, 0}, {'n', 1, 8731, 0}, {'l', 1, 8732, 0},
+            {'s', 1, 8733, 0}, {';', 0, 0, 1916}, {'r', 1, 8734, 0}, {'r', 1, 8735, 0}, {'a', 1, 8736, 0},
+            {'n', 2, 8737, 0}, {'r', 1, 8739, 0}, {'r', 1, 8740, 0}, {'a', 1, 8741, 0}, {'q', 1, 8742, 0},
+            {'i', 1, 8743, 0}, {';', 0, 0, 1917}, {';', 0, 0, 1918}, {';', 0, 0, 1919}, {'r', 1, 8744, 0},
+            {'g', 1, 8745, 0}, {';', 0, 0, 1920}, {'r', 1, 8746, 0}, {'e', 1, 8747, 0}, {'i', 1, 8748, 0},
+            {';', 0, 0, 1921}, {';', 0, 0, 1922}, {'g', 1, 8749, 0}, {';', 0, 0, 1923}, {'a', 1, 8750, 0},
+            {'w', 1, 8751, 0}, {';', 0, 0, 1924}, {'a', 1, 8752, 0}, {'w', 1, 8753, 0}, {'l', 1, 8754, 0},
+            {';', 0, 0, 1925}, {';', 0, 0, 1926}, {'e', 1, 8755, 0}, {'i', 1, 8756, 0}, {';', 0, 0, 1927},
+            {'q', 1, 8757, 0}, {'x', 1, 8758, 0}, {'s', 1, 8759, 0}, {';', 0, 0, 1928}, {'t', 1, 8760, 0},
+            {'o', 1, 8761, 0}, {'r', 1, 8762, 0}, {'a', 1, 8763, 0}, {'a', 1, 8764, 0}, {'a', 1, 8765, 0},
+            {'t', 1, 8766, 0}, {'e', 1, 8767, 0}, {';', 0, 0, 1929}, {'l', 1, 8768, 0}, {'n', 1, 8769, 0},
+            {';', 0, 0, 1930}, {';', 0, 0, 1931}, {'s', 1, 8770, 0}, {'i', 1, 8771, 0}, {';', 0, 0, 1932},
+            {';', 0, 0, 1933}, {'q', 1, 8772, 0}, {'x', 1, 8773, 0}, {';', 0, 0, 1934}, {'x', 1, 8774, 0},
+            {'w', 1, 8775, 0}, {'f', 1, 8776, 0}, {'g', 1, 8777, 0}, {'t', 1, 8778, 0}, {'h', 1, 8779, 0},
+            {'w', 1, 8780, 0}, {'e', 1, 8781, 0}, {'i', 1, 8782, 0}, {';', 0, 0, 1935}, {';', 0, 0, 1936},
+            {';', 0, 0, 1937}, {'e', 1, 8783, 0}, {'e', 1, 8784, 0}, {'e', 2, 8785, 0}, {'o', 1, 8787, 0},
+            {'e', 1, 8788, 0}, {';', 0, 0, 1938}, {';', 0, 0, 1939}, {'n', 1, 8789, 0}, {'o', 1, 8790, 0},
+            {'u', 1, 8791, 0}, {'g', 1, 8792, 0}, {'k', 1, 8793, 0}, {'A', 1, 8794, 0}, {'D', 1, 8795, 0},
+            {'G', 1, 8796, 0}, {'T', 1, 8797, 0}, {'l', 1, 8798, 0}, {'u', 1, 8799, 0}, {'r', 1, 8800, 0},
+            {'r', 1, 8801, 0}, {'i', 1, 8802, 0}, {'e', 1, 8803, 0}, {'e', 1, 8804, 0}, {'i', 1, 8805, 0},
+            {'A', 1, 8806, 0}, {'T', 1, 8807, 0}, {'o', 1, 8808, 0}, {'n', 1, 8809, 0}, {'c', 1, 8810, 0},
+            {'r', 1, 8811, 0}, {'A', 1, 8812, 0}, {'h', 1, 8813, 0}, {'V', 1, 8814, 0}, {'t', 1, 8815, 0},
+            {'e', 1, 8816, 0}, {'c', 1, 8817, 0}, {'w', 1, 8818, 0}, {'q', 1, 8819, 0}, {'a', 1, 8820, 0},
+            {';', 0, 0, 1940}, {'E', 1, 8821, 0}, {'S', 1, 8822, 0}, {'m', 1, 8823, 0}, {'l', 2, 8824, 0},
+            {'E', 1, 8826, 0}, {'t', 1, 8827, 0}, {';', 0, 0, 1941}, {'t', 1, 8828, 0}, {'e', 1, 8829, 0},
+            {'e', 1, 8830, 0}, {'i', 1, 8831, 0}, {'p', 1, 8832, 0}, {'n', 1, 8833, 0}, {'m', 1, 8834, 0},
+            {'m', 1, 8835, 0}, {'a', 1, 8836, 0}, {'r', 1, 8837, 0}, {'g', 1, 8838, 0}, {';', 0, 0, 1942},
+            {'r', 1, 8839, 0}, {'V', 1, 8840, 0}, {'t', 1, 8841, 0}, {'r', 1, 8842, 0}, {'c', 1, 8843, 0},
+            {'w', 1, 8844, 0}, {'o', 1, 8845, 0}, {'e', 3, 8846, 0}, {'e', 1, 8849, 0}, {'c', 1, 8850, 0},
+            {'r', 2, 8851, 0}, {'a', 1, 8853, 0}, {'r', 1, 8854, 0}, {'e', 1, 8855, 0}, {'a', 1, 8856, 0},
+            {';', 0, 0, 1943}, {'u', 1, 8857, 0}, {'o', 1, 8858, 0}, {'h', 1, 8859, 0}, {'r', 1, 8860, 0},
+            {'o', 1, 8861, 0}, {'h', 1, 8862, 0}, {'r', 1, 8863, 0}, {'r', 1, 8864, 0}, {'r', 1, 8865, 0},
+            {';', 0, 0, 1944}, {'i', 1, 8866, 0}, {'c', 1, 8867, 0}, {'n', 1, 8868, 0}, {'y', 1, 8869, 0},
+            {'e', 1, 8870, 0}, {'e', 1, 8871, 0}, {'S', 1, 8872, 0}, {'t', 1, 8873, 0}, {'r', 1, 8874, 0},
+            {'d', 1, 8875, 0}, {'q', 1, 8876, 0}, {'u', 1, 8877, 0}, {'r', 1, 8878, 0}, {'e', 1, 8879, 0},
+            {'l', 1, 8880, 0}, {'i', 1, 8881, 0}, {'H', 1, 8882, 0}, {'l', 1, 8883, 0}, {'n', 1, 8884, 0},
+            {'l', 1, 8885, 0}, {'t', 1, 8886, 0}, {';', 0, 0, 1945}, {'t', 1, 8887, 0}, {'e', 1, 8888, 0},
+            {'e', 1, 8889, 0}, {'s', 1, 8890, 0}, {';', 0, 0, 1946}, {'E', 1, 8891, 0}, {'S', 1, 8892, 0},
+            {'l', 1, 8893, 0}, {'a', 1, 8894, 0}, {'b', 1, 8895, 0}, {'p', 1, 8896, 0}, {'u', 1, 8897, 0},
+            {';', 0, 0, 1947}, {'E', 1, 8898, 0}, {'S', 1, 8899, 0}, {'T', 1, 8900, 0}, {';', 0, 0, 1948},
+            {'E', 1, 8901, 0}, {'a', 1, 8902, 0}, {'l', 1, 8903, 0}, {'d', 1, 8904, 0}, {'B', 1, 8905, 0},
+            {'u', 1, 8906, 0}, {'o', 1, 8907, 0}, {';', 0, 0, 1949}, {'e', 1, 8908, 0}, {'n', 1, 8909, 0},
+            {'a', 1, 8910, 0}, {'n', 1, 8911, 0}, {'d', 1, 8912, 0}, {'l', 1, 8913, 0}, {'e', 1, 8914, 0},
+            {'l', 1, 8915, 0}, {'u', 1, 8916, 0}, {'r', 1, 8917, 0}, {'a', 1, 8918, 0}, {'e', 1, 8919, 0},
+            {'g', 1, 8920, 0}, {'B', 1, 8921, 0}, {'e', 1, 8922, 0}, {'c', 1, 8923, 0}, {'o', 1, 8924, 0},
+            {'t', 1, 8925, 0}, {'l', 1, 8926, 0}, {'V', 1, 8927, 0}, {'e', 1, 8928, 0}, {'o', 1, 8929, 0},
+            {';', 0, 0, 1950}, {'B', 1, 8930, 0}, {'s', 1, 8931, 0}, {';', 0, 0, 1951}, {';', 0, 0, 1952},
+            {'r', 1, 8932, 0}, {'r', 1, 8933, 0}, {'r', 1, 8934, 0}, {'w', 1, 8935, 0}, {';', 0, 0, 1953},
+            {'s', 1, 8936, 0}, {'t', 2, 8937, 0}, {'s', 1, 8939, 0}, {';', 0, 0, 1954}, {';', 0, 0, 1955},
+            {'a', 1, 8940, 0}, {'n', 1, 8941, 0}, {'d', 1, 8942, 0}, {'a', 1, 8943, 0}, {'u', 1, 8944, 0},
+            {'t', 1, 8945, 0}, {'h', 1, 8946, 0}, {'A', 1, 8947, 0}, {';', 0, 0, 1956}, {'u', 1, 8948, 0},
+            {';', 0, 0, 1957}, {'r', 1, 8949, 0}, {'r', 1, 8950, 0}, {';', 0, 0, 1958}, {'e', 1, 8951, 0},
+            {'a', 1, 8952, 0}, {'d', 1, 8953, 0}, {'c', 1, 8954, 0}, {'a', 1, 8955, 0}, {';', 0, 0, 1959},
+            {'d', 1, 8956, 0}, {'u', 1, 8957, 0}, {'e', 1, 8958, 0}, {';', 0, 0, 1960}, {'l', 1, 8959, 0},
+            {'l', 1, 8960, 0}, {'r', 1, 8961, 0}, {';', 0, 0, 1961}, {';', 0, 0, 1962}, {';', 0, 0, 1963},
+            {';', 0, 0, 1964}, {'e', 1, 8962, 0}, {'i', 1, 8963, 0}, {';', 0, 0, 1965}, {'e', 1, 8964, 0},
+            {'d', 1, 8965, 0}, {'o', 1, 8966, 0}, {'l', 1, 8967, 0}, {'r', 1, 8968, 0}, {';', 0, 0, 1966},
+            {';', 0, 0, 1967}, {'e', 1, 8969, 0}, {'e', 1, 8970, 0}, {'o', 1, 8971, 0}, {'r', 1, 8972, 0},
+            {'i', 1, 8973, 0}, {'d', 1, 8974, 0}, {'u', 1, 8975, 0}, {'o', 1, 8976, 0}, {'r', 1, 8977, 0},
+            {'r', 1, 8978, 0}, {'u', 1, 8979, 0}, {'m', 1, 8980, 0}, {'o', 1, 8981, 0}, {'h', 1, 8982, 0},
+            {'r', 1, 8983, 0}, {'f', 1, 8984, 0}, {'g', 1, 8985, 0}, {'l', 1, 8986, 0}, {'r', 1, 8987, 0},
+            {';', 0, 0, 1968}, {'r', 1, 8988, 0}, {';', 0, 0, 1969}, {'l', 1, 8989, 0}, {'f', 1, 8990, 0},
+            {'g', 1, 8991, 0}, {';', 0, 0, 1970}, {';', 0, 0, 1971}, {';', 0, 0, 1972}, {'a', 1, 8992, 0},
+            {'n', 2, 8993, 0}, {'r', 1, 8995, 0}, {'r', 1, 8996, 0}, {'r', 1, 8997, 0}, {'r', 1, 8998, 0},
+            {'i', 1, 8999, 0}, {'q', 1, 9000, 0}, {'e', 1, 9001, 0}, {'u', 1, 9002, 0}, {'i', 1, 9003, 0},
+            {';', 0, 0, 1973}, {';', 0, 0, 1974}, {';', 0, 0, 1975}, {';', 0, 0, 1976}, {'n', 1, 9004, 0},
+            {'t', 2, 9005, 0}, {'h', 1, 9007, 0}, {'a', 1, 9008, 0}, {'t', 1, 9009, 0}, {';', 0, 0, 1977},
+            {'f', 1, 9010, 0}, {'g', 1, 9011, 0}, {'q', 2, 9012, 0}, {'q', 2, 9014, 0}, {'l', 1, 9016, 0},
+            {'r', 1, 9017, 0}, {'n', 1, 9018, 0}, {'r', 1, 9019, 0}, {'t', 1, 9020, 0}, {'u', 1, 9021, 0},
+            {'o', 1, 9022, 0}, {'r', 1, 9023, 0}, {'w', 1, 9024, 0}, {'c', 1, 9025, 0}, {'o', 2, 9026, 0},
+            {'r', 1, 9028, 0}, {'i', 1, 9029, 0}, {'D', 1, 9030, 0}, {'r', 1, 9031, 0}, {'r', 1, 9032, 0},
+            {'r', 1, 9033, 0}, {'g', 1, 9034, 0}, {'e', 1, 9035, 0}, {'f', 1, 9036, 0}, {'g', 1, 9037, 0},
+            {'r', 1, 9038, 0}, {'e', 1, 9039, 0}, {'w', 1, 9040, 0}, {'A', 1, 9041, 0}, {'a', 1, 9042, 0},
+            {';', 0, 0, 1978}, {'r', 1, 9043, 0}, {'t', 1, 9044, 0}, {'e', 1, 9045, 0}, {'o', 1, 9046, 0},
+            {'V', 1, 9047, 0}, {'t', 1, 9048, 0}, {';', 0, 0, 1979}, {'u', 1, 9049, 0}, {'l', 1, 9050, 0},
+            {';', 0, 0, 1980}, {'q', 1, 9051, 0}, {'a', 1, 9052, 0}, {';', 0, 0, 1981}, {'L', 1, 9053, 0},
+            {'q', 1, 9054, 0}, {'e', 1, 9055, 0}, {'E', 1, 9056, 0}, {';', 0, 0, 1982}, {';', 0, 0, 1983},
+            {'n', 1, 9057, 0}, {';', 0, 0, 1984}, {';', 0, 0, 1985}, {'m', 1, 9058, 0}, {'e', 1, 9059, 0},
+            {'c', 1, 9060, 0}, {';', 0, 0, 1986}, {'h', 1, 9061, 0}, {'a', 1, 9062, 0}, {'e', 1, 9063, 0},
+            {'o', 1, 9064, 0}, {'o', 1, 9065, 0}, {'t', 1, 9066, 0}, {';', 0, 0, 1987}, {'r', 1, 9067, 0},
+            {';', 0, 0, 1988}, {'B', 1, 9068, 0}, {'E', 1, 9069, 0}, {'c', 1, 9070, 0}, {'t', 1, 9071, 0},
+            {';', 0, 0, 1989}, {'B', 1, 9072, 0}, {'r', 1, 9073, 0}, {'o', 1, 9074, 0}, {'a', 1, 9075, 0},
+            {'l', 1, 9076, 0}, {'a', 1, 9077, 0}, {'w', 1, 9078, 0}, {'t', 1, 9079, 0}, {'o', 1, 9080, 0},
+            {'w', 1, 9081, 0}, {'t', 1, 9082, 0}, {'o', 1, 9083, 0}, {'o', 1, 9084, 0}, {'r', 1, 9085, 0},
+            {'u', 1, 9086, 0}, {'k', 1, 9087, 0}, {'S', 1, 9088, 0}, {'T', 1, 9089, 0}, {'r', 1, 9090, 0},
+            {'s', 1, 9091, 0}, {'p', 1, 9092, 0}, {';', 0, 0, 1990}, {'t', 1, 9093, 0}, {'e', 1, 9094, 0},
+            {'u', 1, 9095, 0}, {'l', 1, 9096, 0}, {'e', 1, 9097, 0}, {'s', 1, 9098, 0}, {'a', 1, 9099, 0},
+            {'l', 1, 9100, 0}, {'u', 1, 9101, 0}, {';', 0, 0, 1991}, {'g', 1, 9102, 0}, {';', 0, 0, 1992},
+            {'e', 1, 9103, 0}, {'E', 1, 9104, 0}, {';', 0, 0, 1993}, {'a', 1, 9105, 0}, {'s', 1, 9106, 0},
+            {'q', 1, 9107, 0}, {'l', 1, 9108, 0}, {'e', 1, 9109, 0}, {'n', 1, 9110, 0}, {'s', 1, 9111, 0},
+            {'e', 1, 9112, 0}, {'a', 1, 9113, 0}, {'q', 1, 9114, 0}, {'l', 1, 9115, 0}, {'i', 1, 9116, 0},
+            {'q', 1, 9117, 0}, {'l', 1, 9118, 0}, {'E', 1, 9119, 0}, {'e', 1, 9120, 0}, {'a', 1, 9121, 0},
+            {'b', 1, 9122, 0}, {'t', 1, 9123, 0}, {'s', 1, 9124, 0}, {'e', 1, 9125, 0}, {'l', 1, 9126, 0},
+            {'t', 1, 9127, 0}, {'e', 1, 9128, 0}, {';', 0, 0, 1994}, {'n', 1, 9129, 0}, {'i', 1, 9130, 0},
+            {'i', 1, 9131, 0}, {'a', 1, 9132, 0}, {'r', 1, 9133, 0}, {'f', 1, 9134, 0}, {';', 0, 0, 1995},
+            {'r', 1, 9135, 0}, {'V', 1, 9136, 0}, {'t', 1, 9137, 0}, {'w', 1, 9138, 0}, {'o', 1, 9139, 0},
+            {'e', 3, 9140, 0}, {'e', 1, 9143, 0}, {'c', 1, 9144, 0}, {'r', 2, 9145, 0}, {'a', 1, 9147, 0},
+            {';', 0, 0, 1996}, {'o', 1, 9148, 0}, {'o', 1, 9149, 0}, {'r', 1, 9150, 0}, {';', 0, 0, 1997},
+            {'e', 1, 9151, 0}, {';', 0, 0, 1998}, {'E', 1, 9152, 0}, {'e', 1, 9153, 0}, {'l', 1, 9154, 0},
+            {'t', 1, 9155, 0}, {'e', 1, 9156, 0}, {'l', 1, 9157, 0}, {'a', 1, 9158, 0}, {';', 0, 0, 1999},
+            {'e', 1, 9159, 0}, {'r', 1, 9160, 0}, {'m', 1, 9161, 0}, {'o', 1, 9162, 0}, {'r', 1, 9163, 0},
+            {';', 0, 0, 2000}, {'r', 1, 9164, 0}, {'e', 1, 9165, 0}, {'e', 1, 9166, 0}, {'c', 1, 9167, 0},
+            {'o', 1, 9168, 0}, {'p', 1, 9169, 0}, {';', 0, 0, 2001}, {'e', 4, 9170, 0}, {'e', 1, 9174, 0},
+            {'i', 1, 9175, 0}, {'f', 1, 9176, 0}, {'g', 1, 9177, 0}, {'s', 1, 9178, 0}, {'g', 1, 9179, 0},
+            {'w', 1, 9180, 0}, {'e', 1, 9181, 0}, {'i', 1, 9182, 0}, {';', 0, 0, 2002}, {'q', 1, 9183, 0},
+            {'w', 1, 9184, 0}, {'o', 1, 9185, 0}, {'l', 1, 9186, 0}, {'o', 1, 9187, 0}, {'p', 1, 9188, 0},
+            {'w', 1, 9189, 0}, {'o', 1, 9190, 0}, {'p', 1, 9191, 0}, {'i', 1, 9192, 0}, {'e', 1, 9193, 0},
+            {'w', 1, 9194, 0}, {'t', 1, 9195, 0}, {'o', 1, 9196, 0}, {'t', 1, 9197, 0}, {'h', 1, 9198, 0},
+            {'e', 1, 9199, 0}, {'r', 1, 9200, 0}, {'r', 1, 9201, 0}, {'e', 1, 9202, 0}, {'t', 2, 9203, 0},
+            {'h', 1, 9205, 0}, {'i', 1, 9206, 0}, {'d', 1, 9207, 0}, {'u', 1, 9208, 0}, {'o', 1, 9209, 0},
+            {'p', 1, 9210, 0}, {'r', 1, 9211, 0}, {'r', 1, 9212, 0}, {'m', 1, 9213, 0}, {';', 0, 0, 2003},
+            {'l', 1, 9214, 0}, {'s', 1, 9215, 0}, {'l', 1, 9216, 0}, {';', 0, 0, 2004}, {';', 0, 0, 2005},
+            {'e', 1, 9217, 0}, {'t', 2, 9218, 0}, {'r', 1, 9220, 0}, {'a', 1, 9221, 0}, {'t', 1, 9222, 0},
+            {'h', 1, 9223, 0}, {';', 0, 0, 2006}, {'q', 1, 9224, 0}, {';', 0, 0, 2007}, {'q', 1, 9225, 0},
+            {'e', 1, 9226, 0}, {'i', 1, 9227, 0}, {';', 0, 0, 2008}, {'e', 1, 9228, 0}, {'o', 1, 9229, 0},
+            {'b', 1, 9230, 0}, {'t', 1, 9231, 0}, {'a', 1, 9232, 0}, {'i', 1, 9233, 0}, {'u', 1, 9234, 0},
+            {'t', 1, 9235, 0}, {'u', 1, 9236, 0}, {'a', 1, 9237, 0}, {'l', 1, 9238, 0}, {';', 0, 0, 2009},
+            {'I', 1, 9239, 0}, {'o', 1, 9240, 0}, {'o', 1, 9241, 0}, {'h', 1, 9242, 0}, {';', 0, 0, 2010},
+            {'t', 2, 9243, 0}, {'h', 1, 9245, 0}, {'r', 1, 9246, 0}, {'e', 1, 9247, 0}, {';', 0, 0, 2011},
+            {'r', 1, 9248, 0}, {'l', 1, 9249, 0}, {'r', 1, 9250, 0}, {'V', 1, 9251, 0}, {'c', 1, 9252, 0},
+            {'r', 2, 9253, 0}, {'e', 1, 9255, 0}, {'o', 1, 9256, 0}, {'a', 1, 9257, 0}, {'l', 1, 9258, 0},
+            {'u', 1, 9259, 0}, {'l', 1, 9260, 0}, {'e', 1, 9261, 0}, {'u', 1, 9262, 0}, {'r', 1, 9263, 0},
+            {'q', 1, 9264, 0}, {'e', 1, 9265, 0}, {'a', 1, 9266, 0}, {'s', 1, 9267, 0}, {'k', 1, 9268, 0},
+            {'t', 1, 9269, 0}, {'c', 1, 9270, 0}, {'c', 1, 9271, 0}, {'r', 2, 9272, 0}, {'w', 1, 9274, 0},
+            {'o', 1, 9275, 0}, {';', 0, 0, 2012}, {'a', 1, 9276, 0}, {'q', 1, 9277, 0}, {'t', 1, 9278, 0},
+            {'o', 1, 9279, 0}, {'a', 1, 9280, 0}, {';', 0, 0, 2013}, {'w', 1, 9281, 0}, {'t', 1, 9282, 0},
+            {';', 0, 0, 2014}, {'l', 1, 9283, 0}, {';', 0, 0, 2015}, {'A', 1, 9284, 0}, {'w', 1, 9285, 0},
+            {';', 0, 0, 2016}, {'a', 1, 9286, 0}, {'w', 1, 9287, 0}, {'w', 1, 9288, 0}, {'o', 1, 9289, 0},
+            {'m', 1, 9290, 0}, {'S', 1, 9291, 0}, {'p', 1, 9292, 0}, {'h', 1, 9293, 0}, {'G', 1, 9294, 0},
+            {'s', 1, 9295, 0}, {'a', 1, 9296, 0}, {'i', 1, 9297, 0}, {';', 0, 0, 2017}, {'a', 1, 9298, 0},
+            {'l', 1, 9299, 0}, {'a', 1, 9300, 0}, {'s', 1, 9301, 0}, {'n', 1, 9302, 0}, {'d', 1, 9303, 0},
+            {'m', 1, 9304, 0}, {'l', 1, 9305, 0}, {'r', 1, 9306, 0}, {'q', 1, 9307, 0}, {'t', 1, 9308, 0},
+            {'L', 1, 9309, 0}, {'u', 1, 9310, 0}, {'a', 1, 9311, 0}, {'m', 1, 9312, 0}, {'g', 1, 9313, 0},
+            {'e', 1, 9314, 0}, {'r', 1, 9315, 0}, {'l', 1, 9316, 0}, {'u', 1, 9317, 0}, {'a', 1, 9318, 0},
+            {'l', 1, 9319, 0}, {'u', 1, 9320, 0}, {';', 0, 0, 2018}, {'q', 1, 9321, 0}, {';', 0, 0, 2019},
+            {'r', 1, 9322, 0}, {'l', 1, 9323, 0}, {'e', 1, 9324, 0}, {'i', 1, 9325, 0}, {';', 0, 0, 2020},
+            {';', 0, 0, 2021}, {'E', 1, 9326, 0}, {';', 0, 0, 2022}, {'t', 1, 9327, 0}, {'b', 1, 9328, 0},
+            {'l', 1, 9329, 0}, {'c', 1, 9330, 0}, {';', 0, 0, 2023}, {'t', 1, 9331, 0}, {'a', 1, 9332, 0},
+            {'e', 1, 9333, 0}, {'o', 1, 9334, 0}, {';', 0, 0, 2024}, {'r', 1, 9335, 0}, {';', 0, 0, 2025},
+            {'B', 1, 9336, 0}, {'E', 1, 9337, 0}, {'c', 1, 9338, 0}, {'t', 1, 9339, 0}, {';', 0, 0, 2026},
+            {'B', 1, 9340, 0}, {'r', 1, 9341, 0}, {'w', 1, 9342, 0}, {'w', 1, 9343, 0}, {'o', 1, 9344, 0},
+            {'c', 1, 9345, 0}, {'q', 1, 9346, 0}, {'t', 2, 9347, 0}, {';', 0, 0, 2027}, {'E', 1, 9349, 0},
+            {';', 0, 0, 2028}, {';', 0, 0, 2029}, {'l', 1, 9350, 0}, {'s', 1, 9351, 0}, {'r', 1, 9352, 0},
+            {';', 0, 0, 2030}, {'w', 1, 9353, 0}, {'o', 1, 9354, 0}, {'a', 1, 9355, 0}, {';', 0, 0, 2031},
+            {';', 0, 0, 2032}, {'e', 1, 9356, 0}, {'w', 1, 9357, 0}, {';', 0, 0, 2033}, {';', 0, 0, 2034},
+            {'d', 1, 9358, 0}, {'l', 1, 9359, 0}, {'r', 1, 9360, 0}, {'f', 1, 9361, 0}, {'g', 1, 9362, 0},
+            {'t', 1, 9363, 0}, {'h', 1, 9364, 0}, {';', 0, 0, 2035}, {'e', 1, 9365, 0}, {'s', 1, 9366, 0},
+            {'f', 1, 9367, 0}, {'g', 1, 9368, 0}, {';', 0, 0, 2036}, {';', 0, 0, 2037}, {'w', 1, 9369, 0},
+            {';', 0, 0, 2038}, {'w', 1, 9370, 0}, {';', 0, 0, 2039}, {'s', 1, 9371, 0}, {'w', 2, 9372, 0},
+            {'o', 1, 9374, 0}, {'g', 1, 9375, 0}, {'s', 1, 9376, 0}, {';', 0, 0, 2040}, {'a', 1, 9377, 0},
+            {'w', 1, 9378, 0}, {';', 0, 0, 2041}, {'t', 1, 9379, 0}, {';', 0, 0, 2042}, {'o', 1, 9380, 0},
+            {'o', 1, 9381, 0}, {'l', 1, 9382, 0}, {';', 0, 0, 2043}, {'e', 1, 9383, 0}, {'t', 2, 9384, 0},
+            {'l', 1, 9386, 0}, {'o', 1, 9387, 0}, {'p', 1, 9388, 0}, {'w', 1, 9389, 0}, {'o', 1, 9390, 0},
+            {'o', 1, 9391, 0}, {'o', 1, 9392, 0}, {'e', 1, 9393, 0}, {';', 0, 0, 2044}, {';', 0, 0, 2045},
+            {'o', 1, 9394, 0}, {'q', 1, 9395, 0}, {';', 0, 0, 2046}, {'e', 1, 9396, 0}, {'r', 1, 9397, 0},
+            {'r', 1, 9398, 0}, {';', 0, 0, 2047}, {'t', 1, 9399, 0}, {';', 0, 0, 2048}, {';', 0, 0, 2049},
+            {'f', 1, 9400, 0}, {'g', 1, 9401, 0}, {'n', 1, 9402, 0}, {'u', 1, 9403, 0}, {'l', 1, 9404, 0},
+            {'e', 1, 9405, 0}, {'l', 1, 9406, 0}, {'s', 1, 9407, 0}, {'t', 1, 9408, 0}, {';', 0, 0, 2050},
+            {'b', 1, 9409, 0}, {'v', 1, 9410, 0}, {'d', 1, 9411, 0}, {'n', 1, 9412, 0}, {'w', 1, 9413, 0},
+            {'w', 1, 9414, 0}, {'t', 1, 9415, 0}, {'A', 1, 9416, 0}, {'R', 1, 9417, 0}, {'t', 1, 9418, 0},
+            {'o', 1, 9419, 0}, {';', 0, 0, 2051}, {'r', 1, 9420, 0}, {'B', 1, 9421, 0}, {'o', 1, 9422, 0},
+            {'e', 1, 9423, 0}, {'t', 1, 9424, 0}, {';', 0, 0, 2052}, {'B', 1, 9425, 0}, {'c', 1, 9426, 0},
+            {'r', 2, 9427, 0}, {'r', 1, 9429, 0}, {'S', 1, 9430, 0}, {'a', 1, 9431, 0}, {'l', 1, 9432, 0},
+            {'s', 1, 9433, 0}, {'a', 1, 9434, 0}, {';', 0, 0, 2053}, {'u', 1, 9435, 0}, {';', 0, 0, 2054},
+            {';', 0, 0, 2055}, {';', 0, 0, 2056}, {'e', 1, 9436, 0}, {'A', 1, 9437, 0}, {'k', 1, 9438, 0},
+            {'t', 1, 9439, 0}, {';', 0, 0, 2057}, {'B', 1, 9440, 0}, {';', 0, 0, 2058}, {'r', 1, 9441, 0},
+            {'r', 1, 9442, 0}, {'u', 1, 9443, 0}, {'o', 1, 9444, 0}, {'r', 1, 9445, 0}, {'r', 1, 9446, 0},
+            {';', 0, 0, 2059}, {'e', 1, 9447, 0}, {';', 0, 0, 2060}, {'r', 1, 9448, 0}, {';', 0, 0, 2061},
+            {'r', 1, 9449, 0}, {';', 0, 0, 2062}, {';', 0, 0, 2063}, {'w', 1, 9450, 0}, {'S', 1, 9451, 0},
+            {'p', 1, 9452, 0}, {'a', 1, 9453, 0}, {'i', 1, 9454, 0}, {'r', 1, 9455, 0}, {';', 0, 0, 2064},
+            {'c', 1, 9456, 0}, {'c', 1, 9457, 0}, {'l', 1, 9458, 0}, {'E', 1, 9459, 0}, {'t', 1, 9460, 0},
+            {';', 0, 0, 2065}, {'t', 1, 9461, 0}, {'e', 1, 9462, 0}, {'p', 1, 9463, 0}, {'e', 3, 9464, 0},
+            {';', 0, 0, 2066}, {'u', 1, 9467, 0}, {'e', 1, 9468, 0}, {'e', 1, 9469, 0}, {'a', 1, 9470, 0},
+            {'n', 1, 9471, 0}, {'e', 1, 9472, 0}, {'l', 1, 9473, 0}, {'t', 2, 9474, 0}, {'s', 1, 9476, 0},
+            {';', 0, 0, 2067}, {'a', 1, 9477, 0}, {'n', 1, 9478, 0}, {'d', 1, 9479, 0}, {'a', 1, 9480, 0},
+            {'u', 1, 9481, 0}, {';', 0, 0, 2068}, {'e', 1, 9482, 0}, {';', 0, 0, 2069}, {'s', 1, 9483, 0},
+            {'q', 1, 9484, 0}, {';', 0, 0, 2070}, {'r', 1, 9485, 0}, {'i', 1, 9486, 0}, {'k', 1, 9487, 0},
+            {'A', 1, 9488, 0}, {'c', 1, 9489, 0}, {'c', 1, 9490, 0}, {'r', 2, 9491, 0}, {';', 0, 0, 2071},
+            {'a', 1, 9493, 0}, {'q', 1, 9494, 0}, {'t', 1, 9495, 0}, {'o', 1, 9496, 0}, {'a', 1, 9497, 0},
+            {';', 0, 0, 2072}, {';', 0, 0, 2073}, {';', 0, 0, 2074}, {'w', 1, 9498, 0}, {'t', 1, 9499, 0},
+            {'u', 1, 9500, 0}, {';', 0, 0, 2075}, {'E', 1, 9501, 0}, {'q', 1, 9502, 0}, {';', 0, 0, 2076},
+            {'i', 1, 9503, 0}, {'o', 1, 9504, 0}, {';', 0, 0, 2077}, {'w', 1, 9505, 0}, {'t', 1, 9506, 0},
+            {';', 0, 0, 2078}, {'n', 1, 9507, 0}, {'o', 1, 9508, 0}, {'e', 1, 9509, 0}, {'i', 1, 9510, 0},
+            {'t', 1, 9511, 0}, {'h', 1, 9512, 0}, {';', 0, 0, 2079}, {'t', 1, 9513, 0}, {';', 0, 0, 2080},
+            {';', 0, 0, 2081}, {'t', 1, 9514, 0}, {'h', 1, 9515, 0}, {';', 0, 0, 2082}, {'n', 1, 9516, 0},
+            {';', 0, 0, 2083}, {';', 0, 0, 2084}, {'s', 1, 9517, 0}, {'o', 1, 9518, 0}, {'a', 1, 9519, 0},
+            {';', 0, 0, 2085}, {'r', 1, 9520, 0}, {';', 0, 0, 2086}, {';', 0, 0, 2087}, {'w', 1, 9521, 0},
+            {'w', 1, 9522, 0}, {';', 0, 0, 2088}, {'q', 1, 9523, 0}, {';', 0, 0, 2089}, {'e', 1, 9524, 0},
+            {';', 0, 0, 2090}, {'w', 1, 9525, 0}, {';', 0, 0, 2091}, {'s', 1, 9526, 0}, {'o', 1, 9527, 0},
+            {'w', 1, 9528, 0}, {'w', 1, 9529, 0}, {'s', 1, 9530, 0}, {'n', 1, 9531, 0}, {';', 0, 0, 2092},
+            {'q', 1, 9532, 0}, {'o', 1, 9533, 0}, {'r', 1, 9534, 0}, {';', 0, 0, 2093}, {'t', 1, 9535, 0},
+            {'h', 1, 9536, 0}, {'t', 1, 9537, 0}, {'r', 1, 9538, 0}, {'e', 1, 9539, 0}, {';', 0, 0, 2094},
+            {';', 0, 0, 2095}, {'e', 1, 9540, 0}, {'e', 1, 9541, 0}, {'l', 1, 9542, 0}, {'e', 1, 9543, 0},
+            {'e', 1, 9544, 0}, {'t', 1, 9545, 0}, {';', 0, 0, 2096}, {';', 0, 0, 2097}, {'A', 1, 9546, 0},
+            {'r', 1, 9547, 0}, {'i', 1, 9548, 0}, {'A', 1, 9549, 0}, {'w', 1, 9550, 0}, {'o', 1, 9551, 0},
+            {'a', 1, 9552, 0}, {'w', 1, 9553, 0}, {'c', 1, 9554, 0}, {'o', 1, 9555, 0}, {'a', 1, 9556, 0},
+            {'t', 1, 9557, 0}, {';', 0, 0, 2098}, {'B', 1, 9558, 0}, {'e', 1, 9559, 0}, {'q', 1, 9560, 0},
+            {'r', 1, 9561, 0}, {'S', 1, 9562, 0}, {'s', 1, 9563, 0}, {'l', 1, 9564, 0}, {'a', 1, 9565, 0},
+            {'t', 1, 9566, 0}, {'r', 1, 9567, 0}, {'e', 1, 9568, 0}, {'o', 1, 9569, 0}, {'a', 1, 9570, 0},
+            {';', 0, 0, 2099}, {';', 0, 0, 2100}, {'a', 1, 9571, 0}, {'r', 1, 9572, 0}, {';', 0, 0, 2101},
+            {';', 0, 0, 2102}, {'r', 1, 9573, 0}, {'r', 1, 9574, 0}, {'r', 1, 9575, 0}, {';', 0, 0, 2103},
+            {'p', 1, 9576, 0}, {'a', 1, 9577, 0}, {'c', 1, 9578, 0}, {'n', 1, 9579, 0}, {'e', 1, 9580, 0},
+            {'e', 1, 9581, 0}, {'a', 1, 9582, 0}, {';', 0, 0, 2104}, {'q', 1, 9583, 0}, {'e', 1, 9584, 0},
+            {'E', 1, 9585, 0}, {';', 0, 0, 2105}, {';', 0, 0, 2106}, {';', 0, 0, 2107}, {'B', 1, 9586, 0},
+            {'E', 1, 9587, 0}, {'a', 1, 9588, 0}, {'r', 1, 9589, 0}, {'s', 1, 9590, 0}, {'l', 1, 9591, 0},
+            {'t', 1, 9592, 0}, {'n', 1, 9593, 0}, {'e', 3, 9594, 0}, {';', 0, 0, 2108}, {'E', 1, 9597, 0},
+            {'e', 1, 9598, 0}, {'l', 1, 9599, 0}, {'t', 1, 9600, 0}, {'e', 1, 9601, 0}, {'l', 1, 9602, 0},
+            {'a', 1, 9603, 0}, {'Q', 1, 9604, 0}, {';', 0, 0, 2109}, {'u', 1, 9605, 0}, {'i', 1, 9606, 0},
+            {'b', 1, 9607, 0}, {'e', 1, 9608, 0}, {'r', 1, 9609, 0}, {'k', 1, 9610, 0}, {'t', 1, 9611, 0},
+            {';', 0, 0, 2110}, {'B', 1, 9612, 0}, {'r', 1, 9613, 0}, {'u', 1, 9614, 0}, {'o', 1, 9615, 0},
+            {'r', 1, 9616, 0}, {'r', 1, 9617, 0}, {';', 0, 0, 2111}, {'i', 1, 9618, 0}, {'a', 1, 9619, 0},
+            {'q', 1, 9620, 0}, {'u', 1, 9621, 0}, {'s', 1, 9622, 0}, {'w', 1, 9623, 0}, {';', 0, 0, 2112},
+            {'o', 1, 9624, 0}, {';', 0, 0, 2113}, {'w', 1, 9625, 0}, {'f', 1, 9626, 0}, {'g', 1, 9627, 0},
+            {';', 0, 0, 2114}, {'t', 1, 9628, 0}, {';', 0, 0, 2115}, {';', 0, 0, 2116}, {'t', 1, 9629, 0},
+            {';', 0, 0, 2117}, {';', 0, 0, 2118}, {'n', 1, 9630, 0}, {'r', 1, 9631, 0}, {'r', 1, 9632, 0},
+            {';', 0, 0, 2119}, {';', 0, 0, 2120}, {';', 0, 0, 2121}, {'q', 1, 9633, 0}, {'n', 1, 9634, 0},
+            {';', 0, 0, 2122}, {'n', 1, 9635, 0}, {'s', 1, 9636, 0}, {';', 0, 0, 2123}, {';', 0, 0, 2124},
+            {';', 0, 0, 2125}, {';', 0, 0, 2126}, {'w', 1, 9637, 0}, {'o', 1, 9638, 0}, {';', 0, 0, 2127},
+            {'t', 1, 9639, 0}, {'i', 1, 9640, 0}, {'I', 1, 9641, 0}, {'Q', 1, 9642, 0}, {'C', 1, 9643, 0},
+            {';', 0, 0, 2128}, {'e', 1, 9644, 0}, {';', 0, 0, 2129}, {';', 0, 0, 2130}, {'e', 1, 9645, 0},
+            {'r', 1, 9646, 0}, {'r', 1, 9647, 0}, {'g', 1, 9648, 0}, {'r', 1, 9649, 0}, {';', 0, 0, 2131},
+            {'w', 1, 9650, 0}, {'r', 1, 9651, 0}, {';', 0, 0, 2132}, {'t', 1, 9652, 0}, {'r', 1, 9653, 0},
+            {'r', 1, 9654, 0}, {'o', 1, 9655, 0}, {'a', 1, 9656, 0}, {';', 0, 0, 2133}, {'u', 1, 9657, 0},
+            {'e', 1, 9658, 0}, {'q', 1, 9659, 0}, {';', 0, 0, 2134}, {';', 0, 0, 2135}, {'l', 1, 9660, 0},
+            {';', 0, 0, 2136}, {'r', 1, 9661, 0}, {'t', 1, 9662, 0}, {'r', 1, 9663, 0}, {'r', 1, 9664, 0},
+            {'l', 1, 9665, 0}, {';', 0, 0, 2137}, {';', 0, 0, 2138}, {'o', 1, 9666, 0}, {'o', 1, 9667, 0},
+            {'a', 1, 9668, 0}, {'c', 1, 9669, 0}, {'e', 1, 9670, 0}, {'S', 1, 9671, 0}, {'a', 1, 9672, 0},
+            {';', 0, 0, 2139}, {'l', 1, 9673, 0}, {'u', 1, 9674, 0}, {'r', 1, 9675, 0}, {'q', 1, 9676, 0},
+            {'a', 1, 9677, 0}, {'q', 1, 9678, 0}, {'l', 1, 9679, 0}, {'G', 1, 9680, 0}, {'s', 1, 9681, 0},
+            {';', 0, 0, 2140}, {'E', 1, 9682, 0}, {'t', 1, 9683, 0}, {';', 0, 0, 2141}, {'B', 1, 9684, 0},
+            {'E', 1, 9685, 0}, {'q', 1, 9686, 0}, {'t', 2, 9687, 0}, {';', 0, 0, 2142}, {'E', 1, 9689, 0},
+            {';', 0, 0, 2143}, {';', 0, 0, 2144}, {'l', 1, 9690, 0}, {'u', 1, 9691, 0}, {'a', 1, 9692, 0},
+            {'u', 1, 9693, 0}, {'r', 1, 9694, 0}, {'t', 1, 9695, 0}, {'r', 1, 9696, 0}, {'e', 1, 9697, 0},
+            {'o', 1, 9698, 0}, {'a', 1, 9699, 0}, {';', 0, 0, 2145}, {'a', 1, 9700, 0}, {'r', 1, 9701, 0},
+            {';', 0, 0, 2146}, {';', 0, 0, 2147}, {'o', 1, 9702, 0}, {'l', 1, 9703, 0}, {'u', 1, 9704, 0},
+            {'a', 1, 9705, 0}, {';', 0, 0, 2148}, {';', 0, 0, 2149}, {'r', 1, 9706, 0}, {'n', 1, 9707, 0},
+            {'t', 1, 9708, 0}, {'h', 1, 9709, 0}, {';', 0, 0, 2150}, {';', 0, 0, 2151}, {'s', 1, 9710, 0},
+            {'r', 1, 9711, 0}, {'o', 1, 9712, 0}, {';', 0, 0, 2152}, {';', 0, 0, 2153}, {'s', 1, 9713, 0},
+            {';', 0, 0, 2154}, {';', 0, 0, 2155}, {'w', 1, 9714, 0}, {';', 0, 0, 2156}, {'a', 1, 9715, 0},
+            {'n', 1, 9716, 0}, {'u', 1, 9717, 0}, {'o', 1, 9718, 0}, {'A', 1, 9719, 0}, {'g', 1, 9720, 0},
+            {'r', 1, 9721, 0}, {'o', 1, 9722, 0}, {'h', 1, 9723, 0}, {'r', 1, 9724, 0}, {';', 0, 0, 2157},
+            {';', 0, 0, 2158}, {'o', 1, 9725, 0}, {';', 0, 0, 2159}, {';', 0, 0, 2160}, {'r', 1, 9726, 0},
+            {'r', 1, 9727, 0}, {'a', 1, 9728, 0}, {';', 0, 0, 2161}, {'u', 1, 9729, 0}, {';', 0, 0, 2162},
+            {'o', 1, 9730, 0}, {';', 0, 0, 2163}, {';', 0, 0, 2164}, {';', 0, 0, 2165}, {';', 0, 0, 2166},
+            {'w', 1, 9731, 0}, {'w', 1, 9732, 0}, {'c', 1, 9733, 0}, {'e', 1, 9734, 0}, {';', 0, 0, 2167},
+            {'p', 1, 9735, 0}, {'t', 1, 9736, 0}, {'B', 1, 9737, 0}, {'a', 1, 9738, 0}, {';', 0, 0, 2168},
+            {'u', 1, 9739, 0}, {'r', 1, 9740, 0}, {'u', 1, 9741, 0}, {';', 0, 0, 2169}, {'r', 1, 9742, 0},
+            {';', 0, 0, 2170}, {'q', 1, 9743, 0}, {';', 0, 0, 2171}, {'a', 1, 9744, 0}, {'q', 1, 9745, 0},
+            {'u', 1, 9746, 0}, {';', 0, 0, 2172}, {'E', 1, 9747, 0}, {'q', 1, 9748, 0}, {';', 0, 0, 2173},
+            {'o', 1, 9749, 0}, {'l', 1, 9750, 0}, {'m', 1, 9751, 0}, {'i', 1, 9752, 0}, {';', 0, 0, 2174},
+            {'o', 1, 9753, 0}, {'t', 1, 9754, 0}, {'r', 1, 9755, 0}, {'r', 1, 9756, 0}, {'l', 1, 9757, 0},
+            {';', 0, 0, 2175}, {'n', 1, 9758, 0}, {';', 0, 0, 2176}, {'a', 1, 9759, 0}, {'l', 1, 9760, 0},
+            {';', 0, 0, 2177}, {';', 0, 0, 2178}, {';', 0, 0, 2179}, {'t', 1, 9761, 0}, {';', 0, 0, 2180},
+            {'o', 1, 9762, 0}, {'w', 1, 9763, 0}, {';', 0, 0, 2181}, {';', 0, 0, 2182}, {'l', 1, 9764, 0},
+            {'t', 1, 9765, 0}, {'o', 1, 9766, 0}, {'n', 1, 9767, 0}, {'c', 1, 9768, 0}, {'r', 1, 9769, 0},
+            {'o', 1, 9770, 0}, {'w', 1, 9771, 0}, {'t', 1, 9772, 0}, {'o', 1, 9773, 0}, {'r', 1, 9774, 0},
+            {';', 0, 0, 2183}, {';', 0, 0, 2184}, {'r', 1, 9775, 0}, {'a', 1, 9776, 0}, {'w', 1, 9777, 0},
+            {';', 0, 0, 2185}, {';', 0, 0, 2186}, {'e', 1, 9778, 0}, {';', 0, 0, 2187}, {'a', 1, 9779, 0},
+            {'e', 1, 9780, 0}, {'a', 1, 9781, 0}, {'l', 1, 9782, 0}, {'a', 1, 9783, 0}, {';', 0, 0, 2188},
+            {'a', 1, 9784, 0}, {'e', 1, 9785, 0}, {'u', 1, 9786, 0}, {'r', 1, 9787, 0}, {'u', 1, 9788, 0},
+            {'a', 1, 9789, 0}, {'q', 1, 9790, 0}, {'u', 1, 9791, 0}, {'t', 1, 9792, 0}, {';', 0, 0, 2189},
+            {';', 0, 0, 2190}, {'u', 1, 9793, 0}, {'w', 1, 9794, 0}, {';', 0, 0, 2191}, {';', 0, 0, 2192},
+            {';', 0, 0, 2193}, {';', 0, 0, 2194}, {';', 0, 0, 2195}, {'l', 1, 9795, 0}, {';', 0, 0, 2196},
+            {';', 0, 0, 2197}, {'w', 1, 9796, 0}, {';', 0, 0, 2198}, {'D', 1, 9797, 0}, {'e', 1, 9798, 0},
+            {'t', 1, 9799, 0}, {'t', 1, 9800, 0}, {'u', 1, 9801, 0}, {'a', 1, 9802, 0}, {'w', 1, 9803, 0},
+            {';', 0, 0, 2199}, {'A', 1, 9804, 0}, {'w', 1, 9805, 0}, {';', 0, 0, 2200}, {'e', 1, 9806, 0},
+            {'r', 1, 9807, 0}, {';', 0, 0, 2201}, {';', 0, 0, 2202}, {'c', 1, 9808, 0}, {'r', 1, 9809, 0},
+            {'r', 1, 9810, 0}, {';', 0, 0, 2203}, {'l', 1, 9811, 0}, {'l', 1, 9812, 0}, {'a', 1, 9813, 0},
+            {'a', 1, 9814, 0}, {';', 0, 0, 2204}, {'a', 1, 9815, 0}, {'l', 1, 9816, 0}, {'u', 1, 9817, 0},
+            {'a', 1, 9818, 0}, {'e', 1, 9819, 0}, {'m', 1, 9820, 0}, {';', 0, 0, 2205}, {';', 0, 0, 2206},
+            {';', 0, 0, 2207}, {';', 0, 0, 2208}, {'g', 1, 9821, 0}, {'e', 1, 9822, 0}, {'o', 1, 9823, 0},
+            {'t', 1, 9824, 0}, {'l', 1, 9825, 0}, {';', 0, 0, 2209}, {'r', 1, 9826, 0}, {';', 0, 0, 2210},
+            {';', 0, 0, 2211}, {'e', 1, 9827, 0}, {'e', 1, 9828, 0}, {';', 0, 0, 2212}, {';', 0, 0, 2213},
+            {';', 0, 0, 2214}, {';', 0, 0, 2215}, {'t', 1, 9829, 0}, {'l', 1, 9830, 0}, {'l', 1, 9831, 0},
+            {';', 0, 0, 2216}, {'a', 1, 9832, 0}, {'l', 1, 9833, 0}, {';', 0, 0, 2217}, {';', 0, 0, 2218},
+            {'r', 1, 9834, 0}, {';', 0, 0, 2219}, {'u', 1, 9835, 0}, {'e', 1, 9836, 0}, {';', 0, 0, 2220},
+            {'r', 1, 9837, 0}, {';', 0, 0, 2221}, {';', 0, 0, 2222}, {'e', 1, 9838, 0}, {';', 0, 0, 2223},
+            {';', 0, 0, 2224}, {'l', 1, 9839, 0}, {';', 0, 0, 2225}, {'a', 1, 9840, 0}, {'r', 1, 9841, 0},
+            {';', 0, 0, 2226}, {'o', 1, 9842, 0}, {'r', 1, 9843, 0}, {';', 0, 0, 2227}, {'l', 1, 9844, 0},
+            {'I', 1, 9845, 0}, {'w', 1, 9846, 0}, {';', 0, 0, 2228}, {';', 0, 0, 2229}, {'n', 1, 9847, 0},
+            {';', 0, 0, 2230}, {'t', 1, 9848, 0}, {'e', 1, 9849, 0}, {'g', 1, 9850, 0}, {'r', 1, 9851, 0},
+            {'a', 1, 9852, 0}, {'l', 1, 9853, 0}, {';', 0, 0, 2231},
+        };
+
+        // code points of each entity; the second is 0 for entities of one code point
+        const int kEntityCodePoints[2231][2] = {
+            {0x3E, 0x0}, {0x3C, 0x0}, {0x3E, 0x0}, {0x3C, 0x0}, {0x26, 0x0}, {0x2145, 0x0}, {0xD0, 0x0},
+            {0x3E, 0x0}, {0x22D9, 0x0}, {0x226B, 0x0}, {0x2111, 0x0}, {0x3C, 0x0}, {0x22D8, 0x0}, {0x226A, 0x0},
+            {0x39C, 0x0}, {0x39D, 0x0}, {0x2A54, 0x0}, {0x3A0, 0x0}, {0x2ABB, 0x0}, {0xAE, 0x0}, {0x211C, 0x0},
+            {0x2ABC, 0x0}, {0x39E, 0x0}, {0x223E, 0x0}, {0x2061, 0x0}, {0x26, 0x0}, {0x2248, 0x0}, {0x2146, 0x0},
+            {0xB0, 0x0}, {0x2147, 0x0}, {0x2A9A, 0x0}, {0x2A99, 0x0}, {0xF0, 0x0}, {0x2267, 0x0}, {0x2265, 0x0},
+            {0x226B, 0x0}, {0x2277, 0x0}, {0x3E, 0x0}, {0x2063, 0x0}, {0x2148, 0x0}, {0x2208, 0x0}, {0x2062, 0x0},
+            {0x2266, 0x0}, {0x2264, 0x0}, {0x2276, 0x0}, {0x226A, 0x0}, {0x3C, 0x0}, {0x2213, 0x0}, {0x3BC, 0x0},
+            {0x2260, 0x0}, {0x220B, 0x0}, {0xAC, 0x0}, {0x3BD, 0x0}, {0x24C8, 0x0}, {0x2228, 0x0}, {0x3C0, 0x0},
+            {0xB1, 0x0}, {0x227A, 0x0}, {0xAE, 0x0}, {0x211E, 0x0}, {0x227B, 0x0}, {0xAD, 0x0}, {0xA8, 0x0},
+            {0x2118, 0x0}, {0x2240, 0x0}, {0x3BE, 0x0}, {0xA5, 0x0}, {0x26, 0x0}, {0x410, 0x0}, {0x1D504, 0x0},
+            {0x2A53, 0x0}, {0xC4, 0x0}, {0x411, 0x0}, {0x1D505, 0x0}, {0xA9, 0x0}, {0x22D2, 0x0}, {0x212D, 0x0},
+            {0x3A7, 0x0}, {0x22D3, 0x0}, {0x414, 0x0}, {0x2207, 0x0}, {0x1D507, 0x0}, {0xA8, 0x0}, {0x14A, 0x0},
+            {0xD0, 0x0}, {0x42D, 0x0}, {0x1D508, 0x0}, {0x397, 0x0}, {0xCB, 0x0}, {0x424, 0x0}, {0x1D509, 0x0},
+            {0x413, 0x0}, {0x1D50A, 0x0}, {0x5E, 0x0}, {0x210C, 0x0}, {0x418, 0x0}, {0x2111, 0x0}, {0x222C, 0x0},
+            {0xCF, 0x0}, {0x419, 0x0}, {0x1D50D, 0x0}, {0x41A, 0x0}, {0x1D50E, 0x0}, {0x41B, 0x0}, {0x1D50F, 0x0},
+            {0x21B0, 0x0}, {0x2905, 0x0}, {0x41C, 0x0}, {0x1D510, 0x0}, {0x41D, 0x0}, {0x1D511, 0x0}, {0x2AEC, 0x0},
+            {0x41E, 0x0}, {0x1D512, 0x0}, {0xD6, 0x0}, {0x41F, 0x0}, {0x1D513, 0x0}, {0x3A6, 0x0}, {0x3A8, 0x0},
+            {0x22, 0x0}, {0x1D514, 0x0}, {0xAE, 0x0}, {0x420, 0x0}, {0x211C, 0x0}, {0x3A1, 0x0}, {0x21B1, 0x0},
+            {0x421, 0x0}, {0x1D516, 0x0}, {0x22D0, 0x0}, {0x2211, 0x0}, {0x22D1, 0x0}, {0x9, 0x0}, {0x3A4, 0x0},
+            {0x422, 0x0}, {0x1D517, 0x0}, {0x423, 0x0}, {0x1D518, 0x0}, {0xDC, 0x0}, {0x412, 0x0}, {0x22C1, 0x0},
+            {0x1D519, 0x0}, {0x1D51A, 0x0}, {0x1D51B, 0x0}, {0x42B, 0x0}, {0x1D51C, 0x0}, {0x417, 0x0},
+            {0x2128, 0x0}, {0x223E, 0x333}, {0x223F, 0x0}, {0x430, 0x0}, {0x1D51E, 0x0}, {0x26, 0x0}, {0x2227, 0x0},
+            {0x2220, 0x0}, {0x2A70, 0x0}, {0x224A, 0x0}, {0x2A, 0x0}, {0xE4, 0x0}, {0x431, 0x0}, {0x1D51F, 0x0},
+            {0x3D, 0x20E5}, {0x22A5, 0x0}, {0x2229, 0x0}, {0xA2, 0x0}, {0x1D520, 0x0}, {0x3C7, 0x0}, {0x25CB, 0x0},
+            {0xA9, 0x0}, {0x222A, 0x0}, {0x434, 0x0}, {0xB0, 0x0}, {0x1D521, 0x0}, {0xA8, 0x0}, {0xF7, 0x0},
+            {0x2D9, 0x0}, {0x44D, 0x0}, {0x1D522, 0x0}, {0x2A96, 0x0}, {0x2113, 0x0}, {0x2A95, 0x0}, {0x14B, 0x0},
+            {0x3B7, 0x0}, {0xF0, 0x0}, {0xEB, 0x0}, {0x444, 0x0}, {0x1D523, 0x0}, {0x2A8C, 0x0}, {0x2A86, 0x0},
+            {0x433, 0x0}, {0x22DB, 0x0}, {0x2265, 0x0}, {0x2A7E, 0x0}, {0x1D524, 0x0}, {0x22D9, 0x0}, {0x2A92, 0x0},
+            {0x2AA5, 0x0}, {0x2AA4, 0x0}, {0x2269, 0x0}, {0x2A88, 0x0}, {0x1D525, 0x0}, {0x438, 0x0}, {0x21D4, 0x0},
+            {0x1D526, 0x0}, {0x222B, 0x0}, {0xEF, 0x0}, {0x439, 0x0}, {0x1D527, 0x0}, {0x43A, 0x0}, {0x1D528, 0x0},
+            {0x2A8B, 0x0}, {0x2A85, 0x0}, {0x2AAB, 0x0}, {0x43B, 0x0}, {0x22DA, 0x0}, {0x2264, 0x0}, {0x2A7D, 0x0},
+            {0x1D529, 0x0}, {0x2A91, 0x0}, {0x2268, 0x0}, {0x2A87, 0x0}, {0x25CA, 0x0}, {0x200E, 0x0},
+            {0x21B0, 0x0}, {0xAF, 0x0}, {0x21A6, 0x0}, {0x43C, 0x0}, {0x1D52A, 0x0}, {0x2127, 0x0}, {0x2223, 0x0},
+            {0x22D9, 0x338}, {0x226B, 0x20D2}, {0x22D8, 0x338}, {0x226A, 0x20D2}, {0x2249, 0x0}, {0xA0, 0x0},
+            {0x43D, 0x0}, {0x1D52B, 0x0}, {0x2267, 0x338}, {0x2271, 0x0}, {0x226F, 0x0}, {0x22FC, 0x0},
+            {0x220B, 0x0}, {0x2266, 0x338}, {0x2270, 0x0}, {0x226E, 0x0}, {0xAC, 0x0}, {0x2280, 0x0}, {0x2281, 0x0},
+            {0x23, 0x0}, {0x43E, 0x0}, {0x1D52C, 0x0}, {0x29C1, 0x0}, {0x3A9, 0x0}, {0x29C0, 0x0}, {0x2A5D, 0x0},
+            {0xAA, 0x0}, {0xBA, 0x0}, {0x2A5B, 0x0}, {0xF6, 0x0}, {0x2225, 0x0}, {0xB6, 0x0}, {0x43F, 0x0},
+            {0x1D52D, 0x0}, {0x3C6, 0x0}, {0x3D6, 0x0}, {0x2AB3, 0x0}, {0x2AAF, 0x0}, {0x3C8, 0x0}, {0x1D52E, 0x0},
+            {0x22, 0x0}, {0x440, 0x0}, {0xAE, 0x0}, {0x1D52F, 0x0}, {0x3C1, 0x0}, {0x200F, 0x0}, {0x21B1, 0x0},
+            {0x2AB4, 0x0}, {0x2AB0, 0x0}, {0x441, 0x0}, {0xA7, 0x0}, {0x1D530, 0x0}, {0xAD, 0x0}, {0x223C, 0x0},
+            {0x2AAA, 0x0}, {0x2F, 0x0}, {0x25A1, 0x0}, {0x2282, 0x0}, {0x2211, 0x0}, {0xB9, 0x0}, {0xB2, 0x0},
+            {0xB3, 0x0}, {0x2283, 0x0}, {0x3C4, 0x0}, {0x442, 0x0}, {0x1D531, 0x0}, {0x22A4, 0x0}, {0x443, 0x0},
+            {0x1D532, 0x0}, {0xA8, 0x0}, {0xFC, 0x0}, {0x432, 0x0}, {0x2228, 0x0}, {0x1D533, 0x0}, {0x1D534, 0x0},
+            {0x1D535, 0x0}, {0x44B, 0x0}, {0xA5, 0x0}, {0x1D536, 0x0}, {0xFF, 0x0}, {0x437, 0x0}, {0x1D537, 0x0},
+            {0x200D, 0x0}, {0xC6, 0x0}, {0xC2, 0x0}, {0x1D538, 0x0}, {0xC5, 0x0}, {0x1D49C, 0x0}, {0xC4, 0x0},
+            {0x2AE7, 0x0}, {0x392, 0x0}, {0x1D539, 0x0}, {0x212C, 0x0}, {0x427, 0x0}, {0xA9, 0x0}, {0x10A, 0x0},
+            {0x2102, 0x0}, {0x1D49E, 0x0}, {0x402, 0x0}, {0x405, 0x0}, {0x40F, 0x0}, {0x21A1, 0x0}, {0x1D53B, 0x0},
+            {0x1D49F, 0x0}, {0xCA, 0x0}, {0x116, 0x0}, {0x1D53C, 0x0}, {0x2130, 0x0}, {0x2A73, 0x0}, {0xCB, 0x0},
+            {0x1D53D, 0x0}, {0x2131, 0x0}, {0x403, 0x0}, {0x120, 0x0}, {0x1D53E, 0x0}, {0x1D4A2, 0x0},
+            {0x210D, 0x0}, {0x210B, 0x0}, {0x415, 0x0}, {0x401, 0x0}, {0xCE, 0x0}, {0x130, 0x0}, {0x1D540, 0x0},
+            {0x399, 0x0}, {0x2110, 0x0}, {0xCF, 0x0}, {0x1D541, 0x0}, {0x1D4A5, 0x0}, {0x425, 0x0}, {0x40C, 0x0},
+            {0x1D542, 0x0}, {0x1D4A6, 0x0}, {0x409, 0x0}, {0x27EA, 0x0}, {0x219E, 0x0}, {0x1D543, 0x0},
+            {0x2112, 0x0}, {0x1D544, 0x0}, {0x2133, 0x0}, {0x40A, 0x0}, {0x2115, 0x0}, {0x1D4A9, 0x0}, {0xD4, 0x0},
+            {0x1D546, 0x0}, {0x1D4AA, 0x0}, {0xD6, 0x0}, {0x2119, 0x0}, {0x1D4AB, 0x0}, {0x22, 0x0}, {0x211A, 0x0},
+            {0x1D4AC, 0x0}, {0x27EB, 0x0}, {0x21A0, 0x0}, {0x211D, 0x0}, {0x211B, 0x0}, {0x428, 0x0},
+            {0x1D54A, 0x0}, {0x221A, 0x0}, {0x1D4AE, 0x0}, {0x22C6, 0x0}, {0xDE, 0x0}, {0x426, 0x0}, {0x1D54B, 0x0},
+            {0x1D4AF, 0x0}, {0x219F, 0x0}, {0xDB, 0x0}, {0x1D54C, 0x0}, {0x3D2, 0x0}, {0x1D4B0, 0x0}, {0xDC, 0x0},
+            {0x2AEB, 0x0}, {0x2016, 0x0}, {0x1D54D, 0x0}, {0x1D4B1, 0x0}, {0x1D54E, 0x0}, {0x1D4B2, 0x0},
+            {0x1D54F, 0x0}, {0x1D4B3, 0x0}, {0x42F, 0x0}, {0x407, 0x0}, {0x42E, 0x0}, {0x1D550, 0x0},
+            {0x1D4B4, 0x0}, {0x178, 0x0}, {0x416, 0x0}, {0x17B, 0x0}, {0x396, 0x0}, {0x2124, 0x0}, {0x1D4B5, 0x0},
+            {0xE2, 0x0}, {0xB4, 0x0}, {0xE6, 0x0}, {0x2A5C, 0x0}, {0x2A5A, 0x0}, {0x29A4, 0x0}, {0x1D552, 0x0},
+            {0x224B, 0x0}, {0x27, 0x0}, {0xE5, 0x0}, {0x1D4B6, 0x0}, {0xE4, 0x0}, {0x2AED, 0x0}, {0x23B5, 0x0},
+            {0x3B2, 0x0}, {0x2136, 0x0}, {0x2310, 0x0}, {0x1D553, 0x0}, {0x2550, 0x0}, {0x2551, 0x0}, {0x2500, 0x0},
+            {0x2502, 0x0}, {0x1D4B7, 0x0}, {0x223D, 0x0}, {0x5C, 0x0}, {0x2022, 0x0}, {0x224E, 0x0},
+            {0x2229, 0xFE00}, {0x10B, 0x0}, {0xB8, 0x0}, {0xA2, 0x0}, {0x447, 0x0}, {0x29C3, 0x0}, {0x2C6, 0x0},
+            {0x2257, 0x0}, {0x2201, 0x0}, {0x2245, 0x0}, {0x1D554, 0x0}, {0xA9, 0x0}, {0x1D4B8, 0x0}, {0x2ACF, 0x0},
+            {0x2AD0, 0x0}, {0x222A, 0xFE00}, {0x21D3, 0x0}, {0x2965, 0x0}, {0x2193, 0x0}, {0x2010, 0x0},
+            {0x22C4, 0x0}, {0x452, 0x0}, {0x1D555, 0x0}, {0x1D4B9, 0x0}, {0x455, 0x0}, {0x29F6, 0x0}, {0x25BF, 0x0},
+            {0x45F, 0x0}, {0x2251, 0x0}, {0x2256, 0x0}, {0xEA, 0x0}, {0x117, 0x0}, {0x2003, 0x0}, {0x2002, 0x0},
+            {0x1D556, 0x0}, {0x22D5, 0x0}, {0x3B5, 0x0}, {0x212F, 0x0}, {0x2242, 0x0}, {0xEB, 0x0}, {0x20AC, 0x0},
+            {0x21, 0x0}, {0x266D, 0x0}, {0x192, 0x0}, {0x1D557, 0x0}, {0x22D4, 0x0}, {0x1D4BB, 0x0}, {0x121, 0x0},
+            {0x2267, 0x0}, {0x22DB, 0xFE00}, {0x453, 0x0}, {0x2A8A, 0x0}, {0x2A88, 0x0}, {0x1D558, 0x0},
+            {0x210A, 0x0}, {0x2273, 0x0}, {0x2AA7, 0x0}, {0x2269, 0xFE00}, {0x21D4, 0x0}, {0xBD, 0x0},
+            {0x2194, 0x0}, {0x210F, 0x0}, {0x1D559, 0x0}, {0x1D4BD, 0x0}, {0xEE, 0x0}, {0x435, 0x0}, {0xA1, 0x0},
+            {0x22B7, 0x0}, {0x451, 0x0}, {0x1D55A, 0x0}, {0x3B9, 0x0}, {0x1D4BE, 0x0}, {0x2208, 0x0}, {0xEF, 0x0},
+            {0x1D55B, 0x0}, {0x1D4BF, 0x0}, {0x445, 0x0}, {0x45C, 0x0}, {0x1D55C, 0x0}, {0x1D4C0, 0x0},
+            {0x21D0, 0x0}, {0x2962, 0x0}, {0x27E8, 0x0}, {0xAB, 0x0}, {0x2190, 0x0}, {0x2AAD, 0x0}, {0x7B, 0x0},
+            {0x2936, 0x0}, {0x21B2, 0x0}, {0x2266, 0x0}, {0x22DA, 0xFE00}, {0x459, 0x0}, {0x2A89, 0x0},
+            {0x2A87, 0x0}, {0x1D55D, 0x0}, {0x29EB, 0x0}, {0x28, 0x0}, {0x1D4C1, 0x0}, {0x2272, 0x0}, {0x5B, 0x0},
+            {0x2AA6, 0x0}, {0x25C3, 0x0}, {0x2268, 0xFE00}, {0xAF, 0x0}, {0x2642, 0x0}, {0x2720, 0x0}, {0xB5, 0x0},
+            {0x2ADB, 0x0}, {0x2026, 0x0}, {0x1D55E, 0x0}, {0x1D4C2, 0x0}, {0x226B, 0x338}, {0x226A, 0x338},
+            {0x2220, 0x20D2}, {0x2A70, 0x338}, {0xA0, 0x0}, {0x2A43, 0x0}, {0x2A42, 0x0}, {0x2271, 0x0},
+            {0x2A7E, 0x338}, {0x226F, 0x0}, {0x22FA, 0x0}, {0x45A, 0x0}, {0x2025, 0x0}, {0x2270, 0x0},
+            {0x2A7D, 0x338}, {0x2224, 0x0}, {0x1D55F, 0x0}, {0x2226, 0x0}, {0x2AAF, 0x338}, {0x2AB0, 0x338},
+            {0x1D4C3, 0x0}, {0x2241, 0x0}, {0x2284, 0x0}, {0x2285, 0x0}, {0x2279, 0x0}, {0x2278, 0x0},
+            {0x224D, 0x20D2}, {0x2265, 0x20D2}, {0x3E, 0x20D2}, {0x2264, 0x20D2}, {0x3C, 0x20D2}, {0x229B, 0x0},
+            {0x229A, 0x0}, {0xF4, 0x0}, {0x2A38, 0x0}, {0x2299, 0x0}, {0x2DB, 0x0}, {0x222E, 0x0}, {0x29B6, 0x0},
+            {0x1D560, 0x0}, {0x29B7, 0x0}, {0xAA, 0x0}, {0xBA, 0x0}, {0x2A56, 0x0}, {0x2134, 0x0}, {0x2298, 0x0},
+            {0xF6, 0x0}, {0xB6, 0x0}, {0x2202, 0x0}, {0x22A5, 0x0}, {0x3D5, 0x0}, {0x2B, 0x0}, {0x1D561, 0x0},
+            {0xA3, 0x0}, {0x2AB7, 0x0}, {0x227A, 0x0}, {0x2AB5, 0x0}, {0x220F, 0x0}, {0x221D, 0x0}, {0x1D4C5, 0x0},
+            {0x2A0C, 0x0}, {0x1D562, 0x0}, {0x1D4C6, 0x0}, {0x22, 0x0}, {0x21D2, 0x0}, {0x2964, 0x0},
+            {0x223D, 0x331}, {0x27E9, 0x0}, {0xBB, 0x0}, {0x2192, 0x0}, {0x7D, 0x0}, {0x2937, 0x0}, {0x21B3, 0x0},
+            {0x211C, 0x0}, {0x25AD, 0x0}, {0x3F1, 0x0}, {0x2DA, 0x0}, {0x1D563, 0x0}, {0x29, 0x0}, {0x1D4C7, 0x0},
+            {0x5D, 0x0}, {0x25B9, 0x0}, {0x2AB8, 0x0}, {0x2AB6, 0x0}, {0x22C5, 0x0}, {0xA7, 0x0}, {0x3B, 0x0},
+            {0x2736, 0x0}, {0x448, 0x0}, {0x2243, 0x0}, {0x2A9E, 0x0}, {0x2A9D, 0x0}, {0x2223, 0x0}, {0x2AAC, 0x0},
+            {0x29C4, 0x0}, {0x1D564, 0x0}, {0x2225, 0x0}, {0x25AA, 0x0}, {0x1D4C8, 0x0}, {0x2606, 0x0},
+            {0x2AC5, 0x0}, {0x2286, 0x0}, {0x227B, 0x0}, {0x266A, 0x0}, {0xB9, 0x0}, {0xB2, 0x0}, {0xB3, 0x0},
+            {0x2AC6, 0x0}, {0x2287, 0x0}, {0xDF, 0x0}, {0x23B4, 0x0}, {0x20DB, 0x0}, {0xFE, 0x0}, {0xD7, 0x0},
+            {0x222D, 0x0}, {0x2928, 0x0}, {0x1D565, 0x0}, {0x2929, 0x0}, {0x225C, 0x0}, {0x1D4C9, 0x0},
+            {0x446, 0x0}, {0x21D1, 0x0}, {0x2963, 0x0}, {0x2191, 0x0}, {0xFB, 0x0}, {0x1D566, 0x0}, {0x3C5, 0x0},
+            {0x1D4CA, 0x0}, {0x25B5, 0x0}, {0xFC, 0x0}, {0x21D5, 0x0}, {0x2AE8, 0x0}, {0x2195, 0x0}, {0x7C, 0x0},
+            {0x1D567, 0x0}, {0x1D4CB, 0x0}, {0x1D568, 0x0}, {0x1D4CC, 0x0}, {0x22C2, 0x0}, {0x22C3, 0x0},
+            {0x27FC, 0x0}, {0x22FB, 0x0}, {0x1D569, 0x0}, {0x1D4CD, 0x0}, {0x22C1, 0x0}, {0x44F, 0x0}, {0x457, 0x0},
+            {0x1D56A, 0x0}, {0x1D4CE, 0x0}, {0x44E, 0x0}, {0xFF, 0x0}, {0x17C, 0x0}, {0x3B6, 0x0}, {0x436, 0x0},
+            {0x1D56B, 0x0}, {0x1D4CF, 0x0}, {0x200C, 0x0}, {0xC6, 0x0}, {0xC1, 0x0}, {0xC2, 0x0}, {0xC0, 0x0},
+            {0x391, 0x0}, {0x100, 0x0}, {0x104, 0x0}, {0xC5, 0x0}, {0xC3, 0x0}, {0x2D8, 0x0}, {0xC7, 0x0},
+            {0x108, 0x0}, {0x2237, 0x0}, {0x2A2F, 0x0}, {0x2AE4, 0x0}, {0x394, 0x0}, {0xC9, 0x0}, {0xCA, 0x0},
+            {0xC8, 0x0}, {0x112, 0x0}, {0x118, 0x0}, {0x2A75, 0x0}, {0x393, 0x0}, {0x11C, 0x0}, {0x2C7, 0x0},
+            {0x124, 0x0}, {0x132, 0x0}, {0xCD, 0x0}, {0xCE, 0x0}, {0xCC, 0x0}, {0x12A, 0x0}, {0x12E, 0x0},
+            {0x406, 0x0}, {0x134, 0x0}, {0x404, 0x0}, {0x39A, 0x0}, {0xD1, 0x0}, {0x152, 0x0}, {0xD3, 0x0},
+            {0xD4, 0x0}, {0xD2, 0x0}, {0x14C, 0x0}, {0x3A9, 0x0}, {0xD8, 0x0}, {0xD5, 0x0}, {0x2033, 0x0},
+            {0x2910, 0x0}, {0x15C, 0x0}, {0x3A3, 0x0}, {0xDE, 0x0}, {0x2122, 0x0}, {0x40B, 0x0}, {0x398, 0x0},
+            {0x223C, 0x0}, {0xDA, 0x0}, {0x40E, 0x0}, {0xDB, 0x0}, {0xD9, 0x0}, {0x16A, 0x0}, {0x22C3, 0x0},
+            {0x172, 0x0}, {0x22A5, 0x0}, {0x16E, 0x0}, {0x22AB, 0x0}, {0x22A9, 0x0}, {0x174, 0x0}, {0x22C0, 0x0},
+            {0xDD, 0x0}, {0x176, 0x0}, {0xE1, 0x0}, {0xE2, 0x0}, {0xB4, 0x0}, {0xE6, 0x0}, {0xE0, 0x0},
+            {0x2135, 0x0}, {0x3B1, 0x0}, {0x101, 0x0}, {0x2A3F, 0x0}, {0x2220, 0x0}, {0x221F, 0x0}, {0xC5, 0x0},
+            {0x105, 0x0}, {0xE5, 0x0}, {0x2248, 0x0}, {0xE3, 0x0}, {0x2A11, 0x0}, {0x224C, 0x0}, {0x201E, 0x0},
+            {0x3F6, 0x0}, {0x2423, 0x0}, {0x2592, 0x0}, {0x2591, 0x0}, {0x2593, 0x0}, {0x2588, 0x0}, {0x2557, 0x0},
+            {0x2554, 0x0}, {0x2556, 0x0}, {0x2553, 0x0}, {0x2566, 0x0}, {0x2569, 0x0}, {0x2564, 0x0}, {0x2567, 0x0},
+            {0x255D, 0x0}, {0x255A, 0x0}, {0x255C, 0x0}, {0x2559, 0x0}, {0x256C, 0x0}, {0x2563, 0x0}, {0x2560, 0x0},
+            {0x256B, 0x0}, {0x2562, 0x0}, {0x255F, 0x0}, {0x2555, 0x0}, {0x2552, 0x0}, {0x2510, 0x0}, {0x250C, 0x0},
+            {0x2565, 0x0}, {0x2568, 0x0}, {0x252C, 0x0}, {0x2534, 0x0}, {0x255B, 0x0}, {0x2558, 0x0}, {0x2518, 0x0},
+            {0x2514, 0x0}, {0x256A, 0x0}, {0x2561, 0x0}, {0x255E, 0x0}, {0x253C, 0x0}, {0x2524, 0x0}, {0x251C, 0x0},
+            {0x2D8, 0x0}, {0xA6, 0x0}, {0x204F, 0x0}, {0x22CD, 0x0}, {0x29C5, 0x0}, {0x2AAE, 0x0}, {0x224F, 0x0},
+            {0x2041, 0x0}, {0x2C7, 0x0}, {0x2A4D, 0x0}, {0xE7, 0x0}, {0x109, 0x0}, {0x2A4C, 0x0}, {0xB8, 0x0},
+            {0x2713, 0x0}, {0x2663, 0x0}, {0x3A, 0x0}, {0x2C, 0x0}, {0x21B5, 0x0}, {0x2717, 0x0}, {0x2AD1, 0x0},
+            {0x2AD2, 0x0}, {0x22EF, 0x0}, {0x22DE, 0x0}, {0x22DF, 0x0}, {0x2A45, 0x0}, {0xA4, 0x0}, {0x22CE, 0x0},
+            {0x22CF, 0x0}, {0x2231, 0x0}, {0x22A3, 0x0}, {0x2DD, 0x0}, {0x21CA, 0x0}, {0x3B4, 0x0}, {0x21C3, 0x0},
+            {0x21C2, 0x0}, {0x2666, 0x0}, {0x22F2, 0x0}, {0xF7, 0x0}, {0x2250, 0x0}, {0x22F1, 0x0}, {0x25BE, 0x0},
+            {0x21F5, 0x0}, {0x296F, 0x0}, {0x2A77, 0x0}, {0xE9, 0x0}, {0xEA, 0x0}, {0x2252, 0x0}, {0xE8, 0x0},
+            {0x113, 0x0}, {0x2205, 0x0}, {0x119, 0x0}, {0x2A71, 0x0}, {0x3F5, 0x0}, {0x2242, 0x0}, {0x2261, 0x0},
+            {0x2253, 0x0}, {0x2971, 0x0}, {0x2250, 0x0}, {0x2203, 0x0}, {0xFB00, 0x0}, {0xFB01, 0x0}, {0x66, 0x6A},
+            {0xFB02, 0x0}, {0x25B1, 0x0}, {0x2AD9, 0x0}, {0xBD, 0x0}, {0xBC, 0x0}, {0xBE, 0x0}, {0x2044, 0x0},
+            {0x2322, 0x0}, {0x3B3, 0x0}, {0x11D, 0x0}, {0x2AA9, 0x0}, {0x2137, 0x0}, {0x2269, 0x0}, {0x22E7, 0x0},
+            {0x60, 0x0}, {0x2A8E, 0x0}, {0x2A90, 0x0}, {0x2A7A, 0x0}, {0x22D7, 0x0}, {0x21AD, 0x0}, {0x125, 0x0},
+            {0x21FF, 0x0}, {0xED, 0x0}, {0xEE, 0x0}, {0xA1, 0x0}, {0xEC, 0x0}, {0x222D, 0x0}, {0x2129, 0x0},
+            {0x133, 0x0}, {0x12B, 0x0}, {0x2111, 0x0}, {0x131, 0x0}, {0x1B5, 0x0}, {0x221E, 0x0}, {0x12F, 0x0},
+            {0x2A3C, 0x0}, {0xBF, 0x0}, {0x22F9, 0x0}, {0x22F4, 0x0}, {0x2208, 0x0}, {0x456, 0x0}, {0x135, 0x0},
+            {0x237, 0x0}, {0x454, 0x0}, {0x3BA, 0x0}, {0x21DA, 0x0}, {0x290E, 0x0}, {0x2991, 0x0}, {0xAB, 0x0},
+            {0x21E4, 0x0}, {0x2AAD, 0xFE00}, {0x290C, 0x0}, {0x2772, 0x0}, {0x298B, 0x0}, {0x2308, 0x0},
+            {0x201C, 0x0}, {0x2AA8, 0x0}, {0x21BD, 0x0}, {0x21BC, 0x0}, {0x2584, 0x0}, {0x21C7, 0x0}, {0x25FA, 0x0},
+            {0x2268, 0x0}, {0x22E6, 0x0}, {0x27EC, 0x0}, {0x21FD, 0x0}, {0x27E6, 0x0}, {0x2985, 0x0}, {0x21C6, 0x0},
+            {0x21CB, 0x0}, {0x22BF, 0x0}, {0x2A8D, 0x0}, {0x2A8F, 0x0}, {0x2018, 0x0}, {0x2A79, 0x0}, {0x22D6, 0x0},
+            {0x22B4, 0x0}, {0x25C2, 0x0}, {0x223A, 0x0}, {0x2014, 0x0}, {0xB5, 0x0}, {0xB7, 0x0}, {0x2212, 0x0},
+            {0x22B8, 0x0}, {0x2207, 0x0}, {0x224B, 0x338}, {0x149, 0x0}, {0x266E, 0x0}, {0x224E, 0x338},
+            {0x2247, 0x0}, {0x2013, 0x0}, {0x21D7, 0x0}, {0x2197, 0x0}, {0x2250, 0x338}, {0x2242, 0x338},
+            {0x2267, 0x338}, {0x2275, 0x0}, {0x21CE, 0x0}, {0x21AE, 0x0}, {0x2AF2, 0x0}, {0x21CD, 0x0},
+            {0x219A, 0x0}, {0x2266, 0x338}, {0x226E, 0x0}, {0x2274, 0x0}, {0x22EA, 0x0}, {0x2209, 0x0},
+            {0x220C, 0x0}, {0x2202, 0x338}, {0x2280, 0x0}, {0x21CF, 0x0}, {0x219B, 0x0}, {0x22EB, 0x0},
+            {0x2244, 0x0}, {0x2224, 0x0}, {0x2226, 0x0}, {0x2AC5, 0x338}, {0x2288, 0x0}, {0x2281, 0x0},
+            {0x2AC6, 0x338}, {0x2289, 0x0}, {0xF1, 0x0}, {0x2007, 0x0}, {0x223C, 0x20D2}, {0x21D6, 0x0},
+            {0x2196, 0x0}, {0xF3, 0x0}, {0xF4, 0x0}, {0x229D, 0x0}, {0x153, 0x0}, {0x29BF, 0x0}, {0xF2, 0x0},
+            {0x29B5, 0x0}, {0x21BA, 0x0}, {0x29BE, 0x0}, {0x203E, 0x0}, {0x14D, 0x0}, {0x3C9, 0x0}, {0x29B9, 0x0},
+            {0x2295, 0x0}, {0x21BB, 0x0}, {0x2134, 0x0}, {0xF8, 0x0}, {0xF5, 0x0}, {0x233D, 0x0}, {0x2AFD, 0x0},
+            {0x260E, 0x0}, {0x229E, 0x0}, {0x2A72, 0x0}, {0xB1, 0x0}, {0xA3, 0x0}, {0x227C, 0x0}, {0x2032, 0x0},
+            {0x2AB9, 0x0}, {0x227E, 0x0}, {0x3F, 0x0}, {0x21DB, 0x0}, {0x290F, 0x0}, {0x221A, 0x0}, {0x2992, 0x0},
+            {0x29A5, 0x0}, {0xBB, 0x0}, {0x21E5, 0x0}, {0x2933, 0x0}, {0x219D, 0x0}, {0x2236, 0x0}, {0x290D, 0x0},
+            {0x2773, 0x0}, {0x298C, 0x0}, {0x2309, 0x0}, {0x201D, 0x0}, {0x211D, 0x0}, {0x21C1, 0x0}, {0x21C0, 0x0},
+            {0x21C4, 0x0}, {0x21CC, 0x0}, {0x2AEE, 0x0}, {0x27ED, 0x0}, {0x21FE, 0x0}, {0x27E7, 0x0}, {0x2986, 0x0},
+            {0x21C9, 0x0}, {0x2019, 0x0}, {0x22B5, 0x0}, {0x25B8, 0x0}, {0x201A, 0x0}, {0x227D, 0x0}, {0x15D, 0x0},
+            {0x2ABA, 0x0}, {0x227F, 0x0}, {0x22A1, 0x0}, {0x2A66, 0x0}, {0x21D8, 0x0}, {0x2198, 0x0}, {0x2216, 0x0},
+            {0x266F, 0x0}, {0x3C3, 0x0}, {0x2243, 0x0}, {0x2AA0, 0x0}, {0x2A9F, 0x0}, {0x2246, 0x0}, {0x2190, 0x0},
+            {0x2323, 0x0}, {0x2AAC, 0xFE00}, {0x2293, 0x0}, {0x2294, 0x0}, {0x228F, 0x0}, {0x2290, 0x0},
+            {0x2192, 0x0}, {0x2605, 0x0}, {0xAF, 0x0}, {0x2ACB, 0x0}, {0x228A, 0x0}, {0x2ACC, 0x0}, {0x228B, 0x0},
+            {0x21D9, 0x0}, {0x2199, 0x0}, {0xDF, 0x0}, {0x3B8, 0x0}, {0x2248, 0x0}, {0xFE, 0x0}, {0x2DC, 0x0},
+            {0xD7, 0x0}, {0x2122, 0x0}, {0x29CD, 0x0}, {0x45B, 0x0}, {0x226C, 0x0}, {0xFA, 0x0}, {0x45E, 0x0},
+            {0xFB, 0x0}, {0x21C5, 0x0}, {0x296E, 0x0}, {0xF9, 0x0}, {0x21BF, 0x0}, {0x21BE, 0x0}, {0x2580, 0x0},
+            {0x25F8, 0x0}, {0x16B, 0x0}, {0x173, 0x0}, {0x228E, 0x0}, {0x3D2, 0x0}, {0x16F, 0x0}, {0x25F9, 0x0},
+            {0x22F0, 0x0}, {0x25B4, 0x0}, {0x21C8, 0x0}, {0x2AE9, 0x0}, {0x22A8, 0x0}, {0x3D6, 0x0}, {0x22A2, 0x0},
+            {0x225A, 0x0}, {0x22B2, 0x0}, {0x2282, 0x20D2}, {0x2283, 0x20D2}, {0x221D, 0x0}, {0x22B3, 0x0},
+            {0x175, 0x0}, {0x2227, 0x0}, {0x25EF, 0x0}, {0x25BD, 0x0}, {0x27FA, 0x0}, {0x27F7, 0x0}, {0x27F8, 0x0},
+            {0x27F5, 0x0}, {0x2A00, 0x0}, {0x27F9, 0x0}, {0x27F6, 0x0}, {0x25B3, 0x0}, {0xFD, 0x0}, {0x177, 0x0},
+            {0xC1, 0x0}, {0x102, 0x0}, {0xC0, 0x0}, {0x2254, 0x0}, {0xC3, 0x0}, {0x2306, 0x0}, {0x224E, 0x0},
+            {0x106, 0x0}, {0x10C, 0x0}, {0xC7, 0x0}, {0x2A74, 0x0}, {0x222F, 0x0}, {0x224D, 0x0}, {0x2021, 0x0},
+            {0x10E, 0x0}, {0x20DC, 0x0}, {0x110, 0x0}, {0xC9, 0x0}, {0x11A, 0x0}, {0xC8, 0x0}, {0x2203, 0x0},
+            {0x2200, 0x0}, {0x3DC, 0x0}, {0x11E, 0x0}, {0x122, 0x0}, {0x42A, 0x0}, {0x126, 0x0}, {0xCD, 0x0},
+            {0xCC, 0x0}, {0x128, 0x0}, {0x408, 0x0}, {0x136, 0x0}, {0x139, 0x0}, {0x39B, 0x0}, {0x13D, 0x0},
+            {0x13B, 0x0}, {0x13F, 0x0}, {0x141, 0x0}, {0x143, 0x0}, {0x147, 0x0}, {0x145, 0x0}, {0xD1, 0x0},
+            {0xD3, 0x0}, {0x150, 0x0}, {0xD2, 0x0}, {0xD8, 0x0}, {0xD5, 0x0}, {0x2A37, 0x0}, {0x154, 0x0},
+            {0x2916, 0x0}, {0x158, 0x0}, {0x156, 0x0}, {0x429, 0x0}, {0x42C, 0x0}, {0x15A, 0x0}, {0x160, 0x0},
+            {0x15E, 0x0}, {0x25A1, 0x0}, {0x22D0, 0x0}, {0x22D1, 0x0}, {0x164, 0x0}, {0x162, 0x0}, {0x166, 0x0},
+            {0xDA, 0x0}, {0x16C, 0x0}, {0x170, 0x0}, {0xD9, 0x0}, {0x168, 0x0}, {0x2AE6, 0x0}, {0x2016, 0x0},
+            {0x22AA, 0x0}, {0xDD, 0x0}, {0x179, 0x0}, {0x17D, 0x0}, {0xE1, 0x0}, {0x103, 0x0}, {0xE0, 0x0},
+            {0x2A55, 0x0}, {0x2221, 0x0}, {0x2222, 0x0}, {0x2A6F, 0x0}, {0x2248, 0x0}, {0xE3, 0x0}, {0x22BD, 0x0},
+            {0x2305, 0x0}, {0x2235, 0x0}, {0x212C, 0x0}, {0x22C2, 0x0}, {0x22C3, 0x0}, {0x22C1, 0x0}, {0x290D, 0x0},
+            {0x22A5, 0x0}, {0x22C8, 0x0}, {0x29C9, 0x0}, {0x2035, 0x0}, {0xA6, 0x0}, {0x2022, 0x0}, {0x224F, 0x0},
+            {0x107, 0x0}, {0x2A44, 0x0}, {0x2A4B, 0x0}, {0x2A47, 0x0}, {0x2A40, 0x0}, {0x10D, 0x0}, {0xE7, 0x0},
+            {0x2257, 0x0}, {0x2AEF, 0x0}, {0x2254, 0x0}, {0x40, 0x0}, {0x2218, 0x0}, {0x222E, 0x0}, {0x2210, 0x0},
+            {0x2117, 0x0}, {0x21B6, 0x0}, {0x2A46, 0x0}, {0x2A4A, 0x0}, {0x228D, 0x0}, {0x21B7, 0x0}, {0xA4, 0x0},
+            {0x232D, 0x0}, {0x2020, 0x0}, {0x2138, 0x0}, {0x10F, 0x0}, {0x297F, 0x0}, {0xF7, 0x0}, {0x22C7, 0x0},
+            {0x231E, 0x0}, {0x230D, 0x0}, {0x24, 0x0}, {0x231F, 0x0}, {0x230C, 0x0}, {0x111, 0x0}, {0xE9, 0x0},
+            {0x2A6E, 0x0}, {0x11B, 0x0}, {0x2255, 0x0}, {0xE8, 0x0}, {0x2A98, 0x0}, {0x2A97, 0x0}, {0x2205, 0x0},
+            {0x2004, 0x0}, {0x2005, 0x0}, {0x29E3, 0x0}, {0x2256, 0x0}, {0x3D, 0x0}, {0x225F, 0x0}, {0x2640, 0x0},
+            {0xFB03, 0x0}, {0xFB04, 0x0}, {0x2200, 0x0}, {0xBD, 0x0}, {0x2153, 0x0}, {0xBC, 0x0}, {0x2155, 0x0},
+            {0x2159, 0x0}, {0x215B, 0x0}, {0x2154, 0x0}, {0x2156, 0x0}, {0xBE, 0x0}, {0x2157, 0x0}, {0x215C, 0x0},
+            {0x2158, 0x0}, {0x215A, 0x0}, {0x215D, 0x0}, {0x215E, 0x0}, {0x1F5, 0x0}, {0x3DD, 0x0}, {0x11F, 0x0},
+            {0x2A80, 0x0}, {0x2A94, 0x0}, {0x2995, 0x0}, {0x2978, 0x0}, {0x22D7, 0x0}, {0x2273, 0x0}, {0x200A, 0x0},
+            {0x210B, 0x0}, {0x44A, 0x0}, {0x2665, 0x0}, {0x2026, 0x0}, {0x22B9, 0x0}, {0x223B, 0x0}, {0x2015, 0x0},
+            {0x210F, 0x0}, {0x127, 0x0}, {0x2043, 0x0}, {0x2010, 0x0}, {0xED, 0x0}, {0xEC, 0x0}, {0x2A0C, 0x0},
+            {0x29DC, 0x0}, {0x2105, 0x0}, {0x131, 0x0}, {0x22BA, 0x0}, {0xBF, 0x0}, {0x22F3, 0x0}, {0x129, 0x0},
+            {0x458, 0x0}, {0x3F0, 0x0}, {0x137, 0x0}, {0x138, 0x0}, {0x291B, 0x0}, {0x13A, 0x0}, {0x2112, 0x0},
+            {0x3BB, 0x0}, {0x27E8, 0x0}, {0x291D, 0x0}, {0x21A9, 0x0}, {0x21AB, 0x0}, {0x2939, 0x0}, {0x21A2, 0x0},
+            {0x2919, 0x0}, {0x7B, 0x0}, {0x5B, 0x0}, {0x13E, 0x0}, {0x13C, 0x0}, {0x201E, 0x0}, {0x2A7F, 0x0},
+            {0x2A93, 0x0}, {0x297C, 0x0}, {0x230A, 0x0}, {0x296A, 0x0}, {0x296B, 0x0}, {0x140, 0x0}, {0x23B0, 0x0},
+            {0x2A2D, 0x0}, {0x2217, 0x0}, {0x5F, 0x0}, {0x2993, 0x0}, {0x296D, 0x0}, {0x2039, 0x0}, {0x201A, 0x0},
+            {0x142, 0x0}, {0x22CB, 0x0}, {0x22C9, 0x0}, {0x2976, 0x0}, {0x2996, 0x0}, {0x21A6, 0x0}, {0x25AE, 0x0},
+            {0x2A29, 0x0}, {0x2A, 0x0}, {0x2AF0, 0x0}, {0xB7, 0x0}, {0x229F, 0x0}, {0x2238, 0x0}, {0x2213, 0x0},
+            {0x22A7, 0x0}, {0x223E, 0x0}, {0x22AF, 0x0}, {0x22AE, 0x0}, {0x144, 0x0}, {0x224F, 0x338}, {0x148, 0x0},
+            {0x146, 0x0}, {0x2924, 0x0}, {0x2262, 0x0}, {0x2928, 0x0}, {0x2204, 0x0}, {0x22EC, 0x0},
+            {0x22F9, 0x338}, {0x2AFD, 0x20E5}, {0x22E0, 0x0}, {0x2933, 0x338}, {0x219D, 0x338}, {0x22ED, 0x0},
+            {0x22E1, 0x0}, {0x2244, 0x0}, {0xF1, 0x0}, {0x2116, 0x0}, {0x22AD, 0x0}, {0x2904, 0x0}, {0x22AC, 0x0},
+            {0x2902, 0x0}, {0x2903, 0x0}, {0x2923, 0x0}, {0x2927, 0x0}, {0xF3, 0x0}, {0x151, 0x0}, {0x29BC, 0x0},
+            {0xF2, 0x0}, {0x2296, 0x0}, {0x22B6, 0x0}, {0xF8, 0x0}, {0xF5, 0x0}, {0x2297, 0x0}, {0x2AF3, 0x0},
+            {0x25, 0x0}, {0x2E, 0x0}, {0x2030, 0x0}, {0x2133, 0x0}, {0x210F, 0x0}, {0x210F, 0x0}, {0x2214, 0x0},
+            {0x2A25, 0x0}, {0xB1, 0x0}, {0x2AAF, 0x0}, {0x2119, 0x0}, {0x22E8, 0x0}, {0x221D, 0x0}, {0x22B0, 0x0},
+            {0x2008, 0x0}, {0x2057, 0x0}, {0x291C, 0x0}, {0x155, 0x0}, {0x27E9, 0x0}, {0x2975, 0x0}, {0x291E, 0x0},
+            {0x21AA, 0x0}, {0x21AC, 0x0}, {0x2945, 0x0}, {0x21A3, 0x0}, {0x291A, 0x0}, {0x7D, 0x0}, {0x5D, 0x0},
+            {0x159, 0x0}, {0x157, 0x0}, {0x201D, 0x0}, {0x297D, 0x0}, {0x230B, 0x0}, {0x296C, 0x0}, {0x23B1, 0x0},
+            {0x2A2E, 0x0}, {0x2994, 0x0}, {0x203A, 0x0}, {0x2019, 0x0}, {0x22CC, 0x0}, {0x22CA, 0x0}, {0x15B, 0x0},
+            {0x161, 0x0}, {0x15F, 0x0}, {0x22E9, 0x0}, {0x2925, 0x0}, {0x2929, 0x0}, {0x2322, 0x0}, {0x449, 0x0},
+            {0x3C2, 0x0}, {0x3C2, 0x0}, {0x2A6A, 0x0}, {0x2A33, 0x0}, {0x44C, 0x0}, {0x233F, 0x0}, {0x2660, 0x0},
+            {0x2293, 0xFE00}, {0x2294, 0xFE00}, {0x2291, 0x0}, {0x2292, 0x0}, {0x25A1, 0x0}, {0x25AA, 0x0},
+            {0x2216, 0x0}, {0x2323, 0x0}, {0x22C6, 0x0}, {0x2ABD, 0x0}, {0x2282, 0x0}, {0x2AC7, 0x0}, {0x2AD5, 0x0},
+            {0x2AD3, 0x0}, {0x2AB0, 0x0}, {0x2ABE, 0x0}, {0x2283, 0x0}, {0x2AC8, 0x0}, {0x2AD4, 0x0}, {0x2AD6, 0x0},
+            {0x2926, 0x0}, {0x292A, 0x0}, {0x2316, 0x0}, {0x165, 0x0}, {0x163, 0x0}, {0x2315, 0x0}, {0x2234, 0x0},
+            {0x3D1, 0x0}, {0x2009, 0x0}, {0x223C, 0x0}, {0x22A0, 0x0}, {0x2A30, 0x0}, {0x2336, 0x0}, {0x2AF1, 0x0},
+            {0x2034, 0x0}, {0x25EC, 0x0}, {0x167, 0x0}, {0xFA, 0x0}, {0x16D, 0x0}, {0x171, 0x0}, {0x297E, 0x0},
+            {0xF9, 0x0}, {0x231C, 0x0}, {0x230F, 0x0}, {0x231D, 0x0}, {0x230E, 0x0}, {0x169, 0x0}, {0x299C, 0x0},
+            {0x3D5, 0x0}, {0x3F1, 0x0}, {0x22BB, 0x0}, {0x22EE, 0x0}, {0x7C, 0x0}, {0x2ACB, 0xFE00},
+            {0x228A, 0xFE00}, {0x2ACC, 0xFE00}, {0x228B, 0xFE00}, {0x2A5F, 0x0}, {0x2259, 0x0}, {0x2118, 0x0},
+            {0x2240, 0x0}, {0x2A01, 0x0}, {0x2A02, 0x0}, {0x2A06, 0x0}, {0x2A04, 0x0}, {0x22C0, 0x0}, {0xFD, 0x0},
+            {0x17A, 0x0}, {0x17E, 0x0}, {0x2128, 0x0}, {0x2235, 0x0}, {0x212D, 0x0}, {0x2230, 0x0}, {0xB8, 0x0},
+            {0x22C4, 0x0}, {0x22A4, 0x0}, {0x2208, 0x0}, {0x395, 0x0}, {0x21D2, 0x0}, {0x22A3, 0x0}, {0xA, 0x0},
+            {0x2060, 0x0}, {0x226E, 0x0}, {0x39F, 0x0}, {0x203E, 0x0}, {0x220F, 0x0}, {0x2191, 0x0}, {0x21D1, 0x0},
+            {0x3A5, 0x0}, {0x2135, 0x0}, {0x22BE, 0x0}, {0x237C, 0x0}, {0x224D, 0x0}, {0x223D, 0x0}, {0x2235, 0x0},
+            {0x29B0, 0x0}, {0x226C, 0x0}, {0x25EF, 0x0}, {0x2A00, 0x0}, {0x2605, 0x0}, {0x2261, 0x20E5},
+            {0x229E, 0x0}, {0x2A50, 0x0}, {0x29B2, 0x0}, {0x29C2, 0x0}, {0x2254, 0x0}, {0x2A6D, 0x0}, {0x2938, 0x0},
+            {0x2935, 0x0}, {0x293D, 0x0}, {0x293C, 0x0}, {0x290F, 0x0}, {0x2021, 0x0}, {0x2A77, 0x0}, {0x29B1, 0x0},
+            {0x22C4, 0x0}, {0x3DD, 0x0}, {0x2214, 0x0}, {0x29A6, 0x0}, {0x3B5, 0x0}, {0x2255, 0x0}, {0x2A78, 0x0},
+            {0x2A82, 0x0}, {0x2A7C, 0x0}, {0x2277, 0x0}, {0x2948, 0x0}, {0x2A3C, 0x0}, {0x22F5, 0x0}, {0x291F, 0x0},
+            {0x2973, 0x0}, {0x298F, 0x0}, {0x298D, 0x0}, {0x2967, 0x0}, {0x2A81, 0x0}, {0x22D6, 0x0}, {0x2276, 0x0},
+            {0x2272, 0x0}, {0x2A34, 0x0}, {0x25CA, 0x0}, {0x2A7B, 0x0}, {0x2966, 0x0}, {0x2720, 0x0}, {0x2A2A, 0x0},
+            {0x2249, 0x0}, {0x266E, 0x0}, {0x2197, 0x0}, {0x2204, 0x0}, {0x2209, 0x0}, {0x22F7, 0x0}, {0x22F6, 0x0},
+            {0x220C, 0x0}, {0x22FE, 0x0}, {0x22FD, 0x0}, {0x2A14, 0x0}, {0x2AAF, 0x338}, {0x22E2, 0x0},
+            {0x22E3, 0x0}, {0x2282, 0x20D2}, {0x2AB0, 0x338}, {0x2283, 0x20D2}, {0x29DE, 0x0}, {0x22B4, 0x20D2},
+            {0x22B5, 0x20D2}, {0x2196, 0x0}, {0x29BB, 0x0}, {0x3BF, 0x0}, {0x2134, 0x0}, {0x2A57, 0x0},
+            {0x2031, 0x0}, {0x210E, 0x0}, {0x2A22, 0x0}, {0x2A26, 0x0}, {0x2A27, 0x0}, {0x227E, 0x0}, {0x2A16, 0x0},
+            {0x225F, 0x0}, {0x2920, 0x0}, {0x2974, 0x0}, {0x298E, 0x0}, {0x2990, 0x0}, {0x2969, 0x0}, {0x211B, 0x0},
+            {0x2A35, 0x0}, {0x2968, 0x0}, {0x2198, 0x0}, {0x2A24, 0x0}, {0x2972, 0x0}, {0x2AC3, 0x0}, {0x2AC1, 0x0},
+            {0x2ABF, 0x0}, {0x2979, 0x0}, {0x227F, 0x0}, {0x2AD8, 0x0}, {0x2AC4, 0x0}, {0x27C9, 0x0}, {0x2AD7, 0x0},
+            {0x297B, 0x0}, {0x2AC2, 0x0}, {0x2AC0, 0x0}, {0x2199, 0x0}, {0x2ADA, 0x0}, {0x2A39, 0x0}, {0x2A3B, 0x0},
+            {0x2191, 0x0}, {0x3C5, 0x0}, {0x29A7, 0x0}, {0x299A, 0x0}, {0x21DD, 0x0}, {0x2911, 0x0}, {0x2250, 0x0},
+            {0x222B, 0x0}, {0x2AA1, 0x0}, {0x2260, 0x0}, {0x2241, 0x0}, {0x2202, 0x0}, {0x227A, 0x0}, {0x22A2, 0x0},
+            {0x227B, 0x0}, {0x220B, 0x0}, {0x2283, 0x0}, {0x2949, 0x0}, {0x5F, 0x0}, {0x2A58, 0x0}, {0x29A8, 0x0},
+            {0x29A9, 0x0}, {0x29AA, 0x0}, {0x29AB, 0x0}, {0x29AC, 0x0}, {0x29AD, 0x0}, {0x29AE, 0x0}, {0x29AF, 0x0},
+            {0x299D, 0x0}, {0x224A, 0x0}, {0x2233, 0x0}, {0x224C, 0x0}, {0x2305, 0x0}, {0x23B6, 0x0}, {0x2A01, 0x0},
+            {0x2A06, 0x0}, {0x2A04, 0x0}, {0x22C0, 0x0}, {0x229F, 0x0}, {0x22A0, 0x0}, {0x27C8, 0x0}, {0x2A49, 0x0},
+            {0xAE, 0x0}, {0x24C8, 0x0}, {0x2A10, 0x0}, {0x2663, 0x0}, {0x2A48, 0x0}, {0x22CE, 0x0}, {0x2232, 0x0},
+            {0x2251, 0x0}, {0x2238, 0x0}, {0x2910, 0x0}, {0x27FF, 0x0}, {0x23E7, 0x0}, {0x2205, 0x0}, {0x29E5, 0x0},
+            {0x2A0D, 0x0}, {0x2A7E, 0x0}, {0x2A84, 0x0}, {0x2A8A, 0x0}, {0x2925, 0x0}, {0x2926, 0x0}, {0x2110, 0x0},
+            {0x2111, 0x0}, {0x29DD, 0x0}, {0x2124, 0x0}, {0x22BA, 0x0}, {0x2A17, 0x0}, {0x29B4, 0x0}, {0x294B, 0x0},
+            {0x2A7D, 0x0}, {0x2A83, 0x0}, {0x231E, 0x0}, {0x2A89, 0x0}, {0x231F, 0x0}, {0x294A, 0x0}, {0x21A5, 0x0},
+            {0x22B8, 0x0}, {0x2115, 0x0}, {0x2A6D, 0x338}, {0x22F5, 0x338}, {0x2A36, 0x0}, {0x2225, 0x0},
+            {0x2A23, 0x0}, {0x2A15, 0x0}, {0x2AB5, 0x0}, {0x22E8, 0x0}, {0x232E, 0x0}, {0x2312, 0x0}, {0x2313, 0x0},
+            {0x29B3, 0x0}, {0x211C, 0x0}, {0x2A12, 0x0}, {0x29CE, 0x0}, {0x2A13, 0x0}, {0x2216, 0x0}, {0x2223, 0x0},
+            {0x29E4, 0x0}, {0x228F, 0x0}, {0x2290, 0x0}, {0x2286, 0x0}, {0x2AB6, 0x0}, {0x22E9, 0x0}, {0x2287, 0x0},
+            {0x3D1, 0x0}, {0x223C, 0x0}, {0x2A31, 0x0}, {0x25B5, 0x0}, {0x2A3A, 0x0}, {0x23E2, 0x0}, {0x231C, 0x0},
+            {0x231D, 0x0}, {0x3F0, 0x0}, {0x3C2, 0x0}, {0x3D1, 0x0}, {0x2216, 0x0}, {0xB7, 0x0}, {0x2299, 0x0},
+            {0x2261, 0x0}, {0x2210, 0x0}, {0xA8, 0x0}, {0x2193, 0x0}, {0x311, 0x0}, {0x21D3, 0x0}, {0x224F, 0x0},
+            {0x2190, 0x0}, {0x230A, 0x0}, {0x21D0, 0x0}, {0x2272, 0x0}, {0x2133, 0x0}, {0x2213, 0x0}, {0x226D, 0x0},
+            {0x2204, 0x0}, {0x2282, 0x20D2}, {0x23DE, 0x0}, {0xB1, 0x0}, {0x2234, 0x0}, {0x2009, 0x0},
+            {0x20DB, 0x0}, {0x228E, 0x0}, {0x2035, 0x0}, {0x22CD, 0x0}, {0x2A02, 0x0}, {0xB7, 0x0}, {0x2713, 0x0},
+            {0x2102, 0x0}, {0x22A1, 0x0}, {0x2193, 0x0}, {0x2A86, 0x0}, {0x22DB, 0x0}, {0x2269, 0xFE00},
+            {0x2665, 0x0}, {0x2190, 0x0}, {0x22DA, 0x0}, {0x2268, 0xFE00}, {0x2A7E, 0x338}, {0x2A7D, 0x338},
+            {0x2226, 0x0}, {0x2224, 0x0}, {0x2288, 0x0}, {0x2289, 0x0}, {0x22D4, 0x0}, {0x211A, 0x0}, {0x2660, 0x0},
+            {0x2AC5, 0x0}, {0x228A, 0x0}, {0x2AC6, 0x0}, {0x228B, 0x0}, {0x2234, 0x0}, {0x225C, 0x0}, {0x221D, 0x0},
+            {0x212C, 0x0}, {0x2295, 0x0}, {0x2242, 0x0}, {0x2131, 0x0}, {0x2148, 0x0}, {0x2112, 0x0}, {0x21BC, 0x0},
+            {0x21DA, 0x0}, {0x2209, 0x0}, {0x226F, 0x0}, {0x2237, 0x0}, {0x2192, 0x0}, {0x230B, 0x0}, {0x21D2, 0x0},
+            {0x205F, 0x200A}, {0x2243, 0x0}, {0x2248, 0x0}, {0x23DF, 0x0}, {0x2912, 0x0}, {0x21A5, 0x0},
+            {0x229B, 0x0}, {0x2201, 0x0}, {0x22CF, 0x0}, {0x2A96, 0x0}, {0x2A8C, 0x0}, {0x2A85, 0x0}, {0x2A8B, 0x0},
+            {0x23B0, 0x0}, {0x27FC, 0x0}, {0x21A7, 0x0}, {0x21A4, 0x0}, {0x21CD, 0x0}, {0x219A, 0x0},
+            {0x2AC5, 0x338}, {0x2AC6, 0x338}, {0x2AB7, 0x0}, {0x2192, 0x0}, {0x23B1, 0x0}, {0x2291, 0x0},
+            {0x2292, 0x0}, {0x2ACB, 0x0}, {0x2AB8, 0x0}, {0x2ACC, 0x0}, {0x21C8, 0x0}, {0x3F5, 0x0}, {0x2205, 0x0},
+            {0x2296, 0x0}, {0x2297, 0x0}, {0x21CC, 0x0}, {0x2277, 0x0}, {0x2308, 0x0}, {0x2276, 0x0}, {0x205F, 0x0},
+            {0x226A, 0x338}, {0x2280, 0x0}, {0x2281, 0x0}, {0x2283, 0x20D2}, {0x23B4, 0x0}, {0x21C0, 0x0},
+            {0x21DB, 0x0}, {0x29F4, 0x0}, {0x2218, 0x0}, {0x2294, 0x0}, {0x2286, 0x0}, {0x2195, 0x0}, {0x21D5, 0x0},
+            {0x2223, 0x0}, {0x3F6, 0x0}, {0x25AA, 0x0}, {0x229A, 0x0}, {0x229D, 0x0}, {0x22DE, 0x0}, {0x22DF, 0x0},
+            {0x2666, 0x0}, {0x2A95, 0x0}, {0x2130, 0x0}, {0x21CF, 0x0}, {0x219B, 0x0}, {0x227C, 0x0}, {0x2AB9, 0x0},
+            {0x210D, 0x0}, {0x3D5, 0x0}, {0x227D, 0x0}, {0x2ABA, 0x0}, {0x2248, 0x0}, {0x2195, 0x0}, {0x2913, 0x0},
+            {0x21A7, 0x0}, {0x2147, 0x0}, {0x2265, 0x0}, {0x2273, 0x0}, {0x210B, 0x0}, {0x224E, 0x0}, {0x22C2, 0x0},
+            {0x21E4, 0x0}, {0x21A4, 0x0}, {0x22B2, 0x0}, {0x21BF, 0x0}, {0x2262, 0x0}, {0x224F, 0x338},
+            {0x2270, 0x0}, {0x2274, 0x0}, {0x221D, 0x0}, {0x2309, 0x0}, {0x2970, 0x0}, {0x2191, 0x0}, {0x228F, 0x0},
+            {0x23B5, 0x0}, {0x7C, 0x0}, {0x29EB, 0x0}, {0x2147, 0x0}, {0x2253, 0x0}, {0x25BF, 0x0}, {0x25C3, 0x0},
+            {0x228A, 0xFE00}, {0x228B, 0xFE00}, {0x2061, 0x0}, {0x2146, 0x0}, {0x2AE4, 0x0}, {0x21D1, 0x0},
+            {0x295A, 0x0}, {0x2952, 0x0}, {0x2266, 0x0}, {0x27F5, 0x0}, {0x27F8, 0x0}, {0x2242, 0x338},
+            {0x2244, 0x0}, {0x2249, 0x0}, {0x210C, 0x0}, {0x2AAF, 0x0}, {0x227E, 0x0}, {0x21E5, 0x0}, {0x21A6, 0x0},
+            {0x22B3, 0x0}, {0x21BE, 0x0}, {0x2AB0, 0x0}, {0x227F, 0x0}, {0x2287, 0x0}, {0x296E, 0x0}, {0x2240, 0x0},
+            {0x200A, 0x0}, {0x25B3, 0x0}, {0x25B4, 0x0}, {0x22C7, 0x0}, {0x2252, 0x0}, {0x21A9, 0x0}, {0x21A2, 0x0},
+            {0x21BC, 0x0}, {0x27F5, 0x0}, {0x21AB, 0x0}, {0x2221, 0x0}, {0x22EA, 0x0}, {0x2225, 0x0}, {0x2216, 0x0},
+            {0x25B9, 0x0}, {0x21BF, 0x0}, {0x2ACB, 0xFE00}, {0x2ACC, 0xFE00}, {0x2D9, 0x0}, {0x22A8, 0x0},
+            {0x21BD, 0x0}, {0x2AA2, 0x0}, {0x2500, 0x0}, {0x2063, 0x0}, {0x2062, 0x0}, {0x21C3, 0x0}, {0x2194, 0x0},
+            {0x21D4, 0x0}, {0x2A7D, 0x0}, {0x27F6, 0x0}, {0x27F9, 0x0}, {0x2199, 0x0}, {0x226A, 0x0}, {0x2279, 0x0},
+            {0x2278, 0x0}, {0x2288, 0x0}, {0x2224, 0x0}, {0x2018, 0x0}, {0x220B, 0x0}, {0x295B, 0x0}, {0x2953, 0x0},
+            {0x2193, 0x0}, {0x2190, 0x0}, {0x2290, 0x0}, {0x2245, 0x0}, {0x2196, 0x0}, {0x200B, 0x0}, {0x21B6, 0x0},
+            {0x2306, 0x0}, {0x21CA, 0x0}, {0x21AA, 0x0}, {0x21C7, 0x0}, {0x2194, 0x0}, {0x22CB, 0x0}, {0x27F6, 0x0},
+            {0x21AC, 0x0}, {0x2226, 0x0}, {0x22EB, 0x0}, {0x21A3, 0x0}, {0x21C0, 0x0}, {0x22B4, 0x0}, {0x21BE, 0x0},
+            {0x2019, 0x0}, {0x222E, 0x0}, {0x21D3, 0x0}, {0x21D0, 0x0}, {0x21C1, 0x0}, {0x294E, 0x0}, {0x29CF, 0x0},
+            {0x2960, 0x0}, {0x2958, 0x0}, {0x2198, 0x0}, {0x2271, 0x0}, {0x2275, 0x0}, {0x224E, 0x338},
+            {0x22EA, 0x0}, {0x228F, 0x338}, {0x23DC, 0x0}, {0x21C2, 0x0}, {0x2192, 0x0}, {0x2197, 0x0},
+            {0x25BD, 0x0}, {0x21BA, 0x0}, {0x21B7, 0x0}, {0x21C3, 0x0}, {0x21BD, 0x0}, {0x21C6, 0x0}, {0x21CE, 0x0},
+            {0x21AE, 0x0}, {0x22EC, 0x0}, {0x21C4, 0x0}, {0x219D, 0x0}, {0x22CC, 0x0}, {0x3F5, 0x0}, {0x22B5, 0x0},
+            {0x22B2, 0x0}, {0xB4, 0x0}, {0x60, 0x0}, {0x2DC, 0x0}, {0x21D2, 0x0}, {0x21F5, 0x0}, {0x25FB, 0x0},
+            {0x22DB, 0x0}, {0x2267, 0x0}, {0x27E8, 0x0}, {0x2951, 0x0}, {0x22DA, 0x0}, {0xA0, 0x0}, {0x2AAF, 0x338},
+            {0x22EB, 0x0}, {0x2AB0, 0x338}, {0x227F, 0x338}, {0x2289, 0x0}, {0x29D0, 0x0}, {0x295C, 0x0},
+            {0x2954, 0x0}, {0x23DD, 0x0}, {0x21C5, 0x0}, {0x21BB, 0x0}, {0x21C2, 0x0}, {0x22ED, 0x0}, {0x21C1, 0x0},
+            {0x21C9, 0x0}, {0x219E, 0x0}, {0x22B3, 0x0}, {0x21D5, 0x0}, {0x2225, 0x0}, {0x295E, 0x0}, {0x2956, 0x0},
+            {0x25FC, 0x0}, {0x2A7E, 0x0}, {0x27E6, 0x0}, {0x2961, 0x0}, {0x2959, 0x0}, {0x22B4, 0x0}, {0x200B, 0x0},
+            {0x226B, 0x338}, {0x2A7D, 0x338}, {0x2AA1, 0x338}, {0x220C, 0x0}, {0x2290, 0x338}, {0x2247, 0x0},
+            {0x27E9, 0x0}, {0x294F, 0x0}, {0x2291, 0x0}, {0x2758, 0x0}, {0x25BE, 0x0}, {0x25C2, 0x0}, {0x21CB, 0x0},
+            {0x21CC, 0x0}, {0x21A0, 0x0}, {0x295F, 0x0}, {0x2957, 0x0}, {0x27F7, 0x0}, {0x27FA, 0x0}, {0x200B, 0x0},
+            {0x29CF, 0x338}, {0x227C, 0x0}, {0x21CB, 0x0}, {0x27E7, 0x0}, {0x295D, 0x0}, {0x2955, 0x0},
+            {0x22B5, 0x0}, {0x2293, 0x0}, {0x227D, 0x0}, {0x25B8, 0x0}, {0x27F7, 0x0}, {0x27F8, 0x0}, {0x2950, 0x0},
+            {0x21C6, 0x0}, {0x200B, 0x0}, {0x2267, 0x338}, {0x29D0, 0x338}, {0x21C4, 0x0}, {0x2292, 0x0},
+            {0x21AD, 0x0}, {0x2145, 0x0}, {0x21D4, 0x0}, {0x27F9, 0x0}, {0x25AB, 0x0}, {0x226B, 0x0}, {0x2226, 0x0},
+            {0x2A7E, 0x338}, {0x22EC, 0x0}, {0x22E2, 0x0}, {0x201C, 0x0}, {0x296F, 0x0}, {0x201D, 0x0},
+            {0x222F, 0x0}, {0x25AA, 0x0}, {0x200B, 0x0}, {0x22E0, 0x0}, {0x22ED, 0x0}, {0x22E1, 0x0}, {0x2DD, 0x0},
+            {0x22E3, 0x0}, {0x2AA2, 0x338}, {0x2232, 0x0}, {0x27FA, 0x0}, {0x2233, 0x0},
+        };
+    } // namespace internal
+} // namespace csoup
+
+#endif // CSOUP_ENTITYTRIE_H_
@@ -7,9 +7,20 @@
 //
 
 #include "formelement.h"
+#include "document.h"
 #include "../selector/elementsref.h"
 
 namespace csoup {
+    FormElement::FormElement(Document* document, const StringRef& tagName, const StringRef& baseUri, Allocator* allocator) :
+    Element(CSOUP_NODE_FORMELEMENT, document->internTag(tagName), baseUri, allocator), elements_(NULL) {
+        
+    }
+    
+    FormElement::FormElement(Document* document, const StringRef& tagName, const Attributes& attributes, const StringRef& baseUri, Allocator* allocator) :
+    Element(CSOUP_NODE_FORMELEMENT, document->internTag(tagName), attributes, baseUri, allocator), elements_(NULL) {
+        
+    }
+    
     void FormElement::appendElementToForm(csoup::Element *ele) {
         ensureElementsRef()->append(ele);
     }
@@ -8,13 +8,18 @@ namespace csoup {
     
     class FormElement : public Element {
     public:
-        FormElement(const StringRef& tagName, const StringRef& baseUri, Allocator* allocator) :
-        Element(CSOUP_NODE_FORMELEMENT, tagName, baseUri, allocator), elements_(NULL) {
+        // see the Element constructors taking a document
+        FormElement(Document* document, const StringRef& tagName, const StringRef& baseUri, Allocator* allocator);
+        
+        FormElement(Document* document, const StringRef& tagName, const Attributes& attributes, const StringRef& baseUri, Allocator* allocator);
+        
+        FormElement(const Tag* tag, const StringRef& baseUri, Allocator* allocator) :
+        Element(CSOUP_NODE_FORMELEMENT, tag, baseUri, allocator), elements_(NULL) {
             
         }
         
-        FormElement(const StringRef& tagName, const Attributes& attributes, const StringRef& baseUri, Allocator* allocator) :
-        Element(CSOUP_NODE_FORMELEMENT, tagName, attributes, baseUri, allocator), elements_(NULL) {
+        FormElement(const Tag* tag, const Attributes& attributes, const StringRef& baseUri, Allocator* allocator) :
+        Element(CSOUP_NODE_FORMELEMENT, tag, attributes, baseUri, allocator), elements_(NULL) {
             
         }
         
@@ -40,10 +40,10 @@ namespace csoup {
     }
     
     void Node::after(csoup::Node *node) {
-        parentNode()->insertNode(siblingIndex(), node);
+        parentNode()->insertNode(siblingIndex() + 1, node);
     }
     
     void Node::before(csoup::Node *node) {
-        parentNode()->insertNode(siblingIndex() + 1, node);
+        parentNode()->insertNode(siblingIndex(), node);
     }
 }
\ No newline at end of file
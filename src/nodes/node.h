@@ -3,6 +3,7 @@
 
 #include "../internal/nodedata.h"
 #include "../util/stringref.h"
+#include "../util/csoup_string.h"
 
 namespace csoup {
     class Document;
@@ -11,7 +12,7 @@ namespace csoup {
     class Node {
     public:
         Node(NodeTypeEnum type, Node* parent, size_t siblingIndex, const StringRef& baseUri, Allocator* allocator)
-        : type_(type), parent_(parent), siblingIndex_(siblingIndex), baseUri_(NULL), allocator_(allocator) {
+        : type_(type), parent_(parent), siblingIndex_(siblingIndex), sourcePos_(kNoSourcePos), baseUri_(NULL), allocator_(allocator) {
             CSOUP_ASSERT(allocator != NULL);
             baseUri_ = CSOUP_NEW2(allocator, String, baseUri, allocator);
         }
@@ -40,6 +41,16 @@ namespace csoup {
             return baseUri_ ? baseUri_->ref() : StringRef("");
         }
         
+        // Byte offset in the parser input of the token that created this node, or
+        // kNoSourcePos. Document::locate() turns it into a line and column.
+        size_t sourcePos() const {
+            return sourcePos_;
+        }
+        
+        void setSourcePos(size_t pos) {
+            sourcePos_ = pos;
+        }
+        
         void before(Node* node);
         void after(Node* node);
         
@@ -62,6 +73,7 @@ namespace csoup {
         // This is a weak reference to parent node; Don't try to release this node;
         Node* parent_;
         size_t siblingIndex_;
+        size_t sourcePos_;
         
         String* baseUri_;
         Allocator* allocator_;
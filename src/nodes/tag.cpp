@@ -1,146 +1,129 @@
-#include <map>
-#include <string>
+#include <cstring>
 #include "tag.h"
+#include "tagtable.h"
 #include "../util/stringref.h"
-
-namespace {
-    using namespace csoup;
-    
-    typedef std::map<std::string, Tag*> TagMap;
-    TagMap globalTags_;
-    
-    // internal static initialisers:
-    // prepped from http://www.w3.org/TR/REC-html40/sgml/dtd.html and other sources
-    StringRef blockTags[] = {
-        "html", "head", "body", "frameset", "script", "noscript", "style", "meta", "link", "title", "frame",
-        "noframes", "section", "nav", "aside", "hgroup", "header", "footer", "p", "h1", "h2", "h3", "h4", "h5", "h6",
-        "ul", "ol", "pre", "div", "blockquote", "hr", "address", "figure", "figcaption", "form", "fieldset", "ins",
-        "del", "s", "dl", "dt", "dd", "li", "table", "caption", "thead", "tfoot", "tbody", "colgroup", "col", "tr", "th",
-        "td", "video", "audio", "canvas", "details", "menu", "plaintext"
-    };
-    StringRef inlineTags[] = {
-        "object", "base", "font", "tt", "i", "b", "u", "big", "small", "em", "strong", "dfn", "code", "samp", "kbd",
-        "var", "cite", "abbr", "time", "acronym", "mark", "ruby", "rt", "rp", "a", "img", "br", "wbr", "map", "q",
-        "sub", "sup", "bdo", "iframe", "embed", "span", "input", "select", "textarea", "label", "button", "optgroup",
-        "option", "legend", "datalist", "keygen", "output", "progress", "meter", "area", "param", "source", "track",
-        "summary", "command", "device", "area", "basefont", "bgsound", "menuitem", "param", "source", "track"
-    };
-    StringRef emptyTags[] = {
-        "meta", "link", "base", "frame", "img", "br", "wbr", "embed", "hr", "input", "keygen", "col", "command",
-        "device", "area", "basefont", "bgsound", "menuitem", "param", "source", "track"
-    };
-    StringRef formatAsInlineTags[] = {
-        "title", "a", "p", "h1", "h2", "h3", "h4", "h5", "h6", "pre", "address", "li", "th", "td", "script", "style",
-        "ins", "del", "s"
-    };
-    StringRef preserveWhitespaceTags[] = {
-        "pre", "plaintext", "title", "textarea"
-        // script is not here as it is a data node, which always preserve whitespace
-    };
-    // todo: I think we just need submit tags, and can scrub listed
-    StringRef formListedTags[] = {
-        "button", "fieldset", "input", "keygen", "object", "output", "select", "textarea"
-    };
-    StringRef formSubmitTags[] = {
-        "input", "keygen", "object", "select", "textarea"
-    };
-}
+#include "../util/allocators.h"
+#include "../internal/vector.h"
+#include "../internal/strscan.h"
 
 namespace csoup {
-    void Tag::GlobalTagMap::registerTag(const csoup::StringRef &tagName, Tag* tag) {
-        std::string strTagName(tagName.data(), tagName.size());
-        if (globalTags_.count(strTagName)) {
-            delete globalTags_[strTagName];
+    Tag::KnownTags::KnownTags() {
+        tags_[CSOUP_TAG_UNKNOWN] = NULL;
+        for (int id = CSOUP_TAG_UNKNOWN + 1; id < CSOUP_TAG_COUNT; ++ id) {
+            const internal::TagTableEntry& entry = internal::kTagTable[id];
+            tags_[id] = new Tag(StringRef(entry.name, entry.length), static_cast<TagIdEnum>(id), entry.flags);
         }
-        
-        globalTags_[strTagName] = tag;
     }
-    
-    Tag::GlobalTagMap::GlobalTagMap() {
-        for (size_t i = 0; i < arrayLength(blockTags); ++ i) {
-            Tag* tag = new Tag(blockTags[i]);
-            registerTag(blockTags[i], tag);
-        }
-        
-        for (size_t i = 0; i < arrayLength(inlineTags); ++ i) {
-            Tag* tag = new Tag(inlineTags[i]);
-            tag->isBlock_ = false;
-            tag->canContainBlock_ = false;
-            tag->formatAsBlock_ = false;
-            
-            registerTag(inlineTags[i], tag);
-        }
-        
-        for (size_t i = 0; i < arrayLength(emptyTags); ++ i) {
-            Tag* tag = query(emptyTags[i]);
-            CSOUP_ASSERT(tag != NULL);
-            
-            tag->canContainBlock_ = false;
-            tag->canContainInline_ = false;
-            tag->empty_ = true;
-        }
-        
-        for (size_t i = 0; i < arrayLength(formatAsInlineTags); ++ i) {
-            Tag* tag = query(formatAsInlineTags[i]);
-            CSOUP_ASSERT(tag != NULL);
-            tag->formatAsBlock_ = false;
-        }
-        
-        for (size_t i = 0; i < arrayLength(preserveWhitespaceTags); ++ i) {
-            Tag* tag = query(preserveWhitespaceTags[i]);
-            CSOUP_ASSERT(tag != NULL);
-            tag->preserveWhitespace_ = true;
+
+    Tag::KnownTags::~KnownTags() {
+        for (int id = 0; id < CSOUP_TAG_COUNT; ++ id) {
+            delete tags_[id];
         }
-        
-        for (size_t i = 0; i < arrayLength(formListedTags); ++ i) {
-            Tag* tag = query(formListedTags[i]);
-            CSOUP_ASSERT(tag != NULL);
-            tag->formList_ = true;
+    }
+
+    const Tag* Tag::valueOf(TagIdEnum id) {
+        static const Tag::KnownTags knownTags;
+
+        CSOUP_ASSERT(id >= 0 && id < CSOUP_TAG_COUNT);
+        return knownTags.tags_[id];
+    }
+
+    TagIdEnum Tag::idOf(const StringRef& tagName) {
+        size_t length = tagName.size();
+        if (length == 0 || length > internal::kTagNameMaxLength) return CSOUP_TAG_UNKNOWN;
+
+        uint32_t hash = internal::kTagHashBasis;
+        for (size_t i = 0; i < length; ++ i) {
+            hash = hashName(hash, static_cast<unsigned char>(tagName.data()[i]));
         }
-        
-        for (size_t i = 0; i < arrayLength(formSubmitTags); ++ i) {
-            Tag* tag = query(formSubmitTags[i]);
-            CSOUP_ASSERT(tag != NULL);
-            tag->formSubmit_ = true;
+
+        // the only known name with this hash, if tagName is known at all
+        int id = slotOf(hash);
+        const internal::TagTableEntry& entry = internal::kTagTable[id];
+        if (entry.length != length || std::memcmp(entry.name, tagName.data(), length) != 0) {
+            return CSOUP_TAG_UNKNOWN;
         }
+        return static_cast<TagIdEnum>(id);
     }
-    
-    Tag::GlobalTagMap::~GlobalTagMap() {
-        for (TagMap::iterator it = globalTags_.begin(); it != globalTags_.end(); ++ it) {
-            delete it->second;
+
+    TagIdEnum Tag::idOf(uint32_t hash, const StringRef& tagName) {
+        size_t length = tagName.size();
+        if (length == 0 || length > internal::kTagNameMaxLength) return CSOUP_TAG_UNKNOWN;
+
+        const internal::TagTableEntry& entry = internal::kTagTable[slotOf(hash)];
+        if (entry.length != length) return CSOUP_TAG_UNKNOWN;
+        for (size_t i = 0; i < length; ++ i) {
+            if (entry.name[i] != internal::asciiToLower(tagName.data()[i])) return CSOUP_TAG_UNKNOWN;
         }
+        return static_cast<TagIdEnum>(&entry - internal::kTagTable);
     }
-    
-    Tag* Tag::GlobalTagMap::query(const csoup::StringRef &tagName) {
-        std::string strTagName(tagName.data(), tagName.size());
-        if (globalTags_.count(strTagName)) {
-            return globalTags_[strTagName];
-        } else {
-            return NULL;
-        }
+
+    int Tag::slotOf(uint32_t hash) {
+        uint32_t bucket = hash >> (32 - internal::kTagBucketBits);
+        uint32_t slot = ((hash >> (32 - internal::kTagBucketBits - internal::kTagSlotBits)) +
+                         internal::kTagDisplacements[bucket]) & ((1u << internal::kTagSlotBits) - 1);
+        return internal::kTagSlots[slot];
     }
-    
-    Tag::Tag(const StringRef& tagName) :
-    tagName_(tagName), isBlock_(true), formatAsBlock_(true), canContainBlock_(true), canContainInline_(true),
-    empty_(false), selfClosing_(false), preserveWhitespace_(false), formList_(false), formSubmit_(false)
+
+    Tag::Tag(const StringRef& tagName, TagIdEnum id, unsigned flags) :
+    tagName_(tagName), id_(id), flags_(flags), selfClosing_(false)
     {
     }
-    
+
     bool Tag::operator==(const csoup::Tag &obj) const {
         if (this == &obj) return true;
-        
-        if (canContainBlock_ != obj.canContainBlock_) return false;
-        if (canContainInline_ != obj.canContainInline_) return false;
-        if (empty_ != obj.empty_) return false;
-        if (formatAsBlock_ != obj.formatAsBlock_) return false;
-        if (isBlock_ != obj.isBlock_) return false;
-        if (preserveWhitespace_ != obj.preserveWhitespace_) return false;
+
+        if (flags_ != obj.flags_) return false;
         if (selfClosing_ != obj.selfClosing_) return false;
-        if (formList_ != obj.formList_) return false;
-        if (formSubmit_ != obj.formSubmit_) return false;
-        
+
         if (!internal::strEquals(tagName_, obj.tagName_)) return false;
-        
+
         return true;
     }
-}
\ No newline at end of file
+
+    UnknownTagSet::UnknownTagSet(Allocator* allocator) : allocator_(allocator), tags_(NULL) {
+        CSOUP_ASSERT(allocator != NULL);
+        tags_ = CSOUP_NEW2(allocator, internal::Vector<Tag*>, 4, allocator);
+    }
+
+    UnknownTagSet::~UnknownTagSet() {
+        for (size_t i = 0; i < tags_->size(); ++ i) {
+            Tag* tag = *tags_->at(i);
+            allocator_->free(tag->tagName().data());
+            CSOUP_DELETE(allocator_, tag);
+        }
+        CSOUP_DELETE(allocator_, tags_);
+    }
+
+    const Tag* UnknownTagSet::valueOf(const StringRef& tagName) {
+        const Tag* known = Tag::valueOf(tagName);
+        if (known != NULL) return known;
+
+        for (size_t i = 0; i < tags_->size(); ++ i) {
+            Tag* tag = *tags_->at(i);
+            if (internal::strEquals(tag->tagName(), tagName)) return tag;
+        }
+
+        // jsoup's defaults for tags it doesn't know
+        CharType* name = static_cast<CharType*>(allocator_->malloc(tagName.size() + 1));
+        std::memcpy(name, tagName.data(), tagName.size());
+        name[tagName.size()] = '\0';
+
+        Tag* tag = CSOUP_NEW3(allocator_, Tag, StringRef(name, tagName.size()), CSOUP_TAG_UNKNOWN,
+                              CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK |
+                              CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE);
+        tags_->push(tag);
+        return tag;
+    }
+
+    void UnknownTagSet::setSelfClosing(const Tag* tag) {
+        for (size_t i = 0; i < tags_->size(); ++ i) {
+            if (*tags_->at(i) == tag) {
+                (*tags_->at(i))->setSelfClosing();
+                return;
+            }
+        }
+        // not one of ours: a known tag, or another document's
+        CSOUP_ASSERT(false);
+    }
+}
@@ -3,101 +3,165 @@
 
 #include "../util/common.h"
 #include "../util/stringref.h"
+#include "tagid.h"
 
 namespace csoup {
     class StringRef;
-    
+    class Allocator;
+
+    namespace internal {
+        template <class T>
+        class Vector;
+    }
+
     class Tag {
     public:
         StringRef tagName() const {
             return tagName_;
         }
-        
-        static Tag* valueOf(const StringRef& tagName) {
-            static Tag::GlobalTagMap globalTagMap;
-            
-            return globalTagMap.query(tagName);
+
+        // CSOUP_TAG_UNKNOWN unless the tag is known
+        TagIdEnum id() const {
+            return id_;
         }
-        
+
+        // The known tag named tagName (lower case), or NULL. Tags for other names
+        // come from an UnknownTagSet. The known tags are shared by every parse and
+        // never change, so threads can parse at once.
+        static const Tag* valueOf(const StringRef& tagName) {
+            TagIdEnum id = idOf(tagName);
+            return id != CSOUP_TAG_UNKNOWN ? valueOf(id) : NULL;
+        }
+
+        static const Tag* valueOf(TagIdEnum id);
+
+        // The id of the known tag named tagName (lower case), or CSOUP_TAG_UNKNOWN.
+        // A perfect hash over the known names leads to the only one tagName can be,
+        // so it costs one pass to hash the name and one to compare it.
+        static TagIdEnum idOf(const StringRef& tagName);
+
+        // idOf() for a name hashed while it was read, so it isn't passed over twice:
+        // hash is hashName() fed the bytes of tagName in lower case, starting from
+        // internal::kTagHashBasis. tagName itself may be in any case.
+        static TagIdEnum idOf(uint32_t hash, const StringRef& tagName);
+
+        static uint32_t hashName(uint32_t hash, unsigned char lowerCaseByte) {
+            return (hash ^ lowerCaseByte) * internal::kTagHashPrime;
+        }
+
+        // TagFlagEnum bits, including the categories of the HTML tree builder
+        unsigned flags() const {
+            return flags_;
+        }
+
         bool block() const {
-            return isBlock_;
+            return (flags_ & CSOUP_TAG_FLAG_BLOCK) != 0;
         }
-        
+
         bool formatAsBlock() const {
-            return formatAsBlock_;
+            return (flags_ & CSOUP_TAG_FLAG_FORMAT_AS_BLOCK) != 0;
         }
-        
+
         bool canContainBlock() const {
-            return canContainBlock_;
+            return (flags_ & CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK) != 0;
         }
-        
+
         bool inlineTag() const {
-            return !isBlock_;
+            return !block();
         }
-        
+
         bool data() const {
-            return !canContainInline_ && !empty();
+            return (flags_ & CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE) == 0 && !empty();
         }
-        
+
         bool empty() const {
-            return empty_;
+            return (flags_ & CSOUP_TAG_FLAG_EMPTY) != 0;
         }
-        
+
         bool selfClosing() const {
-            return empty_ || selfClosing_;
+            return empty() || selfClosing_;
         }
-        
+
         bool isKnownTag() const {
-            return valueOf(tagName()) != NULL;
+            return id_ != CSOUP_TAG_UNKNOWN;
         }
-        
+
         static bool isKnownTag(const StringRef& tagName) {
-            return valueOf(tagName) != NULL;
+            return idOf(tagName) != CSOUP_TAG_UNKNOWN;
         }
-        
+
         bool preserveWhitespace() const {
-            return preserveWhitespace_;
+            return (flags_ & CSOUP_TAG_FLAG_PRESERVE_WHITESPACE) != 0;
         }
-        
+
         bool formListed() const {
-            return formList_;
+            return (flags_ & CSOUP_TAG_FLAG_FORM_LISTED) != 0;
         }
-        
+
         bool formSubmittable() const {
-            return formSubmit_;
+            return (flags_ & CSOUP_TAG_FLAG_FORM_SUBMIT) != 0;
         }
-        
+
+        bool operator == (const Tag& obj) const;
+
+    private:
+        friend class UnknownTagSet;
+
+        Tag(const StringRef& tagName, TagIdEnum id, unsigned flags);
+
+        // only for tags of an UnknownTagSet, see UnknownTagSet::setSelfClosing()
         void setSelfClosing() {
+            CSOUP_ASSERT(!isKnownTag());
             selfClosing_ = true;
         }
-        
-        bool operator == (const Tag& obj) const;
-        
-    private:
-        Tag(const StringRef& tagName);
-        
-        struct GlobalTagMap {
-            GlobalTagMap();
-            ~GlobalTagMap();
-            
-            Tag* query(const StringRef& tagName);
-        private:
-            void registerTag(const StringRef& tagName, Tag* tag);
+
+        // the id of the only known name that can have the hash
+        static int slotOf(uint32_t hash);
+
+        struct KnownTags {
+            KnownTags();
+            ~KnownTags();
+
+            const Tag* tags_[CSOUP_TAG_COUNT]; // by id, NULL for CSOUP_TAG_UNKNOWN
         };
-        
+
         StringRef tagName_;
-        
-        // Use a bit to optimize this;
-        bool isBlock_; // block or inline
-        bool formatAsBlock_; // should be formatted as a block
-        bool canContainBlock_; // Can this tag hold block level tags?
-        bool canContainInline_; // only pcdata if not
-        bool empty_ ; // can hold nothing; e.g. img
+        TagIdEnum id_;
+        unsigned flags_; // TagFlagEnum bits
         bool selfClosing_; // can self close (<foo />). used for unknown tags that self close, without forcing them as empty.
-        bool preserveWhitespace_; // for pre, textarea, script etc
-        bool formList_; // a control that appears in forms: input, textarea, output etc
-        bool formSubmit_; // a control that can be submitted in a form: input etc
+    };
+
+    // A set of known tags, a bit per TagIdEnum. It is an aggregate so that sets can be
+    // constants, see tools/gen_tag_table.py; CSOUP_TAG_UNKNOWN is never in a set.
+    struct TagSet {
+        uint64_t words[(CSOUP_TAG_COUNT + 63) / 64];
+        
+        bool contains(TagIdEnum id) const {
+            return ((words[id >> 6] >> (id & 63)) & 1) != 0;
+        }
+    };
+    
+    // Tags for the names Tag::valueOf() doesn't know, made the first time they are
+    // asked for and kept as long as the set. Each document has its own, so that an
+    // unknown tag marked self closing in one parse doesn't show in another.
+    class UnknownTagSet {
+    public:
+        UnknownTagSet(Allocator* allocator);
+        ~UnknownTagSet();
+
+        // the tag named tagName (lower case), known or not
+        const Tag* valueOf(const StringRef& tagName);
+
+        // Marks one of the unknown tags of this set as able to self close (<foo />).
+        void setSelfClosing(const Tag* tag);
+
+    private:
+        Allocator* allocator_;
+        internal::Vector<Tag*>* tags_; // few per document, so they are searched in order
+
+        UnknownTagSet(const UnknownTagSet&);
+        UnknownTagSet& operator=(const UnknownTagSet&);
     };
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,69 @@
+//
+//  tagid.h
+//  csoup
+//
+//  Generated by tools/gen_tag_table.py; don't edit.
+//
+
+#ifndef CSOUP_TAGID_H_
+#define CSOUP_TAGID_H_
+
+#include "../util/common.h"
+
+namespace csoup {
+    // Known tags in name order, see Tag::idOf(). CSOUP_TAG_UNKNOWN stands for every
+    // other name.
+    typedef enum {
+        CSOUP_TAG_UNKNOWN,
+        CSOUP_TAG_A, CSOUP_TAG_ABBR, CSOUP_TAG_ACRONYM, CSOUP_TAG_ADDRESS, CSOUP_TAG_APPLET, CSOUP_TAG_AREA,
+        CSOUP_TAG_ARTICLE, CSOUP_TAG_ASIDE, CSOUP_TAG_AUDIO, CSOUP_TAG_B, CSOUP_TAG_BASE, CSOUP_TAG_BASEFONT,
+        CSOUP_TAG_BDO, CSOUP_TAG_BGSOUND, CSOUP_TAG_BIG, CSOUP_TAG_BLOCKQUOTE, CSOUP_TAG_BODY, CSOUP_TAG_BR,
+        CSOUP_TAG_BUTTON, CSOUP_TAG_CANVAS, CSOUP_TAG_CAPTION, CSOUP_TAG_CENTER, CSOUP_TAG_CITE, CSOUP_TAG_CODE,
+        CSOUP_TAG_COL, CSOUP_TAG_COLGROUP, CSOUP_TAG_COMMAND, CSOUP_TAG_DATALIST, CSOUP_TAG_DD, CSOUP_TAG_DEL,
+        CSOUP_TAG_DETAILS, CSOUP_TAG_DEVICE, CSOUP_TAG_DFN, CSOUP_TAG_DIR, CSOUP_TAG_DIV, CSOUP_TAG_DL,
+        CSOUP_TAG_DT, CSOUP_TAG_EM, CSOUP_TAG_EMBED, CSOUP_TAG_FIELDSET, CSOUP_TAG_FIGCAPTION, CSOUP_TAG_FIGURE,
+        CSOUP_TAG_FONT, CSOUP_TAG_FOOTER, CSOUP_TAG_FORM, CSOUP_TAG_FRAME, CSOUP_TAG_FRAMESET, CSOUP_TAG_H1,
+        CSOUP_TAG_H2, CSOUP_TAG_H3, CSOUP_TAG_H4, CSOUP_TAG_H5, CSOUP_TAG_H6, CSOUP_TAG_HEAD, CSOUP_TAG_HEADER,
+        CSOUP_TAG_HGROUP, CSOUP_TAG_HR, CSOUP_TAG_HTML, CSOUP_TAG_I, CSOUP_TAG_IFRAME, CSOUP_TAG_IMAGE,
+        CSOUP_TAG_IMG, CSOUP_TAG_INPUT, CSOUP_TAG_INS, CSOUP_TAG_ISINDEX, CSOUP_TAG_KBD, CSOUP_TAG_KEYGEN,
+        CSOUP_TAG_LABEL, CSOUP_TAG_LEGEND, CSOUP_TAG_LI, CSOUP_TAG_LINK, CSOUP_TAG_LISTING, CSOUP_TAG_MAIN,
+        CSOUP_TAG_MAP, CSOUP_TAG_MARK, CSOUP_TAG_MARQUEE, CSOUP_TAG_MATH, CSOUP_TAG_MENU, CSOUP_TAG_MENUITEM,
+        CSOUP_TAG_META, CSOUP_TAG_METER, CSOUP_TAG_NAV, CSOUP_TAG_NOBR, CSOUP_TAG_NOEMBED, CSOUP_TAG_NOFRAMES,
+        CSOUP_TAG_NOSCRIPT, CSOUP_TAG_OBJECT, CSOUP_TAG_OL, CSOUP_TAG_OPTGROUP, CSOUP_TAG_OPTION, CSOUP_TAG_OUTPUT,
+        CSOUP_TAG_P, CSOUP_TAG_PARAM, CSOUP_TAG_PLAINTEXT, CSOUP_TAG_PRE, CSOUP_TAG_PROGRESS, CSOUP_TAG_Q,
+        CSOUP_TAG_RP, CSOUP_TAG_RT, CSOUP_TAG_RUBY, CSOUP_TAG_S, CSOUP_TAG_SAMP, CSOUP_TAG_SCRIPT,
+        CSOUP_TAG_SECTION, CSOUP_TAG_SELECT, CSOUP_TAG_SMALL, CSOUP_TAG_SOURCE, CSOUP_TAG_SPAN, CSOUP_TAG_STRIKE,
+        CSOUP_TAG_STRONG, CSOUP_TAG_STYLE, CSOUP_TAG_SUB, CSOUP_TAG_SUMMARY, CSOUP_TAG_SUP, CSOUP_TAG_SVG,
+        CSOUP_TAG_TABLE, CSOUP_TAG_TBODY, CSOUP_TAG_TD, CSOUP_TAG_TEMPLATE, CSOUP_TAG_TEXTAREA, CSOUP_TAG_TFOOT,
+        CSOUP_TAG_TH, CSOUP_TAG_THEAD, CSOUP_TAG_TIME, CSOUP_TAG_TITLE, CSOUP_TAG_TR, CSOUP_TAG_TRACK,
+        CSOUP_TAG_TT, CSOUP_TAG_U, CSOUP_TAG_UL, CSOUP_TAG_VAR, CSOUP_TAG_VIDEO, CSOUP_TAG_WBR, CSOUP_TAG_XMP,
+        CSOUP_TAG_COUNT
+    } TagIdEnum;
+
+    // Properties of a tag, see Tag.
+    typedef enum {
+        CSOUP_TAG_FLAG_BLOCK = 1 << 0,                  // block or inline
+        CSOUP_TAG_FLAG_FORMAT_AS_BLOCK = 1 << 1,        // should be formatted as a block
+        CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK = 1 << 2,      // can hold block level tags
+        CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE = 1 << 3,     // only pcdata if not
+        CSOUP_TAG_FLAG_EMPTY = 1 << 4,                  // can hold nothing, e.g. img
+        CSOUP_TAG_FLAG_PRESERVE_WHITESPACE = 1 << 5,    // for pre, textarea, script etc
+        CSOUP_TAG_FLAG_FORM_LISTED = 1 << 6,            // a control that appears in forms: input, textarea, output etc
+        CSOUP_TAG_FLAG_FORM_SUBMIT = 1 << 7,            // a control that can be submitted in a form: input etc
+        CSOUP_TAG_FLAG_SPECIAL = 1 << 8,                // in the special category of the tree builder
+        CSOUP_TAG_FLAG_SCOPE = 1 << 9,                  // ends the search of a scope: html, table, td etc
+        CSOUP_TAG_FLAG_LIST_SCOPE = 1 << 10,            // also ends the search of list item scope: ol, ul
+        CSOUP_TAG_FLAG_BUTTON_SCOPE = 1 << 11,          // also ends the search of button scope: button
+        CSOUP_TAG_FLAG_TABLE_SCOPE = 1 << 12,           // ends the search of table scope: html, table
+        CSOUP_TAG_FLAG_SELECT_SCOPE = 1 << 13,          // doesn't end the search of select scope: optgroup, option
+        CSOUP_TAG_FLAG_IMPLIED_END = 1 << 14            // closed by generating implied end tags: dd, li, p etc
+    } TagFlagEnum;
+
+    namespace internal {
+        // FNV-1a over the lower case name, see Tag::idOf() and Tag::hashName()
+        const uint32_t kTagHashBasis = 0x811C9DC5;
+        const uint32_t kTagHashPrime = 0x01000193;
+    } // namespace internal
+} // namespace csoup
+
+#endif // CSOUP_TAGID_H_
@@ -0,0 +1,189 @@
+//
+//  tagtable.h
+//  csoup
+//
+//  Generated by tools/gen_tag_table.py; don't edit.
+//
+
+#ifndef CSOUP_TAGTABLE_H_
+#define CSOUP_TAGTABLE_H_
+
+#include "../util/common.h"
+#include "tagid.h"
+
+namespace csoup {
+    namespace internal {
+        struct TagTableEntry {
+            const char* name;
+            uint8_t length;
+            uint32_t flags;         // TagFlagEnum bits
+        };
+
+        const size_t kTagNameMaxLength = 10;
+        const int kTagSlotBits = 8;
+        const int kTagBucketBits = 7;
+
+        // indexed by TagIdEnum
+        const TagTableEntry kTagTable[CSOUP_TAG_COUNT] = {
+            {"", 0, 0},
+            {"a", 1, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"abbr", 4, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"acronym", 7, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"address", 7, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"applet", 6, CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_SCOPE},
+            {"area", 4, CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"article", 7, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"aside", 5, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"audio", 5, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"b", 1, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"base", 4, CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"basefont", 8, CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"bdo", 3, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"bgsound", 7, CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"big", 3, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"blockquote", 10, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"body", 4, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"br", 2, CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"button", 6, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_FORM_LISTED | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_BUTTON_SCOPE},
+            {"canvas", 6, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"caption", 7, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_SCOPE},
+            {"center", 6, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"cite", 4, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"code", 4, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"col", 3, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"colgroup", 8, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"command", 7, CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"datalist", 8, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"dd", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_IMPLIED_END},
+            {"del", 3, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"details", 7, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"device", 6, CSOUP_TAG_FLAG_EMPTY},
+            {"dfn", 3, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"dir", 3, CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"div", 3, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"dl", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"dt", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_IMPLIED_END},
+            {"em", 2, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"embed", 5, CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"fieldset", 8, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_FORM_LISTED | CSOUP_TAG_FLAG_SPECIAL},
+            {"figcaption", 10, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"figure", 6, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"font", 4, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"footer", 6, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"form", 4, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"frame", 5, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"frameset", 8, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"h1", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"h2", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"h3", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"h4", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"h5", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"h6", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"head", 4, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"header", 6, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"hgroup", 6, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"hr", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"html", 4, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_SCOPE | CSOUP_TAG_FLAG_TABLE_SCOPE},
+            {"i", 1, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"iframe", 6, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"image", 5, CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"img", 3, CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"input", 5, CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_FORM_LISTED | CSOUP_TAG_FLAG_FORM_SUBMIT | CSOUP_TAG_FLAG_SPECIAL},
+            {"ins", 3, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"isindex", 7, CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"kbd", 3, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"keygen", 6, CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_FORM_LISTED | CSOUP_TAG_FLAG_FORM_SUBMIT},
+            {"label", 5, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"legend", 6, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"li", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_IMPLIED_END},
+            {"link", 4, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"listing", 7, CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"main", 4, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"map", 3, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"mark", 4, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"marquee", 7, CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_SCOPE},
+            {"math", 4, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"menu", 4, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"menuitem", 8, CSOUP_TAG_FLAG_EMPTY},
+            {"meta", 4, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"meter", 5, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"nav", 3, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"nobr", 4, CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"noembed", 7, CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"noframes", 8, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"noscript", 8, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"object", 6, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_FORM_LISTED | CSOUP_TAG_FLAG_FORM_SUBMIT | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_SCOPE},
+            {"ol", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_LIST_SCOPE},
+            {"optgroup", 8, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SELECT_SCOPE | CSOUP_TAG_FLAG_IMPLIED_END},
+            {"option", 6, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SELECT_SCOPE | CSOUP_TAG_FLAG_IMPLIED_END},
+            {"output", 6, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_FORM_LISTED},
+            {"p", 1, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_IMPLIED_END},
+            {"param", 5, CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"plaintext", 9, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_PRESERVE_WHITESPACE | CSOUP_TAG_FLAG_SPECIAL},
+            {"pre", 3, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_PRESERVE_WHITESPACE | CSOUP_TAG_FLAG_SPECIAL},
+            {"progress", 8, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"q", 1, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"rp", 2, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_IMPLIED_END},
+            {"rt", 2, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_IMPLIED_END},
+            {"ruby", 4, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"s", 1, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"samp", 4, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"script", 6, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"section", 7, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"select", 6, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_FORM_LISTED | CSOUP_TAG_FLAG_FORM_SUBMIT | CSOUP_TAG_FLAG_SPECIAL},
+            {"small", 5, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"source", 6, CSOUP_TAG_FLAG_EMPTY},
+            {"span", 4, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"strike", 6, CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"strong", 6, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"style", 5, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"sub", 3, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"summary", 7, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"sup", 3, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"svg", 3, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"table", 5, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_SCOPE | CSOUP_TAG_FLAG_TABLE_SCOPE},
+            {"tbody", 5, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"td", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_SCOPE},
+            {"template", 8, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"textarea", 8, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_PRESERVE_WHITESPACE | CSOUP_TAG_FLAG_FORM_LISTED | CSOUP_TAG_FLAG_FORM_SUBMIT | CSOUP_TAG_FLAG_SPECIAL},
+            {"tfoot", 5, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"th", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_SCOPE},
+            {"thead", 5, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"time", 4, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"title", 5, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_PRESERVE_WHITESPACE | CSOUP_TAG_FLAG_SPECIAL},
+            {"tr", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+            {"track", 5, CSOUP_TAG_FLAG_EMPTY},
+            {"tt", 2, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"u", 1, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"ul", 2, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_LIST_SCOPE},
+            {"var", 3, CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"video", 5, CSOUP_TAG_FLAG_BLOCK | CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE},
+            {"wbr", 3, CSOUP_TAG_FLAG_EMPTY | CSOUP_TAG_FLAG_SPECIAL},
+            {"xmp", 3, CSOUP_TAG_FLAG_FORMAT_AS_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_BLOCK | CSOUP_TAG_FLAG_CAN_CONTAIN_INLINE | CSOUP_TAG_FLAG_SPECIAL},
+        };
+
+        // by the top kTagBucketBits of the hash, added to the kTagSlotBits below them
+        const uint8_t kTagDisplacements[1 << kTagBucketBits] = {
+            1, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 7, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 5, 0, 1, 0,
+            0, 19, 5, 0, 0, 2, 0, 0, 0, 0, 1, 0, 2, 21, 0, 0, 3, 0, 4, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 3, 0,
+            0, 0, 9, 4, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 8, 2, 0, 0, 0, 0, 2, 0, 0, 0, 1, 9, 0, 0, 0, 0, 1,
+            0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 5, 0, 11, 0, 0, 2, 0, 0, 1, 0,
+        };
+
+        // the tag id of each slot, CSOUP_TAG_UNKNOWN for unused ones
+        const uint8_t kTagSlots[1 << kTagSlotBits] = {
+            0, 60, 0, 0, 0, 46, 97, 1, 101, 93, 69, 59, 100, 39, 38, 102, 123, 129, 131, 0, 0, 0, 0, 0, 2, 70, 111,
+            0, 0, 48, 0, 103, 0, 50, 0, 0, 0, 0, 52, 112, 114, 0, 0, 0, 0, 45, 0, 0, 9, 0, 125, 0, 54, 4, 0, 0,
+            134, 32, 0, 0, 0, 95, 0, 0, 0, 0, 0, 72, 77, 55, 25, 0, 73, 0, 0, 0, 0, 68, 116, 0, 0, 0, 0, 113, 0,
+            120, 76, 0, 0, 0, 83, 14, 0, 3, 0, 0, 0, 0, 106, 87, 40, 0, 0, 0, 0, 0, 0, 0, 0, 89, 67, 104, 0, 0, 0,
+            0, 64, 0, 62, 84, 0, 0, 26, 0, 132, 0, 0, 0, 108, 0, 66, 0, 0, 96, 92, 10, 6, 21, 0, 20, 56, 12, 37,
+            110, 29, 36, 0, 0, 0, 0, 0, 18, 24, 41, 88, 5, 0, 53, 127, 57, 124, 49, 128, 122, 115, 44, 51, 118, 61,
+            119, 98, 33, 30, 27, 43, 99, 81, 34, 35, 7, 31, 126, 130, 0, 0, 0, 58, 0, 0, 75, 117, 0, 0, 0, 0, 0, 0,
+            0, 16, 82, 22, 0, 0, 0, 0, 0, 65, 0, 0, 74, 0, 42, 91, 17, 47, 0, 13, 19, 109, 121, 0, 0, 0, 0, 8, 0,
+            105, 23, 86, 15, 0, 107, 28, 85, 79, 0, 63, 71, 133, 0, 0, 90, 78, 11, 0, 0, 0, 0, 0, 94, 0, 0, 0, 0,
+            0, 80,
+        };
+    } // namespace internal
+} // namespace csoup
+
+#endif // CSOUP_TAGTABLE_H_
@@ -3,13 +3,15 @@
 
 #include "node.h"
 #include "../util/csoup_string.h"
+#include "../util/stringbuffer.h"
 
 namespace csoup {
     class TextNode : public Node {
     public:
-        TextNode(const StringRef& text, const StringRef& baseUri, Allocator* allocator) :
-            Node(CSOUP_NODE_TEXT, NULL, 0, baseUri, allocator) {
-            setWholeText(text);
+        // With copy false the node refers to text, which must outlive it.
+        TextNode(const StringRef& text, const StringRef& baseUri, Allocator* allocator, bool copy = true) :
+            Node(CSOUP_NODE_TEXT, NULL, 0, baseUri, allocator), text_(NULL) {
+            setWholeText(text, copy);
         }
         
         ~TextNode() {
@@ -20,14 +22,29 @@ namespace csoup {
             }
         }
         
-        void setWholeText(const StringRef& data) {
+        void setWholeText(const StringRef& data, bool copy = true) {
             if (text_) {
                 text_->~String();
             } else {
                 text_ = allocator()->malloc_t<String>();
             }
             
-            new (text_) String(data, allocator());
+            if (copy)   new (text_) String(data, allocator());
+            else        new (text_) String(data);
+        }
+        
+        // Appends data. A reference stays one when data continues the run of input
+        // the node refers to; otherwise the text becomes a copy.
+        void appendWholeText(const StringRef& data, bool copy = true) {
+            StringRef text = wholeText();
+            if (!copy && text_ != NULL && text_->isConst() && text.data() + text.size() == data.data()) {
+                setWholeText(StringRef(text.data(), text.size() + data.size()), false);
+            } else {
+                StringBuffer joined(allocator());
+                joined.appendString(text);
+                joined.appendString(data);
+                setWholeText(joined.ref(), true);
+            }
         }
         
         // you should return normaliseWhitespace text
@@ -6,10 +6,11 @@
 //  Copyright (c) 2014 windpls. All rights reserved.
 //
 
-#include <iostream>
 
 #include "characterreader.h"
 #include "stringbuffer.h"
+#include "../internal/strscan.h"
+#include "../nodes/tag.h"
 
 namespace {
     const int kUtf8ReplacementChar = 0xFFFD;
@@ -54,20 +55,130 @@ namespace {
         (c >= 0x7F && c <= 0x9F) || (c >= 0xFDD0 && c <= 0xFDEF) ||
         ((c & 0xFFFF) == 0xFFFE) || ((c & 0xFFFF) == 0xFFFF);
     }
+    
+    // code point of the well-formed n byte sequence at q, n > 1
+    uint32_t decodeSequence(const unsigned char* q, size_t n) {
+        return n == 2 ? ((q[0] & 0x1Fu) << 6) | (q[1] & 0x3Fu) :
+               n == 3 ? ((q[0] & 0x0Fu) << 12) | ((q[1] & 0x3Fu) << 6) | (q[2] & 0x3Fu) :
+               ((q[0] & 0x07u) << 18) | ((q[1] & 0x3Fu) << 12) | ((q[2] & 0x3Fu) << 6) | (q[3] & 0x3Fu);
+    }
+    
+    // the first byte in [p, end) that doesn't read as is, or end
+    const char* findDecodeByte(const char* p, const char* end) {
+        for (;;) {
+            p = csoup::internal::findControlOrNonAscii(p, end);
+            if (p == end) return end;
+            
+            const unsigned char* q = reinterpret_cast<const unsigned char*>(p);
+            size_t n = csoup::internal::utf8SequenceLength(q, reinterpret_cast<const unsigned char*>(end));
+            if (n < 2 || isInvalidUTF8CodePoint(decodeSequence(q, n))) return p;
+            p += n;
+        }
+    }
+    
+    bool isEndTagTerminator(char c) {
+        return c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == ' ' || c == '/' || c == '>';
+    }
 }
 
 namespace csoup {
     // we uuse
     CSOUP_STATIC_ASSERT(sizeof(CharType) == sizeof(char));
     
-    void CharacterReader::readChar() {
+    ByteClassTable::ByteClassTable(const CharType* terms, size_t n) : groups_(internal::StructuralIndex::kSpecial) {
+        for (int b = 0; b < 256; ++ b) {
+            table_[b] = (b >= 0x80 || b == '\r' || isInvalidUTF8CodePoint(b)) ? kDecode : kRun;
+        }
+        
+        for (size_t i = 0; i < n; ++ i) {
+            CSOUP_ASSERT(terms[i] >= 0);
+            table_[static_cast<unsigned char>(terms[i])] = kTerminator;
+            groups_ |= internal::StructuralIndex::groupOf(static_cast<unsigned char>(terms[i]));
+        }
+        
+        // CR is always read as LF, a '\r' terminator is matched after decoding
+        table_[static_cast<unsigned char>('\r')] = kDecode;
+    }
+    
+    void CharacterReader::reset(const StringRef& input, size_t pos, bool final) {
+        CSOUP_ASSERT(input.data() != NULL && pos <= input.size());
+        
+        // offsets shift by what was dropped from the front of the input
+        size_t dropped = pos < this->pos() ? this->pos() - pos : 0;
+        decodeErrorEnd_ = decodeErrorEnd_ > dropped ? decodeErrorEnd_ - dropped : 0;
+        for (int i = 0; i < CSOUP_DECODE_ERROR_KIND_COUNT; ++ i) {
+            for (size_t j = 0; j < decodeErrorLogSizes_[i]; ++ j) {
+                size_t& logged = decodeErrorLog_[i][j];
+                logged = logged > dropped ? logged - dropped : 0;
+            }
+        }
+        
+        start_ = input.data();
+        end_ = start_ + input.size();
+        cur_ = prev_ = mark_ = start_ + pos;
+        validBegin_ = validEnd_ = cur_;
+        if (index_ != NULL && !index_->covers(start_, end_)) {
+            index_ = NULL;
+        }
+        final_ = final;
+        starved_ = false;
+        readChar();
+    }
+    
+    void CharacterReader::readCharSlow() {
         if (cur_ >= end_) {
-            // No input left to consume; emit an EOF and set width = 0.
+            // No input left to consume; emit an EOF and set width = 0. Of partial
+            // input, the reader starves when the EOF is looked at, see peek().
+            current_ = -1;
+            width_ = 0;
+            return;
+        }
+        
+        // A CR at the end of partial input may still be followed by LF.
+        if (!final_ && *cur_ == '\r' && cur_ + 1 == end_) {
             current_ = -1;
             width_ = 0;
             return;
         }
         
+        if (cur_ < validBegin_ || cur_ >= validEnd_) {
+            const CharType* blockEnd = (size_t)(end_ - cur_) > kValidateBlockSize ? cur_ + kValidateBlockSize : end_;
+            validBegin_ = cur_;
+            validEnd_ = internal::validUtf8Prefix(cur_, blockEnd);
+        }
+        
+        if (cur_ < validEnd_) {
+            // Well-formed input, the sequence length follows from the lead byte.
+            const unsigned char* p = reinterpret_cast<const unsigned char*>(cur_);
+            uint32_t code_point;
+            if (p[0] < 0x80) {
+                code_point = p[0];
+                width_ = 1;
+            } else if (p[0] < 0xE0) {
+                code_point = ((p[0] & 0x1Fu) << 6) | (p[1] & 0x3Fu);
+                width_ = 2;
+            } else if (p[0] < 0xF0) {
+                code_point = ((p[0] & 0x0Fu) << 12) | ((p[1] & 0x3Fu) << 6) | (p[2] & 0x3Fu);
+                width_ = 3;
+            } else {
+                code_point = ((p[0] & 0x07u) << 18) | ((p[1] & 0x3Fu) << 12) | ((p[2] & 0x3Fu) << 6) | (p[3] & 0x3Fu);
+                width_ = 4;
+            }
+            
+            if (code_point == '\r') {
+                if (cur_ + 1 < end_ && cur_[1] == '\n') {
+                    ++cur_;
+                }
+                code_point = '\n';
+            }
+            if (isInvalidUTF8CodePoint(code_point)) {
+                decodeError(CSOUP_DECODE_ERROR_INVALID_CODE_POINT);
+                code_point = kUtf8ReplacementChar;
+            }
+            current_ = code_point;
+            return;
+        }
+        
         uint32_t code_point = 0;
         uint32_t state = UTF8_ACCEPT;
         for (const CharType* c = cur_; c < end_; ++ c) {
@@ -92,9 +203,7 @@ namespace csoup {
                     code_point = '\n';
                 }
                 if (isInvalidUTF8CodePoint(code_point)) {
-                    //add_error(iter, GUMBO_ERR_UTF8_INVALID);
-                    //CSOUP_ASSERT()
-                    std::cout << "UTF8 decoding error" << std::endl;
+                    decodeError(CSOUP_DECODE_ERROR_INVALID_CODE_POINT);
                     code_point = kUtf8ReplacementChar;
                 }
                 current_ = code_point;
@@ -104,18 +213,24 @@ namespace csoup {
                 // run, but we do want to skip past an invalid first byte.
                 width_ = c - cur_ + (c == cur_);
                 current_ = kUtf8ReplacementChar;
-                std::cout << "UTF8 decoding error" << std::endl;
-                //add_error(iter, GUMBO_ERR_UTF8_INVALID);
+                decodeError(CSOUP_DECODE_ERROR_INVALID_SEQUENCE);
                 return;
             }
         }
+        if (!final_) {
+            // The sequence may be completed by the next chunk.
+            current_ = -1;
+            width_ = 0;
+            return;
+        }
+        
         // If we got here without exiting early, then we've reached the end of the iterator.
         // Add an error for truncated input, set the width to consume the rest of the
         // iterator, and emit a replacement character.  The next time we enter this method,
         // it will detect that there's no input to consume and
         current_ = kUtf8ReplacementChar;
-        width_ = end_ - start_;
-        std::cout << "UTF8 decoding error: TRUNCATED" << std::endl;
+        width_ = end_ - cur_;
+        decodeError(CSOUP_DECODE_ERROR_TRUNCATED);
         //add_error(iter, GUMBO_ERR_UTF8_TRUNCATED);
     }
     
@@ -124,6 +239,7 @@ namespace csoup {
         if (start_ + offset < end_) {
             StringRef data(cur_, offset - pos());
             output->appendString(data);
+            prev_ = cur_;
             cur_ = start_ + offset;
             
             readChar();
@@ -132,46 +248,187 @@ namespace csoup {
         }
     }
     
-    void CharacterReader::consumeToEnd(csoup::StringBuffer *output) {
-        while (!empty()) {
-            output->append(next());
+    StringRef CharacterReader::consumeToAny(const ByteClassTable& stops) {
+        const CharType* begin = cur_;
+        const CharType* p = cur_;
+        
+        while (p < end_) {
+            if (index_ != NULL) {
+                // everything before the next byte of the table's groups is a run
+                p = index_->nextStop(p, stops.structuralGroups());
+                if (p == end_) break;
+            }
+            
+            uint8_t cls = stops.classOf(*p);
+            if (cls == ByteClassTable::kRun) {
+                ++ p;
+                continue;
+            }
+            if (cls == ByteClassTable::kTerminator || static_cast<unsigned char>(*p) < 0x80) {
+                break;
+            }
+            
+            // a multi-byte sequence can be copied if it is well formed and allowed
+            const unsigned char* q = reinterpret_cast<const unsigned char*>(p);
+            size_t n = internal::utf8SequenceLength(q, reinterpret_cast<const unsigned char*>(end_));
+            if (n == 0) break;
+            
+            if (isInvalidUTF8CodePoint(decodeSequence(q, n))) break;
+            p += n;
         }
+        
+        if (p == begin) {
+            return StringRef(begin, 0);
+        }
+        
+        prev_ = cur_;
+        cur_ = p;
+        readChar();
+        return StringRef(begin, p - begin);
     }
     
-    // need to be re-implemented
-    size_t CharacterReader::nextIndexOf(int c) {
-        CSOUP_ASSERT(c <= 127 && c >= 0);
-        
+    StringRef CharacterReader::consumeTagName(const ByteClassTable& stops, uint32_t* hash) {
+        const CharType* begin = cur_;
         const CharType* p = cur_;
+        uint32_t h = internal::kTagHashBasis;
         
-        while (p < end_ && *p != c) {
-            p ++;
+        while (p < end_ && static_cast<unsigned char>(*p) < 0x80 && stops.classOf(*p) == ByteClassTable::kRun) {
+            h = Tag::hashName(h, static_cast<unsigned char>(internal::asciiToLower(*p)));
+            ++ p;
         }
+        *hash = h;
         
-        return p - start_;
+        if (p == begin) {
+            return StringRef(begin, 0);
+        }
+        
+        prev_ = cur_;
+        cur_ = p;
+        readChar();
+        return StringRef(begin, p - begin);
     }
     
-    size_t CharacterReader::nextIndexOf(const csoup::StringRef &seq) {
-        CSOUP_ASSERT(seq.size() > 0);
+    StringRef CharacterReader::consumeRawText(const StringRef& endTagName, bool stopAtReference, bool stopAtEscape) {
+        const CharType* begin = cur_;
+        const CharType* p = cur_;
+        
+        // from one '<' to the next; only the text in between has to be checked
+        for (;;) {
+            const CharType* lt = internal::findByte(p, end_, '<');
+            const CharType* stop = findDecodeByte(p, lt);
+            if (stopAtReference) {
+                stop = internal::findByte(p, stop, '&');
+            }
+            if (stop != lt || lt == end_ || lt + 1 == end_) {
+                p = stop;
+                break;
+            }
+            
+            if (lt[1] == '/' && endTagName.size() > 0) {
+                // stops at the end tag, or at what may turn out to be it once more input comes
+                const CharType* after = lt + 2 + endTagName.size();
+                if (after >= end_ || (internal::compareIgnoreCase(lt + 2, endTagName.data(), endTagName.size()) == 0 &&
+                                      isEndTagTerminator(*after))) {
+                    p = lt;
+                    break;
+                }
+            } else if (lt[1] == '!' && stopAtEscape) {
+                p = lt;
+                break;
+            }
+            p = lt + 1;
+        }
         
-        if (seq.size() == 1) {
-            return nextIndexOf(seq.at(0));
+        if (p == begin) {
+            return StringRef(begin, 0);
         }
         
-        int startCode = seq.at(0);
-        for (const CharType* p = cur_; p < end_; ++ p) {
-            if (startCode != *p) {
-                while (p < end_ && startCode != *p) ++ p;
+        prev_ = cur_;
+        cur_ = p;
+        readChar();
+        return StringRef(begin, p - begin);
+    }
+    
+    bool CharacterReader::consumeToEndTag(const StringRef& name, bool nested, size_t* depth) {
+        const CharType* p = cur_;
+        bool found = false;
+        
+        for (;;) {
+            const CharType* lt = internal::findByte(p, end_, '<');
+            if (lt == end_) {
+                p = end_;
+                if (!final_) starved_ = true;
+                break;
+            }
+            
+            bool close = lt + 1 < end_ && lt[1] == '/';
+            const CharType* tagName = lt + (close ? 2 : 1);
+            const CharType* after = tagName + name.size();
+            if (after >= end_ && !final_) {
+                p = lt;
+                starved_ = true;
+                break;
             }
             
-            const CharType* p2 = p + 1;
-            const CharType* last = (p2 + seq.size()) - 1;
-            if (p2 < end_ && last <= end_) {
-                for (size_t i = 1; p2 < last && *p2 == seq.at(i); ++ p2, ++ i);
-                if (p2 == end_) return p - start_;
+            if (after < end_ && internal::compareIgnoreCase(tagName, name.data(), name.size()) == 0 &&
+                isEndTagTerminator(*after)) {
+                if (close && *depth == 0) {
+                    p = lt;
+                    found = true;
+                    break;
+                }
+                if (close) {
+                    -- *depth;
+                } else if (nested) {
+                    ++ *depth;
+                }
+                p = after;
+            } else {
+                p = lt + 1;
             }
         }
         
-        return end_ - start_;
+        if (p != cur_) {
+            prev_ = cur_;
+            cur_ = p;
+            readChar();
+        }
+        return found;
+    }
+    
+    StringRef CharacterReader::consumeLetterSequence() {
+        const CharType* begin = cur_;
+        const CharType* p = cur_;
+        
+        while (p < end_ && ((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z'))) {
+            ++ p;
+        }
+        
+        if (p == begin) {
+            return StringRef(begin, 0);
+        }
+        
+        prev_ = cur_;
+        cur_ = p;
+        readChar();
+        return StringRef(begin, p - begin);
+    }
+    
+    void CharacterReader::consumeToEnd(csoup::StringBuffer *output) {
+        while (peek() != eof_) {
+            output->append(next());
+        }
+    }
+    
+    size_t CharacterReader::nextIndexOf(int c) {
+        CSOUP_ASSERT(c <= 127 && c >= 0);
+        
+        return internal::findByte(cur_, end_, static_cast<CharType>(c)) - start_;
+    }
+    
+    size_t CharacterReader::nextIndexOf(const csoup::StringRef &seq) {
+        CSOUP_ASSERT(seq.size() > 0);
+        
+        return internal::findSubstring(cur_, end_, seq.data(), seq.size()) - start_;
     }
 }
\ No newline at end of file
@@ -12,20 +12,132 @@
 #include <cctype>
 #include "../util/common.h"
 #include "../util/stringref.h"
+#include "../internal/strscan.h"
+#include "../internal/structuralindex.h"
+#include "../nodes/entities.h"
+#include "parseerror.h"
 
 namespace csoup {
     class StringBuffer;
     
+    // Byte classes for CharacterReader::consumeToAny. A run stops at one of the
+    // given ASCII terminators, and also wherever the raw bytes would differ from the
+    // decoded characters (CR, invalid code points, malformed UTF-8).
+    class ByteClassTable {
+    public:
+        enum {
+            kRun = 0,           // copied as is
+            kTerminator = 1,    // one of the terminators
+            kDecode = 2         // needs a look through readChar()
+        };
+        
+        ByteClassTable(const CharType* terms, size_t n);
+        
+        uint8_t classOf(CharType c) const {
+            return table_[static_cast<unsigned char>(c)];
+        }
+        
+        bool isTerminator(int c) const {
+            return c >= 0 && c < 0x80 && table_[c] == kTerminator;
+        }
+        
+        // the StructuralIndex groups holding every byte that isn't kRun
+        unsigned structuralGroups() const {
+            return groups_;
+        }
+    private:
+        uint8_t table_[256];
+        unsigned groups_;
+    };
+    
     class CharacterReader {
     public:
-        CharacterReader(const StringRef& input): start_(input.data()),
+        // A reader over input that is not final may run out of bytes before the
+        // document ends. It then reads EOF and flags itself as starved, so that the
+        // tokeniser can roll back and retry once more input is available.
+        CharacterReader(const StringRef& input, bool final = true): start_(input.data()),
                                                  cur_(input.data()),
+                                                 prev_(input.data()),
                                                  mark_(input.data()),
                                                  end_(input.data() + input.size()),
+                                                 validBegin_(input.data()),
+                                                 validEnd_(input.data()),
                                                  current_(0),
-                                                 width_(0)
+                                                 width_(0),
+                                                 final_(final),
+                                                 starved_(false),
+                                                 decodeErrorEnd_(0),
+                                                 logDecodeErrors_(false),
+                                                 index_(NULL)
         {
             CSOUP_ASSERT(start_ != NULL);
+            for (int i = 0; i < CSOUP_DECODE_ERROR_KIND_COUNT; ++ i) {
+                decodeErrorCounts_[i] = decodeErrorLogSizes_[i] = 0;
+            }
+            readChar();
+        }
+        
+        // Points the reader at a new buffer holding the same input from pos() == pos on,
+        // e.g. after more bytes were appended or consumed bytes were dropped.
+        void reset(const StringRef& input, size_t pos, bool final);
+        
+        // Moves to pos, which must be on a character boundary.
+        void seek(size_t pos) {
+            CSOUP_ASSERT(start_ + pos <= end_);
+            cur_ = prev_ = start_ + pos;
+            readChar();
+        }
+        
+        bool isFinal() const {
+            return final_;
+        }
+        
+        bool starved() const {
+            return starved_;
+        }
+        
+        void clearStarved() {
+            starved_ = false;
+        }
+        
+        // Decoding errors are counted per kind, each byte offset once even when it is
+        // read again. Only with logging on are their offsets also kept, the first
+        // kDecodeErrorLogSize of each kind until the log is cleared.
+        size_t decodeErrorCount(DecodeErrorEnum kind) const {
+            return decodeErrorCounts_[kind];
+        }
+        
+        void setDecodeErrorLogging(bool enabled) {
+            logDecodeErrors_ = enabled;
+        }
+        
+        size_t decodeErrorLogSize(DecodeErrorEnum kind) const {
+            return decodeErrorLogSizes_[kind];
+        }
+        
+        size_t decodeErrorLogAt(DecodeErrorEnum kind, size_t index) const {
+            CSOUP_ASSERT(index < decodeErrorLogSizes_[kind]);
+            return decodeErrorLog_[kind][index];
+        }
+        
+        void clearDecodeErrorLog() {
+            for (int i = 0; i < CSOUP_DECODE_ERROR_KIND_COUNT; ++ i) {
+                decodeErrorLogSizes_[i] = 0;
+            }
+        }
+        
+        static const size_t kDecodeErrorLogSize = 16;
+        
+        // Lets consumeToAny() skip plain text with an index built over exactly the
+        // input of the reader. reset() drops it unless it covers the new input too.
+        void setStructuralIndex(const internal::StructuralIndex* index) {
+            CSOUP_ASSERT(index == NULL || index->covers(start_, end_));
+            index_ = index;
+        }
+        
+        // the whole input the reader was given
+        StringRef input() const {
+            return StringRef(start_, end_ - start_);
         }
         
         size_t pos() const {
@@ -33,29 +145,36 @@ namespace csoup {
         }
         
         bool empty() const {
-            return start_ >= end_;
+            if (cur_ < end_) return false;
+            if (!final_) starved_ = true;
+            return true;
         }
         
+        // steps back over the character returned by the last next()/advance()
         void unconsume() {
-            CSOUP_ASSERT(width_ > 0);
-            cur_ -= width_;
-            width_ = 0;
+            cur_ = prev_;
+            readChar();
         }
         
         void advance() {
+            prev_ = cur_;
             cur_ += width_;
             readChar();
         }
         
         int next() {
-            int ret = current_;
+            int ret = peek();
+            prev_ = cur_;
             cur_ += width_;
             readChar();
             
             return ret;
         }
         
+        // At the end of partial input this is an EOF that starves the reader. Only
+        // reading it does: a token that ends with the input is complete.
         int peek() const {
+            if (current_ == eof_ && !final_) starved_ = true;
             return current_;
         }
         
@@ -65,10 +184,12 @@ namespace csoup {
         
         void rewindToMark() {
             cur_ = mark_;
+            readChar();
         }
         
         StringRef consumeAsStringRef() {
             StringRef ret(cur_, width_);
+            prev_ = cur_;
             cur_ += width_;
             readChar();
             return ret;
@@ -80,8 +201,10 @@ namespace csoup {
         
         bool matches(const StringRef& seq) {
             size_t scanLength = seq.size();
-            if (scanLength > end_ - cur_)
+            if (scanLength > (size_t)(end_ - cur_)) {
+                if (!final_) starved_ = true;
                 return false;
+            }
             
             for (size_t offset = 0; offset < scanLength; offset++) {
                 if (seq.at(offset) != cur_[offset])
@@ -92,19 +215,30 @@ namespace csoup {
         }
         
         bool matchesIgnoreCase(int c) {
-            return std::tolower(peek()) == std::tolower(c);
+            return internal::asciiToLower(peek()) == internal::asciiToLower(c);
         }
         
         bool matchesIgnoreCase(const StringRef& seq) {
             size_t scanLength = seq.size();
-            if (scanLength > end_ - cur_)
+            if (scanLength > (size_t)(end_ - cur_)) {
+                if (!final_) starved_ = true;
                 return false;
-            
-            for (size_t offset = 0; offset < scanLength; offset++) {
-                if (std::tolower(seq.at(offset)) != std::tolower(cur_[offset]))
-                    return false;
             }
             
+            return internal::compareIgnoreCase(seq.data(), cur_, scanLength) == 0;
+        }
+        
+        // Consumes the longest named character reference name at the reader, see
+        // Entities::matchPrefix(). Consumes nothing if there is none.
+        bool consumeNamedReference(EntityMatch* match) {
+            bool truncated;
+            bool found = Entities::matchPrefix(cur_, end_, match, &truncated);
+            if (truncated && !final_) starved_ = true;
+            if (!found) return false;
+            
+            prev_ = cur_;
+            cur_ += match->length;
+            readChar();
             return true;
         }
         
@@ -131,7 +265,7 @@ namespace csoup {
             int c = peek();
             
             for (size_t i = 0; i < cnt; ++ i) {
-                if (c == seq[cnt]) {
+                if (c == seq[i]) {
                     return true;
                 }
             }
@@ -141,8 +275,36 @@ namespace csoup {
         
         void consumeTo(const StringRef& term, StringBuffer* output);
         
+        // Consumes up to the first byte that is not ByteClassTable::kRun and returns
+        // the consumed bytes. The run is exactly the UTF-8 of the characters read.
+        StringRef consumeToAny(const ByteClassTable& stops);
+        
+        // consumeToAny() for a tag name: consumes a run of ASCII bytes up to one of
+        // stops or the first byte that isn't ASCII, feeding them in lower case to
+        // *hash (see Tag::hashName()) as it goes.
+        StringRef consumeTagName(const ByteClassTable& stops, uint32_t* hash);
+        
+        // Consumes the text of a raw text element up to its end tag: "</" followed by
+        // endTagName (lower case, matched ignoring case) and whitespace, '/' or '>'.
+        // Stops early before anything that doesn't read as is (see consumeToAny()),
+        // before '&' if stopAtReference, before "<!" if stopAtEscape, and before a
+        // "</" that the end of non-final input cuts off. Returns the consumed bytes.
+        StringRef consumeRawText(const StringRef& endTagName, bool stopAtReference, bool stopAtEscape);
+        
+        // Consumes the content of an element without reading it, up to its end tag: "</"
+        // followed by name (lower case, matched ignoring case) and whitespace, '/' or '>'.
+        // If nested, start tags of the same name open further elements that their end tags
+        // close first; *depth counts them and carries over between calls. Returns true when
+        // the reader is at the end tag. Otherwise all input was consumed, or non-final input
+        // ran out at a '<' that may still turn out to be a tag, and the reader is starved.
+        bool consumeToEndTag(const StringRef& name, bool nested, size_t* depth);
+        
+        // Consumes a run of ASCII letters.
+        StringRef consumeLetterSequence();
+        
         bool matchConsume(const StringRef& str) {
             if (matches(str)) {
+                prev_ = cur_;
                 cur_ += str.size();
                 readChar();
                 return true;
@@ -153,6 +315,7 @@ namespace csoup {
         
         bool matchConsumeIgnoreCase(const StringRef& str) {
             if (matchesIgnoreCase(str)) {
+                prev_ = cur_;
                 cur_ += str.size();
                 readChar();
                 return true;
@@ -210,15 +373,60 @@ namespace csoup {
         //static const int EOF = -1;
         static const int eof_ = -1;
     private:
-        void readChar();
+        // Printable ASCII needs neither decoding nor the CR/invalid code point checks,
+        // everything else goes through readCharSlow(). Normalised input (see
+        // TreeBuilder::setNormaliseNewlines) has no CR, so its newlines stay on the fast path.
+        void readChar() {
+            if (cur_ < end_) {
+                unsigned char b = static_cast<unsigned char>(*cur_);
+                if ((b >= 0x20 && b < 0x7F) || b == '\n' || b == '\t') {
+                    current_ = b;
+                    width_ = 1;
+                    return;
+                }
+            }
+            readCharSlow();
+        }
+        
+        void readCharSlow();
+        
+        void decodeError(DecodeErrorEnum kind) {
+            size_t pos = cur_ - start_;
+            if (pos < decodeErrorEnd_) return;
+            
+            decodeErrorEnd_ = pos + 1;
+            ++ decodeErrorCounts_[kind];
+            if (logDecodeErrors_ && decodeErrorLogSizes_[kind] < kDecodeErrorLogSize) {
+                decodeErrorLog_[kind][decodeErrorLogSizes_[kind] ++] = pos;
+            }
+        }
+        
+        // Size of the blocks validated ahead of the cursor.
+        static const size_t kValidateBlockSize = 4096;
         
         const CharType* start_;
         const CharType* cur_;
+        const CharType* prev_;
         const CharType* mark_;
         const CharType* end_;
         
+        // [validBegin_, validEnd_) is known to be well-formed UTF-8, so multi-byte
+        // sequences inside it are decoded directly instead of through the DFA.
+        const CharType* validBegin_;
+        const CharType* validEnd_;
+        
         int current_;
         size_t width_;
+        
+        bool final_;
+        mutable bool starved_;
+        
+        size_t decodeErrorCounts_[CSOUP_DECODE_ERROR_KIND_COUNT];
+        size_t decodeErrorLog_[CSOUP_DECODE_ERROR_KIND_COUNT][kDecodeErrorLogSize];
+        size_t decodeErrorLogSizes_[CSOUP_DECODE_ERROR_KIND_COUNT];
+        size_t decodeErrorEnd_; // past the last counted error; errors before it were counted
+        bool logDecodeErrors_;
+        const internal::StructuralIndex* index_; // optional, see setStructuralIndex()
     };
 }
 
@@ -0,0 +1,355 @@
+//
+//  charset.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include <algorithm>
+#include "../util/stringbuffer.h"
+#include "../internal/strscan.h"
+#include "charset.h"
+
+namespace csoup {
+    namespace {
+        struct CharsetLabel {
+            const char* label;
+            CharsetEnum charset;
+        };
+
+        const CharsetLabel kLabels[] = {
+            { "unicode-1-1-utf-8", CSOUP_CHARSET_UTF8 },
+            { "unicode11utf8", CSOUP_CHARSET_UTF8 },
+            { "unicode20utf8", CSOUP_CHARSET_UTF8 },
+            { "utf-8", CSOUP_CHARSET_UTF8 },
+            { "utf8", CSOUP_CHARSET_UTF8 },
+            { "x-unicode20utf8", CSOUP_CHARSET_UTF8 },
+            { "csunicode", CSOUP_CHARSET_UTF16LE },
+            { "iso-10646-ucs-2", CSOUP_CHARSET_UTF16LE },
+            { "ucs-2", CSOUP_CHARSET_UTF16LE },
+            { "unicode", CSOUP_CHARSET_UTF16LE },
+            { "unicodefeff", CSOUP_CHARSET_UTF16LE },
+            { "utf-16", CSOUP_CHARSET_UTF16LE },
+            { "utf-16le", CSOUP_CHARSET_UTF16LE },
+            { "unicodefffe", CSOUP_CHARSET_UTF16BE },
+            { "utf-16be", CSOUP_CHARSET_UTF16BE },
+            { "ansi_x3.4-1968", CSOUP_CHARSET_WINDOWS_1252 },
+            { "ascii", CSOUP_CHARSET_WINDOWS_1252 },
+            { "cp1252", CSOUP_CHARSET_WINDOWS_1252 },
+            { "cp819", CSOUP_CHARSET_WINDOWS_1252 },
+            { "csisolatin1", CSOUP_CHARSET_WINDOWS_1252 },
+            { "ibm819", CSOUP_CHARSET_WINDOWS_1252 },
+            { "iso-8859-1", CSOUP_CHARSET_WINDOWS_1252 },
+            { "iso-ir-100", CSOUP_CHARSET_WINDOWS_1252 },
+            { "iso8859-1", CSOUP_CHARSET_WINDOWS_1252 },
+            { "iso88591", CSOUP_CHARSET_WINDOWS_1252 },
+            { "iso_8859-1", CSOUP_CHARSET_WINDOWS_1252 },
+            { "iso_8859-1:1987", CSOUP_CHARSET_WINDOWS_1252 },
+            { "l1", CSOUP_CHARSET_WINDOWS_1252 },
+            { "latin1", CSOUP_CHARSET_WINDOWS_1252 },
+            { "us-ascii", CSOUP_CHARSET_WINDOWS_1252 },
+            { "windows-1252", CSOUP_CHARSET_WINDOWS_1252 },
+            { "x-cp1252", CSOUP_CHARSET_WINDOWS_1252 }
+        };
+
+        // code points of windows-1252 bytes 0x80-0x9F; the rest match ISO-8859-1
+        const unsigned short kWindows1252High[32] = {
+            0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+            0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+            0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+        };
+
+        bool isSpace(unsigned char c) {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r';
+        }
+
+        bool startsWithIgnoreCase(const char* p, const char* end, const char* prefix, size_t n) {
+            return static_cast<size_t>(end - p) >= n && internal::compareIgnoreCase(p, prefix, n) == 0;
+        }
+
+        // The "prescan a byte stream" algorithm of the HTML spec, over [begin, end).
+        class Prescanner {
+        public:
+            Prescanner(const char* begin, const char* end) : p_(begin), end_(end) {
+            }
+
+            CharsetEnum scan();
+
+        private:
+            // one attribute of a tag; returns false at the end of the tag
+            bool nextAttribute(const char** name, size_t* nameLength, const char** value, size_t* valueLength);
+
+            CharsetEnum metaCharset();
+
+            void skipTo(const char* s, size_t n) {
+                const char* found = internal::findSubstring(p_, end_, s, n);
+                p_ = found == end_ ? end_ : found + n;
+            }
+
+            void skipSpaces() {
+                while (p_ < end_ && isSpace(*p_)) ++ p_;
+            }
+
+            const char* p_;
+            const char* end_;
+        };
+
+        // the charset=... parameter of a Content-Type value
+        CharsetEnum charsetFromContentType(const char* p, const char* end) {
+            for (;;) {
+                while (p < end && !startsWithIgnoreCase(p, end, "charset", 7)) ++ p;
+                if (p >= end) return CSOUP_CHARSET_UNKNOWN;
+                p += 7;
+                while (p < end && isSpace(*p)) ++ p;
+                if (p < end && *p == '=') break;
+            }
+
+            ++ p;
+            while (p < end && isSpace(*p)) ++ p;
+            if (p >= end) return CSOUP_CHARSET_UNKNOWN;
+
+            const char* start;
+            if (*p == '"' || *p == '\'') {
+                char quote = *p ++;
+                start = p;
+                p = internal::findByte(p, end, quote);
+                if (p >= end) return CSOUP_CHARSET_UNKNOWN;
+            } else {
+                start = p;
+                while (p < end && !isSpace(*p) && *p != ';') ++ p;
+            }
+            return charsetForLabel(StringRef(start, p - start));
+        }
+
+        CharsetEnum Prescanner::scan() {
+            while (p_ < end_) {
+                p_ = internal::findByte(p_, end_, '<');
+                if (p_ >= end_) break;
+
+                if (startsWithIgnoreCase(p_, end_, "<!--", 4)) {
+                    p_ += 2; // "<!-->" is a whole comment
+                    skipTo("-->", 3);
+                } else if (startsWithIgnoreCase(p_, end_, "<meta", 5) &&
+                           end_ - p_ > 5 && (isSpace(p_[5]) || p_[5] == '/')) {
+                    p_ += 6;
+                    CharsetEnum charset = metaCharset();
+                    if (charset != CSOUP_CHARSET_UNKNOWN) return charset;
+                } else if (end_ - p_ > 2 && (internal::isAsciiAlpha(p_[1]) ||
+                                             (p_[1] == '/' && internal::isAsciiAlpha(p_[2])))) {
+                    // any other tag: skip its name and attributes
+                    while (p_ < end_ && !isSpace(*p_) && *p_ != '>') ++ p_;
+                    const char* name;
+                    const char* value;
+                    size_t nameLength, valueLength;
+                    while (nextAttribute(&name, &nameLength, &value, &valueLength)) {
+                    }
+                } else if (end_ - p_ > 1 && (p_[1] == '!' || p_[1] == '/' || p_[1] == '?')) {
+                    skipTo(">", 1);
+                } else {
+                    ++ p_;
+                }
+            }
+            return CSOUP_CHARSET_UNKNOWN;
+        }
+
+        CharsetEnum Prescanner::metaCharset() {
+            bool gotPragma = false;
+            bool seenCharset = false;
+            bool seenContent = false;
+            int needPragma = -1; // unset, false, true
+            CharsetEnum charset = CSOUP_CHARSET_UNKNOWN;
+
+            const char* name;
+            const char* value;
+            size_t nameLength, valueLength;
+            while (nextAttribute(&name, &nameLength, &value, &valueLength)) {
+                StringRef attr(name, nameLength);
+                if (attr.equalsIgnoreCase(StringRef("http-equiv"))) {
+                    gotPragma = gotPragma || StringRef(value, valueLength).equalsIgnoreCase(StringRef("content-type"));
+                } else if (attr.equalsIgnoreCase(StringRef("content")) && !seenContent) {
+                    seenContent = true;
+                    if (!seenCharset) {
+                        CharsetEnum found = charsetFromContentType(value, value + valueLength);
+                        if (found != CSOUP_CHARSET_UNKNOWN) {
+                            charset = found;
+                            needPragma = 1;
+                        }
+                    }
+                } else if (attr.equalsIgnoreCase(StringRef("charset")) && !seenCharset) {
+                    seenCharset = true;
+                    charset = charsetForLabel(StringRef(value, valueLength));
+                    needPragma = 0;
+                }
+            }
+
+            if (needPragma == -1 || (needPragma == 1 && !gotPragma)) return CSOUP_CHARSET_UNKNOWN;
+            // a document that got this far is ASCII-compatible, whatever it says
+            if (charset == CSOUP_CHARSET_UTF16LE || charset == CSOUP_CHARSET_UTF16BE) return CSOUP_CHARSET_UTF8;
+            return charset;
+        }
+
+        bool Prescanner::nextAttribute(const char** name, size_t* nameLength, const char** value, size_t* valueLength) {
+            while (p_ < end_ && (isSpace(*p_) || *p_ == '/')) ++ p_;
+            if (p_ >= end_ || *p_ == '>') {
+                if (p_ < end_) ++ p_;
+                return false;
+            }
+
+            *name = p_;
+            while (p_ < end_ && !isSpace(*p_) && *p_ != '/' && *p_ != '>' && !(*p_ == '=' && p_ != *name)) ++ p_;
+            *nameLength = p_ - *name;
+            *value = p_;
+            *valueLength = 0;
+
+            skipSpaces();
+            if (p_ >= end_ || *p_ != '=') return true;
+            ++ p_;
+            skipSpaces();
+            if (p_ >= end_) return true;
+
+            if (*p_ == '"' || *p_ == '\'') {
+                char quote = *p_ ++;
+                *value = p_;
+                p_ = internal::findByte(p_, end_, quote);
+                *valueLength = p_ - *value;
+                if (p_ < end_) ++ p_;
+            } else {
+                *value = p_;
+                while (p_ < end_ && !isSpace(*p_) && *p_ != '>') ++ p_;
+                *valueLength = p_ - *value;
+            }
+            return true;
+        }
+
+        void transcodeSingleByte(const StringRef& input, bool windows1252, StringBuffer* out) {
+            const char* p = input.data();
+            const char* end = p + input.size();
+            out->reserve(out->size() + input.size() + input.size() / 8);
+
+            while (p < end) {
+                // ASCII runs are copied as they are
+                const char* run = internal::findNonAscii(p, end);
+                out->appendString(p, run - p);
+                p = run;
+
+                for (; p < end && static_cast<unsigned char>(*p) >= 0x80; ++ p) {
+                    unsigned char c = static_cast<unsigned char>(*p);
+                    out->append(windows1252 && c < 0xA0 ? kWindows1252High[c - 0x80] : c);
+                }
+            }
+        }
+
+        void transcodeUtf16(const StringRef& input, bool bigEndian, StringBuffer* out) {
+            const unsigned char* p = reinterpret_cast<const unsigned char*>(input.data());
+            size_t units = input.size() / 2;
+            out->reserve(out->size() + units + units / 4);
+
+            const size_t kBlock = 256;
+            char ascii[kBlock];
+            size_t i = 0;
+            while (i < units) {
+                size_t n = internal::narrowAsciiUtf16(reinterpret_cast<const char*>(p + 2 * i),
+                                                      std::min(kBlock, units - i), bigEndian, ascii);
+                out->appendString(ascii, n);
+                i += n;
+
+                for (; i < units; ++ i) {
+                    unsigned int c = bigEndian ? (p[2 * i] << 8) | p[2 * i + 1] : (p[2 * i + 1] << 8) | p[2 * i];
+                    if (c < 0x80) break;
+
+                    if (c >= 0xD800 && c <= 0xDBFF && i + 1 < units) {
+                        unsigned int low = bigEndian ? (p[2 * i + 2] << 8) | p[2 * i + 3] : (p[2 * i + 3] << 8) | p[2 * i + 2];
+                        if (low >= 0xDC00 && low <= 0xDFFF) {
+                            out->append(0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00));
+                            ++ i;
+                            continue;
+                        }
+                    }
+                    out->append(c >= 0xD800 && c <= 0xDFFF ? 0xFFFD : c);
+                }
+            }
+
+            if (input.size() % 2) {
+                out->append(0xFFFD);
+            }
+        }
+    }
+
+    CharsetEnum charsetForLabel(const StringRef& label) {
+        const char* begin = label.data();
+        const char* end = begin + label.size();
+        while (begin < end && isSpace(*begin)) ++ begin;
+        while (end > begin && isSpace(end[-1])) -- end;
+
+        StringRef trimmed(begin, end - begin);
+        for (size_t i = 0; i < arrayLength(kLabels); ++ i) {
+            if (trimmed.equalsIgnoreCase(StringRef(kLabels[i].label))) {
+                return kLabels[i].charset;
+            }
+        }
+        return CSOUP_CHARSET_UNKNOWN;
+    }
+
+    StringRef charsetName(CharsetEnum charset) {
+        switch (charset) {
+            case CSOUP_CHARSET_UTF8:            return StringRef("UTF-8");
+            case CSOUP_CHARSET_UTF16LE:         return StringRef("UTF-16LE");
+            case CSOUP_CHARSET_UTF16BE:         return StringRef("UTF-16BE");
+            case CSOUP_CHARSET_ISO_8859_1:      return StringRef("ISO-8859-1");
+            case CSOUP_CHARSET_WINDOWS_1252:    return StringRef("windows-1252");
+            default:                            return StringRef("");
+        }
+    }
+
+    CharsetEnum charsetFromBom(const StringRef& input, size_t* bomLength) {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(input.data());
+        size_t n = input.size();
+
+        *bomLength = 0;
+        if (n >= 3 && p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF) {
+            *bomLength = 3;
+            return CSOUP_CHARSET_UTF8;
+        }
+        if (n >= 2 && p[0] == 0xFE && p[1] == 0xFF) {
+            *bomLength = 2;
+            return CSOUP_CHARSET_UTF16BE;
+        }
+        if (n >= 2 && p[0] == 0xFF && p[1] == 0xFE) {
+            *bomLength = 2;
+            return CSOUP_CHARSET_UTF16LE;
+        }
+        return CSOUP_CHARSET_UNKNOWN;
+    }
+
+    CharsetEnum sniffCharset(const StringRef& input, size_t* bomLength) {
+        CharsetEnum charset = charsetFromBom(input, bomLength);
+        if (charset != CSOUP_CHARSET_UNKNOWN) return charset;
+
+        Prescanner prescanner(input.data(), input.data() + std::min(input.size(), kPrescanLength));
+        charset = prescanner.scan();
+        return charset == CSOUP_CHARSET_UNKNOWN ? CSOUP_CHARSET_UTF8 : charset;
+    }
+
+    void transcodeToUtf8(CharsetEnum charset, const StringRef& input, StringBuffer* out) {
+        switch (charset) {
+            case CSOUP_CHARSET_UTF16LE:
+                transcodeUtf16(input, false, out);
+                break;
+            case CSOUP_CHARSET_UTF16BE:
+                transcodeUtf16(input, true, out);
+                break;
+            case CSOUP_CHARSET_ISO_8859_1:
+                transcodeSingleByte(input, false, out);
+                break;
+            case CSOUP_CHARSET_WINDOWS_1252:
+                transcodeSingleByte(input, true, out);
+                break;
+            default:
+                // already UTF-8; the reader validates it
+                out->appendString(input);
+                break;
+        }
+    }
+}
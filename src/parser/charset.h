@@ -0,0 +1,52 @@
+//
+//  charset.h
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#ifndef CSOUP_CHARSET_H_
+#define CSOUP_CHARSET_H_
+
+#include "../util/common.h"
+#include "../util/stringref.h"
+
+namespace csoup {
+    class StringBuffer;
+
+    // Input encodings the parser can read. Everything is transcoded to UTF-8 before
+    // it reaches the CharacterReader.
+    typedef enum {
+        CSOUP_CHARSET_UNKNOWN,      // not recognised; as a setting it means "sniff it"
+        CSOUP_CHARSET_UTF8,
+        CSOUP_CHARSET_UTF16LE,
+        CSOUP_CHARSET_UTF16BE,
+        CSOUP_CHARSET_ISO_8859_1,
+        CSOUP_CHARSET_WINDOWS_1252
+    } CharsetEnum;
+
+    // Maps an encoding label ("UTF-8", "latin1", " Windows-1252 ", ...) to a charset.
+    // Follows the WHATWG encoding standard, so the ISO-8859-1 and ASCII labels mean
+    // windows-1252. Returns CSOUP_CHARSET_UNKNOWN for labels we can't decode.
+    CharsetEnum charsetForLabel(const StringRef& label);
+
+    StringRef charsetName(CharsetEnum charset);
+
+    // The encoding given by a byte order mark at the start of input, or
+    // CSOUP_CHARSET_UNKNOWN if there is none. *bomLength is set to its size.
+    CharsetEnum charsetFromBom(const StringRef& input, size_t* bomLength);
+
+    // Determines the encoding of a document: a byte order mark wins, then a
+    // <meta charset> or <meta http-equiv=Content-Type> in the first kPrescanLength
+    // bytes, then UTF-8. *bomLength is set to the size of the byte order mark.
+    CharsetEnum sniffCharset(const StringRef& input, size_t* bomLength);
+
+    const size_t kPrescanLength = 1024;
+
+    // Appends input decoded from charset to out as UTF-8. Unpaired surrogates and
+    // a trailing odd byte of UTF-16 become U+FFFD.
+    void transcodeToUtf8(CharsetEnum charset, const StringRef& input, StringBuffer* out);
+}
+
+#endif // CSOUP_CHARSET_H_
@@ -15,6 +15,7 @@
 #include "../nodes/document.h"
 #include "../internal/list.h"
 #include "htmltreebuilderstate.h"
+#include "openelementstack.h"
 #include "formelement.h"
 #include "parseerrorlist.h"
 #include "parseerror.h"
@@ -25,22 +26,6 @@
 namespace csoup {
     using namespace internal;
     
-    const StringRef HtmlTreeBuilder::TagsScriptStyle[]      = {"script", "style"};
-    const StringRef HtmlTreeBuilder::TagsSearchInScope[]    = {"applet", "caption", "html", "table", "td", "th", "marquee", "object"};
-    const StringRef HtmlTreeBuilder::TagSearchList[]        = {"ol", "ul"};
-    const StringRef HtmlTreeBuilder::TagSearchButton[]      = {"button"};
-    const StringRef HtmlTreeBuilder::TagSearchTableScope[]  = {"html", "table"};
-    const StringRef HtmlTreeBuilder::TagSearchSelectScope[] = {"optgroup", "option"};
-    const StringRef HtmlTreeBuilder::TagSearchEndTags[]     = {"dd", "dt", "li", "option", "optgroup", "p", "rp", "rt"};
-    const StringRef HtmlTreeBuilder::TagSearchSpecial[]     = {"address", "applet", "area", "article", "aside", "base", "basefont", "bgsound",
-        "blockquote", "body", "br", "button", "caption", "center", "col", "colgroup", "command", "dd",
-        "details", "dir", "div", "dl", "dt", "embed", "fieldset", "figcaption", "figure", "footer", "form",
-        "frame", "frameset", "h1", "h2", "h3", "h4", "h5", "h6", "head", "header", "hgroup", "hr", "html",
-        "iframe", "img", "input", "isindex", "li", "link", "listing", "marquee", "menu", "meta", "nav",
-        "noembed", "noframes", "noscript", "object", "ol", "p", "param", "plaintext", "pre", "script",
-        "section", "select", "style", "summary", "table", "tbody", "td", "textarea", "tfoot", "th", "thead",
-        "title", "tr", "ul", "wbr", "xmp"};
-    
     HtmlTreeBuilder::HtmlTreeBuilder(Allocator* allocator) :
     state_(NULL), originalState_(NULL), baseUriSetFromDoc_(false), headElement_(NULL),
     /*formElement(NULL),*/ contextElement_(NULL), formattingElements_(NULL), pendingTableCharacters_(NULL),
@@ -50,7 +35,7 @@ namespace csoup {
         using internal::Vector;
         
         formattingElements_ = new (allocator->malloc_t< Vector<Element*> >()) Vector<Element*>(4, allocator);
-        pendingTableCharacters_ = new (allocator->malloc_t< Vector<CharacterToken*> >()) Vector<CharacterToken*>();
+        pendingTableCharacters_ = new (allocator->malloc_t< Vector<CharacterToken*> >()) Vector<CharacterToken*>(4, allocator);
     }
     
     HtmlTreeBuilder::~HtmlTreeBuilder() {
@@ -64,23 +49,33 @@ namespace csoup {
         allocator_->deconstructAndFree(pendingTableCharacters_);
     }
     
+    Element* HtmlTreeBuilder::newElement(StartTagToken* startTag) {
+        // a tag read without attributes has none allocated
+        const Tag* tag = doc_->internTag(startTag->tagName());
+        StringRef baseUri = baseUri_ ? baseUri_->ref() : "";
+        if (startTag->attributes() != NULL) {
+            return new (doc_->allocator()->malloc_t<Element>()) Element(tag, *startTag->attributes(), baseUri, doc_->allocator());
+        }
+        return new (doc_->allocator()->malloc_t<Element>()) Element(tag, baseUri, doc_->allocator());
+    }
+    
     Element* HtmlTreeBuilder::insert(csoup::StartTagToken *startTag) {
         if (startTag->selfClosing()) {
             Element* el = insertEmpty(startTag);
             stack_->push(el);
             tokeniser_->transition(Data::instance());
-            tokeniser_->emit(CSOUP_NEW2(allocator(), EndTagToken, el->tagName(), allocator()));
+            tokeniser_->emit(CSOUP_NEW2(doc_->allocator(), EndTagToken, el->tagName(), doc_->allocator()));
             return el;
         }
         
-        Element* el = new (allocator_->malloc_t<Element>())
-        Element(startTag->tagName(), *startTag->attributes(), baseUri_ ? baseUri_->ref() : "", allocator());
+        Element* el = newElement(startTag);
+        el->setSourcePos(startTag->sourcePos());
         insert(el);
         return el;
     }
     
     Element* HtmlTreeBuilder::insert(const csoup::StringRef &startTagName) {
-        Element* el = new (allocator()->malloc_t<Element>()) Element(startTagName, baseUri_ ? baseUri_->ref() : "", allocator());
+        Element* el = new (doc_->allocator()->malloc_t<Element>()) Element(doc_->internTag(startTagName), baseUri_ ? baseUri_->ref() : "", doc_->allocator());
         insert(el);
         return el;
     }
@@ -91,16 +86,17 @@ namespace csoup {
     }
     
     Element* HtmlTreeBuilder::insertEmpty(csoup::StartTagToken *startTag) {
-        Element* el = new (allocator()->malloc_t<Element>())
-            Element(startTag->tagName(), *startTag->attributes(), baseUri_ ? baseUri_->ref() : "", allocator());
+        Element* el = newElement(startTag);
+        el->setSourcePos(startTag->sourcePos());
         insertNode(el);
         if (startTag->selfClosing()) {
-            if (Tag::isKnownTag(startTag->tagName())) {
+            if (el->tag()->isKnownTag()) {
                 if (el->tag()->selfClosing()) {
                     tokeniser()->setAcknowledgeSelfClosingFlag();
                 }
             } else {
-                el->tag()->setSelfClosing();
+                // the document's own tag, see Document::internTag()
+                doc_->setSelfClosing(el->tag());
                 tokeniser()->setAcknowledgeSelfClosingFlag();
             }
         }
@@ -109,8 +105,13 @@ namespace csoup {
     }
     
     FormElement* HtmlTreeBuilder::insertForm(StartTagToken *startTag, bool onStack) {
-        FormElement* el = new (allocator()->malloc_t<FormElement>())
-            FormElement(startTag->tagName(), *startTag->attributes(), baseUri_ ? baseUri_->ref() : "", allocator());
+        // a tag read without attributes has none allocated
+        const Tag* tag = doc_->internTag(startTag->tagName());
+        StringRef baseUri = baseUri_ ? baseUri_->ref() : "";
+        FormElement* el = startTag->attributes() != NULL ?
+            new (doc_->allocator()->malloc_t<FormElement>()) FormElement(tag, *startTag->attributes(), baseUri, doc_->allocator()) :
+            new (doc_->allocator()->malloc_t<FormElement>()) FormElement(tag, baseUri, doc_->allocator());
+        el->setSourcePos(startTag->sourcePos());
         setFormElement(el, false);
         insertNode(el);
         if (onStack) {
@@ -121,29 +122,42 @@ namespace csoup {
     }
     
     void HtmlTreeBuilder::insert(CommentToken* commentToken) {
-        CommentNode* comment = CSOUP_NEW3(allocator(), CommentNode,commentToken->data(), baseUri_ ? baseUri_->ref() : "", allocator());
+        CommentNode* comment = CSOUP_NEW3(doc_->allocator(), CommentNode,commentToken->data(), baseUri_ ? baseUri_->ref() : "", doc_->allocator());
+        comment->setSourcePos(commentToken->sourcePos());
         insertNode(comment);
     }
     
     void HtmlTreeBuilder::insert(csoup::CharacterToken *characterToken) {
         Node* node;
-        StringRef tagName = currentElement()->tagName();
-        if (tagName.equals("script") || tagName.equals("style")) {
-            node = CSOUP_NEW3(allocator(), DataNode, characterToken->data(), baseUri_ ? baseUri_->ref() : "", allocator());
+        Element* current = currentElement();
+        // a run of input the document keeps is referred to, not copied
+        bool copy = !(keepsInputSpans_ && characterToken->isInputSpan());
+        bool isData = TagsScriptStyle.contains(current->tagId());
+        
+        // text split over several tokens, e.g. by the chunks of feed(), goes into one node
+        Node* last = current->childNodeSize() > 0 ? current->childNode(current->childNodeSize() - 1) : NULL;
+        if (last != NULL && last->type() == (isData ? CSOUP_NODE_CDATA : CSOUP_NODE_TEXT)) {
+            if (isData) static_cast<DataNode*>(last)->appendWholeData(characterToken->data(), copy);
+            else        static_cast<TextNode*>(last)->appendWholeText(characterToken->data(), copy);
+            return;
+        }
+        
+        if (isData) {
+            node = CSOUP_NEW4(doc_->allocator(), DataNode, characterToken->data(), baseUri_ ? baseUri_->ref() : "", doc_->allocator(), copy);
         } else {
-            node = CSOUP_NEW3(allocator(), TextNode, characterToken->data(), baseUri_ ? baseUri_->ref() : "", allocator());
+            node = CSOUP_NEW4(doc_->allocator(), TextNode, characterToken->data(), baseUri_ ? baseUri_->ref() : "", doc_->allocator(), copy);
         }
         
-        currentElement()->appendNode(node);
+        node->setSourcePos(characterToken->sourcePos());
+        current->appendNode(node);
     }
     
-    Document* HtmlTreeBuilder::parse(const csoup::StringRef &input, const csoup::StringRef &baseUri, csoup::ParseErrorList *errors, csoup::Allocator *allocator) {
-        // reset builder state
+    void HtmlTreeBuilder::resetBuilderState() {
         formattingElements_->clear();
         clearPendingTableCharacters();
         pendingTableCharacters_->clear();
         
-        //state_ = ; // set to INITIAL state
+        state_ = Initial::instance();
         originalState_ = NULL;
         contextElement_ = NULL;
         baseUriSetFromDoc_ = false;
@@ -152,10 +166,18 @@ namespace csoup {
         framesetOk_ = true;
         fosterInserts_ = false;
         fragmentParsing_ = false;
-        
+    }
+    
+    Document* HtmlTreeBuilder::parse(const csoup::StringRef &input, const csoup::StringRef &baseUri, csoup::ParseErrorList *errors, csoup::Allocator *allocator) {
+        resetBuilderState();
         return TreeBuilder::parse(input, baseUri, errors, allocator);
     }
     
+    void HtmlTreeBuilder::beginParse(const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator) {
+        resetBuilderState();
+        TreeBuilder::beginParse(baseUri, errors, allocator);
+    }
+    
     internal::Vector<Node>* HtmlTreeBuilder::parseFragment(const StringRef& inputFragment, Element* context,
                                         const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator) {
         // reset builder state
@@ -163,7 +185,7 @@ namespace csoup {
         clearPendingTableCharacters();
         pendingTableCharacters_->clear();
         
-        //state_ = ; // set to INITIAL state
+        state_ = Initial::instance();
         originalState_ = NULL;
         contextElement_ = context;
         baseUriSetFromDoc_ = false;
@@ -181,16 +203,16 @@ namespace csoup {
                 doc_->setQuirksMode(context->ownerDocument()->quirksMode());
             
             // initialise the tokeniser state:
-            StringRef contextTag = context->tagName();
-            if (StringUtil::in(contextTag, "title", "textarea"))
+            TagIdEnum contextTag = context->tagId();
+            if (TagsRcdata.contains(contextTag))
                 tokeniser_->transition(internal::Rcdata::instance());
-            else if (StringUtil::in(contextTag, "iframe", "noembed", "noframes", "style", "xmp"))
+            else if (TagsRawText.contains(contextTag))
                 tokeniser_->transition(RawText::instance());
-            else if (contextTag.equals("script"))
+            else if (contextTag == CSOUP_TAG_SCRIPT)
                 tokeniser_->transition(ScriptData::instance());
-            else if (contextTag.equals(("noscript")))
+            else if (contextTag == CSOUP_TAG_NOSCRIPT)
                 tokeniser_->transition(Data::instance()); // if scripting enabled, rawtext
-            else if (contextTag.equals("plaintext"))
+            else if (contextTag == CSOUP_TAG_PLAINTEXT)
                 tokeniser_->transition(Data::instance());
             else
                 tokeniser_->transition(Data::instance()); // default
@@ -222,13 +244,15 @@ namespace csoup {
     }
     
     bool HtmlTreeBuilder::process(Token *token) {
-        CSOUP_DELETE(allocator(), currentToken_);
+        // runParser() owns the token; this is only kept for error positions
         currentToken_ = token;
         return state_->process(token, this);
     }
     
     bool HtmlTreeBuilder::process(Token* token, HtmlTreeBuilderState* state) {
-        return process(token);
+        // by the rules of state, without switching to it
+        currentToken_ = token;
+        return state->process(token, this);
     }
     
     void HtmlTreeBuilder::maybeSetBaseUri(csoup::Element *base) {
@@ -240,11 +264,17 @@ namespace csoup {
     }
     
     
+#if CSOUP_PARSE_ERRORS
     void HtmlTreeBuilder::error(HtmlTreeBuilderState *state) {
         if (errors_->notFull()) {
-            new (errors_->appendError()) ParseError(0, "Unexpected token", allocator());
+            size_t pos = currentToken_ != NULL && currentToken_->sourcePos() != kNoSourcePos ?
+                            currentToken_->sourcePos() : tokeniser_->sourcePos();
+            size_t line, column;
+            tokeniser_->locate(pos, &line, &column);
+            new (errors_->appendError()) ParseError(CSOUP_PARSE_ERROR_UNEXPECTED_TOKEN, pos, line, column);
         }
     }
+#endif
     
     void HtmlTreeBuilder::insertNode(csoup::Node *node) {
         if (stack_->size() == 0) {
@@ -263,10 +293,7 @@ namespace csoup {
     }
     
     Element* HtmlTreeBuilder::pop() {
-        Element* ret = *stack_->back();
-        stack_->pop();
-        
-        return ret;
+        return stack_->pop();
     }
 
     void HtmlTreeBuilder::push(Element* el) {
@@ -274,7 +301,15 @@ namespace csoup {
     }
     
     bool HtmlTreeBuilder::onStack(csoup::Element *el) {
-        return isElementInQueue(stack_, el);
+        if (stack_->count(el->tagId()) == 0) return false;
+        
+        for (size_t i = stack_->size(); i > 0; -- i) {
+            if (stack_->at(i - 1) == el) {
+                return true;
+            }
+        }
+        
+        return false;
     }
     
     bool HtmlTreeBuilder::isElementInQueue(internal::Vector<Element*> *queue, csoup::Element *element) {
@@ -287,24 +322,19 @@ namespace csoup {
         return false;
     }
     
-    Element* HtmlTreeBuilder::getFromStack(const csoup::StringRef &elName) {
-        if (stack_->size() == 0) return NULL;
+    Element* HtmlTreeBuilder::getFromStack(TagIdEnum id) {
+        CSOUP_ASSERT(id != CSOUP_TAG_UNKNOWN);
+        if (stack_->count(id) == 0) return NULL;
         
-        for (size_t i = stack_->size(); i > 0; -- i) {
-            if ((*stack_->at(i - 1))->tagName().equals(elName)) {
-                return *stack_->at(i - 1);
-            }
-        }
-        
-        return NULL;
+        return stack_->at(stack_->lastIndexOf(id));
     }
     
     bool HtmlTreeBuilder::removeFromStack(csoup::Element *el, bool del) {
         if (stack_->size() == 0) return false;
         
         for (size_t i = stack_->size(); i > 0; -- i) {
-            if (*stack_->at(i - 1) == el) {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
+            if (stack_->at(i - 1) == el) {
+                if (del) CSOUP_DELETE(allocator(), stack_->at(i - 1));
                 stack_->remove(i - 1);
                 return true;
             }
@@ -313,177 +343,73 @@ namespace csoup {
         return false;
     }
     
-    void HtmlTreeBuilder::popStackToClose(bool del, const csoup::StringRef &s1) {
-        if (stack_->size() == 0) return ;
-        
-        for (size_t i = stack_->size(); i > 0; -- i) {
-            if ((*stack_->at(i - 1))->tagName().equals(s1)) {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
-                break;
-            } else {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
+    void HtmlTreeBuilder::truncateStack(size_t size, bool del) {
+        if (del) {
+            for (size_t i = stack_->size(); i > size; -- i) {
+                CSOUP_DELETE(allocator(), stack_->at(i - 1));
             }
         }
+        stack_->truncate(size);
     }
     
-    void HtmlTreeBuilder::popStackToClose(bool del, const StringRef &s1, const StringRef &s2) {
-        if (stack_->size() == 0) return ;
-        
-        for (size_t i = stack_->size(); i > 0; -- i) {
-            if (StringUtil::in((*stack_->at(i - 1))->tagName(), s1, s2)) {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
-                break;
-            } else {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
-            }
-        }
-    }
-    
-    void HtmlTreeBuilder::popStackToClose(bool del, const StringRef &s1, const StringRef &s2, const StringRef &s3) {
-        if (stack_->size() == 0) return ;
-        
-        for (size_t i = stack_->size(); i > 0; -- i) {
-            if (StringUtil::in((*stack_->at(i - 1))->tagName(), s1, s2, s3)) {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
-                break;
-            } else {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
-            }
-        }
+    void HtmlTreeBuilder::popStackToClose(bool del, TagIdEnum id) {
+        popStackToClose(del, &id, 1);
     }
     
-    void HtmlTreeBuilder::popStackToClose(bool del, const StringRef &s1, const StringRef &s2, const StringRef &s3,
-                                          const StringRef& s4) {
-        if (stack_->size() == 0) return ;
-        
-        for (size_t i = stack_->size(); i > 0; -- i) {
-            if (StringUtil::in((*stack_->at(i - 1))->tagName(), s1, s2, s3, s4)) {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
-                break;
-            } else {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
-            }
-        }
+    void HtmlTreeBuilder::popStackToClose(bool del, const TagIdEnum* ids, size_t cnt) {
+        size_t index = stack_->lastIndexOf(ids, cnt);
+        truncateStack(index < stack_->size() ? index : 0, del);
     }
     
-    void HtmlTreeBuilder::popStackToClose(bool del, const StringRef &s1, const StringRef &s2, const StringRef &s3,
-                                          const StringRef& s4, const StringRef& s5) {
-        if (stack_->size() == 0) return ;
-        
-        for (size_t i = stack_->size(); i > 0; -- i) {
-            if (StringUtil::in((*stack_->at(i - 1))->tagName(), s1, s2, s3, s4, s5)) {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
-                break;
-            } else {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
-            }
+    void HtmlTreeBuilder::popStackToClose(bool del, const StringRef& elName) {
+        TagIdEnum id = Tag::idOf(elName);
+        if (id != CSOUP_TAG_UNKNOWN) {
+            popStackToClose(del, id);
+            return ;
         }
-    }
-    
-    void HtmlTreeBuilder::popStackToClose(bool del, const csoup::StringRef *elName, size_t cnt) {
-        if (stack_->size() == 0) return ;
         
+        // only the elements of unknown tags can have the name
+        size_t index = 0;
         for (size_t i = stack_->size(); i > 0; -- i) {
-            if (StringUtil::in((*stack_->at(i - 1))->tagName(), elName, cnt)) {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
+            if (stack_->idAt(i - 1) == CSOUP_TAG_UNKNOWN && stack_->at(i - 1)->tagName().equals(elName)) {
+                index = i - 1;
                 break;
-            } else {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
             }
         }
+        truncateStack(index, del);
     }
     
-    void HtmlTreeBuilder::popStackToBefore(bool del, const csoup::StringRef &elName) {
-        if (stack_->size() == 0) return ;
-        
-        for (size_t i = stack_->size(); i > 0; -- i) {
-            if ((*stack_->at(i - 1))->tagName().equals(elName)) {
-                break;
-            } else {
-                if (del) CSOUP_DELETE(allocator(), (*stack_->at(i - 1)));
-                stack_->remove(i - 1);
-            }
-        }
+    void HtmlTreeBuilder::popStackToBefore(bool del, TagIdEnum id) {
+        size_t index = stack_->lastIndexOf(id);
+        truncateStack(index < stack_->size() ? index + 1 : 0, del);
     }
     
     void HtmlTreeBuilder::clearStackToTableContext(bool del) {
-        clearStackToContext(del, "table");
+        static const TagIdEnum context[] = {CSOUP_TAG_TABLE, CSOUP_TAG_HTML};
+        clearStackToContext(del, context, arrayLength(context));
     }
     
     void HtmlTreeBuilder::clearStackToTableBodyContext(bool del) {
-        clearStackToContext(del, "tbody", "tfoot", "thead");
+        static const TagIdEnum context[] = {CSOUP_TAG_TBODY, CSOUP_TAG_TFOOT, CSOUP_TAG_THEAD, CSOUP_TAG_HTML};
+        clearStackToContext(del, context, arrayLength(context));
     }
     
     void HtmlTreeBuilder::clearStackToTableRowContext(bool del) {
-        clearStackToContext(del, "tr");
+        static const TagIdEnum context[] = {CSOUP_TAG_TR, CSOUP_TAG_HTML};
+        clearStackToContext(del, context, arrayLength(context));
     }
     
-    void HtmlTreeBuilder::clearStackToContext(bool del, const csoup::StringRef &n1) {
-        if (stack_->empty()) return ;
-        for (size_t i = stack_->size(); i > 0; -- i) {
-            Element* el = *stack_->at(i - 1);
-            if (StringUtil::in(el->tagName(), n1) || el->tagName().equals("html")) {
-                break;
-            } else {
-                if (del) CSOUP_DELETE(allocator(), el);
-                stack_->remove(i - 1);
-            }
-        }
-    }
-    
-    void HtmlTreeBuilder::clearStackToContext(bool del, const csoup::StringRef &n1, const csoup::StringRef &n2) {
-        StringRef names[] = {n1, n2};
-        clearStackToContext(del, names, arrayLength(names));
-    }
-    
-    void HtmlTreeBuilder::clearStackToContext(bool del, const StringRef &n1, const StringRef &n2, const StringRef &n3) {
-        StringRef names[] = {n1, n2, n3};
-        clearStackToContext(del, names, arrayLength(names));
-    }
-    
-    void HtmlTreeBuilder::clearStackToContext(bool del, const StringRef &n1, const StringRef &n2, const StringRef &n3,
-                                              const StringRef& n4) {
-        StringRef names[] = {n1, n2, n3, n4};
-        clearStackToContext(del, names, arrayLength(names));
-    }
-    
-    void HtmlTreeBuilder::clearStackToContext(bool del, const StringRef &n1, const StringRef &n2, const StringRef &n3,
-                                              const StringRef& n4, const StringRef& n5) {
-        StringRef names[] = {n1, n2, n3, n4, n5};
-        clearStackToContext(del, names, arrayLength(names));
-    }
-    
-    void HtmlTreeBuilder::clearStackToContext(bool del, const csoup::StringRef *n1, size_t cnt) {
-        if (stack_->empty()) return ;
-        for (size_t i = stack_->size(); i > 0; -- i) {
-            Element* el = *stack_->at(i - 1);
-            if (StringUtil::in(el->tagName(), n1, cnt) || el->tagName().equals("html")) {
-                break;
-            } else {
-                if (del) CSOUP_DELETE(allocator(), el);
-                stack_->remove(i - 1);
-            }
-        }
+    void HtmlTreeBuilder::clearStackToContext(bool del, const TagIdEnum* ids, size_t cnt) {
+        size_t index = stack_->lastIndexOf(ids, cnt);
+        truncateStack(index < stack_->size() ? index + 1 : 0, del);
     }
     
     Element* HtmlTreeBuilder::aboveOnStack(csoup::Element *el) {
         CSOUP_ASSERT(onStack(el));
         for (size_t i = stack_->size(); i > 0; -- i) {
-            Element* next = *stack_->at(i - 1);
+            Element* next = stack_->at(i - 1);
             if (next == el) {
-                return (i - 1 > 0) ? *stack_->at(i - 2) : NULL;
+                return (i - 1 > 0) ? stack_->at(i - 2) : NULL;
             }
         }
         
@@ -492,7 +418,7 @@ namespace csoup {
     
     void HtmlTreeBuilder::insertOnStackAfter(csoup::Element *after, csoup::Element *in) {
         for (size_t i = stack_->size(); i > 0; -- i) {
-            if (*stack_->at(i - 1) == after) {
+            if (stack_->at(i - 1) == after) {
                 stack_->insert(i, in);
                 return ;
             }
@@ -502,15 +428,21 @@ namespace csoup {
     }
     
     void HtmlTreeBuilder::replaceOnStack(csoup::Element *out, csoup::Element *in, bool del) {
-        replaceInQueue(stack_, out, in, del);
+        for (size_t i = stack_->size(); i > 0; -- i) {
+            Element* cur = stack_->at(i - 1);
+            if (cur == out) {
+                if (del) CSOUP_DELETE(allocator(), cur);
+                stack_->replace(i - 1, in);
+            }
+        }
     }
     
     void HtmlTreeBuilder::replaceInQueue(internal::Vector<Element *> *queue, Element *out, Element *in, bool del) {
-        for (size_t i = stack_->size(); i > 0; -- i) {
-            Element* cur = *stack_->at(i - 1);
+        for (size_t i = queue->size(); i > 0; -- i) {
+            Element* cur = *queue->at(i - 1);
             if (cur == out) {
                 if (del) CSOUP_DELETE(allocator(), cur);
-                *stack_->at(i - 1) = in;
+                *queue->at(i - 1) = in;
             }
         }
     }
@@ -518,75 +450,77 @@ namespace csoup {
     void HtmlTreeBuilder::resetInsertionMode() {
         bool last = false;
         for (size_t i = stack_->size(); i > 0; -- i) {
-            Element* node = *stack_->at(i);
+            Element* node = stack_->at(i - 1);
             if (i - 1 == 0) {
                 last = true;
                 node = contextElement_;
             }
             
-            StringRef name(node->tagName());
-            if (name.equals("select")) {
-                transition(InSelect::instance());
-                break;
-                
+            switch (node->tagId()) {
+                case CSOUP_TAG_SELECT:
+                    transition(InSelect::instance());
+                    return;
+                    
                 ////////////////////////
                 // There is a bug!
-            } else if (name.equals("td") || (name.equals("td") && !last)) {
-                transition(InCell::instance());
-                break;
-            } else if (name.equals("tr")) {
-                transition(InRow::instance());
-                break;
-            } else if (name.equals("tbody") || name.equals("thead") || name.equals("tfoot")) {
-                transition(InTableBody::instance());
-                break;
-            } else if (name.equals("caption")) {
-                transition(InCaption::instance());
-                break;
-            } else if (name.equals("colgroup")) {
-                transition(InColumnGroup::instance());
-                break;
-            } else if (name.equals("table")) {
-                transition(InTable::instance());
-                break;
-            } else if (name.equals("head")) {
-                transition(InBody::instance());
-                break;
-            } else if (name.equals("body")) {
-                transition(InBody::instance());
-                break;
-            } else if (name.equals("frameset")) {
-                transition(InFrameset::instance());
-                break;
-            } else if (name.equals("html")) {
-                transition(BeforeHead::instance());
-                break;
-            } else if (last) {
+                case CSOUP_TAG_TD:
+                    transition(InCell::instance());
+                    return;
+                case CSOUP_TAG_TR:
+                    transition(InRow::instance());
+                    return;
+                case CSOUP_TAG_TBODY:
+                case CSOUP_TAG_THEAD:
+                case CSOUP_TAG_TFOOT:
+                    transition(InTableBody::instance());
+                    return;
+                case CSOUP_TAG_CAPTION:
+                    transition(InCaption::instance());
+                    return;
+                case CSOUP_TAG_COLGROUP:
+                    transition(InColumnGroup::instance());
+                    return;
+                case CSOUP_TAG_TABLE:
+                    transition(InTable::instance());
+                    return;
+                case CSOUP_TAG_HEAD:
+                case CSOUP_TAG_BODY:
+                    transition(InBody::instance());
+                    return;
+                case CSOUP_TAG_FRAMESET:
+                    transition(InFrameset::instance());
+                    return;
+                case CSOUP_TAG_HTML:
+                    transition(BeforeHead::instance());
+                    return;
+                default:
+                    break;
+            }
+            
+            if (last) {
                 transition(InBody::instance());
-                break;
+                return;
             }
         }
     }
     
-    bool HtmlTreeBuilder::inSpecificScope(const csoup::StringRef &targetName, const csoup::StringRef *baseTypes, size_t baseTypeLen, const csoup::StringRef *extraTypes, size_t extraTypeLen) {
-        StringRef targetNames[] = {targetName};
-        return inSpecificScope(targetNames, 1, baseTypes, baseTypeLen, extraTypes, extraTypeLen);
-    }
-    
-    bool HtmlTreeBuilder::inSpecificScope(const StringRef* targetName, size_t targetNameLen, const StringRef *baseTypes, size_t baseTypeLen, const StringRef *extraTypes, size_t extraTypeLen) {
+    bool HtmlTreeBuilder::inSpecificScope(const TagIdEnum* targets, size_t len, unsigned boundaries) {
+        // nothing to look for unless one of the targets is open
+        bool open = false;
+        for (size_t t = 0; t < len && !open; ++ t) {
+            CSOUP_ASSERT(targets[t] != CSOUP_TAG_UNKNOWN);
+            open = stack_->count(targets[t]) != 0;
+        }
+        if (!open) return false;
+        
         for (size_t i = stack_->size(); i > 0; -- i) {
-            Element* el = *stack_->at(i - 1);
-            StringRef elName = el->tagName();
+            const Tag* tag = stack_->at(i - 1)->tag();
             
-            if (StringUtil::in(elName, targetName, targetNameLen)) {
-                return true;
-            }
-            
-            if (StringUtil::in(elName, baseTypes, baseTypeLen)) {
-                return false;
+            for (size_t t = 0; t < len; ++ t) {
+                if (tag->id() == targets[t]) return true;
             }
             
-            if (extraTypes != NULL && extraTypeLen != 0 && StringUtil::in(elName, extraTypes, extraTypeLen)) {
+            if ((tag->flags() & boundaries) != 0) {
                 return false;
             }
         }
@@ -595,37 +529,35 @@ namespace csoup {
         return false;
     }
     
-    bool HtmlTreeBuilder::inScope(const csoup::StringRef &targetName) {
-        return inScope(targetName, NULL, 0);
+    bool HtmlTreeBuilder::inScope(TagIdEnum target) {
+        return inSpecificScope(&target, 1, CSOUP_TAG_FLAG_SCOPE);
     }
     
-    bool HtmlTreeBuilder::inScope(const csoup::StringRef &targetName, const csoup::StringRef *extras, size_t len) {
-        return inSpecificScope(targetName, TagsSearchInScope, arrayLength(TagsSearchInScope), extras, len);
+    bool HtmlTreeBuilder::inScope(const TagIdEnum* targets, size_t len) {
+        return inSpecificScope(targets, len, CSOUP_TAG_FLAG_SCOPE);
     }
     
-    bool HtmlTreeBuilder::inScope(const csoup::StringRef *targetNames, size_t len) {
-        return inSpecificScope(targetNames, len, TagsSearchInScope, arrayLength(TagsSearchInScope), NULL, 0);
+    bool HtmlTreeBuilder::inListItemScope(TagIdEnum target) {
+        return inSpecificScope(&target, 1, CSOUP_TAG_FLAG_SCOPE | CSOUP_TAG_FLAG_LIST_SCOPE);
     }
     
-    bool HtmlTreeBuilder::inListItemScope(const csoup::StringRef &targetName) {
-        return inScope(targetName, TagSearchList, arrayLength(TagSearchList));
+    bool HtmlTreeBuilder::inButtonScope(TagIdEnum target) {
+        return inSpecificScope(&target, 1, CSOUP_TAG_FLAG_SCOPE | CSOUP_TAG_FLAG_BUTTON_SCOPE);
     }
     
-    bool HtmlTreeBuilder::inButtonScope(const csoup::StringRef &targetName) {
-        return inScope(targetName, TagSearchButton, arrayLength(TagSearchButton));
+    bool HtmlTreeBuilder::inTableScope(TagIdEnum target) {
+        return inSpecificScope(&target, 1, CSOUP_TAG_FLAG_TABLE_SCOPE);
     }
     
-    bool HtmlTreeBuilder::inTableScope(const csoup::StringRef &targetName) {
-        return inSpecificScope(targetName, TagSearchTableScope, arrayLength(TagSearchTableScope), NULL, 0);
-    }
-    
-    bool HtmlTreeBuilder::inSelectScope(const csoup::StringRef &targetName) {
+    bool HtmlTreeBuilder::inSelectScope(TagIdEnum target) {
+        CSOUP_ASSERT(target != CSOUP_TAG_UNKNOWN);
+        if (stack_->count(target) == 0) return false;
+        
         for (size_t i = stack_->size(); i > 0; -- i) {
-            Element* el = *stack_->at(i);
-            StringRef elName = el->tagName();
+            const Tag* tag = stack_->at(i - 1)->tag();
             
-            if (elName.equals(targetName)) return true;
-            if (!StringUtil::in(elName, TagSearchSelectScope, arrayLength(TagSearchSelectScope))) {
+            if (tag->id() == target) return true;
+            if ((tag->flags() & CSOUP_TAG_FLAG_SELECT_SCOPE) == 0) {
                 return false;
             }
         }
@@ -668,7 +600,7 @@ namespace csoup {
     
     void HtmlTreeBuilder::generateImpliedEndTags(const csoup::StringRef &excludeTag, bool del) {
         while ((excludeTag.size() != 0 && !currentElement()->tagName().equals(excludeTag)) &&
-               StringUtil::in(currentElement()->tagName(), TagSearchEndTags, arrayLength(TagSearchEndTags))) {
+               (currentElement()->tag()->flags() & CSOUP_TAG_FLAG_IMPLIED_END) != 0) {
             if (del) CSOUP_DELETE(allocator(), pop());
             else pop();
         }
@@ -679,7 +611,7 @@ namespace csoup {
     }
     
     bool HtmlTreeBuilder::isSpecial(const csoup::Element *el) {
-        return StringUtil::in(el->tagName(), TagSearchSpecial, arrayLength(TagSearchSpecial));
+        return (el->tag()->flags() & CSOUP_TAG_FLAG_SPECIAL) != 0;
     }
     
     void HtmlTreeBuilder::pushActiveFormattingElements(csoup::Element *in, bool del) {
@@ -703,7 +635,15 @@ namespace csoup {
     }
     
     bool HtmlTreeBuilder::isSameFormattingElement(csoup::Element *a, csoup::Element *b) {
-        return a->tagName().equals(b->tagName()) && a->attributes()->equals(*b->attributes());
+        if (!a->tagName().equals(b->tagName())) return false;
+        
+        // elements without attributes have none allocated
+        const Attributes* attrsOfA = a->attributes();
+        const Attributes* attrsOfB = b->attributes();
+        size_t sizeOfA = attrsOfA ? attrsOfA->size() : 0;
+        size_t sizeOfB = attrsOfB ? attrsOfB->size() : 0;
+        if (sizeOfA == 0 || sizeOfB == 0) return sizeOfA == sizeOfB;
+        return attrsOfA->equals(*attrsOfB);
     }
     
     void HtmlTreeBuilder::reconstructFormattingElements(bool del) {
@@ -736,7 +676,7 @@ namespace csoup {
             Element* newEl = insert(entry->tagName());
             
             const Attributes* attrs = entry->attributes();
-            for (size_t i = 0; i < attrs->size(); ++ i) {
+            for (size_t i = 0; attrs != NULL && i < attrs->size(); ++ i) {
                 newEl->addAttribute(attrs->get(i)->key(), attrs->get(i)->value());
             }
             
@@ -796,7 +736,7 @@ namespace csoup {
     
     void HtmlTreeBuilder::insertInFosterParent(csoup::Node *in) {
         Element* fosterParent = NULL;
-        Element* lastTable = getFromStack("table");
+        Element* lastTable = getFromStack(CSOUP_TAG_TABLE);
         bool isLastTableParent = false;
         if (lastTable != NULL) {
             if (lastTable->parentNode() != NULL) {
@@ -806,7 +746,7 @@ namespace csoup {
                 fosterParent = aboveOnStack(lastTable);
             }
         } else {
-            fosterParent = *stack_->at(0);
+            fosterParent = stack_->at(0);
         }
         
         if (isLastTableParent) {
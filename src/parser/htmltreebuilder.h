@@ -11,6 +11,7 @@
 
 #include "treebuilder.h"
 #include "../util/stringref.h"
+#include "../nodes/tagid.h"
 
 // TODO:
 //      1. Methods about creating/inserting/removing nodes should be modified to be
@@ -24,6 +25,7 @@ namespace csoup {
     class Allocator;
     class StartTagToken;
     class Tag;
+    struct TagSet;
     class Node;
     class TagToken;
     class StartTagToken;
@@ -51,6 +53,8 @@ namespace csoup {
         
         Document* parse(const StringRef& input, const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator);
         
+        void beginParse(const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator);
+        
         // Usesr should mever invoke this
         internal::Vector<Node>* parseFragment(const StringRef& inputFragment, Element* context, const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator);
         
@@ -92,7 +96,11 @@ namespace csoup {
             return fragmentParsing_;
         }
         
+#if CSOUP_PARSE_ERRORS
         void error(HtmlTreeBuilderState* state);
+#else
+        void error(HtmlTreeBuilderState*) {}
+#endif
         Element* insert(StartTagToken* startTag);
         
         Element* insert(const StringRef& startTagName);
@@ -116,21 +124,20 @@ namespace csoup {
         
         bool onStack(Element* el);
         
-        Element* getFromStack(const StringRef& elName);
+        // the topmost open element of the known tag id, or NULL
+        Element* getFromStack(TagIdEnum id);
         
         bool removeFromStack(Element* el, bool del);
         
-        void popStackToClose(bool del, const StringRef& s1);
-        void popStackToClose(bool del, const StringRef& s1, const StringRef& s2);
-        void popStackToClose(bool del, const StringRef& s1, const StringRef& s2, const StringRef& s3);
-        void popStackToClose(bool del, const StringRef& s1, const StringRef& s2, const StringRef& s3, const StringRef& s4);
-        void popStackToClose(bool del, const StringRef& s1, const StringRef& s2, const StringRef& s3, const StringRef& s4,
-                             const StringRef& s5);
-        void popStackToClose(bool del, const StringRef& s1, const StringRef& s2, const StringRef& s3, const StringRef& s4,
-                             const StringRef& s5, const StringRef& s6);
-        void popStackToClose(bool del, const StringRef* elName, size_t cnt);
+        // Pops the topmost element of one of the tags and everything above it, or the
+        // whole stack if none is open, in one truncate. Each is deleted too if del.
+        void popStackToClose(bool del, TagIdEnum id);
+        void popStackToClose(bool del, const TagIdEnum* ids, size_t cnt);
+        
+        // the same for a name Tag may not know
+        void popStackToClose(bool del, const StringRef& elName);
         
-        void popStackToBefore(bool del, const StringRef& elName);
+        void popStackToBefore(bool del, TagIdEnum id);
         
         void clearStackToTableContext(bool del);
         
@@ -148,19 +155,19 @@ namespace csoup {
         
         void resetInsertionMode();
         
-        bool inScope(const StringRef* targetNames, size_t len);
-        
-        bool inScope(const StringRef& targetName);
+        // Whether an open element of a known tag is in scope. The stack isn't looked
+        // at unless one is open, see internal::OpenElementStack::count().
+        bool inScope(const TagIdEnum* targets, size_t len);
         
-        bool inScope(const StringRef& targetName, const StringRef* extras, size_t len);
+        bool inScope(TagIdEnum target);
         
-        bool inListItemScope(const StringRef& targetName);
+        bool inListItemScope(TagIdEnum target);
         
-        bool inButtonScope(const StringRef& targetName);
+        bool inButtonScope(TagIdEnum target);
         
-        bool inTableScope(const StringRef& targetName);
+        bool inTableScope(TagIdEnum target);
         
-        bool inSelectScope(const StringRef& targetName);
+        bool inSelectScope(TagIdEnum target);
         
         void setHeadElement(Element* headElement, bool del);
         
@@ -173,7 +180,7 @@ namespace csoup {
         }
         
         void setFosterInserts(bool fosterInserts) {
-            fosterInserts = fosterInserts;
+            fosterInserts_ = fosterInserts;
         }
         
         FormElement* formElement() {
@@ -221,39 +228,29 @@ namespace csoup {
         }
         
     private:
+        void resetBuilderState();
+        
         void clearPendingTableCharacters();
         
+        Element* newElement(StartTagToken* startTag);
         void insertNode(Node* node);
         bool isElementInQueue(internal::Vector<Element*>* queue, Element* element);
         void replaceInQueue(internal::Vector<Element>* queue, Element* out, Element* in);
         bool isSameFormattingElement(Element* a, Element* b);
 
-        void clearStackToContext(bool del, const StringRef& n1);
-        void clearStackToContext(bool del, const StringRef& n1, const StringRef& n2);
-        void clearStackToContext(bool del, const StringRef& n1, const StringRef& n2, const StringRef& n3);
-        void clearStackToContext(bool del, const StringRef& n1, const StringRef& n2, const StringRef& n3, const StringRef& n4);
-        void clearStackToContext(bool del, const StringRef& n1, const StringRef& n2, const StringRef& n3, const StringRef& n4,
-                                 const StringRef& n5);
-        void clearStackToContext(bool del, const StringRef* n1, size_t cnt);
-        
-        bool inSpecificScope(const StringRef* targetName, size_t targetNameLen, const StringRef* baseTypes, size_t baseTypeLen,
-                            const StringRef* extraTypes, size_t extraTypeLen);
-        
-        bool inSpecificScope(const StringRef& targetName, const StringRef* baseTypes, size_t baseTypeLen,
-                             const StringRef* extraTypes, size_t extraTypeLen);
-
+        // pops everything above the topmost element of one of ids
+        void clearStackToContext(bool del, const TagIdEnum* ids, size_t cnt);
+        
+        // pops everything above the first size elements, deleting them if del
+        void truncateStack(size_t size, bool del);
         
-//        bool inSpecificScope(const StringRef& targetNames, StringRef* baseTypes, size_t baseTypeLen,
-//                             StringRef* extraTypes, size_t extraTypeLen);
+        // boundaries are the TagFlagEnum categories that end the search
+        bool inSpecificScope(const TagIdEnum* targets, size_t len, unsigned boundaries);
 
-        static const StringRef TagsScriptStyle[];
-        static const StringRef TagsSearchInScope[];
-        static const StringRef TagSearchList[];
-        static const StringRef TagSearchButton[];
-        static const StringRef TagSearchTableScope[];
-        static const StringRef TagSearchSelectScope[];
-        static const StringRef TagSearchEndTags[];
-        static const StringRef TagSearchSpecial[];
+        // defined in tagsets.h
+        static const TagSet TagsScriptStyle;
+        static const TagSet TagsRcdata;
+        static const TagSet TagsRawText;
         
         // Never try to release two guys below. They refered to
         // static members
@@ -15,46 +15,15 @@
 #include "tokeniser.h"
 #include "../nodes/formelement.h"
 #include "../internal/list.h"
+#include "openelementstack.h"
+#include "tagsets.h"
 
 namespace csoup {
-    const StringRef HtmlTreeBuilderState::Constants::InBodyStartToHead[]
-            = {"base", "basefont", "bgsound", "command", "link", "meta","noframes", "script", "style", "title"};
-    const StringRef HtmlTreeBuilderState::Constants::InBodyStartPClosers[]
-            = {"address", "article", "aside", "blockquote", "center", "details", "dir", "div", "dl","fieldset",
-                "figcaption", "figure", "footer", "header", "hgroup", "menu", "nav", "ol","p", "section",
-                "summary", "ul"};
-    const StringRef HtmlTreeBuilderState::Constants::Headings[]
-            = {"h1", "h2", "h3", "h4", "h5", "h6"};
-    const StringRef HtmlTreeBuilderState::Constants::InBodyStartPreListing[]
-            = {"pre", "listing"};
-    const StringRef HtmlTreeBuilderState::Constants::InBodyStartLiBreakers[]
-            = {"address", "div", "p"};
-    const StringRef HtmlTreeBuilderState::Constants::DdDt[]
-            = {"dd", "dt"};
-    const StringRef HtmlTreeBuilderState::Constants::Formatters[]
-            = {"b", "big", "code", "em", "font", "i", "s", "small", "strike", "strong", "tt", "u"};
-    const StringRef HtmlTreeBuilderState::Constants::InBodyStartApplets[]
-            = {"applet", "marquee", "object"};
-    const StringRef HtmlTreeBuilderState::Constants::InBodyStartEmptyFormatters[]
-            = {"area", "br", "embed", "img", "keygen", "wbr"};
-    const StringRef HtmlTreeBuilderState::Constants::InBodyStartMedia[]
-            = {"param", "source", "track"};
     const StringRef HtmlTreeBuilderState::Constants::InBodyStartInputAttribs[]
             = {"name", "action", "prompt"};
-    const StringRef HtmlTreeBuilderState::Constants::InBodyStartOptions[]
-            = {"optgroup", "option"};
-    const StringRef HtmlTreeBuilderState::Constants::InBodyStartRuby[]
-            = {"rp", "rt"};
-    const StringRef HtmlTreeBuilderState::Constants::InBodyStartDrop[]
-            = {"caption", "col", "colgroup", "frame", "head", "tbody", "td", "tfoot", "th", "thead", "tr"};
-    const StringRef HtmlTreeBuilderState::Constants::InBodyEndClosers[]
-            = {"address", "article", "aside", "blockquote", "button", "center", "details", "dir", "div",
-                "dl", "fieldset", "figcaption", "figure", "footer", "header", "hgroup", "listing", "menu",
-                "nav", "ol", "pre", "section", "summary", "ul"};
-    const StringRef HtmlTreeBuilderState::Constants::InBodyEndAdoptionFormatters[]
-            = {"a", "b", "big", "code", "em", "font", "i", "nobr", "s", "small", "strike", "strong", "tt", "u"};
-    const StringRef HtmlTreeBuilderState::Constants::InBodyEndTableFosters[]
-            = {"table", "tbody", "tfoot", "thead", "tr"};
+    
+    // Constants::Headings by id, for the stack methods of HtmlTreeBuilder
+    static const TagIdEnum HeadingIds[] = {CSOUP_TAG_H1, CSOUP_TAG_H2, CSOUP_TAG_H3, CSOUP_TAG_H4, CSOUP_TAG_H5, CSOUP_TAG_H6};
     
     HtmlTreeBuilderState::TokenDeleter::~TokenDeleter() {
         CSOUP_DELETE(allocator_, token_);
@@ -67,9 +36,7 @@ namespace csoup {
             StringRef data = ((CharacterToken*)t)->data();
             for (size_t i = 0; i < data.size(); ++ i) {
                 if (!StringUtil::isWhitespace(data.at(i))) {
-                    // In UTF-8, this should be only 1 byte;
-                    
-                    CSOUP_ASSERT(data.size() == 1);
+                    // the tokeniser emits runs of characters, not single ones
                     return false;
                 }
             }
@@ -81,10 +48,16 @@ namespace csoup {
     
     void HtmlTreeBuilderState::handleRawtext(StartTagToken *startTag, HtmlTreeBuilder *tb) {
         tb->insert(startTag);
+        tb->setTokeniserState(internal::RawText::instance());
+        tb->markInsertionMode();
+        tb->transition(Text::instance());
     }
     
     void HtmlTreeBuilderState::handleRcData(csoup::StartTagToken *startTag, csoup::HtmlTreeBuilder *tb) {
-        
+        tb->insert(startTag);
+        tb->setTokeniserState(internal::Rcdata::instance());
+        tb->markInsertionMode();
+        tb->transition(Text::instance());
     }
     
     bool HtmlTreeBuilderState::processExtraToken(csoup::Token *token, csoup::HtmlTreeBuilder *tb) {
@@ -117,6 +90,25 @@ namespace csoup {
         return ret;
     }
     
+    bool HtmlTreeBuilderState::isHeadBodyHtmlBr(TagIdEnum id) {
+        switch (id) {
+            case CSOUP_TAG_HEAD: case CSOUP_TAG_BODY: case CSOUP_TAG_HTML: case CSOUP_TAG_BR:
+                return true;
+            default:
+                return false;
+        }
+    }
+    
+    bool HtmlTreeBuilderState::isTablePart(TagIdEnum id) {
+        switch (id) {
+            case CSOUP_TAG_COL: case CSOUP_TAG_COLGROUP: case CSOUP_TAG_TBODY: case CSOUP_TAG_TD:
+            case CSOUP_TAG_TFOOT: case CSOUP_TAG_TH: case CSOUP_TAG_THEAD: case CSOUP_TAG_TR:
+                return true;
+            default:
+                return false;
+        }
+    }
+    
     bool Initial::process(Token* t, HtmlTreeBuilder* tb) {
         //TokenDeleter tokenDeleter(t, tb->allocator());
         
@@ -154,10 +146,10 @@ namespace csoup {
             tb->insert(t->asCommentToken());
         } else if (isWhitespace(t)) {
             return true; // ignore whitespace
-        } else if (t->isStartTagToken() && t->asStartTagToken()->tagName().equals("html")) {
+        } else if (t->isStartTagToken() && t->asStartTagToken()->tagId() == CSOUP_TAG_HTML) {
             tb->insert(t->asStartTagToken());
             tb->transition(BeforeHead::instance());
-        } else if (t->isEndTagToken() && (StringUtil::in(t->asEndTagToken()->tagName(), "head", "body", "html", "br"))) {
+        } else if (t->isEndTagToken() && isHeadBodyHtmlBr(t->asEndTagToken()->tagId())) {
             tb->insert("html");
             tb->transition(BeforeHead::instance());
             return tb->process(t);
@@ -183,13 +175,13 @@ namespace csoup {
         } else if (t->isDoctypeToken()) {
             tb->error(this);
             return false;
-        } else if (t->isStartTagToken() && t->asStartTagToken()->tagName().equals("html")) {
+        } else if (t->isStartTagToken() && t->asStartTagToken()->tagId() == CSOUP_TAG_HTML) {
             return InBody::instance()->process(t, tb); // does not transition
-        } else if (t->isStartTagToken() && t->asStartTagToken()->tagName().equals("head")) {
+        } else if (t->isStartTagToken() && t->asStartTagToken()->tagId() == CSOUP_TAG_HEAD) {
             Element* head = tb->insert(t->asStartTagToken());
             tb->setHeadElement(head, false);
             tb->transition(InHead::instance());
-        } else if (t->isEndTagToken() && (StringUtil::in(t->asEndTagToken()->tagName(), "head", "body", "html", "br"))) {
+        } else if (t->isEndTagToken() && isHeadBodyHtmlBr(t->asEndTagToken()->tagId())) {
             processExtraStartTagToken("head", tb);
             return tb->process(t);
         } else if (t->isEndTagToken()) {
@@ -204,7 +196,7 @@ namespace csoup {
     
 #define INHEAD_STATE_ANYTHINGELSE \
     do { \
-        processExtraStartTagToken("head", tb); \
+        processExtraEndTagToken("head", tb); \
         return tb->process(t); \
     } while(false)
 
@@ -224,51 +216,59 @@ namespace csoup {
                return false;
            case CSOUP_TOKEN_START_TAG: {
                StartTagToken* start = t->asStartTagToken();
-               StringRef name = start->tagName();
-               if (name.equals("html")) {
-                   return InBody::instance()->process(t, tb);
-               } else if (StringUtil::in(name, "base", "basefont", "bgsound", "command", "link")) {
-                   Element* el = tb->insertEmpty(start);
-                   // jsoup special: update base the frist time it is seen
-                   if (name.equals("base") && el->hasAttribute("href"))
-                       tb->maybeSetBaseUri(el);
-               } else if (name.equals("meta")) {
-                   //Element* meta = tb->insertEmpty(start);
-                   // todo: charset switches
-               } else if (name.equals("title")) {
-                   handleRcData(start, tb);
-               } else if (StringUtil::in(name, "noframes", "style")) {
-                   handleRawtext(start, tb);
-               } else if (name.equals("noscript")) {
-                   // else if noscript && scripting flag = true: rawtext (jsoup doesn't run script, to handle as noscript)
-                   tb->insert(start);
-                   tb->transition(InHeadNoscript::instance());
-               } else if (name.equals("script")) {
-                   // skips some script rules as won't execute them
-                   
-                   tb->setTokeniserState(internal::ScriptData::instance());
-                   tb->markInsertionMode();
-                   tb->transition(Text::instance());
-                   tb->insert(start);
-               } else if (name.equals("head")) {
-                   tb->error(this);
-                   return false;
-               } else {
-                   INHEAD_STATE_ANYTHINGELSE;
+               switch (start->tagId()) {
+                   case CSOUP_TAG_HTML:
+                       return InBody::instance()->process(t, tb);
+                   case CSOUP_TAG_BASE: case CSOUP_TAG_BASEFONT: case CSOUP_TAG_BGSOUND:
+                   case CSOUP_TAG_COMMAND: case CSOUP_TAG_LINK: {
+                       Element* el = tb->insertEmpty(start);
+                       // jsoup special: update base the frist time it is seen
+                       if (start->tagId() == CSOUP_TAG_BASE && el->hasAttribute("href"))
+                           tb->maybeSetBaseUri(el);
+                       break;
+                   }
+                   case CSOUP_TAG_META:
+                       //Element* meta = tb->insertEmpty(start);
+                       // todo: charset switches
+                       break;
+                   case CSOUP_TAG_TITLE:
+                       handleRcData(start, tb);
+                       break;
+                   case CSOUP_TAG_NOFRAMES: case CSOUP_TAG_STYLE:
+                       handleRawtext(start, tb);
+                       break;
+                   case CSOUP_TAG_NOSCRIPT:
+                       // else if noscript && scripting flag = true: rawtext (jsoup doesn't run script, to handle as noscript)
+                       tb->insert(start);
+                       tb->transition(InHeadNoscript::instance());
+                       break;
+                   case CSOUP_TAG_SCRIPT:
+                       // skips some script rules as won't execute them
+                       
+                       tb->setTokeniserState(internal::ScriptData::instance());
+                       tb->markInsertionMode();
+                       tb->transition(Text::instance());
+                       tb->insert(start);
+                       break;
+                   case CSOUP_TAG_HEAD:
+                       tb->error(this);
+                       return false;
+                   default:
+                       INHEAD_STATE_ANYTHINGELSE;
                }
                break;
            }
            case CSOUP_TOKEN_END_TAG: {
-               EndTagToken* end = t->asEndTagToken();
-               StringRef name = end->tagName();
-               if (name.equals("head")) {
-                   tb->pop();
-                   tb->transition(AfterHead::instance());
-               } else if (StringUtil::in(name, "body", "html", "br")) {
-                   INHEAD_STATE_ANYTHINGELSE;
-               } else {
-                   tb->error(this);
-                   return false;
+               switch (t->asEndTagToken()->tagId()) {
+                   case CSOUP_TAG_HEAD:
+                       tb->pop();
+                       tb->transition(AfterHead::instance());
+                       break;
+                   case CSOUP_TAG_BODY: case CSOUP_TAG_HTML: case CSOUP_TAG_BR:
+                       INHEAD_STATE_ANYTHINGELSE;
+                   default:
+                       tb->error(this);
+                       return false;
                }
                break;
            }
@@ -288,23 +288,34 @@ do { \
     return tb->process(t); \
 } while(false)
 
+    bool InHeadNoscript::isNoscriptHeadTag(TagIdEnum id) {
+        switch (id) {
+            case CSOUP_TAG_BASEFONT: case CSOUP_TAG_BGSOUND: case CSOUP_TAG_LINK: case CSOUP_TAG_META:
+            case CSOUP_TAG_NOFRAMES: case CSOUP_TAG_STYLE:
+                return true;
+            default:
+                return false;
+        }
+    }
+    
     bool InHeadNoscript::process(Token* t, HtmlTreeBuilder* tb) {
        //TokenDeleter tokenDeleter(t, tb->allocator());
        
        if (t->isDoctypeToken()) {
            tb->error(this);
-       } else if (t->isStartTagToken() && internal::strEquals(t->asStartTagToken()->tagName(),"html")) {
+       } else if (t->isStartTagToken() && t->asStartTagToken()->tagId() == CSOUP_TAG_HTML) {
            return tb->process(t, InBody::instance());
-       } else if (t->isEndTagToken() && internal::strEquals(t->asEndTagToken()->tagName(),"noscript")) {
+       } else if (t->isEndTagToken() && t->asEndTagToken()->tagId() == CSOUP_TAG_NOSCRIPT) {
            tb->pop();
            tb->transition(InHead::instance());
        } else if (isWhitespace(t) || t->asCommentToken() ||
-                  (t->isStartTagToken() && StringUtil::in(t->asStartTagToken()->tagName(),
-                                                            "basefont", "bgsound", "link", "meta", "noframes", "style"))) {
+                  (t->isStartTagToken() && isNoscriptHeadTag(t->asStartTagToken()->tagId()))) {
            return tb->process(t, InHead::instance());
-       } else if (t->isEndTagToken() && internal::strEquals(t->asEndTagToken()->tagName(),"br")) {
+       } else if (t->isEndTagToken() && t->asEndTagToken()->tagId() == CSOUP_TAG_BR) {
            IHEADNOSCRIPT_ANYTHINGELSE;
-       } else if ((t->isStartTagToken() && StringUtil::in(t->asStartTagToken()->tagName(), "head", "noscript")) || t->isEndTagToken()) {
+       } else if ((t->isStartTagToken() && (t->asStartTagToken()->tagId() == CSOUP_TAG_HEAD ||
+                                            t->asStartTagToken()->tagId() == CSOUP_TAG_NOSCRIPT)) ||
+                  t->isEndTagToken()) {
            tb->error(this);
            return false;
        } else {
@@ -326,19 +337,18 @@ do { \
            tb->error(this);
        } else if (t->isStartTagToken()) {
            StartTagToken* startTag = t->asStartTagToken();
-           StringRef name = startTag->tagName();
-           static const StringRef tagsInHead[] = {"base", "basefont", "bgsound", "link", "meta", "noframes", "script", "style", "title"};
+           TagIdEnum id = startTag->tagId();
            
-           if (name.equals(StringRef("html"))) {
+           if (id == CSOUP_TAG_HTML) {
                return tb->process(t, InBody::instance());
-           } else if (name.equals("body")) {
+           } else if (id == CSOUP_TAG_BODY) {
                tb->insert(startTag);
                tb->setFramesetOk(false);
                tb->transition(InBody::instance());
-           } else if (name.equals("frameset")) {
+           } else if (id == CSOUP_TAG_FRAMESET) {
                tb->insert(startTag);
                tb->transition(InFrameset::instance());
-           } else if (StringUtil::in(name, tagsInHead, arrayLength(tagsInHead))) {
+           } else if (Constants::InBodyStartToHead.contains(id) && id != CSOUP_TAG_COMMAND) { // what InHead takes, bar command
                tb->error(this);
                
                // temporarily add it to top of the stack and process, then remove it
@@ -346,7 +356,7 @@ do { \
                tb->push(head);
                tb->process(t, InHead::instance());
                tb->removeFromStack(head, false);
-           } else if (name.equals("head")) {
+           } else if (id == CSOUP_TAG_HEAD) {
                tb->error(this);
                return false;
            } else {
@@ -355,7 +365,8 @@ do { \
                return tb->process(t);
            }
        } else if (t->isEndTagToken()) {
-           if (StringUtil::in(t->asEndTagToken()->tagName(), "body", "html")) {
+           TagIdEnum id = t->asEndTagToken()->tagId();
+           if (id == CSOUP_TAG_BODY || id == CSOUP_TAG_HTML) {
                processExtraStartTagToken("body", tb);
                tb->setFramesetOk(true);
                return tb->process(t);
@@ -374,17 +385,19 @@ do { \
     
     bool InBodyAnyOtherEndTag(HtmlTreeBuilderState* state, Token* t, HtmlTreeBuilder* tb) {
         StringRef name = t->asEndTagToken()->tagName();
-        internal::Vector<Element*>* stack = tb->stack();
-        internal::VectorIterator<Element*> it = stack->end();
-        while (it.hasPrevious()) {
-            it.previous();
-            
-            Element* node = *it.data();
-            if (node->tagName().equals(name)) {
+        TagIdEnum id = t->asEndTagToken()->tagId();
+        internal::OpenElementStack* stack = tb->stack();
+        for (size_t i = stack->size(); i > 0; -- i) {
+            Element* node = stack->at(i - 1);
+            // only names Tag doesn't know need comparing
+            if (id != CSOUP_TAG_UNKNOWN ? node->tagId() == id : node->tagName().equals(name)) {
                 tb->generateImpliedEndTags(name);
-                if (!name.equals(tb->currentElement()->tagName()))
+                if (id != CSOUP_TAG_UNKNOWN ? tb->currentElement()->tagId() != id : !name.equals(tb->currentElement()->tagName()))
                     tb->error(state);
-                tb->popStackToClose(false, name);
+                if (id != CSOUP_TAG_UNKNOWN)
+                    tb->popStackToClose(false, id);
+                else
+                    tb->popStackToClose(false, name);
                 break;
             } else {
                 if (tb->isSpecial(node)) {
@@ -396,6 +409,109 @@ do { \
         return true;
     }
 
+    bool InBody::adoptionAgency(Token* t, HtmlTreeBuilder* tb) {
+        StringRef name = t->asEndTagToken()->tagName();
+        // Adoption Agency Algorithm.
+    OUTER:
+        for (int i = 0; i < 8; i++) {
+            Element* formatEl = tb->getActiveFormattingElement(name);
+            if (formatEl == NULL)
+                return InBodyAnyOtherEndTag(this, t, tb);
+            else if (!tb->onStack(formatEl)) {
+                tb->error(this);
+                tb->removeFromActiveFormattingElements(formatEl, false);
+                return true;
+            } else if (!tb->inScope(formatEl->tagId())) {
+                tb->error(this);
+                return false;
+            } else if (tb->currentElement() != formatEl)
+                tb->error(this);
+
+            Element* furthestBlock = NULL;
+            Element* commonAncestor = NULL;
+            bool seenFormattingElement = false;
+            internal::OpenElementStack* stack = tb->stack();
+            // the spec doesn't limit to < 64, but in degenerate cases (9000+ stack depth) this prevents
+            // run-aways
+            const size_t stackSize = stack->size();
+            for (size_t si = 0; si < stackSize && si < 64; si++) {
+                Element* el = stack->at(si);
+                if (el == formatEl) {
+                    commonAncestor = stack->at(si - 1);
+                    seenFormattingElement = true;
+                } else if (seenFormattingElement && tb->isSpecial(el)) {
+                    furthestBlock = el;
+                    break;
+                }
+            }
+            if (furthestBlock == NULL) {
+                tb->popStackToClose(false, formatEl->tagId());
+                tb->removeFromActiveFormattingElements(formatEl, false);
+                return true;
+            }
+
+            // todo: Let a bookmark note the position of the formatting element in the list of active formatting elements relative to the elements on either side of it in the list.
+            // does that mean: int pos of format el in list?
+            Element* node = furthestBlock;
+            Element* lastNode = furthestBlock;
+        INNER:
+            for (int j = 0; j < 3; j++) {
+                if (tb->onStack(node))
+                    node = tb->aboveOnStack(node);
+                if (!tb->isInActiveFormattingElements(node)) { // note no bookmark check
+                    tb->removeFromStack(node,false);
+                    continue;
+                } else if (node == formatEl)
+                    break;
+
+                Element* replacement = CSOUP_NEW3(tb->document()->allocator(), Element, node->tag(), tb->baseUri(), tb->document()->allocator());
+                tb->replaceActiveFormattingElement(node, replacement, false);
+                tb->replaceOnStack(node, replacement, false);
+                node = replacement;
+
+                if (lastNode == furthestBlock) {
+                    // todo: move the aforementioned bookmark to be immediately after the new node in the list of active formatting elements.
+                    // not getting how this bookmark both straddles the element above, but is inbetween here...
+                }
+                if (lastNode->parentNode() != NULL) {
+                    // don't destroy it ! we;ll
+                    lastNode->removeFromParent(false);
+                }
+                node->appendNode(lastNode);
+                lastNode = node;
+            }
+
+            if (Constants::InBodyEndTableFosters.contains(commonAncestor->tagId())) {
+                if (lastNode->parentNode() != NULL)
+                    lastNode->removeFromParent(false);
+                tb->insertInFosterParent(lastNode);
+            } else {
+                if (lastNode->parentNode() != NULL)
+                    lastNode->removeFromParent(false);
+
+                commonAncestor->appendNode(lastNode);
+            }
+
+            Element* adopter = CSOUP_NEW3(tb->document()->allocator(), Element, formatEl->tag(), tb->baseUri(), tb->document()->allocator());
+            if (formatEl->attributes() != NULL)
+                adopter->addAttributes(*formatEl->attributes());
+
+            for (size_t i = furthestBlock->childNodeSize(); i > 0; -- i) {
+                Node* c = furthestBlock->childNode(i - 1);
+                c->removeFromParent(false);
+                // This is very slow
+                adopter->insertNode(0, c);
+            }
+
+            furthestBlock->appendNode(adopter);
+            tb->removeFromActiveFormattingElements(formatEl, false);
+            // todo: insert the new element into the list of active formatting elements at the position of the aforementioned bookmark.
+            tb->removeFromStack(formatEl, false);
+            tb->insertOnStackAfter(furthestBlock, adopter);
+        }
+        return true;
+    }
+    
     bool InBody::process(Token* t, HtmlTreeBuilder* tb) {
        //TokenDeleter tokenDeleter(t, tb->allocator());
        
@@ -426,520 +542,459 @@ do { \
            }
            case CSOUP_TOKEN_START_TAG: {
                StartTagToken* startTag = t->asStartTagToken();
-               StringRef name = startTag->tagName();
-               if (name.equals("html")) {
-                   tb->error(this);
-                   // merge attributes onto real html
-                   Element* html = *tb->stack()->front();
-                   Attributes* attrsOfStartTag = startTag->attributes();
-                   for (size_t i = 0; i < attrsOfStartTag->size(); ++ i) {
-                       const Attribute* attr = attrsOfStartTag->get(i);
-                       if (!html->hasAttribute(attr->key())) {
-                           html->addAttribute(attr->key(), attr->value());
-                       }
-                   }
-               } else if (StringUtil::in(name, Constants::InBodyStartToHead, arrayLength(Constants::InBodyStartToHead))) {
-                   return tb->process(t, InHead::instance());
-               } else if (name.equals("body")) {
-                   tb->error(this);
-                   internal::Vector<Element*>* stack = tb->stack();
-                   if (stack->size() == 1 || (stack->size() > 2 && !(*stack->at(1))->tagName().equals("body"))) {
-                       // only in fragment case
-                       return false; // ignore
-                   } else {
-                       tb->setFramesetOk(false);
-                       Element* body = *stack->at(1);
-                       
+               TagIdEnum id = startTag->tagId();
+               switch (id) {
+                   case CSOUP_TAG_HTML: {
+                       tb->error(this);
+                       // merge attributes onto real html
+                       Element* html = tb->stack()->bottom();
                        Attributes* attrsOfStartTag = startTag->attributes();
-                       for (size_t i = 0; i < attrsOfStartTag->size(); ++ i) {
+                       for (size_t i = 0; attrsOfStartTag != NULL && i < attrsOfStartTag->size(); ++ i) {
                            const Attribute* attr = attrsOfStartTag->get(i);
-                           if (!body->hasAttribute(attr->key())) {
-                               body->addAttribute(attr->key(), attr->value());
+                           if (!html->hasAttribute(attr->key())) {
+                               html->addAttribute(attr->key(), attr->value());
                            }
                        }
-                       
-//                       for (Attribute attribute : startTag.getAttributes()) {
-//                           if (!body.hasAttribute(attribute.getKey()))
-//                               body.attributes().put(attribute);
-//                       }
-                   }
-               } else if (name.equals("frameset")) {
-                   tb->error(this);
-                   internal::Vector<Element*>* stack = tb->stack();
-                   if (stack->size() == 1 || (stack->size() > 2 && !(*stack->at(1))->tagName().equals("body"))) {
-                       // only in fragment case
-                       return false; // ignore
-                   } else if (!tb->framesetOk()) {
-                       return false; // ignore frameset
-                   } else {
-                       Element* second = *stack->at(1);
-                       if (second->parentNode() != NULL) {
-                           second->removeFromParent(true);
-                       }
-                       // pop up to html element
-                       while (stack->size() > 1)
-                           stack->pop();
-                       tb->insert(startTag);
-                       tb->transition(InFrameset::instance());
-                   }
-               } else if (StringUtil::in(name, Constants::InBodyStartPClosers, arrayLength(Constants::InBodyEndAdoptionFormatters))) {
-                   if (tb->inButtonScope("p")) {
-                       processExtraEndTagToken("p", tb);
-                   }
-                   tb->insert(startTag);
-               } else if (StringUtil::in(name, Constants::Headings, arrayLength(Constants::Headings))) {
-                   if (tb->inButtonScope("p")) {
-                       processExtraEndTagToken("p", tb);
+                       break;
                    }
-                   if (StringUtil::in(tb->currentElement()->tagName(), Constants::Headings, arrayLength(Constants::Headings))) {
+                   case CSOUP_TAG_BODY: {
                        tb->error(this);
-                       tb->pop();
-                   }
-                   tb->insert(startTag);
-               } else if (StringUtil::in(name, Constants::InBodyStartPreListing, arrayLength(Constants::InBodyStartPreListing))) {
-                   if (tb->inButtonScope("p")) {
-                       processExtraEndTagToken("p", tb);
+                       internal::OpenElementStack* stack = tb->stack();
+                       if (stack->size() == 1 || (stack->size() > 2 && stack->at(1)->tagId() != CSOUP_TAG_BODY)) {
+                           // only in fragment case
+                           return false; // ignore
+                       } else {
+                           tb->setFramesetOk(false);
+                           Element* body = stack->at(1);
+
+                           Attributes* attrsOfStartTag = startTag->attributes();
+                           for (size_t i = 0; attrsOfStartTag != NULL && i < attrsOfStartTag->size(); ++ i) {
+                               const Attribute* attr = attrsOfStartTag->get(i);
+                               if (!body->hasAttribute(attr->key())) {
+                                   body->addAttribute(attr->key(), attr->value());
+                               }
+                           }
+                       }
+                       break;
                    }
-                   tb->insert(startTag);
-                   // todo: ignore LF if next token
-                   tb->setFramesetOk(false);
-               } else if (name.equals("form")) {
-                   if (tb->formElement() != NULL) {
+                   case CSOUP_TAG_FRAMESET: {
                        tb->error(this);
-                       return false;
-                   }
-                   
-                   if (tb->inButtonScope("p")) {
-                       processExtraEndTagToken("p", tb);
-                   }
-                   
-                   tb->insert(startTag);
-                   tb->insertForm(startTag, true);
-               } else if (name.equals("li")) {
-                   tb->setFramesetOk(false);
-                   internal::Vector<Element*>* stack = tb->stack();
-                   for (size_t i = stack->size(); i > 1; i--) {
-                       Element* el = *stack->at(i - 1);
-                       if (el->tagName().equals("li")) {
-                           processExtraEndTagToken("li", tb);
-                           break;
+                       internal::OpenElementStack* stack = tb->stack();
+                       if (stack->size() == 1 || (stack->size() > 2 && stack->at(1)->tagId() != CSOUP_TAG_BODY)) {
+                           // only in fragment case
+                           return false; // ignore
+                       } else if (!tb->framesetOk()) {
+                           return false; // ignore frameset
+                       } else {
+                           Element* second = stack->at(1);
+                           if (second->parentNode() != NULL) {
+                               second->removeFromParent(true);
+                           }
+                           // pop up to html element
+                           while (stack->size() > 1)
+                               tb->pop();
+                           tb->insert(startTag);
+                           tb->transition(InFrameset::instance());
                        }
-                       if (tb->isSpecial(el) && !StringUtil::in(el->tagName(), Constants::InBodyStartLiBreakers,
-                                                                arrayLength(Constants::InBodyStartLiBreakers)))
-                           break;
-                   }
-                   if (tb->inButtonScope("p")) {
-                       processExtraEndTagToken("p", tb);
+                       break;
                    }
-                   tb->insert(startTag);
-               } else if (StringUtil::in(name, Constants::DdDt, arrayLength(Constants::DdDt))) {
-                   tb->setFramesetOk(false);
-                   internal::Vector<Element*>* stack = tb->stack();
-                   for (size_t i = stack->size(); i > 1; i--) {
-                       Element* el = *stack->at(i - 1);
-                       if (StringUtil::in(el->tagName(), Constants::DdDt, arrayLength(Constants::DdDt))) {
-                           processExtraEndTagToken(el->tagName(), tb);
-                           
-                           break;
+                   case CSOUP_TAG_FORM:
+                       if (tb->formElement() != NULL) {
+                           tb->error(this);
+                           return false;
                        }
-                       if (tb->isSpecial(el) && !StringUtil::in(el->tagName(), Constants::InBodyStartLiBreakers,
-                                                                arrayLength(Constants::InBodyStartLiBreakers)))
-                           break;
+
+                       if (tb->inButtonScope(CSOUP_TAG_P)) {
+                           processExtraEndTagToken("p", tb);
+                       }
+
+                       tb->insert(startTag);
+                       tb->insertForm(startTag, true);
+                       break;
+                   case CSOUP_TAG_LI: {
+                       tb->setFramesetOk(false);
+                       internal::OpenElementStack* stack = tb->stack();
+                       for (size_t i = stack->size(); i > 1; i--) {
+                           Element* el = stack->at(i - 1);
+                           if (el->tagId() == CSOUP_TAG_LI) {
+                               processExtraEndTagToken("li", tb);
+                               break;
+                           }
+                           if (tb->isSpecial(el) && !Constants::InBodyStartLiBreakers.contains(el->tagId()))
+                               break;
+                       }
+                       if (tb->inButtonScope(CSOUP_TAG_P)) {
+                           processExtraEndTagToken("p", tb);
+                       }
+                       tb->insert(startTag);
+                       break;
                    }
-                   if (tb->inButtonScope("p")) {
-                       processExtraEndTagToken("p", tb);
+                   case CSOUP_TAG_DD: case CSOUP_TAG_DT: {
+                       tb->setFramesetOk(false);
+                       internal::OpenElementStack* stack = tb->stack();
+                       for (size_t i = stack->size(); i > 1; i--) {
+                           Element* el = stack->at(i - 1);
+                           if (Constants::DdDt.contains(el->tagId())) {
+                               processExtraEndTagToken(el->tagName(), tb);
+
+                               break;
+                           }
+                           if (tb->isSpecial(el) && !Constants::InBodyStartLiBreakers.contains(el->tagId()))
+                               break;
+                       }
+                       if (tb->inButtonScope(CSOUP_TAG_P)) {
+                           processExtraEndTagToken("p", tb);
+                       }
+                       tb->insert(startTag);
+                       break;
                    }
-                   tb->insert(startTag);
-               } else if (name.equals("plaintext")) {
-                   if (tb->inButtonScope("p")) {
-                       processExtraEndTagToken("p", tb);
+                   case CSOUP_TAG_PLAINTEXT:
+                       if (tb->inButtonScope(CSOUP_TAG_P)) {
+                           processExtraEndTagToken("p", tb);
+                       }
+                       tb->insert(startTag);
+                       tb->setTokeniserState(internal::PlainText::instance()); // once in, never gets out
+                       break;
+                   case CSOUP_TAG_BUTTON:
+                       if (tb->inButtonScope(CSOUP_TAG_BUTTON)) {
+                           // close and reprocess
+                           tb->error(this);
+                           processExtraEndTagToken("button", tb);
+
+                           tb->process(startTag);
+                       } else {
+                           tb->reconstructFormattingElements(false);
+                           tb->insert(startTag);
+                           tb->setFramesetOk(false);
+                       }
+                       break;
+                   case CSOUP_TAG_A: {
+                       if (tb->getActiveFormattingElement("a") != NULL) {
+                           tb->error(this);
+
+                           processExtraEndTagToken("a", tb);
+
+                           // still on stack?
+                           Element* remainingA = tb->getFromStack(CSOUP_TAG_A);
+                           if (remainingA != NULL) {
+                               tb->removeFromActiveFormattingElements(remainingA, false);
+                               tb->removeFromStack(remainingA, false);
+                           }
+                       }
+                       tb->reconstructFormattingElements(false);
+                       Element* a = tb->insert(startTag);
+                       tb->pushActiveFormattingElements(a, false);
+                       break;
                    }
-                   tb->insert(startTag);
-                   tb->setTokeniserState(internal::PlainText::instance()); // once in, never gets out
-               } else if (name.equals("button")) {
-                   if (tb->inButtonScope("button")) {
-                       // close and reprocess
-                       tb->error(this);
-                       processExtraEndTagToken("button", tb);
-                       
-                       tb->process(startTag);
-                   } else {
+                   case CSOUP_TAG_NOBR: {
                        tb->reconstructFormattingElements(false);
+                       if (tb->inScope(CSOUP_TAG_NOBR)) {
+                           tb->error(this);
+
+                           processExtraEndTagToken("nobr", tb);
+
+                           tb->reconstructFormattingElements(false);
+                       }
+                       Element* el = tb->insert(startTag);
+                       tb->pushActiveFormattingElements(el, false);
+                       break;
+                   }
+                   case CSOUP_TAG_TABLE:
+                       if (tb->document()->quirksMode() != CSOUP_DOCTYPE_QUIRKS && tb->inButtonScope(CSOUP_TAG_P)) {
+                           processExtraEndTagToken("p", tb);
+                       }
                        tb->insert(startTag);
                        tb->setFramesetOk(false);
+                       tb->transition(InTable::instance());
+                       break;
+                   case CSOUP_TAG_INPUT: {
+                       tb->reconstructFormattingElements(false);
+                       Element* el = tb->insertEmpty(startTag);
+                       if (!el->attr("type").equalsIgnoreCase("hidden"))
+                           tb->setFramesetOk(false);
+                       break;
                    }
-               } else if (name.equals("a")) {
-                   if (tb->getActiveFormattingElement("a") != NULL) {
+                   case CSOUP_TAG_HR:
+                       if (tb->inButtonScope(CSOUP_TAG_P)) {
+                           processExtraEndTagToken("p", tb);
+                       }
+                       tb->insertEmpty(startTag);
+                       tb->setFramesetOk(false);
+                       break;
+                   case CSOUP_TAG_IMAGE:
+                       if (tb->getFromStack(CSOUP_TAG_SVG) == NULL) {
+                           startTag->setTagName("img");
+                           return tb->process(startTag); // change <image> to <img>, unless in svg
+                       } else
+                           tb->insert(startTag);
+                       break;
+                   case CSOUP_TAG_ISINDEX: {
+                       // how much do we care about the early 90s?
                        tb->error(this);
-                       
-                       processExtraEndTagToken("a", tb);
-                       
-                       // still on stack?
-                       Element* remainingA = tb->getFromStack("a");
-                       if (remainingA != NULL) {
-                           tb->removeFromActiveFormattingElements(remainingA, false);
-                           tb->removeFromStack(remainingA, false);
+                       if (tb->formElement() != NULL)
+                           return false;
+
+                       tb->tokeniser()->setAcknowledgeSelfClosingFlag();
+                       processExtraStartTagToken("form", tb);
+                       if (startTag->hasAttribute("action")) {
+                           Element* form = tb->formElement();
+                           form->addAttribute("action", startTag->attribute("action"));
                        }
+
+                       processExtraStartTagToken("hr", tb);
+                       processExtraStartTagToken("label", tb);
+                       // hope you like english.
+                       StringRef prompt = startTag->hasAttribute("prompt") ?
+                                        startTag->attribute("prompt") :
+                                        "This is a searchable index. Enter search keywords: ";
+
+                       processExtraCharToken(prompt, tb);
+
+                       // input
+                       Attributes inputAttribs(tb->allocator());
+                       Attributes* attrsOfStartTag = startTag->attributes();
+                       for (size_t i = 0; attrsOfStartTag != NULL && i < attrsOfStartTag->size(); ++ i) {
+                           const Attribute* attr = attrsOfStartTag->get(i);
+                           if (!StringUtil::in(attr->key(), Constants::InBodyStartInputAttribs,
+                                               arrayLength(Constants::InBodyStartInputAttribs))) {
+                               inputAttribs.addAttribute(attr->key(), attr->value());
+                           }
+                       }
+
+                       inputAttribs.addAttribute("name", "isindex");
+
+                       processExtraToken(CSOUP_NEW3(tb->allocator(), StartTagToken, "input", inputAttribs, tb->allocator()), tb);
+                       processExtraEndTagToken("label", tb);
+                       processExtraStartTagToken("hr", tb);
+                       processExtraEndTagToken("form", tb);
+                       break;
                    }
-                   tb->reconstructFormattingElements(false);
-                   Element* a = tb->insert(startTag);
-                   tb->pushActiveFormattingElements(a, false);
-               } else if (StringUtil::in(name, Constants::Formatters, arrayLength(Constants::Formatters))) {
-                   tb->reconstructFormattingElements(false);
-                   Element* el = tb->insert(startTag);
-                   tb->pushActiveFormattingElements(el, false);
-               } else if (name.equals("nobr")) {
-                   tb->reconstructFormattingElements(false);
-                   if (tb->inScope("nobr")) {
-                       tb->error(this);
-                       
-                       processExtraEndTagToken("nobr", tb);
-                       
+                   case CSOUP_TAG_TEXTAREA:
+                       tb->insert(startTag);
+                       // todo: If the next token is a U+000A LINE FEED (LF) character token, then ignore that token and move on to the next one. (Newlines at the start of textarea elements are ignored as an authoring convenience.)
+                       tb->setTokeniserState(internal::Rcdata::instance());
+                       tb->markInsertionMode();
+                       tb->setFramesetOk(false);
+                       tb->transition(Text::instance());
+                       break;
+                   case CSOUP_TAG_XMP:
+                       if (tb->inButtonScope(CSOUP_TAG_P)) {
+                           processExtraEndTagToken("p", tb);
+                       }
                        tb->reconstructFormattingElements(false);
-                   }
-                   Element* el = tb->insert(startTag);
-                   tb->pushActiveFormattingElements(el, false);
-               } else if (StringUtil::in(name, Constants::InBodyStartApplets,arrayLength(Constants::InBodyStartApplets))) {
-                   tb->reconstructFormattingElements(false);
-                   tb->insert(startTag);
-                   tb->insertMarkerToFormattingElements();
-                   tb->setFramesetOk(false);
-               } else if (name.equals("table")) {
-                   if (tb->document()->quirksMode() != CSOUP_DOCTYPE_QUIRKS && tb->inButtonScope("p")) {
-                       processExtraEndTagToken("p", tb);
-                   }
-                   tb->insert(startTag);
-                   tb->setFramesetOk(false);
-                   tb->transition(InTable::instance());
-               } else if (StringUtil::in(name, Constants::InBodyStartEmptyFormatters,
-                                         arrayLength(Constants::InBodyStartEmptyFormatters))) {
-                   tb->reconstructFormattingElements(false);
-                   tb->insertEmpty(startTag);
-                   tb->setFramesetOk(false);
-               } else if (name.equals("input")) {
-                   tb->reconstructFormattingElements(false);
-                   Element* el = tb->insertEmpty(startTag);
-                   if (!el->attr("type").equalsIgnoreCase("hidden"))
                        tb->setFramesetOk(false);
-               } else if (StringUtil::in(name, Constants::InBodyStartMedia, arrayLength(Constants::InBodyStartMedia))) {
-                   tb->insertEmpty(startTag);
-               } else if (name.equals("hr")) {
-                   if (tb->inButtonScope("p")) {
-                       processExtraEndTagToken("p", tb);
-                   }
-                   tb->insertEmpty(startTag);
-                   tb->setFramesetOk(false);
-               } else if (name.equals("image")) {
-                   if (tb->getFromStack("svg") == NULL) {
-                       startTag->setTagName("img");
-                       return tb->process(startTag); // change <image> to <img>, unless in svg
-                   } else
+                       handleRawtext(startTag, tb);
+                       break;
+                   case CSOUP_TAG_IFRAME:
+                       tb->setFramesetOk(false);
+                       handleRawtext(startTag, tb);
+                       break;
+                   case CSOUP_TAG_NOEMBED:
+                       // also handle noscript if script enabled
+                       handleRawtext(startTag, tb);
+                       break;
+                   case CSOUP_TAG_SELECT: {
+                       tb->reconstructFormattingElements(false);
                        tb->insert(startTag);
-               } else if (name.equals("isindex")) {
-                   // how much do we care about the early 90s?
-                   tb->error(this);
-                   if (tb->formElement() != NULL)
-                       return false;
-                   
-                   tb->tokeniser()->setAcknowledgeSelfClosingFlag();
-                   processExtraStartTagToken("form", tb);
-                   if (startTag->attributes()->hasAttribute("action")) {
-                       Element* form = tb->formElement();
-                       form->addAttribute("action", startTag->attribute("action"));
-                   }
-                   
-                   processExtraStartTagToken("hr", tb);
-                   processExtraStartTagToken("label", tb);
-                   // hope you like english.
-                   StringRef prompt = startTag->attributes()->hasAttribute("prompt") ?
-                                    startTag->attributes()->get("prompt") :
-                                    "This is a searchable index. Enter search keywords: ";
-                   
-                   processExtraCharToken(prompt, tb);
-                   
-                   // input
-                   Attributes inputAttribs(tb->allocator());
-                   Attributes* attrsOfStartTag = startTag->attributes();
-                   for (size_t i = 0; i < attrsOfStartTag->size(); ++ i) {
-                       const Attribute* attr = attrsOfStartTag->get(i);
-                       if (!StringUtil::in(attr->key(), Constants::InBodyStartInputAttribs,
-                                           arrayLength(Constants::InBodyStartInputAttribs))) {
-                           inputAttribs.addAttribute(attr->key(), attr->value());
-                       }
-                   }
-                 
-                   inputAttribs.addAttribute("name", "isindex");
-                   
-                   processExtraToken(CSOUP_NEW3(tb->allocator(), StartTagToken, "input", inputAttribs, tb->allocator()), tb);
-                   processExtraEndTagToken("label", tb);
-                   processExtraStartTagToken("hr", tb);
-                   processExtraEndTagToken("form", tb);
-               } else if (name.equals("textarea")) {
-                   tb->insert(startTag);
-                   // todo: If the next token is a U+000A LINE FEED (LF) character token, then ignore that token and move on to the next one. (Newlines at the start of textarea elements are ignored as an authoring convenience.)
-                   tb->setTokeniserState(internal::Rcdata::instance());
-                   tb->markInsertionMode();
-                   tb->setFramesetOk(false);
-                   tb->transition(Text::instance());
-               } else if (name.equals("xmp")) {
-                   if (tb->inButtonScope("p")) {
-                       processExtraEndTagToken("p", tb);
+                       tb->setFramesetOk(false);
+
+                       HtmlTreeBuilderState* state = tb->state();
+                       if (state == InTable::instance() || state == InCaption::instance() || state == InTableBody::instance() || state == InRow::instance() || state == InCell::instance())
+                           tb->transition(InSelectInTable::instance());
+                       else
+                           tb->transition(InSelect::instance());
+                       break;
                    }
-                   tb->reconstructFormattingElements(false);
-                   tb->setFramesetOk(false);
-                   handleRawtext(startTag, tb);
-               } else if (name.equals("iframe")) {
-                   tb->setFramesetOk(false);
-                   handleRawtext(startTag, tb);
-               } else if (name.equals("noembed")) {
-                   // also handle noscript if script enabled
-                   handleRawtext(startTag, tb);
-               } else if (name.equals("select")) {
-                   tb->reconstructFormattingElements(false);
-                   tb->insert(startTag);
-                   tb->setFramesetOk(false);
-                   
-                   HtmlTreeBuilderState* state = tb->state();
-                   if (state == InTable::instance() || state == InCaption::instance() || state == InTableBody::instance() || state == InRow::instance() || state == InCell::instance())
-                       tb->transition(InSelectInTable::instance());
-                   else
-                       tb->transition(InSelect::instance());
-               } else if (StringUtil::in(name, Constants::InBodyStartOptions, arrayLength(Constants::InBodyStartOptions))) {
-                   if (tb->currentElement()->tagName().equals("option"))
-                       processExtraEndTagToken("option", tb);
-                   tb->reconstructFormattingElements(false);
-                   tb->insert(startTag);
-               } else if (StringUtil::in(name, Constants::InBodyStartRuby, arrayLength(Constants::InBodyStartRuby))) {
-                   if (tb->inScope("ruby")) {
-                       tb->generateImpliedEndTags(false);
-                       if (!tb->currentElement()->tagName().equals("ruby")) {
+                   case CSOUP_TAG_MATH:
+                       tb->reconstructFormattingElements(false);
+                       // todo: handle A start tag whose tag name is "math" (i.e. foreign, mathml)
+                       tb->insert(startTag);
+                       tb->tokeniser()->setAcknowledgeSelfClosingFlag();
+                       break;
+                   case CSOUP_TAG_SVG:
+                       tb->reconstructFormattingElements(false);
+                       // todo: handle A start tag whose tag name is "svg" (xlink, svg)
+                       tb->insert(startTag);
+                       tb->tokeniser()->setAcknowledgeSelfClosingFlag();
+                       break;
+                   default:
+                       if (Constants::InBodyStartToHead.contains(id)) {
+                           return tb->process(t, InHead::instance());
+                       } else if (Constants::InBodyStartPClosers.contains(id)) {
+                           if (tb->inButtonScope(CSOUP_TAG_P)) {
+                               processExtraEndTagToken("p", tb);
+                           }
+                           tb->insert(startTag);
+                       } else if (Constants::Headings.contains(id)) {
+                           if (tb->inButtonScope(CSOUP_TAG_P)) {
+                               processExtraEndTagToken("p", tb);
+                           }
+                           if (Constants::Headings.contains(tb->currentElement()->tagId())) {
+                               tb->error(this);
+                               tb->pop();
+                           }
+                           tb->insert(startTag);
+                       } else if (Constants::InBodyStartPreListing.contains(id)) {
+                           if (tb->inButtonScope(CSOUP_TAG_P)) {
+                               processExtraEndTagToken("p", tb);
+                           }
+                           tb->insert(startTag);
+                           // todo: ignore LF if next token
+                           tb->setFramesetOk(false);
+                       } else if (Constants::Formatters.contains(id)) {
+                           tb->reconstructFormattingElements(false);
+                           Element* el = tb->insert(startTag);
+                           tb->pushActiveFormattingElements(el, false);
+                       } else if (Constants::InBodyStartApplets.contains(id)) {
+                           tb->reconstructFormattingElements(false);
+                           tb->insert(startTag);
+                           tb->insertMarkerToFormattingElements();
+                           tb->setFramesetOk(false);
+                       } else if (Constants::InBodyStartEmptyFormatters.contains(id)) {
+                           tb->reconstructFormattingElements(false);
+                           tb->insertEmpty(startTag);
+                           tb->setFramesetOk(false);
+                       } else if (Constants::InBodyStartMedia.contains(id)) {
+                           tb->insertEmpty(startTag);
+                       } else if (Constants::InBodyStartOptions.contains(id)) {
+                           if (tb->currentElement()->tagId() == CSOUP_TAG_OPTION)
+                               processExtraEndTagToken("option", tb);
+                           tb->reconstructFormattingElements(false);
+                           tb->insert(startTag);
+                       } else if (Constants::InBodyStartRuby.contains(id)) {
+                           if (tb->inScope(CSOUP_TAG_RUBY)) {
+                               tb->generateImpliedEndTags(false);
+                               if (tb->currentElement()->tagId() != CSOUP_TAG_RUBY) {
+                                   tb->error(this);
+                                   tb->popStackToBefore(false, CSOUP_TAG_RUBY); // i.e. close up to but not include name
+                               }
+                               tb->insert(startTag);
+                           }
+                       } else if (Constants::InBodyStartDrop.contains(id)) {
                            tb->error(this);
-                           tb->popStackToBefore(false, "ruby"); // i.e. close up to but not include name
+                           return false;
+                       } else {
+                           tb->reconstructFormattingElements(false);
+                           tb->insert(startTag);
                        }
-                       tb->insert(startTag);
-                   }
-               } else if (name.equals("math")) {
-                   tb->reconstructFormattingElements(false);
-                   // todo: handle A start tag whose tag name is "math" (i.e. foreign, mathml)
-                   tb->insert(startTag);
-                   tb->tokeniser()->setAcknowledgeSelfClosingFlag();
-               } else if (name.equals("svg")) {
-                   tb->reconstructFormattingElements(false);
-                   // todo: handle A start tag whose tag name is "svg" (xlink, svg)
-                   tb->insert(startTag);
-                   tb->tokeniser()->setAcknowledgeSelfClosingFlag();
-               } else if (StringUtil::in(name, Constants::InBodyStartDrop, arrayLength(Constants::InBodyStartDrop))) {
-                   tb->error(this);
-                   return false;
-               } else {
-                   tb->reconstructFormattingElements(false);
-                   tb->insert(startTag);
                }
                break;
            }
            case CSOUP_TOKEN_END_TAG: {
                EndTagToken* endTag = t->asEndTagToken();
                StringRef name = endTag->tagName();
-               if (name.equals("body")) {
-                   if (!tb->inScope("body")) {
-                       tb->error(this);
-                       return false;
-                   } else {
-                       // todo: error if stack contains something not dd, dt, li, optgroup, option, p, rp, rt, tbody, td, tfoot, th, thead, tr, body, html
-                       tb->transition(AfterBody::instance());
-                   }
-               } else if (name.equals("html")) {
-                   bool notIgnored = processExtraEndTagToken("body", tb);
-                   if (notIgnored)
-                       return tb->process(endTag);
-               } else if (StringUtil::in(name, Constants::InBodyEndClosers, arrayLength(Constants::InBodyEndClosers))) {
-                   if (!tb->inScope(name)) {
-                       // nothing to close
-                       tb->error(this);
-                       return false;
-                   } else {
-                       tb->generateImpliedEndTags(false);
-                       if (!tb->currentElement()->tagName().equals(name))
-                           tb->error(this);
-                       tb->popStackToClose(false, name);
-                   }
-               } else if (name.equals("form")) {
-                   Element* currentForm = tb->formElement();
-                   tb->setFormElement(NULL, false);
-                   if (currentForm == NULL || !tb->inScope(name)) {
-                       tb->error(this);
-                       return false;
-                   } else {
-                       tb->generateImpliedEndTags(false);
-                       if (!tb->currentElement()->tagName().equals(name))
+               TagIdEnum id = endTag->tagId();
+               switch (id) {
+                   case CSOUP_TAG_BODY:
+                       if (!tb->inScope(CSOUP_TAG_BODY)) {
                            tb->error(this);
-                       // remove currentForm from stack-> will shift anything under up.
-                       tb->removeFromStack(currentForm, false);
-                   }
-               } else if (name.equals("p")) {
-                   if (!tb->inButtonScope(name)) {
-                       tb->error(this);
-                       processExtraStartTagToken(name, tb); // if no p to close, creates an empty <p></p>
-                       return tb->process(endTag);
-                   } else {
-                       tb->generateImpliedEndTags(name);
-                       if (!tb->currentElement()->tagName().equals(name))
-                           tb->error(this);
-                       tb->popStackToClose(false, name);
-                   }
-               } else if (name.equals("li")) {
-                   if (!tb->inListItemScope(name)) {
-                       tb->error(this);
-                       return false;
-                   } else {
-                       tb->generateImpliedEndTags(name);
-                       if (!tb->currentElement()->tagName().equals(name))
-                           tb->error(this);
-                       tb->popStackToClose(false, name);
-                   }
-               } else if (StringUtil::in(name, Constants::DdDt, arrayLength(Constants::DdDt))) {
-                   if (!tb->inScope(name)) {
-                       tb->error(this);
-                       return false;
-                   } else {
-                       tb->generateImpliedEndTags(name);
-                       if (!tb->currentElement()->tagName().equals(name))
-                           tb->error(this);
-                       tb->popStackToClose(false, name);
+                           return false;
+                       } else {
+                           // todo: error if stack contains something not dd, dt, li, optgroup, option, p, rp, rt, tbody, td, tfoot, th, thead, tr, body, html
+                           tb->transition(AfterBody::instance());
+                       }
+                       break;
+                   case CSOUP_TAG_HTML: {
+                       bool notIgnored = processExtraEndTagToken("body", tb);
+                       if (notIgnored)
+                           return tb->process(endTag);
+                       break;
                    }
-               } else if (StringUtil::in(name, Constants::Headings, arrayLength(Constants::Headings))) {
-                   if (!tb->inScope(Constants::Headings, arrayLength(Constants::Headings))) {
-                       tb->error(this);
-                       return false;
-                   } else {
-                       tb->generateImpliedEndTags(name);
-                       if (!tb->currentElement()->tagName().equals(name))
+                   case CSOUP_TAG_FORM: {
+                       Element* currentForm = tb->formElement();
+                       tb->setFormElement(NULL, false);
+                       if (currentForm == NULL || !tb->inScope(id)) {
                            tb->error(this);
-                       tb->popStackToClose(false, Constants::Headings, arrayLength(Constants::Headings));
+                           return false;
+                       } else {
+                           tb->generateImpliedEndTags(false);
+                           if (tb->currentElement()->tagId() != id)
+                               tb->error(this);
+                           // remove currentForm from stack-> will shift anything under up.
+                           tb->removeFromStack(currentForm, false);
+                       }
+                       break;
                    }
-               } else if (name.equals("sarcasm")) {
-                   // *sigh*
-                   return InBodyAnyOtherEndTag(this, t, tb);
-               } else if (StringUtil::in(name, Constants::InBodyEndAdoptionFormatters, arrayLength(Constants::InBodyEndAdoptionFormatters))) {
-                   // Adoption Agency Algorithm.
-               OUTER:
-                   for (int i = 0; i < 8; i++) {
-                       Element* formatEl = tb->getActiveFormattingElement(name);
-                       if (formatEl == NULL)
-                           return InBodyAnyOtherEndTag(this, t, tb);
-                       else if (!tb->onStack(formatEl)) {
+                   case CSOUP_TAG_P:
+                       if (!tb->inButtonScope(id)) {
                            tb->error(this);
-                           tb->removeFromActiveFormattingElements(formatEl, false);
-                           return true;
-                       } else if (!tb->inScope(formatEl->tagName())) {
+                           processExtraStartTagToken(name, tb); // if no p to close, creates an empty <p></p>
+                           return tb->process(endTag);
+                       } else {
+                           tb->generateImpliedEndTags(name);
+                           if (tb->currentElement()->tagId() != id)
+                               tb->error(this);
+                           tb->popStackToClose(false, id);
+                       }
+                       break;
+                   case CSOUP_TAG_LI:
+                       if (!tb->inListItemScope(id)) {
                            tb->error(this);
                            return false;
-                       } else if (tb->currentElement() != formatEl)
+                       } else {
+                           tb->generateImpliedEndTags(name);
+                           if (tb->currentElement()->tagId() != id)
+                               tb->error(this);
+                           tb->popStackToClose(false, id);
+                       }
+                       break;
+                   case CSOUP_TAG_DD: case CSOUP_TAG_DT:
+                       if (!tb->inScope(id)) {
                            tb->error(this);
-                       
-                       Element* furthestBlock = NULL;
-                       Element* commonAncestor = NULL;
-                       bool seenFormattingElement = false;
-                       internal::Vector<Element*>* stack = tb->stack();
-                       // the spec doesn't limit to < 64, but in degenerate cases (9000+ stack depth) this prevents
-                       // run-aways
-                       const size_t stackSize = stack->size();
-                       for (size_t si = 0; si < stackSize && si < 64; si++) {
-                           Element* el = *stack->at(si);
-                           if (el == formatEl) {
-                               commonAncestor = *stack->at(si - 1);
-                               seenFormattingElement = true;
-                           } else if (seenFormattingElement && tb->isSpecial(el)) {
-                               furthestBlock = el;
-                               break;
-                           }
+                           return false;
+                       } else {
+                           tb->generateImpliedEndTags(name);
+                           if (tb->currentElement()->tagId() != id)
+                               tb->error(this);
+                           tb->popStackToClose(false, id);
                        }
-                       if (furthestBlock == NULL) {
-                           tb->popStackToClose(false, formatEl->tagName());
-                           tb->removeFromActiveFormattingElements(formatEl, false);
-                           return true;
+                       break;
+                   case CSOUP_TAG_H1: case CSOUP_TAG_H2: case CSOUP_TAG_H3:
+                   case CSOUP_TAG_H4: case CSOUP_TAG_H5: case CSOUP_TAG_H6:
+                       if (!tb->inScope(HeadingIds, arrayLength(HeadingIds))) {
+                           tb->error(this);
+                           return false;
+                       } else {
+                           tb->generateImpliedEndTags(name);
+                           if (tb->currentElement()->tagId() != id)
+                               tb->error(this);
+                           tb->popStackToClose(false, HeadingIds, arrayLength(HeadingIds));
                        }
-                       
-                       // todo: Let a bookmark note the position of the formatting element in the list of active formatting elements relative to the elements on either side of it in the list.
-                       // does that mean: int pos of format el in list?
-                       Element* node = furthestBlock;
-                       Element* lastNode = furthestBlock;
-                   INNER:
-                       for (int j = 0; j < 3; j++) {
-                           if (tb->onStack(node))
-                               node = tb->aboveOnStack(node);
-                           if (!tb->isInActiveFormattingElements(node)) { // note no bookmark check
-                               tb->removeFromStack(node,false);
-                               continue;
-                           } else if (node == formatEl)
-                               break;
-  
-                           Element* replacement = CSOUP_NEW3(tb->allocator(), Element, node->tagName(), tb->baseUri(), tb->allocator());
-                           tb->replaceActiveFormattingElement(node, replacement, false);
-                           tb->replaceOnStack(node, replacement, false);
-                           node = replacement;
-                           
-                           if (lastNode == furthestBlock) {
-                               // todo: move the aforementioned bookmark to be immediately after the new node in the list of active formatting elements.
-                               // not getting how this bookmark both straddles the element above, but is inbetween here...
+                       break;
+                   case CSOUP_TAG_BR:
+                       tb->error(this);
+                       processExtraStartTagToken("br", tb);
+                       return false;
+                   default:
+                       if (Constants::InBodyEndClosers.contains(id)) {
+                           if (!tb->inScope(id)) {
+                               // nothing to close
+                               tb->error(this);
+                               return false;
+                           } else {
+                               tb->generateImpliedEndTags(false);
+                               if (tb->currentElement()->tagId() != id)
+                                   tb->error(this);
+                               tb->popStackToClose(false, id);
                            }
-                           if (lastNode->parentNode() != NULL) {
-                               // don't destroy it ! we;ll
-                               lastNode->removeFromParent(false);
+                       } else if (Constants::InBodyEndAdoptionFormatters.contains(id)) {
+                           return adoptionAgency(t, tb);
+                       } else if (Constants::InBodyStartApplets.contains(id)) {
+                           // jsoup asks first whether "name" is in scope, which no tag is
+                           if (!tb->inScope(id)) {
+                               tb->error(this);
+                               return false;
                            }
-                           node->appendNode(lastNode);
-                           lastNode = node;
-                       }
-                       
-                       if (StringUtil::in(commonAncestor->tagName(), Constants::InBodyEndTableFosters,
-                                          arrayLength(Constants::InBodyEndTableFosters))) {
-                           if (lastNode->parentNode() != NULL)
-                               lastNode->removeFromParent(false);
-                           tb->insertInFosterParent(lastNode);
+                           tb->generateImpliedEndTags(false);
+                           if (tb->currentElement()->tagId() != id)
+                               tb->error(this);
+                           tb->popStackToClose(false, id);
+                           tb->clearFormattingElementsToLastMarker(false);
                        } else {
-                           if (lastNode->parentNode() != NULL)
-                               lastNode->removeFromParent(false);
-                           
-                           commonAncestor->appendNode(lastNode);
-                       }
-                       
-                       Element* adopter = CSOUP_NEW3(tb->allocator(), Element, formatEl->tagName(), tb->baseUri(), tb->allocator());
-                       adopter->addAttributes(*formatEl->attributes());
-                       
-                       for (size_t i = formatEl->childNodeSize(); i > 0; -- i) {
-                           Node* c = formatEl->childNode(i - 1);
-                           c->removeFromParent(false);
-                           // This is very slow
-                           adopter->insertNode(0, c);
-                       }
-                       
-                       furthestBlock->appendNode(adopter);
-                       tb->removeFromActiveFormattingElements(formatEl, false);
-                       // todo: insert the new element into the list of active formatting elements at the position of the aforementioned bookmark.
-                       tb->removeFromStack(formatEl, false);
-                       tb->insertOnStackAfter(furthestBlock, adopter);
-                   }
-               //AFTER_OUTER:
-               } else if (StringUtil::in(name, Constants::InBodyStartApplets, arrayLength(Constants::InBodyStartApplets))) {
-                   if (!tb->inScope("name")) {
-                       if (!tb->inScope(name)) {
-                           tb->error(this);
-                           return false;
+                           return InBodyAnyOtherEndTag(this, t, tb);
                        }
-                       tb->generateImpliedEndTags(false);
-                       if (!tb->currentElement()->tagName().equals(name))
-                           tb->error(this);
-                       tb->popStackToClose(false, name);
-                       tb->clearFormattingElementsToLastMarker(false);
-                   }
-               } else if (name.equals("br")) {
-                   tb->error(this);
-                   processExtraStartTagToken("br", tb);
-                   return false;
-               } else {
-                   return InBodyAnyOtherEndTag(this, t, tb);
                }
-               
+
                break;
            }
            case CSOUP_TOKEN_EOF:
@@ -972,7 +1027,7 @@ do { \
         bool InTableAnythingElse(HtmlTreeBuilderState* state, Token* t, HtmlTreeBuilder* tb) {
             tb->error(state);
             bool processed = true;
-            if (StringUtil::in(tb->currentElement()->tagName(), "table", "tbody", "tfoot", "thead", "tr")) {
+            if (HtmlTreeBuilderState::Constants::InBodyEndTableFosters.contains(tb->currentElement()->tagId())) {
                 tb->setFosterInserts(true);
                 processed = tb->process(t, InBody::instance());
                 tb->setFosterInserts(false);
@@ -998,64 +1053,69 @@ do { \
                return false;
            } else if (t->isStartTagToken()) {
                StartTagToken* startTag = t->asStartTagToken();
-               StringRef name = startTag->tagName();
-               if (name.equals("caption")) {
-                   tb->clearStackToTableContext(false);
-                   tb->insertMarkerToFormattingElements();
-                   tb->insert(startTag);
-                   tb->transition(InCaption::instance());
-               } else if (name.equals("colgroup")) {
-                   tb->clearStackToTableContext(false);
-                   tb->insert(startTag);
-                   tb->transition(InColumnGroup::instance());
-               } else if (name.equals("col")) {
-                   processExtraStartTagToken("colgroup", tb);
-                   return tb->process(t);
-               } else if (StringUtil::in(name, "tbody", "tfoot", "thead")) {
-                   tb->clearStackToTableContext(false);
-                   tb->insert(startTag);
-                   tb->transition(InTableBody::instance());
-               } else if (StringUtil::in(name, "td", "th", "tr")) {
-                   processExtraStartTagToken("tbody", tb);
-                   return tb->process(t);
-               } else if (name.equals("table")) {
-                   tb->error(this);
-                   bool processed = processExtraEndTagToken("table", tb);
-                   if (processed) // only ignored if in fragment
+               switch (startTag->tagId()) {
+                   case CSOUP_TAG_CAPTION:
+                       tb->clearStackToTableContext(false);
+                       tb->insertMarkerToFormattingElements();
+                       tb->insert(startTag);
+                       tb->transition(InCaption::instance());
+                       break;
+                   case CSOUP_TAG_COLGROUP:
+                       tb->clearStackToTableContext(false);
+                       tb->insert(startTag);
+                       tb->transition(InColumnGroup::instance());
+                       break;
+                   case CSOUP_TAG_COL:
+                       processExtraStartTagToken("colgroup", tb);
                        return tb->process(t);
-               } else if (StringUtil::in(name, "style", "script")) {
-                   return tb->process(t, InHead::instance());
-               } else if (name.equals("input")) {
-                   if (!startTag->attribute("type").equalsIgnoreCase("hidden")) {
-                       return InTableAnythingElse(this, t, tb);
-                   } else {
-                       tb->insertEmpty(startTag);
-                   }
-               } else if (name.equals("form")) {
-                   tb->error(this);
-                   if (tb->formElement() != NULL)
-                       return false;
-                   else {
-                       tb->insertForm(startTag, false);
+                   case CSOUP_TAG_TBODY: case CSOUP_TAG_TFOOT: case CSOUP_TAG_THEAD:
+                       tb->clearStackToTableContext(false);
+                       tb->insert(startTag);
+                       tb->transition(InTableBody::instance());
+                       break;
+                   case CSOUP_TAG_TD: case CSOUP_TAG_TH: case CSOUP_TAG_TR:
+                       processExtraStartTagToken("tbody", tb);
+                       return tb->process(t);
+                   case CSOUP_TAG_TABLE: {
+                       tb->error(this);
+                       bool processed = processExtraEndTagToken("table", tb);
+                       if (processed) // only ignored if in fragment
+                           return tb->process(t);
+                       break;
                    }
-               } else {
-                   return InTableAnythingElse(this, t, tb);
+                   case CSOUP_TAG_STYLE: case CSOUP_TAG_SCRIPT:
+                       return tb->process(t, InHead::instance());
+                   case CSOUP_TAG_INPUT:
+                       if (!startTag->attribute("type").equalsIgnoreCase("hidden")) {
+                           return InTableAnythingElse(this, t, tb);
+                       } else {
+                           tb->insertEmpty(startTag);
+                       }
+                       break;
+                   case CSOUP_TAG_FORM:
+                       tb->error(this);
+                       if (tb->formElement() != NULL)
+                           return false;
+                       else {
+                           tb->insertForm(startTag, false);
+                       }
+                       break;
+                   default:
+                       return InTableAnythingElse(this, t, tb);
                }
                return true; // todo: check if should return processed http://www.whatwg.org/specs/web-apps/current-work/multipage/tree-construction.html#parsing-main-intable
            } else if (t->isEndTagToken()) {
                EndTagToken* endTag = t->asEndTagToken();
-               StringRef name = endTag->tagName();
-               static const StringRef errTags[] = {"body", "caption", "col", "colgroup", "html", "tbody", "td", "tfoot", "th", "thead", "tr"};
-               
-               if (name.equals("table")) {
-                   if (!tb->inTableScope(name)) {
+               TagIdEnum id = endTag->tagId();
+               if (id == CSOUP_TAG_TABLE) {
+                   if (!tb->inTableScope(endTag->tagId())) {
                        tb->error(this);
                        return false;
                    } else {
-                       tb->popStackToClose(false, "table");
+                       tb->popStackToClose(false, CSOUP_TAG_TABLE);
                    }
                    tb->resetInsertionMode();
-               } else if (StringUtil::in(name, errTags, arrayLength(errTags))) {
+               } else if (isTablePart(id) || id == CSOUP_TAG_CAPTION || id == CSOUP_TAG_BODY || id == CSOUP_TAG_HTML) {
                    tb->error(this);
                    return false;
                } else {
@@ -1063,7 +1123,7 @@ do { \
                }
                return true; // todo: as above todo
            } else if (t->isEOFToken()) {
-               if (tb->currentElement()->tagName().equals("html"))
+               if (tb->currentElement()->tagId() == CSOUP_TAG_HTML)
                    tb->error(this);
                return true; // stops parsing
            }
@@ -1094,7 +1154,7 @@ do { \
                            if (!isWhitespace(character)) {
                                // InTable anything else section:
                                tb->error(this);
-                               if (StringUtil::in(tb->currentElement()->tagName(), "table", "tbody", "tfoot", "thead", "tr")) {
+                               if (Constants::InBodyEndTableFosters.contains(tb->currentElement()->tagId())) {
                                    tb->setFosterInserts(true);
                                    tb->process(character, InBody::instance());
                                    tb->setFosterInserts(false);
@@ -1115,30 +1175,29 @@ do { \
        
        bool InCaption::process(Token* t, HtmlTreeBuilder* tb) {
            //TokenDeleter tokenDeleter(t, tb->allocator());
-           static const StringRef errStartTags[] = {"caption", "col", "colgroup", "tbody", "td", "tfoot", "th", "thead", "tr"};
-           static const StringRef errEndTags[] = {"body", "col", "colgroup", "html", "tbody", "td", "tfoot", "th", "thead", "tr"};
            
-           if (t->isEndTagToken() && t->asEndTagToken()->tagName().equals("caption")) {
-               EndTagToken* endTag = t->asEndTagToken();
-               StringRef name = endTag->tagName();
-               if (!tb->inTableScope(name)) {
+           if (t->isEndTagToken() && t->asEndTagToken()->tagId() == CSOUP_TAG_CAPTION) {
+               if (!tb->inTableScope(CSOUP_TAG_CAPTION)) {
                    tb->error(this);
                    return false;
                } else {
                    tb->generateImpliedEndTags(false);
-                   if (!tb->currentElement()->tagName().equals("caption"))
+                   if (tb->currentElement()->tagId() != CSOUP_TAG_CAPTION)
                        tb->error(this);
-                   tb->popStackToClose(false, "caption");
+                   tb->popStackToClose(false, CSOUP_TAG_CAPTION);
                    tb->clearFormattingElementsToLastMarker(false);
                    tb->transition(InTable::instance());
                }
-           } else if ( (t->isStartTagToken() && StringUtil::in(t->asStartTagToken()->tagName(), errStartTags, arrayLength(errStartTags))) ||
-                       (t->isEndTagToken() && t->asEndTagToken()->tagName().equals("table"))) {
+           } else if ((t->isStartTagToken() && (isTablePart(t->asStartTagToken()->tagId()) ||
+                                                t->asStartTagToken()->tagId() == CSOUP_TAG_CAPTION)) ||
+                      (t->isEndTagToken() && t->asEndTagToken()->tagId() == CSOUP_TAG_TABLE)) {
                tb->error(this);
                bool processed = processExtraEndTagToken("caption", tb);
                if (processed)
                    return tb->process(t);
-           } else if (t->isEndTagToken() && StringUtil::in(t->asEndTagToken()->tagName(), errEndTags, arrayLength(errEndTags))) {
+           } else if (t->isEndTagToken() && (isTablePart(t->asEndTagToken()->tagId()) ||
+                                             t->asEndTagToken()->tagId() == CSOUP_TAG_BODY ||
+                                             t->asEndTagToken()->tagId() == CSOUP_TAG_HTML)) {
                tb->error(this);
                return false;
            } else {
@@ -1171,10 +1230,9 @@ do { \
                    break;
                case CSOUP_TOKEN_START_TAG: {
                    StartTagToken* startTag = t->asStartTagToken();
-                   StringRef name = startTag->tagName();
-                   if (name.equals("html"))
+                   if (startTag->tagId() == CSOUP_TAG_HTML)
                        return tb->process(t, InBody::instance());
-                   else if (name.equals("col"))
+                   else if (startTag->tagId() == CSOUP_TAG_COL)
                        tb->insertEmpty(startTag);
                    else
                        InColumnGroupAnythingElse; //return anythingElse(t, tb);
@@ -1182,9 +1240,8 @@ do { \
                }
                case CSOUP_TOKEN_END_TAG: {
                    EndTagToken* endTag = t->asEndTagToken();
-                   StringRef name = endTag->tagName();
-                   if (name.equals("colgroup")) {
-                       if (tb->currentElement()->tagName().equals("html")) { // frag case
+                   if (endTag->tagId() == CSOUP_TAG_COLGROUP) {
+                       if (tb->currentElement()->tagId() == CSOUP_TAG_HTML) { // frag case
                            tb->error(this);
                            return false;
                        } else {
@@ -1196,7 +1253,7 @@ do { \
                    break;
                }
                case CSOUP_TOKEN_EOF: {
-                   if (tb->currentElement()->tagName().equals("html"))
+                   if (tb->currentElement()->tagId() == CSOUP_TAG_HTML)
                        return true; // stop parsing; frag case
                    else
                        InColumnGroupAnythingElse;//return anythingElse(t, tb);
@@ -1214,42 +1271,46 @@ do { \
            switch (t->tokenType()) {
                case CSOUP_TOKEN_START_TAG: {
                    StartTagToken* startTag = t->asStartTagToken();
-                   StringRef name = startTag->tagName();
-                   if (name.equals("tr")) {
-                       tb->clearStackToTableBodyContext(false);
-                       tb->insert(startTag);
-                       tb->transition(InRow::instance());
-                   } else if (StringUtil::in(name, "th", "td")) {
-                       tb->error(this);
-                       processExtraStartTagToken("tr", tb);
-                       return tb->process(startTag);
-                   } else if (StringUtil::in(name, "caption", "col", "colgroup", "tbody", "tfoot", "thead")) {
-                       return exitTableBody(t, tb);
-                   } else
-                       return anythingElse(t, tb);
+                   switch (startTag->tagId()) {
+                       case CSOUP_TAG_TR:
+                           tb->clearStackToTableBodyContext(false);
+                           tb->insert(startTag);
+                           tb->transition(InRow::instance());
+                           break;
+                       case CSOUP_TAG_TH: case CSOUP_TAG_TD:
+                           tb->error(this);
+                           processExtraStartTagToken("tr", tb);
+                           return tb->process(startTag);
+                       case CSOUP_TAG_CAPTION: case CSOUP_TAG_COL: case CSOUP_TAG_COLGROUP:
+                       case CSOUP_TAG_TBODY: case CSOUP_TAG_TFOOT: case CSOUP_TAG_THEAD:
+                           return exitTableBody(t, tb);
+                       default:
+                           return anythingElse(t, tb);
+                   }
                    break;
                }
                case CSOUP_TOKEN_END_TAG: {
                    EndTagToken* endTag = t->asEndTagToken();
-                   StringRef name = endTag->tagName();
-                   static const StringRef errTags[] = {"body", "caption", "col", "colgroup", "html", "td", "th", "tr"};
-                   
-                   if (StringUtil::in(name, "tbody", "tfoot", "thead")) {
-                       if (!tb->inTableScope(name)) {
+                   switch (endTag->tagId()) {
+                       case CSOUP_TAG_TBODY: case CSOUP_TAG_TFOOT: case CSOUP_TAG_THEAD:
+                           if (!tb->inTableScope(endTag->tagId())) {
+                               tb->error(this);
+                               return false;
+                           } else {
+                               tb->clearStackToTableBodyContext(false);
+                               tb->pop();
+                               tb->transition(InTable::instance());
+                           }
+                           break;
+                       case CSOUP_TAG_TABLE:
+                           return exitTableBody(t, tb);
+                       case CSOUP_TAG_BODY: case CSOUP_TAG_CAPTION: case CSOUP_TAG_COL: case CSOUP_TAG_COLGROUP:
+                       case CSOUP_TAG_HTML: case CSOUP_TAG_TD: case CSOUP_TAG_TH: case CSOUP_TAG_TR:
                            tb->error(this);
                            return false;
-                       } else {
-                           tb->clearStackToTableBodyContext(false);
-                           tb->pop();
-                           tb->transition(InTable::instance());
-                       }
-                   } else if (name.equals("table")) {
-                       return exitTableBody(t, tb);
-                   } else if (StringUtil::in(name, errTags, arrayLength(errTags))) {
-                       tb->error(this);
-                       return false;
-                   } else
-                       return anythingElse(t, tb);
+                       default:
+                           return anythingElse(t, tb);
+                   }
                    break;
                }
                default:
@@ -1259,7 +1320,7 @@ do { \
        }
        
        bool InTableBody::exitTableBody(Token* t, HtmlTreeBuilder* tb) {
-           if (!(tb->inTableScope("tbody") || tb->inTableScope("thead") || tb->inScope("tfoot"))) {
+           if (!(tb->inTableScope(CSOUP_TAG_TBODY) || tb->inTableScope(CSOUP_TAG_THEAD) || tb->inScope(CSOUP_TAG_TFOOT))) {
                // frag case
                tb->error(this);
                return false;
@@ -1278,40 +1339,40 @@ do { \
            
            if (t->isStartTagToken()) {
                StartTagToken* startTag = t->asStartTagToken();
-               StringRef name = startTag->tagName();
+               TagIdEnum id = startTag->tagId();
                
-               if (StringUtil::in(name, "th", "td")) {
+               if (id == CSOUP_TAG_TH || id == CSOUP_TAG_TD) {
                    tb->clearStackToTableRowContext(false);
                    tb->insert(startTag);
                    tb->transition(InCell::instance());
                    tb->insertMarkerToFormattingElements();
-               } else if (StringUtil::in(name, "caption", "col", "colgroup", "tbody", "tfoot", "thead", "tr")) {
+               } else if (isTablePart(id) || id == CSOUP_TAG_CAPTION) { // but th and td, above
                    return handleMissingTr(t, tb);
                } else {
                    return anythingElse(t, tb);
                }
            } else if (t->isEndTagToken()) {
                EndTagToken* endTag = t->asEndTagToken();
-               StringRef name = endTag->tagName();
+               TagIdEnum id = endTag->tagId();
                
-               if (name.equals("tr")) {
-                   if (!tb->inTableScope(name)) {
+               if (id == CSOUP_TAG_TR) {
+                   if (!tb->inTableScope(id)) {
                        tb->error(this); // frag
                        return false;
                    }
                    tb->clearStackToTableRowContext(false);
                    tb->pop(); // tr
                    tb->transition(InTableBody::instance());
-               } else if (name.equals("table")) {
+               } else if (id == CSOUP_TAG_TABLE) {
                    return handleMissingTr(t, tb);
-               } else if (StringUtil::in(name, "tbody", "tfoot", "thead")) {
-                   if (!tb->inTableScope(name)) {
+               } else if (id == CSOUP_TAG_TBODY || id == CSOUP_TAG_TFOOT || id == CSOUP_TAG_THEAD) {
+                   if (!tb->inTableScope(id)) {
                        tb->error(this);
                        return false;
                    }
                    processExtraEndTagToken("tr", tb);
                    return tb->process(t);
-               } else if (StringUtil::in(name, "body", "caption", "col", "colgroup", "html", "td", "th")) {
+               } else if (isTablePart(id) || id == CSOUP_TAG_BODY || id == CSOUP_TAG_CAPTION || id == CSOUP_TAG_HTML) {
                    tb->error(this);
                    return false;
                } else {
@@ -1340,37 +1401,39 @@ do { \
            
            if (t->isEndTagToken()) {
                EndTagToken* endTag = t->asEndTagToken();
-               StringRef name = endTag->tagName();
                
-               if (StringUtil::in(name, "td", "th")) {
-                   if (!tb->inTableScope(name)) {
-                       tb->error(this);
-                       tb->transition(InRow::instance()); // might not be in scope if empty: <td /> and processing fake end tag
-                       return false;
-                   }
-                   tb->generateImpliedEndTags(false);
-                   if (!tb->currentElement()->tagName().equals(name))
-                       tb->error(this);
-                   tb->popStackToClose(false, name);
-                   tb->clearFormattingElementsToLastMarker(false);
-                   tb->transition(InRow::instance());
-               } else if (StringUtil::in(name, "body", "caption", "col", "colgroup", "html")) {
-                   tb->error(this);
-                   return false;
-               } else if (StringUtil::in(name, "table", "tbody", "tfoot", "thead", "tr")) {
-                   if (!tb->inTableScope(name)) {
+               switch (endTag->tagId()) {
+                   case CSOUP_TAG_TD: case CSOUP_TAG_TH:
+                       if (!tb->inTableScope(endTag->tagId())) {
+                           tb->error(this);
+                           tb->transition(InRow::instance()); // might not be in scope if empty: <td /> and processing fake end tag
+                           return false;
+                       }
+                       tb->generateImpliedEndTags(false);
+                       if (tb->currentElement()->tagId() != endTag->tagId())
+                           tb->error(this);
+                       tb->popStackToClose(false, endTag->tagId());
+                       tb->clearFormattingElementsToLastMarker(false);
+                       tb->transition(InRow::instance());
+                       break;
+                   case CSOUP_TAG_BODY: case CSOUP_TAG_CAPTION: case CSOUP_TAG_COL: case CSOUP_TAG_COLGROUP:
+                   case CSOUP_TAG_HTML:
                        tb->error(this);
                        return false;
-                   }
-                   closeCell(tb);
-                   return tb->process(t);
-               } else {
-                   return anythingElse(t, tb);
+                   case CSOUP_TAG_TABLE: case CSOUP_TAG_TBODY: case CSOUP_TAG_TFOOT: case CSOUP_TAG_THEAD:
+                   case CSOUP_TAG_TR:
+                       if (!tb->inTableScope(endTag->tagId())) {
+                           tb->error(this);
+                           return false;
+                       }
+                       closeCell(tb);
+                       return tb->process(t);
+                   default:
+                       return anythingElse(t, tb);
                }
-           } else if (t->isStartTagToken() &&
-                      StringUtil::in(t->asStartTagToken()->tagName(),"caption", "col", "colgroup", "tbody") &&
-                      StringUtil::in(t->asStartTagToken()->tagName(), "td", "tfoot", "th", "thead", "tr")) {
-                          if (!(tb->inTableScope("td") || tb->inTableScope("th"))) {
+           } else if (t->isStartTagToken() && (isTablePart(t->asStartTagToken()->tagId()) ||
+                                               t->asStartTagToken()->tagId() == CSOUP_TAG_CAPTION)) {
+                          if (!(tb->inTableScope(CSOUP_TAG_TD) || tb->inTableScope(CSOUP_TAG_TH))) {
                               tb->error(this);
                               return false;
                           }
@@ -1387,7 +1450,7 @@ do { \
     }
        
     void InCell::closeCell(HtmlTreeBuilder* tb) {
-        if (tb->inTableScope("td"))
+        if (tb->inTableScope(CSOUP_TAG_TD))
             processExtraEndTagToken("td", tb);
         else
             processExtraEndTagToken("th", tb); // only here if th or td in scope
@@ -1417,63 +1480,69 @@ do { \
                }
                case CSOUP_TOKEN_START_TAG: {
                    StartTagToken* start = t->asStartTagToken();
-                   StringRef name = start->tagName();
-                   if (name.equals("html"))
-                       return tb->process(start, InBody::instance());
-                   else if (name.equals("option")) {
-                       processExtraEndTagToken("option", tb);
-                       tb->insert(start);
-                   } else if (name.equals("optgroup")) {
-                       if (tb->currentElement()->tagName().equals("option"))
+                   switch (start->tagId()) {
+                       case CSOUP_TAG_HTML:
+                           return tb->process(start, InBody::instance());
+                       case CSOUP_TAG_OPTION:
                            processExtraEndTagToken("option", tb);
-                       else if (tb->currentElement()->tagName().equals("optgroup"))
-                           processExtraEndTagToken("optgroup", tb);
-                       tb->insert(start);
-                   } else if (name.equals("select")) {
-                       tb->error(this);
-                       return processExtraEndTagToken("select", tb);
-                   } else if (StringUtil::in(name, "input", "keygen", "textarea")) {
-                       tb->error(this);
-                       if (!tb->inSelectScope("select"))
-                           return false; // frag
-                       processExtraEndTagToken("select", tb);
-                       return tb->process(start);
-                   } else if (name.equals("script")) {
-                       return tb->process(t, InHead::instance());
-                   } else {
-                       return anythingElse(t, tb);
+                           tb->insert(start);
+                           break;
+                       case CSOUP_TAG_OPTGROUP:
+                           if (tb->currentElement()->tagId() == CSOUP_TAG_OPTION)
+                               processExtraEndTagToken("option", tb);
+                           else if (tb->currentElement()->tagId() == CSOUP_TAG_OPTGROUP)
+                               processExtraEndTagToken("optgroup", tb);
+                           tb->insert(start);
+                           break;
+                       case CSOUP_TAG_SELECT:
+                           tb->error(this);
+                           return processExtraEndTagToken("select", tb);
+                       case CSOUP_TAG_INPUT: case CSOUP_TAG_KEYGEN: case CSOUP_TAG_TEXTAREA:
+                           tb->error(this);
+                           if (!tb->inSelectScope(CSOUP_TAG_SELECT))
+                               return false; // frag
+                           processExtraEndTagToken("select", tb);
+                           return tb->process(start);
+                       case CSOUP_TAG_SCRIPT:
+                           return tb->process(t, InHead::instance());
+                       default:
+                           return anythingElse(t, tb);
                    }
                    break;
                 }
                case CSOUP_TOKEN_END_TAG: {
                    EndTagToken* end = t->asEndTagToken();
-                   StringRef name = end->tagName();
-                   if (name.equals("optgroup")) {
-                       if (tb->currentElement()->tagName().equals("option") && tb->aboveOnStack(tb->currentElement()) != NULL && tb->aboveOnStack(tb->currentElement())->tagName().equals("optgroup"))
-                           processExtraEndTagToken("option", tb);
-                       if (tb->currentElement()->tagName().equals("optgroup"))
-                           tb->pop();
-                       else
-                           tb->error(this);
-                   } else if (name.equals("option")) {
-                       if (tb->currentElement()->tagName().equals("option"))
-                           tb->pop();
-                       else
-                           tb->error(this);
-                   } else if (name.equals("select")) {
-                       if (!tb->inSelectScope(name)) {
-                           tb->error(this);
-                           return false;
-                       } else {
-                           tb->popStackToClose(false, name);
-                           tb->resetInsertionMode();
-                       }
-                   } else
-                       return anythingElse(t, tb);
+                   switch (end->tagId()) {
+                       case CSOUP_TAG_OPTGROUP:
+                           if (tb->currentElement()->tagId() == CSOUP_TAG_OPTION && tb->aboveOnStack(tb->currentElement()) != NULL && tb->aboveOnStack(tb->currentElement())->tagId() == CSOUP_TAG_OPTGROUP)
+                               processExtraEndTagToken("option", tb);
+                           if (tb->currentElement()->tagId() == CSOUP_TAG_OPTGROUP)
+                               tb->pop();
+                           else
+                               tb->error(this);
+                           break;
+                       case CSOUP_TAG_OPTION:
+                           if (tb->currentElement()->tagId() == CSOUP_TAG_OPTION)
+                               tb->pop();
+                           else
+                               tb->error(this);
+                           break;
+                       case CSOUP_TAG_SELECT:
+                           if (!tb->inSelectScope(CSOUP_TAG_SELECT)) {
+                               tb->error(this);
+                               return false;
+                           } else {
+                               tb->popStackToClose(false, CSOUP_TAG_SELECT);
+                               tb->resetInsertionMode();
+                           }
+                           break;
+                       default:
+                           return anythingElse(t, tb);
+                   }
                    break;
                }
                case CSOUP_TOKEN_EOF:
-                   if (!tb->currentElement()->tagName().equals("html"))
+                   if (tb->currentElement()->tagId() != CSOUP_TAG_HTML)
                        tb->error(this);
                    break;
                default:
@@ -1487,17 +1556,26 @@ do { \
            return false;
        }
        
+       bool InSelectInTable::isSelectInTableBreaker(TagIdEnum id) {
+           switch (id) {
+               case CSOUP_TAG_CAPTION: case CSOUP_TAG_TABLE: case CSOUP_TAG_TBODY: case CSOUP_TAG_TFOOT:
+               case CSOUP_TAG_THEAD: case CSOUP_TAG_TR: case CSOUP_TAG_TD: case CSOUP_TAG_TH:
+                   return true;
+               default:
+                   return false;
+           }
+       }
+       
        bool InSelectInTable::process(Token* t, HtmlTreeBuilder* tb) {
            //TokenDeleter tokenDeleter(t, tb->allocator());
            
-           if (t->isStartTagToken() && StringUtil::in(t->asStartTagToken()->tagName(), "caption", "table", "tbody", "tfoot") &&
-               StringUtil::in(t->asStartTagToken()->tagName(), "thead", "tr", "td", "th")) {
+           if (t->isStartTagToken() && isSelectInTableBreaker(t->asStartTagToken()->tagId())) {
                tb->error(this);
                processExtraEndTagToken("select", tb);
                return tb->process(t);
-           } else if (t->isEndTagToken() && StringUtil::in(t->asEndTagToken()->tagName(), "caption", "table", "tbody", "tfoot") && StringUtil::in(t->asEndTagToken()->tagName(), "thead", "tr", "td", "th")) {
+           } else if (t->isEndTagToken() && isSelectInTableBreaker(t->asEndTagToken()->tagId())) {
                tb->error(this);
-               if (tb->inTableScope(t->asEndTagToken()->tagName())) {
+               if (tb->inTableScope(t->asEndTagToken()->tagId())) {
                    processExtraEndTagToken("select", tb);
                    return (tb->process(t));
                } else
@@ -1517,9 +1595,9 @@ do { \
            } else if (t->isDoctypeToken()) {
                tb->error(this);
                return false;
-           } else if (t->isStartTagToken() && t->asStartTagToken()->tagName().equals("html")) {
+           } else if (t->isStartTagToken() && t->asStartTagToken()->tagId() == CSOUP_TAG_HTML) {
                return tb->process(t, InBody::instance());
-           } else if (t->isEndTagToken() && t->asEndTagToken()->tagName().equals("html")) {
+           } else if (t->isEndTagToken() && t->asEndTagToken()->tagId() == CSOUP_TAG_HTML) {
                if (tb->isFragmentParsing()) {
                    tb->error(this);
                    return false;
@@ -1548,31 +1626,33 @@ do { \
                return false;
            } else if (t->isStartTagToken()) {
                StartTagToken* start = t->asStartTagToken();
-               StringRef name = start->tagName();
-               if (name.equals("html")) {
-                   return tb->process(start, InBody::instance());
-               } else if (name.equals("frameset")) {
-                   tb->insert(start);
-               } else if (name.equals("frame")) {
-                   tb->insertEmpty(start);
-               } else if (name.equals("noframes")) {
-                   return tb->process(start, InHead::instance());
-               } else {
-                   tb->error(this);
-                   return false;
+               switch (start->tagId()) {
+                   case CSOUP_TAG_HTML:
+                       return tb->process(start, InBody::instance());
+                   case CSOUP_TAG_FRAMESET:
+                       tb->insert(start);
+                       break;
+                   case CSOUP_TAG_FRAME:
+                       tb->insertEmpty(start);
+                       break;
+                   case CSOUP_TAG_NOFRAMES:
+                       return tb->process(start, InHead::instance());
+                   default:
+                       tb->error(this);
+                       return false;
                }
-           } else if (t->isEndTagToken() && t->asEndTagToken()->tagName().equals("frameset")) {
-               if (tb->currentElement()->tagName().equals("html")) { // frag
+           } else if (t->isEndTagToken() && t->asEndTagToken()->tagId() == CSOUP_TAG_FRAMESET) {
+               if (tb->currentElement()->tagId() == CSOUP_TAG_HTML) { // frag
                    tb->error(this);
                    return false;
                } else {
                    tb->pop();
-                   if (!tb->isFragmentParsing() && !tb->currentElement()->tagName().equals("frameset")) {
+                   if (!tb->isFragmentParsing() && tb->currentElement()->tagId() != CSOUP_TAG_FRAMESET) {
                        tb->transition(AfterFrameset::instance());
                    }
                }
            } else if (t->isEOFToken()) {
-               if (!tb->currentElement()->tagName().equals("html")) {
+               if (tb->currentElement()->tagId() != CSOUP_TAG_HTML) {
                    tb->error(this);
                    return true;
                }
@@ -1593,11 +1673,11 @@ do { \
            } else if (t->isDoctypeToken()) {
                tb->error(this);
                return false;
-           } else if (t->isStartTagToken() && t->asStartTagToken()->tagName().equals("html")) {
+           } else if (t->isStartTagToken() && t->asStartTagToken()->tagId() == CSOUP_TAG_HTML) {
                return tb->process(t, InBody::instance());
-           } else if (t->isEndTagToken() && t->asEndTagToken()->tagName().equals("html")) {
+           } else if (t->isEndTagToken() && t->asEndTagToken()->tagId() == CSOUP_TAG_HTML) {
                tb->transition(AfterAfterFrameset::instance());
-           } else if (t->isStartTagToken() && t->asStartTagToken()->tagName().equals("noframes")) {
+           } else if (t->isStartTagToken() && t->asStartTagToken()->tagId() == CSOUP_TAG_NOFRAMES) {
                return tb->process(t, InHead::instance());
            } else if (t->isEOFToken()) {
                // cool your heels, we're complete
@@ -1613,7 +1693,7 @@ do { \
            
            if (t->isCommentToken()) {
                tb->insert(t->asCommentToken());
-           } else if (t->isDoctypeToken() || isWhitespace(t) || (t->isStartTagToken() && t->asStartTagToken()->tagName().equals("html"))) {
+           } else if (t->isDoctypeToken() || isWhitespace(t) || (t->isStartTagToken() && t->asStartTagToken()->tagId() == CSOUP_TAG_HTML)) {
                return tb->process(t, InBody::instance());
            } else if (t->isEOFToken()) {
                // nice work chuck
@@ -1630,11 +1710,11 @@ do { \
            
            if (t->isCommentToken()) {
                tb->insert(t->asCommentToken());
-           } else if (t->isDoctypeToken() || isWhitespace(t) || (t->isStartTagToken() && t->asStartTagToken()->tagName().equals("html"))) {
+           } else if (t->isDoctypeToken() || isWhitespace(t) || (t->isStartTagToken() && t->asStartTagToken()->tagId() == CSOUP_TAG_HTML)) {
                return tb->process(t, InBody::instance());
            } else if (t->isEOFToken()) {
                // nice work chuck
-           } else if (t->isStartTagToken() && t->asStartTagToken()->tagName().equals("noframes")) {
+           } else if (t->isStartTagToken() && t->asStartTagToken()->tagId() == CSOUP_TAG_NOFRAMES) {
                return tb->process(t, InHead::instance());
            } else {
                tb->error(this);
@@ -11,6 +11,7 @@
 
 #include "treebuilder.h"
 #include "../util/stringref.h"
+#include "../nodes/tag.h"
 
 namespace csoup {
     class StartTagToken;
@@ -22,6 +23,29 @@ namespace csoup {
         virtual ~HtmlTreeBuilderState() = 0;
         virtual bool process(Token* t, HtmlTreeBuilder* tb) = 0;
         
+        // The groups of tags the modes dispatch on. The sets are generated into
+        // tagsets.h by tools/gen_tag_table.py.
+        class Constants {
+        public:
+            static const TagSet InBodyStartToHead;
+            static const TagSet InBodyStartPClosers;
+            static const TagSet Headings;
+            static const TagSet InBodyStartPreListing;
+            static const TagSet InBodyStartLiBreakers;
+            static const TagSet DdDt;
+            static const TagSet Formatters;
+            static const TagSet InBodyStartApplets;
+            static const TagSet InBodyStartEmptyFormatters;
+            static const TagSet InBodyStartMedia;
+            static const StringRef InBodyStartInputAttribs[];
+            static const TagSet InBodyStartOptions;
+            static const TagSet InBodyStartRuby;
+            static const TagSet InBodyStartDrop;
+            static const TagSet InBodyEndClosers;
+            static const TagSet InBodyEndAdoptionFormatters;
+            static const TagSet InBodyEndTableFosters;
+        };
+        
     protected:
         struct TokenDeleter {
             TokenDeleter(Token* t, Allocator* allocator) : token_(t), allocator_(allocator) {}
@@ -42,30 +66,15 @@ namespace csoup {
         
         static bool isWhitespace(Token* t);
         
+        // end tags BeforeHtml and BeforeHead act on as if the tag they wait for was there
+        static bool isHeadBodyHtmlBr(TagIdEnum id);
+        
+        // col, colgroup, tbody, td, tfoot, th, thead and tr
+        static bool isTablePart(TagIdEnum id);
+        
         static void handleRcData(StartTagToken* startTag, HtmlTreeBuilder* tb);
         
         static void handleRawtext(StartTagToken* startTag, HtmlTreeBuilder* tb);
-        
-        class Constants {
-        public:
-            static const StringRef InBodyStartToHead[];
-            static const StringRef InBodyStartPClosers[];
-            static const StringRef Headings[];
-            static const StringRef InBodyStartPreListing[];
-            static const StringRef InBodyStartLiBreakers[];
-            static const StringRef DdDt[];
-            static const StringRef Formatters[];
-            static const StringRef InBodyStartApplets[];
-            static const StringRef InBodyStartEmptyFormatters[];
-            static const StringRef InBodyStartMedia[];
-            static const StringRef InBodyStartInputAttribs[];
-            static const StringRef InBodyStartOptions[];
-            static const StringRef InBodyStartRuby[];
-            static const StringRef InBodyStartDrop[];
-            static const StringRef InBodyEndClosers[];
-            static const StringRef InBodyEndAdoptionFormatters[];
-            static const StringRef InBodyEndTableFosters[];
-        };
     };
     
     inline HtmlTreeBuilderState::~HtmlTreeBuilderState() {}
@@ -93,10 +102,12 @@ namespace csoup {
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_BEGIN(InHead)
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_END
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_BEGIN(InHeadNoscript)
+    static bool isNoscriptHeadTag(TagIdEnum id);
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_END
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_BEGIN(AfterHead)
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_END
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_BEGIN(InBody)
+    bool adoptionAgency(Token* t, HtmlTreeBuilder* tb);
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_END
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_BEGIN(Text)
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_END
@@ -126,6 +137,7 @@ namespace csoup {
     bool anythingElse(Token* t, HtmlTreeBuilder* tb);
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_END
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_BEGIN(InSelectInTable)
+    static bool isSelectInTableBreaker(TagIdEnum id);
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_END
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_BEGIN(AfterBody)
     CSOUP_REGISTER_HTMLTREEBUILDER_STATE_END
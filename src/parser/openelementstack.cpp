@@ -0,0 +1,68 @@
+//
+//  openelementstack.cpp
+//  csoup
+//
+//  Created by mac on 12/22/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include <cstring>
+#include "openelementstack.h"
+#include "../util/allocators.h"
+
+namespace csoup {
+    namespace internal {
+        // the ids array holds a byte per element
+        CSOUP_STATIC_ASSERT(CSOUP_TAG_COUNT <= 256);
+        
+        OpenElementStack::OpenElementStack(Allocator* allocator) :
+        allocator_(allocator), elements_(NULL), ids_(NULL), size_(0), capacity_(0) {
+            CSOUP_ASSERT(allocator != NULL);
+            std::memset(counts_, 0, sizeof(counts_));
+        }
+        
+        OpenElementStack::~OpenElementStack() {
+            allocator_->free(elements_);
+            allocator_->free(ids_);
+        }
+        
+        size_t OpenElementStack::lastIndexOf(const TagIdEnum* ids, size_t len) const {
+            for (size_t i = size_; i > 0; -- i) {
+                uint8_t id = ids_[i - 1];
+                for (size_t t = 0; t < len; ++ t) {
+                    if (id == ids[t]) return i - 1;
+                }
+            }
+            
+            return size_;
+        }
+        
+        void OpenElementStack::insert(size_t index, Element* el) {
+            if (index > size_) index = size_;
+            if (size_ == capacity_) grow();
+            
+            std::memmove(elements_ + index + 1, elements_ + index, sizeof(*elements_) * (size_ - index));
+            std::memmove(ids_ + index + 1, ids_ + index, size_ - index);
+            elements_[index] = el;
+            ids_[index] = static_cast<uint8_t>(el->tagId());
+            ++ counts_[el->tagId()];
+            ++ size_;
+        }
+        
+        void OpenElementStack::remove(size_t index) {
+            CSOUP_ASSERT(index < size_);
+            -- counts_[ids_[index]];
+            
+            std::memmove(elements_ + index, elements_ + index + 1, sizeof(*elements_) * (size_ - index - 1));
+            std::memmove(ids_ + index, ids_ + index + 1, size_ - index - 1);
+            -- size_;
+        }
+        
+        void OpenElementStack::grow() {
+            size_t capacity = capacity_ == 0 ? 16 : capacity_ * 2;
+            elements_ = allocator_->realloc_t(elements_, sizeof(*elements_) * capacity_, sizeof(*elements_) * capacity);
+            ids_ = allocator_->realloc_t(ids_, capacity_, capacity);
+            capacity_ = capacity;
+        }
+    }
+}
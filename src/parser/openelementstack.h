@@ -0,0 +1,123 @@
+//
+//  openelementstack.h
+//  csoup
+//
+//  Created by mac on 12/22/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#ifndef CSOUP_INTERNAL_OPENELEMENTSTACK_H_
+#define CSOUP_INTERNAL_OPENELEMENTSTACK_H_
+
+#include "../util/common.h"
+#include "../nodes/element.h"
+
+namespace csoup {
+    class Allocator;
+    
+    namespace internal {
+        // The stack of open elements of the tree builder, bottom (html) first. The
+        // elements are kept in one array and their tag ids in a parallel one, so that
+        // looking for a tag reads a byte per element and closing it is one truncate().
+        // It also counts the open elements of each tag, so the tree builder can tell
+        // that a tag isn't in any scope without looking at the stack when none is open.
+        class OpenElementStack {
+        public:
+            OpenElementStack(Allocator* allocator);
+            ~OpenElementStack();
+            
+            size_t size() const {
+                return size_;
+            }
+            
+            bool empty() const {
+                return size_ == 0;
+            }
+            
+            Element* at(size_t index) const {
+                CSOUP_ASSERT(index < size_);
+                return elements_[index];
+            }
+            
+            TagIdEnum idAt(size_t index) const {
+                CSOUP_ASSERT(index < size_);
+                return static_cast<TagIdEnum>(ids_[index]);
+            }
+            
+            Element* top() const {
+                return at(size_ - 1);
+            }
+            
+            Element* bottom() const {
+                return at(0);
+            }
+            
+            // how many elements of the known tag id are open; the ones of unknown tags
+            // are all counted under CSOUP_TAG_UNKNOWN
+            size_t count(TagIdEnum id) const {
+                return counts_[id];
+            }
+            
+            // the index of the topmost open element of one of ids, or size() if none is
+            size_t lastIndexOf(const TagIdEnum* ids, size_t len) const;
+            
+            size_t lastIndexOf(TagIdEnum id) const {
+                return lastIndexOf(&id, 1);
+            }
+            
+            void push(Element* el) {
+                if (size_ == capacity_) grow();
+                elements_[size_] = el;
+                ids_[size_] = static_cast<uint8_t>(el->tagId());
+                ++ counts_[el->tagId()];
+                ++ size_;
+            }
+            
+            Element* pop() {
+                Element* el = top();
+                -- size_;
+                -- counts_[ids_[size_]];
+                return el;
+            }
+            
+            void insert(size_t index, Element* el);
+            
+            void remove(size_t index);
+            
+            void replace(size_t index, Element* el) {
+                CSOUP_ASSERT(index < size_);
+                -- counts_[ids_[index]];
+                elements_[index] = el;
+                ids_[index] = static_cast<uint8_t>(el->tagId());
+                ++ counts_[el->tagId()];
+            }
+            
+            // Pops every element above the first size ones at once.
+            void truncate(size_t size) {
+                CSOUP_ASSERT(size <= size_);
+                while (size_ > size) {
+                    -- counts_[ids_[-- size_]];
+                }
+            }
+            
+            void clear() {
+                truncate(0);
+            }
+            
+        private:
+            void grow();
+            
+            Allocator* allocator_;
+            Element** elements_;
+            uint8_t* ids_; // TagIdEnum of each element
+            size_t size_;
+            size_t capacity_;
+            size_t counts_[CSOUP_TAG_COUNT]; // by TagIdEnum
+            
+            OpenElementStack(const OpenElementStack&);
+            OpenElementStack& operator=(const OpenElementStack&);
+        };
+    }
+}
+
+#endif // CSOUP_INTERNAL_OPENELEMENTSTACK_H_
@@ -6,4 +6,42 @@
 //  Copyright (c) 2014 windpls. All rights reserved.
 //
 
+#include "../util/stringbuffer.h"
 #include "parseerror.h"
+
+namespace csoup {
+    namespace {
+        const char* const kMessages[CSOUP_PARSE_ERROR_CODE_COUNT] = {
+            "Invalid UTF-8 sequence",
+            "Invalid code point in input",
+            "Truncated UTF-8 sequence at end of input",
+            "Unexpected character in input",
+            "Unexpectedly reached end of file (EOF)",
+            "Invalid character reference: numeric reference with no numerals",
+            "Invalid character reference: missing semicolon",
+            "Invalid character reference: value is overflow",
+            "Invalid character reference: character outside of valid range",
+            "Invalid character reference: invalid named reference",
+            "Self closing flag not acknowledged",
+            "Unexpected token"
+        };
+    }
+    
+    StringRef ParseError::message(ParseErrorEnum code) {
+        CSOUP_ASSERT(code < CSOUP_PARSE_ERROR_CODE_COUNT);
+        return StringRef(kMessages[code]);
+    }
+    
+    void ParseError::appendMessage(StringBuffer* out) const {
+        if (code() != CSOUP_PARSE_ERROR_UNEXPECTED_CHARACTER) {
+            out->appendString(errorMessage());
+            return;
+        }
+        
+        out->appendString(StringRef("Unexpected character '"));
+        if (character_ >= 0) {
+            out->append(character_);
+        }
+        out->appendString(StringRef("' in input"));
+    }
+}
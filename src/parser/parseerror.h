@@ -11,27 +11,88 @@
 
 #include "../util/common.h"
 #include "../util/stringref.h"
-#include "../util/csoup_string.h"
 
 namespace csoup {
+    class StringBuffer;
+    
+    // Kinds of input decoding errors, counted separately by ParseErrorList.
+    typedef enum {
+        CSOUP_DECODE_ERROR_INVALID_SEQUENCE,    // malformed, overlong or surrogate UTF-8
+        CSOUP_DECODE_ERROR_INVALID_CODE_POINT,  // well-formed, but not allowed in HTML
+        CSOUP_DECODE_ERROR_TRUNCATED,           // the input ends inside a sequence
+        CSOUP_DECODE_ERROR_KIND_COUNT
+    } DecodeErrorEnum;
+    
+    // What a ParseError is about. The decoding errors come first, in DecodeErrorEnum order.
+    typedef enum {
+        CSOUP_PARSE_ERROR_INVALID_SEQUENCE,
+        CSOUP_PARSE_ERROR_INVALID_CODE_POINT,
+        CSOUP_PARSE_ERROR_TRUNCATED_SEQUENCE,
+        CSOUP_PARSE_ERROR_UNEXPECTED_CHARACTER,   // ParseError::character() is the character
+        CSOUP_PARSE_ERROR_UNEXPECTED_EOF,
+        CSOUP_PARSE_ERROR_REFERENCE_NO_NUMERALS,
+        CSOUP_PARSE_ERROR_REFERENCE_NO_SEMICOLON,
+        CSOUP_PARSE_ERROR_REFERENCE_OVERFLOW,
+        CSOUP_PARSE_ERROR_REFERENCE_OUT_OF_RANGE,
+        CSOUP_PARSE_ERROR_REFERENCE_UNKNOWN_NAME,
+        CSOUP_PARSE_ERROR_SELF_CLOSING_NOT_ACKNOWLEDGED,
+        CSOUP_PARSE_ERROR_UNEXPECTED_TOKEN,
+        CSOUP_PARSE_ERROR_CODE_COUNT
+    } ParseErrorEnum;
+    
+    inline ParseErrorEnum parseErrorForDecodeError(DecodeErrorEnum kind) {
+        return static_cast<ParseErrorEnum>(kind);
+    }
+    
+    // A parse error is a code and a position; its message is only looked up when asked for.
     class ParseError {
     public:
-        ParseError(long pos, const StringRef& errorMsg, Allocator* allocator) :
+        ParseError(ParseErrorEnum code, size_t pos, size_t line, size_t column, int character = -1) :
             pos_(pos),
-            errorMsg_(errorMsg, allocator){
+            line_(static_cast<uint32_t>(line)),
+            column_(static_cast<uint32_t>(column)),
+            character_(character),
+            code_(code) {
             
         }
         
+        ParseErrorEnum code() const {
+            return static_cast<ParseErrorEnum>(code_);
+        }
+        
         long pos() const {
-            return pos_;
+            return static_cast<long>(pos_);
+        }
+        
+        // 1-based; 0 if the position wasn't known when the error was added
+        size_t line() const {
+            return line_;
+        }
+        
+        size_t column() const {
+            return column_;
+        }
+        
+        // the offending character of CSOUP_PARSE_ERROR_UNEXPECTED_CHARACTER, -1 at the end of input
+        int character() const {
+            return character_;
         }
         
+        // the message for the code, without the character
         StringRef errorMessage() const {
-            return errorMsg_.ref();
+            return message(code());
         }
+        
+        // appends the full message, e.g. "Unexpected character '<' in input"
+        void appendMessage(StringBuffer* out) const;
+        
+        static StringRef message(ParseErrorEnum code);
     private:
-        long pos_;
-        String errorMsg_;
+        size_t pos_;
+        uint32_t line_;
+        uint32_t column_;
+        int32_t character_;
+        uint8_t code_;
     };
 }
 
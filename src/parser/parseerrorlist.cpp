@@ -10,8 +10,11 @@
 
 namespace csoup {
     ParseErrorList::ParseErrorList(size_t maxSize, Allocator* allocator)  :
+    errorList_(maxSize > INITIAL_CAPACITY ? INITIAL_CAPACITY : (maxSize > 0 ? maxSize : 1), allocator),
     maxSize_(maxSize),
-    errorList_(maxSize > INITIAL_CAPACITY ? INITIAL_CAPACITY : maxSize, allocator) {
-        
+    maxDecodeErrors_(8) {
+        for (int i = 0; i < CSOUP_DECODE_ERROR_KIND_COUNT; ++ i) {
+            decodeErrorCounts_[i] = listedDecodeErrors_[i] = 0;
+        }
     }
 }
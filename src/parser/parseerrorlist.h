@@ -17,6 +17,8 @@ namespace csoup {
     public:
         ParseErrorList(size_t maxSize, Allocator* allocator = NULL);
         
+        // A list of size 0 tracks no errors; decoding errors are then only counted.
+        
         bool notFull() const {
             return errorList_.size() < maxSize_;
         }
@@ -25,6 +27,41 @@ namespace csoup {
             return maxSize_;
         }
         
+        // Decoding errors of one kind are listed at most this many times (default 8),
+        // so that a badly encoded page doesn't crowd out everything else. They are
+        // all counted in decodeErrorCount().
+        void setMaxDecodeErrors(size_t maxPerKind) {
+            maxDecodeErrors_ = maxPerKind;
+        }
+        
+        size_t maxDecodeErrors() const {
+            return maxDecodeErrors_;
+        }
+        
+        bool tracksDecodeErrors() const {
+            return maxSize_ > 0 && maxDecodeErrors_ > 0;
+        }
+        
+        size_t decodeErrorCount(DecodeErrorEnum kind) const {
+            return decodeErrorCounts_[kind];
+        }
+        
+        size_t listedDecodeErrorCount(DecodeErrorEnum kind) const {
+            return listedDecodeErrors_[kind];
+        }
+        
+        void countDecodeErrors(DecodeErrorEnum kind, size_t n) {
+            decodeErrorCounts_[kind] += n;
+        }
+        
+        // adds a listed decoding error, unless the list or the kind's cap is full
+        ParseError* appendDecodeError(DecodeErrorEnum kind) {
+            if (listedDecodeErrors_[kind] >= maxDecodeErrors_) return NULL;
+            ParseError* error = appendError();
+            if (error != NULL) ++ listedDecodeErrors_[kind];
+            return error;
+        }
+        
         Allocator* allocator() {
             return errorList_.allocator();
         }
@@ -32,11 +69,29 @@ namespace csoup {
         ParseError* appendError() {
             return notFull() ? errorList_.push() : NULL;
         }
+        
+        size_t size() const {
+            return errorList_.size();
+        }
+        
+        const ParseError* get(size_t index) const {
+            return errorList_.at(index);
+        }
+        
+        // drops the errors after the first size ones
+        void truncate(size_t size) {
+            while (errorList_.size() > size) {
+                errorList_.pop();
+            }
+        }
     private:
         static const int INITIAL_CAPACITY = 16;
         
         internal::Vector<ParseError> errorList_;
         size_t maxSize_;
+        size_t maxDecodeErrors_;
+        size_t decodeErrorCounts_[CSOUP_DECODE_ERROR_KIND_COUNT];
+        size_t listedDecodeErrors_[CSOUP_DECODE_ERROR_KIND_COUNT];
     };
 }
 
@@ -0,0 +1,303 @@
+//
+//  saxparser.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include "../util/allocators.h"
+#include "../util/stringbuffer.h"
+#include "../util/stringutil.h"
+#include "../internal/vector.h"
+#include "../internal/structuralindex.h"
+#include "characterreader.h"
+#include "parseerrorlist.h"
+#include "token.h"
+#include "tokeniser.h"
+#include "tokeniserstate.h"
+#include "saxparser.h"
+
+namespace csoup {
+    namespace {
+        const StringRef kVoidTags[] = {
+            "area", "base", "basefont", "bgsound", "br", "col", "embed", "frame", "hr", "img", "input",
+            "keygen", "link", "menuitem", "meta", "param", "source", "track", "wbr"
+        };
+
+        // start tags that end an open <p>
+        const StringRef kClosesParagraph[] = {
+            "address", "article", "aside", "blockquote", "center", "dd", "details", "dialog", "dir", "div",
+            "dl", "dt", "fieldset", "figcaption", "figure", "footer", "form", "h1", "h2", "h3", "h4", "h5",
+            "h6", "header", "hgroup", "hr", "li", "listing", "main", "menu", "nav", "ol", "p", "plaintext",
+            "pre", "section", "summary", "table", "ul", "xmp"
+        };
+
+        const StringRef kHeadings[] = {
+            "h1", "h2", "h3", "h4", "h5", "h6"
+        };
+
+        // scope boundaries, see "has an element in scope" in the HTML spec
+        const StringRef kScope[] = {
+            "applet", "caption", "html", "table", "td", "th", "marquee", "object", "template"
+        };
+        const StringRef kButtonScope[] = {
+            "applet", "caption", "html", "table", "td", "th", "marquee", "object", "template", "button"
+        };
+        const StringRef kListItemScope[] = {
+            "applet", "caption", "html", "table", "td", "th", "marquee", "object", "template", "ol", "ul"
+        };
+        const StringRef kTableScope[] = {
+            "html", "table", "template"
+        };
+
+        bool in(const StringRef& name, const StringRef* names, size_t count) {
+            return StringUtil::in(name, names, count);
+        }
+
+        // the tokeniser state the content of an element is read in
+        internal::TokeniserState* contentState(const StringRef& name) {
+            if (StringUtil::in(name, "title", "textarea"))
+                return internal::Rcdata::instance();
+            if (StringUtil::in(name, "iframe", "noembed", "noframes", "style", "xmp"))
+                return internal::RawText::instance();
+            if (name.equals("script"))
+                return internal::ScriptData::instance();
+            if (name.equals("plaintext"))
+                return internal::PlainText::instance();
+            return NULL;
+        }
+    }
+
+    SaxParser::SaxParser(SaxHandler* handler, Allocator* allocator) :
+    handler_(handler), allocator_(allocator), tokeniser_(NULL), mode_(CSOUP_SAX_TOKENS),
+    charset_(CSOUP_CHARSET_UNKNOWN), stopped_(false), useStructuralIndex_(false), skippedTags_(NULL),
+    skippedTagCount_(0), openNames_(NULL), openStarts_(NULL) {
+        CSOUP_ASSERT(handler != NULL);
+        CSOUP_ASSERT(allocator != NULL);
+
+        openNames_ = CSOUP_NEW1(allocator, StringBuffer, allocator);
+        openStarts_ = CSOUP_NEW2(allocator, internal::Vector<size_t>, 16, allocator);
+    }
+
+    SaxParser::~SaxParser() {
+        destroy(&openNames_);
+        destroy(&openStarts_, allocator_);
+    }
+
+    bool SaxParser::parse(const StringRef& input, ParseErrorList* errors) {
+        size_t bomLength;
+        CharsetEnum charset = charsetFromBom(input, &bomLength);
+        if (charset == CSOUP_CHARSET_UNKNOWN) {
+            charset = charset_ != CSOUP_CHARSET_UNKNOWN ? charset_ : sniffCharset(input, &bomLength);
+        }
+
+        StringRef body(input.data() + bomLength, input.size() - bomLength);
+        StringBuffer decoded(allocator_);
+        if (charset != CSOUP_CHARSET_UTF8) {
+            transcodeToUtf8(charset, body, &decoded);
+        }
+
+        ParseErrorList noErrors(0, allocator_);
+        CharacterReader reader(charset == CSOUP_CHARSET_UTF8 ? body : decoded.ref());
+        internal::StructuralIndex index(allocator_);
+        if (useStructuralIndex_) {
+            index.build(reader.input());
+            reader.setStructuralIndex(&index);
+        }
+        Tokeniser tokeniser(&reader, errors != NULL ? errors : &noErrors, allocator_);
+        tokeniser.setSkippedTags(skippedTags_, skippedTagCount_);
+
+        tokeniser_ = &tokeniser;
+        stopped_ = false;
+        openNames_->clear();
+        openStarts_->clear();
+
+        for (;;) {
+            // the reader is final, so read() never runs out of input
+            Token* token = tokeniser.read();
+            if (tokeniser.endsSkippedContent()) {
+                handler_->skippedContent(tokeniser.skippedContent(), tokeniser.skippedPos());
+            }
+            bool isEnd = token->isEOFToken();
+            if (!stopped_) {
+                process(token);
+            }
+            tokeniser.recycle(token);
+
+            if (isEnd || stopped_) break;
+        }
+
+        tokeniser_ = NULL;
+        return !stopped_;
+    }
+
+    void SaxParser::process(Token* token) {
+        switch (token->tokenType()) {
+            case CSOUP_TOKEN_START_TAG:
+                startTag(token);
+                break;
+            case CSOUP_TOKEN_END_TAG:
+                endTag(token);
+                break;
+            case CSOUP_TOKEN_CHARACTER:
+                handler_->text(token->asCharacterToken()->data(), token->sourcePos());
+                break;
+            case CSOUP_TOKEN_COMMENT:
+                handler_->comment(token->asCommentToken()->data(), token->sourcePos());
+                break;
+            case CSOUP_TOKEN_DOCTYPE: {
+                DoctypeToken* doctype = token->asDoctypeToken();
+                handler_->doctype(doctype->name(), doctype->publicIdentifier(),
+                                  doctype->systemIdentifier(), doctype->forceQuirks());
+                break;
+            }
+            case CSOUP_TOKEN_EOF:
+                if (mode_ == CSOUP_SAX_BALANCED && openCount() > 0) {
+                    endOpen(0, kNoSourcePos);
+                }
+                if (!stopped_) {
+                    handler_->endDocument();
+                }
+                break;
+        }
+    }
+
+    void SaxParser::startTag(Token* token) {
+        StartTagToken* tag = token->asStartTagToken();
+        StringRef name = tag->tagName();
+        internal::TokeniserState* state = contentState(name);
+        if (state != NULL) {
+            tokeniser_->transition(state);
+        }
+
+        const Attributes* attributes = tag->attributes();
+        if (attributes != NULL && attributes->size() == 0) {
+            attributes = NULL;
+        }
+
+        if (mode_ == CSOUP_SAX_TOKENS) {
+            handler_->startTag(name, attributes, tag->selfClosing(), token->sourcePos());
+            return;
+        }
+
+        if (in(name, kClosesParagraph, arrayLength(kClosesParagraph))) {
+            closeOpen("p", kButtonScope, arrayLength(kButtonScope));
+        }
+
+        if (name.equals("li")) {
+            closeOpen("li", kListItemScope, arrayLength(kListItemScope));
+        } else if (StringUtil::in(name, "dd", "dt")) {
+            closeOpen("dd", kScope, arrayLength(kScope));
+            closeOpen("dt", kScope, arrayLength(kScope));
+        } else if (in(name, kHeadings, arrayLength(kHeadings))) {
+            if (openCount() > 0 && in(openName(openCount() - 1), kHeadings, arrayLength(kHeadings))) {
+                endOpen(openCount() - 1, kNoSourcePos);
+            }
+        } else if (StringUtil::in(name, "option", "optgroup")) {
+            if (openCount() > 0 && openName(openCount() - 1).equals("option")) {
+                endOpen(openCount() - 1, kNoSourcePos);
+            }
+        } else if (StringUtil::in(name, "td", "th")) {
+            closeOpen("td", kTableScope, arrayLength(kTableScope));
+            closeOpen("th", kTableScope, arrayLength(kTableScope));
+        } else if (name.equals("tr")) {
+            closeOpen("tr", kTableScope, arrayLength(kTableScope));
+        } else if (StringUtil::in(name, "tbody", "thead", "tfoot")) {
+            closeOpen("tbody", kTableScope, arrayLength(kTableScope));
+            closeOpen("thead", kTableScope, arrayLength(kTableScope));
+            closeOpen("tfoot", kTableScope, arrayLength(kTableScope));
+        } else if (name.equals("a")) {
+            // stands in for the adoption agency: links don't nest
+            closeOpen("a", kScope, arrayLength(kScope));
+        }
+
+        if (stopped_) return;
+        handler_->startTag(name, attributes, tag->selfClosing(), token->sourcePos());
+
+        if (in(name, kVoidTags, arrayLength(kVoidTags))) {
+            tokeniser_->setAcknowledgeSelfClosingFlag();
+            if (!stopped_) {
+                handler_->endTag(name, kNoSourcePos);
+            }
+        } else {
+            pushOpen(name);
+        }
+    }
+
+    void SaxParser::endTag(Token* token) {
+        StringRef name = token->asEndTagToken()->tagName();
+        if (mode_ == CSOUP_SAX_TOKENS) {
+            handler_->endTag(name, token->sourcePos());
+            return;
+        }
+
+        // void elements have already ended, and html and body stay open until the end
+        if (in(name, kVoidTags, arrayLength(kVoidTags)) || StringUtil::in(name, "html", "body")) {
+            return;
+        }
+
+        const StringRef* boundaries = kScope;
+        size_t boundaryCount = arrayLength(kScope);
+        if (name.equals("p")) {
+            boundaries = kButtonScope;
+            boundaryCount = arrayLength(kButtonScope);
+        } else if (name.equals("li")) {
+            boundaries = kListItemScope;
+            boundaryCount = arrayLength(kListItemScope);
+        }
+
+        size_t index = findOpen(name, boundaries, boundaryCount);
+        if (index < openCount()) {
+            endOpen(index, token->sourcePos());
+        } else if (name.equals("p")) {
+            // </p> without a <p> is an empty paragraph
+            handler_->startTag(name, NULL, false, kNoSourcePos);
+            if (!stopped_) {
+                handler_->endTag(name, token->sourcePos());
+            }
+        }
+    }
+
+    size_t SaxParser::openCount() const {
+        return openStarts_->size();
+    }
+
+    StringRef SaxParser::openName(size_t index) const {
+        size_t begin = *openStarts_->at(index);
+        size_t end = index + 1 < openCount() ? *openStarts_->at(index + 1) : openNames_->size();
+        return StringRef(openNames_->data() + begin, end - begin);
+    }
+
+    void SaxParser::pushOpen(const StringRef& name) {
+        openStarts_->push(openNames_->size());
+        openNames_->appendString(name);
+    }
+
+    void SaxParser::endOpen(size_t index, size_t sourcePos) {
+        CSOUP_ASSERT(index < openCount());
+
+        while (openCount() > index && !stopped_) {
+            size_t top = openCount() - 1;
+            handler_->endTag(openName(top), top == index ? sourcePos : kNoSourcePos);
+            openNames_->truncate(*openStarts_->at(top));
+            openStarts_->pop();
+        }
+    }
+
+    size_t SaxParser::findOpen(const StringRef& name, const StringRef* boundaries, size_t boundaryCount) const {
+        for (size_t i = openCount(); i > 0; -- i) {
+            StringRef open = openName(i - 1);
+            if (open.equals(name)) return i - 1;
+            if (in(open, boundaries, boundaryCount)) break;
+        }
+        return openCount();
+    }
+
+    void SaxParser::closeOpen(const StringRef& name, const StringRef* boundaries, size_t boundaryCount) {
+        size_t index = findOpen(name, boundaries, boundaryCount);
+        if (index < openCount()) {
+            endOpen(index, kNoSourcePos);
+        }
+    }
+}
@@ -0,0 +1,139 @@
+//
+//  saxparser.h
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#ifndef CSOUP_SAXPARSER_H_
+#define CSOUP_SAXPARSER_H_
+
+#include "../util/common.h"
+#include "../util/stringref.h"
+#include "charset.h"
+
+namespace csoup {
+    class Allocator;
+    class Attributes;
+    class ParseErrorList;
+    class StringBuffer;
+    class Tokeniser;
+    class Token;
+
+    namespace internal {
+        template <class T>
+        class Vector;
+    }
+
+    // Receives a parse as a stream of events. Tag names are lower case. Everything
+    // passed to a callback is only valid during the call; sourcePos is the byte
+    // offset in the UTF-8 input, or kNoSourcePos for tags the parser implied.
+    class SaxHandler {
+    public:
+        virtual ~SaxHandler() {}
+
+        // attributes is NULL when the tag has none
+        virtual void startTag(const StringRef& name, const Attributes* attributes, bool selfClosing, size_t sourcePos) {}
+        virtual void endTag(const StringRef& name, size_t sourcePos) {}
+        virtual void text(const StringRef& data, size_t sourcePos) {}
+        virtual void comment(const StringRef& data, size_t sourcePos) {}
+        virtual void doctype(const StringRef& name, const StringRef& publicIdentifier,
+                             const StringRef& systemIdentifier, bool forceQuirks) {}
+        // the raw content of an element named in SaxParser::setSkippedTags(), right
+        // before its end tag
+        virtual void skippedContent(const StringRef& content, size_t sourcePos) {}
+        virtual void endDocument() {}
+    };
+
+    typedef enum {
+        CSOUP_SAX_TOKENS,   // tags as they are written, unbalanced or not (default)
+        CSOUP_SAX_BALANCED  // every start tag gets an end tag, see SaxParser::setMode()
+    } SaxModeEnum;
+
+    // Runs the tokeniser straight into a SaxHandler, without a tree builder or nodes.
+    // Script, style, title, textarea and the other raw text elements are tokenised
+    // as the tree builder would, so their content arrives as text.
+    class SaxParser {
+    public:
+        SaxParser(SaxHandler* handler, Allocator* allocator);
+        ~SaxParser();
+
+        // In CSOUP_SAX_BALANCED mode the parser keeps a stack of open element names
+        // and applies the tree construction fixups that don't need nodes: void
+        // elements end right away, a block start closes an open <p>, li, dd, dt,
+        // option, tr, td, th and headings close their open siblings, an end tag
+        // first ends the elements opened inside it, stray end tags are dropped and
+        // whatever is open at the end of input is ended. Implied html, head and
+        // body elements, foster parenting and the adoption agency are not done.
+        void setMode(SaxModeEnum mode) {
+            mode_ = mode;
+        }
+
+        SaxModeEnum mode() const {
+            return mode_;
+        }
+
+        // Same as TreeBuilder::setCharset().
+        void setCharset(CharsetEnum charset) {
+            charset_ = charset;
+        }
+
+        // Same as TreeBuilder::setStructuralIndex().
+        void setStructuralIndex(bool enabled) {
+            useStructuralIndex_ = enabled;
+        }
+        
+        // The content of elements named in names (lower case) produces no events but one
+        // SaxHandler::skippedContent(), see Tokeniser::setSkippedTags(). names must outlive
+        // the parser.
+        void setSkippedTags(const StringRef* names, size_t count) {
+            skippedTags_ = names;
+            skippedTagCount_ = count;
+        }
+        
+        // Parses input, sniffing its charset like TreeBuilder::parse(). errors may be
+        // NULL. Returns false if the handler stopped the parse.
+        bool parse(const StringRef& input, ParseErrorList* errors);
+
+        // May be called from a callback; no events follow it, not even endDocument().
+        void stop() {
+            stopped_ = true;
+        }
+
+    private:
+        void process(Token* token);
+        void startTag(Token* token);
+        void endTag(Token* token);
+
+        // open elements in CSOUP_SAX_BALANCED mode
+        size_t openCount() const;
+        StringRef openName(size_t index) const;
+        void pushOpen(const StringRef& name);
+        // ends the open elements from the top of the stack down to index; the one at
+        // index ends at sourcePos, those inside it were implied
+        void endOpen(size_t index, size_t sourcePos);
+        // index of the innermost open element named name, or openCount() if there is
+        // none or a scope boundary is in the way
+        size_t findOpen(const StringRef& name, const StringRef* boundaries, size_t boundaryCount) const;
+        void closeOpen(const StringRef& name, const StringRef* boundaries, size_t boundaryCount);
+
+        SaxHandler* handler_;
+        Allocator* allocator_;
+        Tokeniser* tokeniser_; // only set during parse()
+        SaxModeEnum mode_;
+        CharsetEnum charset_;
+        bool stopped_;
+        bool useStructuralIndex_;
+        const StringRef* skippedTags_;
+        size_t skippedTagCount_;
+
+        StringBuffer* openNames_; // names of the open elements, back to back
+        internal::Vector<size_t>* openStarts_; // where each name starts in openNames_
+
+        SaxParser(const SaxParser&);
+        SaxParser& operator=(const SaxParser&);
+    };
+}
+
+#endif // CSOUP_SAXPARSER_H_
@@ -0,0 +1,136 @@
+//
+//  tagsets.h
+//  csoup
+//
+//  Generated by tools/gen_tag_table.py; don't edit.
+//
+//  Defines the TagSet constants of HtmlTreeBuilder and HtmlTreeBuilderState;
+//  htmltreebuilderstate.cpp includes it once.
+//
+
+#ifndef CSOUP_TAGSETS_H_
+#define CSOUP_TAGSETS_H_
+
+#include "htmltreebuilder.h"
+#include "htmltreebuilderstate.h"
+
+namespace csoup {
+    // script style
+    const TagSet HtmlTreeBuilder::TagsScriptStyle = {{
+        CSOUP_UINT64_C2(0x00000000, 0x00000000),
+        CSOUP_UINT64_C2(0x00008080, 0x00000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+    // textarea title
+    const TagSet HtmlTreeBuilder::TagsRcdata = {{
+        CSOUP_UINT64_C2(0x00000000, 0x00000000),
+        CSOUP_UINT64_C2(0x21000000, 0x00000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+    // iframe noembed noframes style xmp
+    const TagSet HtmlTreeBuilder::TagsRawText = {{
+        CSOUP_UINT64_C2(0x10000000, 0x00000000),
+        CSOUP_UINT64_C2(0x00008000, 0x00300000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000040)
+    }};
+    // base basefont bgsound command link meta noframes script style title
+    const TagSet HtmlTreeBuilderState::Constants::InBodyStartToHead = {{
+        CSOUP_UINT64_C2(0x00000000, 0x08005800),
+        CSOUP_UINT64_C2(0x20008080, 0x00210080),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+    // address article aside blockquote center details dir div dl fieldset figcaption figure footer header hgroup
+    // menu nav ol p section summary ul
+    const TagSet HtmlTreeBuilderState::Constants::InBodyStartPClosers = {{
+        CSOUP_UINT64_C2(0x0180171C, 0x80410190),
+        CSOUP_UINT64_C2(0x00020100, 0x11044000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000004)
+    }};
+    // h1 h2 h3 h4 h5 h6
+    const TagSet HtmlTreeBuilderState::Constants::Headings = {{
+        CSOUP_UINT64_C2(0x003F0000, 0x00000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+    // pre listing
+    const TagSet HtmlTreeBuilderState::Constants::InBodyStartPreListing = {{
+        CSOUP_UINT64_C2(0x00000000, 0x00000000),
+        CSOUP_UINT64_C2(0x00000000, 0x80000100),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+    // address div p
+    const TagSet HtmlTreeBuilderState::Constants::InBodyStartLiBreakers = {{
+        CSOUP_UINT64_C2(0x00000008, 0x00000010),
+        CSOUP_UINT64_C2(0x00000000, 0x10000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+    // dd dt
+    const TagSet HtmlTreeBuilderState::Constants::DdDt = {{
+        CSOUP_UINT64_C2(0x00000020, 0x20000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+    // b big code em font i s small strike strong tt u
+    const TagSet HtmlTreeBuilderState::Constants::Formatters = {{
+        CSOUP_UINT64_C2(0x08000840, 0x01008400),
+        CSOUP_UINT64_C2(0x00006420, 0x00000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000003)
+    }};
+    // applet marquee object
+    const TagSet HtmlTreeBuilderState::Constants::InBodyStartApplets = {{
+        CSOUP_UINT64_C2(0x00000000, 0x00000020),
+        CSOUP_UINT64_C2(0x00000000, 0x00801000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+    // area br embed img keygen wbr
+    const TagSet HtmlTreeBuilderState::Constants::InBodyStartEmptyFormatters = {{
+        CSOUP_UINT64_C2(0x40000080, 0x00040040),
+        CSOUP_UINT64_C2(0x00000000, 0x00000008),
+        CSOUP_UINT64_C2(0x00000000, 0x00000020)
+    }};
+    // param source track
+    const TagSet HtmlTreeBuilderState::Constants::InBodyStartMedia = {{
+        CSOUP_UINT64_C2(0x00000000, 0x00000000),
+        CSOUP_UINT64_C2(0x80000800, 0x20000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+    // optgroup option
+    const TagSet HtmlTreeBuilderState::Constants::InBodyStartOptions = {{
+        CSOUP_UINT64_C2(0x00000000, 0x00000000),
+        CSOUP_UINT64_C2(0x00000000, 0x06000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+    // rp rt
+    const TagSet HtmlTreeBuilderState::Constants::InBodyStartRuby = {{
+        CSOUP_UINT64_C2(0x00000000, 0x00000000),
+        CSOUP_UINT64_C2(0x0000000C, 0x00000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+    // caption col colgroup frame head tbody td tfoot th thead tr
+    const TagSet HtmlTreeBuilderState::Constants::InBodyStartDrop = {{
+        CSOUP_UINT64_C2(0x00404000, 0x06200000),
+        CSOUP_UINT64_C2(0x4E600000, 0x00000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+    // address article aside blockquote button center details dir div dl fieldset figcaption figure footer header
+    // hgroup listing menu nav ol pre section summary ul
+    const TagSet HtmlTreeBuilderState::Constants::InBodyEndClosers = {{
+        CSOUP_UINT64_C2(0x0180171C, 0x80490190),
+        CSOUP_UINT64_C2(0x00020100, 0x81044100),
+        CSOUP_UINT64_C2(0x00000000, 0x00000004)
+    }};
+    // a b big code em font i nobr s small strike strong tt u
+    const TagSet HtmlTreeBuilderState::Constants::InBodyEndAdoptionFormatters = {{
+        CSOUP_UINT64_C2(0x08000840, 0x01008402),
+        CSOUP_UINT64_C2(0x00006420, 0x00080000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000003)
+    }};
+    // table tbody tfoot thead tr
+    const TagSet HtmlTreeBuilderState::Constants::InBodyEndTableFosters = {{
+        CSOUP_UINT64_C2(0x00000000, 0x00000000),
+        CSOUP_UINT64_C2(0x4A300000, 0x00000000),
+        CSOUP_UINT64_C2(0x00000000, 0x00000000)
+    }};
+} // namespace csoup
+
+#endif // CSOUP_TAGSETS_H_
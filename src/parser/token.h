@@ -30,6 +30,8 @@ namespace csoup {
         CSOUP_TOKEN_EOF
     };
     
+    const int kTokenTypeCount = CSOUP_TOKEN_EOF + 1;
+    
     class TagToken;
     class StartTagToken;
     class EndTagToken;
@@ -40,16 +42,30 @@ namespace csoup {
     
     class Token {
     public:
-        Token(TokenTypeEnum type) : tokenType_(type) {
+        Token(TokenTypeEnum type) : tokenType_(type), sourcePos_(kNoSourcePos) {
             
         }
         
         virtual ~Token() = 0;
         
+        // Empties the token for reuse, keeping the capacity of its buffers.
+        virtual void reset() {
+            sourcePos_ = kNoSourcePos;
+        }
+        
         TokenTypeEnum tokenType() const {
             return tokenType_;
         }
         
+        // byte offset of the token's first character in the input
+        size_t sourcePos() const {
+            return sourcePos_;
+        }
+        
+        void setSourcePos(size_t pos) {
+            sourcePos_ = pos;
+        }
+        
         bool isStartTagToken() const {
             return tokenType() == CSOUP_TOKEN_START_TAG;
         }
@@ -94,6 +110,7 @@ namespace csoup {
         
     private:
         TokenTypeEnum tokenType_;
+        size_t sourcePos_;
     };
     
     inline Token::~Token() {
@@ -120,6 +137,14 @@ namespace csoup {
             destroy(&systemIdentifier_);
         }
         
+        void reset() {
+            Token::reset();
+            name_->clear();
+            publicIdentifier_->clear();
+            systemIdentifier_->clear();
+            forceQuirks_ = false;
+        }
+        
         StringRef name() const {
             return name_->ref();
         }
@@ -178,6 +203,8 @@ namespace csoup {
                                             pendingAttributeName_(NULL),
                                             pendingAttributeValue_(NULL),
                                             attributes_(NULL),
+                                            tagId_(CSOUP_TAG_UNKNOWN),
+                                            tagIdResolved_(false),
                                             selfClosing_(false),
                                             allocator_(allocator) {
             
@@ -185,6 +212,17 @@ namespace csoup {
         
         virtual ~TagToken() = 0;
         
+        void reset() {
+            Token::reset();
+            if (tagName_) tagName_->clear();
+            if (pendingAttributeName_) pendingAttributeName_->clear();
+            if (pendingAttributeValue_) pendingAttributeValue_->clear();
+            if (attributes_) attributes_->clear();
+            tagId_ = CSOUP_TAG_UNKNOWN;
+            tagIdResolved_ = false;
+            selfClosing_ = false;
+        }
+        
         void setTagName(const StringRef& name) {
             if(!tagName_) {
                 tagName_ = new (allocator_->malloc_t<StringBuffer>()) StringBuffer(allocator_);
@@ -192,12 +230,41 @@ namespace csoup {
             
             tagName_->clear();
             tagName_->appendString(name);
+            tagId_ = Tag::idOf(tagName_->ref());
+            tagIdResolved_ = true;
+        }
+        
+        // Sets the whole name from the input, in any case, with hash taken while it
+        // was read (see CharacterReader::consumeTagName()). A known name is resolved
+        // from the hash and isn't copied; tagName() is then the tag's own.
+        void setTagNameRead(const StringRef& name, uint32_t hash) {
+            tagId_ = Tag::idOf(hash, name);
+            tagIdResolved_ = true;
+            if (tagId_ != CSOUP_TAG_UNKNOWN) {
+                if (tagName_) tagName_->clear();
+            } else {
+                ensureStringBuffer(&tagName_);
+                tagName_->clear();
+                tagName_->appendLowercased(name);
+            }
+        }
+        
+        bool hasTagName() const {
+            return tagIdResolved_ || (tagName_ != NULL && tagName_->size() > 0);
         }
         
         void finaliseTag() {
             if (pendingAttributeName_ != NULL && pendingAttributeName_->size() > 0) {
                 newAttribute();
             }
+            if (!tagIdResolved_) {
+                tagId_ = tagName_ != NULL ? Tag::idOf(tagName_->ref()) : CSOUP_TAG_UNKNOWN;
+                tagIdResolved_ = true;
+            }
+        }
+        
+        bool hasAttribute(const StringRef& key) const {
+            return attributes_ ? attributes_->hasAttribute(key) : false;
         }
         
         StringRef attribute(const StringRef& key) const {
@@ -205,13 +272,22 @@ namespace csoup {
         }
         
         StringRef tagName() const {
+            if (tagIdResolved_ && tagId_ != CSOUP_TAG_UNKNOWN && (tagName_ == NULL || tagName_->size() == 0)) {
+                return Tag::valueOf(tagId_)->tagName();
+            }
             CSOUP_ASSERT(tagName_ != NULL);
             return tagName_->ref();
         }
         
-        Tag* tag() const {
-            CSOUP_ASSERT(tagName_ != NULL);
-            return Tag::valueOf(tagName());
+        // Resolved by setTagName(), setTagNameRead() and finaliseTag(); CSOUP_TAG_UNKNOWN
+        // for names Tag doesn't know.
+        TagIdEnum tagId() const {
+            return tagId_;
+        }
+        
+        // NULL unless the tag is known
+        const Tag* tag() const {
+            return tagId_ != CSOUP_TAG_UNKNOWN ? Tag::valueOf(tagId_) : NULL;
         }
         
         bool selfClosing() const {
@@ -230,9 +306,8 @@ namespace csoup {
         void newAttribute() {
             ensureAttributes();
             
-            if (pendingAttributeName_ != NULL) {
-                CSOUP_ASSERT(pendingAttributeName_->size() > 0);
-                
+            // a reset token keeps an empty name buffer, which means no attribute yet
+            if (pendingAttributeName_ != NULL && pendingAttributeName_->size() > 0) {
                 if (pendingAttributeValue_ != NULL) {
                     attributes_->addAttribute(CSOUP_ATTR_NAMESPACE_NONE,
                                               pendingAttributeName_->ref(),
@@ -249,15 +324,25 @@ namespace csoup {
         }
         
         void appendTagName(int codePoint) {
-            ensureStringBuffer(&tagName_);
+            unresolveTagName();
             tagName_->append(codePoint);
         }
         
         void appendTagName(const StringRef& str) {
-            ensureStringBuffer(&tagName_);
+            unresolveTagName();
             tagName_->appendString(str);
         }
         
+        void appendTagNameLowercased(const StringRef& str) {
+            unresolveTagName();
+            tagName_->appendLowercased(str);
+        }
+        
+        void appendAttributeNameLowercased(const StringRef& str) {
+            ensureStringBuffer(&pendingAttributeName_);
+            pendingAttributeName_->appendLowercased(str);
+        }
+        
         void appendAttributeName(int codePoint) {
             ensureStringBuffer(&pendingAttributeName_);
             pendingAttributeName_->append(codePoint);
@@ -289,12 +374,24 @@ namespace csoup {
                 attributes_ = new (allocator_->malloc_t<Attributes>()) Attributes(allocator_);
             }
         }
+        
+        // the name grows, so it has to be in tagName_ and resolved again
+        void unresolveTagName() {
+            ensureStringBuffer(&tagName_);
+            if (tagIdResolved_ && tagId_ != CSOUP_TAG_UNKNOWN && tagName_->size() == 0) {
+                tagName_->appendString(Tag::valueOf(tagId_)->tagName());
+            }
+            tagId_ = CSOUP_TAG_UNKNOWN;
+            tagIdResolved_ = false;
+        }
     
     private:
         StringBuffer* tagName_;
         StringBuffer* pendingAttributeName_;
         StringBuffer* pendingAttributeValue_;
         Attributes* attributes_;
+        TagIdEnum tagId_;
+        bool tagIdResolved_; // tagId_ is up to date; a known name may then be missing from tagName_
         bool selfClosing_;
         
         Allocator* allocator_;
@@ -304,7 +401,7 @@ namespace csoup {
         destroy(&tagName_);
         destroy(&pendingAttributeName_);
         destroy(&pendingAttributeValue_);
-        destroy(&attributes_, attributes_->allocator());
+        destroy(&attributes_, allocator_);
     }
     
     class StartTagToken : public TagToken {
@@ -316,6 +413,7 @@ namespace csoup {
         StartTagToken(const StringRef& name, const Attributes& attrs, Allocator* allocator)
         :TagToken(CSOUP_TOKEN_START_TAG, allocator) {
             CSOUP_ASSERT(allocator != NULL);
+            ensureAttributes();
             for (size_t i = 0; i < attrs.size(); ++ i) {
                 const Attribute* attr = attrs.get(i);
                 attributes()->addAttribute(attr->key(), attr->value());
@@ -336,7 +434,7 @@ namespace csoup {
             CSOUP_ASSERT(allocator != NULL);
         }
         
-        EndTagToken(const StringRef& name, Allocator* allocator) : TagToken(CSOUP_TOKEN_START_TAG, allocator) {
+        EndTagToken(const StringRef& name, Allocator* allocator) : TagToken(CSOUP_TOKEN_END_TAG, allocator) {
             CSOUP_ASSERT(allocator != NULL);
             setTagName(name);
         }
@@ -355,6 +453,12 @@ namespace csoup {
             destroy(&content_);
         }
         
+        void reset() {
+            Token::reset();
+            content_->clear();
+            bogus_ = false;
+        }
+        
         void append(int c) {
             content_->append(c);
         }
@@ -381,21 +485,73 @@ namespace csoup {
     
     class CharacterToken : public Token {
     public:
-        CharacterToken(const StringRef& str, Allocator* allocator) : Token(CSOUP_TOKEN_CHARACTER) {
+        enum InputSpanTag { kInputSpan };
+        
+        explicit CharacterToken(Allocator* allocator) : Token(CSOUP_TOKEN_CHARACTER),
+                                                        data_(NULL), span_(NULL), spanSize_(0), allocator_(allocator) {
+            CSOUP_ASSERT(allocator != NULL);
+        }
+        
+        CharacterToken(const StringRef& str, Allocator* allocator) : Token(CSOUP_TOKEN_CHARACTER),
+                                                                      data_(NULL), span_(NULL), spanSize_(0),
+                                                                      allocator_(allocator) {
             CSOUP_ASSERT(allocator != NULL);
-            data_ = new (allocator->malloc_t<String>()) String(str, allocator);
+            data_ = new (allocator->malloc_t<StringBuffer>()) StringBuffer(allocator);
+            data_->appendString(str);
+        }
+        
+        // Refers to str, a run of the tokeniser's input, instead of copying it.
+        CharacterToken(const StringRef& str, InputSpanTag) : Token(CSOUP_TOKEN_CHARACTER),
+                                                            data_(NULL), span_(str.data()), spanSize_(str.size()),
+                                                            allocator_(NULL) {
+            CSOUP_ASSERT(span_ != NULL);
         }
         
         ~CharacterToken() {
             destroy(&data_);
         }
         
+        void reset() {
+            Token::reset();
+            if (data_) data_->clear();
+            span_ = NULL;
+            spanSize_ = 0;
+        }
+        
         StringRef data() const {
-            return data_->ref();
+            if (span_ != NULL) return StringRef(span_, spanSize_);
+            return data_ != NULL ? data_->ref() : StringRef("");
+        }
+        
+        // True if data() points into the input, which is only valid until the
+        // tokeniser moves on unless the input outlives the document.
+        bool isInputSpan() const {
+            return span_ != NULL;
+        }
+        
+        void setSpan(const StringRef& str) {
+            CSOUP_ASSERT(str.data() != NULL);
+            span_ = str.data();
+            spanSize_ = str.size();
+        }
+        
+        // Takes the characters in buffer without copying them; buffer gets
+        // what the token held before, so neither gives up its capacity.
+        void swapData(StringBuffer* buffer) {
+            CSOUP_ASSERT(allocator_ != NULL && buffer->allocator() == allocator_);
+            if (data_ == NULL) {
+                data_ = new (allocator_->malloc_t<StringBuffer>()) StringBuffer(allocator_);
+            }
+            data_->swap(*buffer);
+            span_ = NULL;
+            spanSize_ = 0;
         }
         
     private:
-        String* data_;
+        StringBuffer* data_;
+        const CharType* span_;
+        size_t spanSize_;
+        Allocator* allocator_;
     };
     
     class EOFToken : public Token {
@@ -7,8 +7,11 @@
 //
 
 #include <cctype>
+#include <cstring>
 
 #include "../nodes/entities.h"
+#include "../internal/lineindex.h"
+#include "parseerrorlist.h"
 #include "characterreader.h"
 #include "tokeniserstate.h"
 #include "tokeniser.h"
@@ -17,53 +20,214 @@
 #include "util/stringref.h"
 #include "util/stringbuffer.h"
 #include "util/csoup_string.h"
+#include "util/stringutil.h"
 #include "util/allocators.h"
 
 
 namespace csoup {
+    namespace {
+        // their content ends at the first end tag, whatever it looks like
+        const StringRef kRawTextTags[] = {
+            "iframe", "noembed", "noframes", "plaintext", "script", "style", "textarea", "title", "xmp"
+        };
+    }
+    
     Tokeniser::Tokeniser(CharacterReader* reader, ParseErrorList* errorList, Allocator* allocator) :
         allocator_(allocator), reader_(reader), errors_(errorList),
         state_(internal::Data::instance()), emitPending_(NULL), isEmitPending_(false),
-        charBuffer_(NULL), dataBuffer_(NULL), tagPending_(NULL), doctypePending_(NULL),
-        commentPending_(NULL), lastStartTag_(NULL), selfClosingFlagAcknowledged(true) {
+        charBuffer_(NULL), spanBegin_(NULL), spanEnd_(NULL), dataBuffer_(NULL), tagPending_(NULL), doctypePending_(NULL),
+        commentPending_(NULL), lastStartTagName_(NULL), lineIndex_(NULL), charStart_(0), tokenStart_(0),
+        selfClosingFlagAcknowledged(true), skippedTags_(NULL),
+        skippedTagCount_(0), skipPending_(false), skipNested_(false), skipDepth_(0), skippedPos_(0), skippedSize_(0),
+        skipEnded_(false), endsSkip_(false) {
         
         CSOUP_ASSERT(allocator != NULL);
         CSOUP_ASSERT(reader != NULL);
         CSOUP_ASSERT(errorList != NULL);
             
         charBuffer_ = new (allocator->malloc_t<StringBuffer>()) StringBuffer(allocator);
+        lastStartTagName_ = new (allocator->malloc_t<StringBuffer>()) StringBuffer(allocator);
+        lineIndex_ = CSOUP_NEW1(allocator, internal::LineIndex, allocator);
+        
+        for (int i = 0; i < CSOUP_DECODE_ERROR_KIND_COUNT; ++ i) {
+            decodeErrorsSeen_[i] = reader->decodeErrorCount(static_cast<DecodeErrorEnum>(i));
+        }
+        for (int i = 0; i < kTokenTypeCount; ++ i) {
+            spare_[i] = NULL;
+        }
+        reader->setDecodeErrorLogging(CSOUP_PARSE_ERRORS && errorList->tracksDecodeErrors());
     }
     
     Tokeniser::~Tokeniser() {
         destroy(&charBuffer_);
-        // you must destroying other memebers
+        destroy(&dataBuffer_);
+        destroy(&lastStartTagName_);
+        destroy(&lineIndex_, allocator_);
+        discardPending();
+        destroy(&emitPending_, allocator_);
+        for (int i = 0; i < kTokenTypeCount; ++ i) {
+            destroy(&spare_[i], allocator_);
+        }
     }
     
     Token* Tokeniser::read() {
         if (!selfClosingFlagAcknowledged) {
-            error(StringRef("Self closing flag not acknowledged"));
+            error(CSOUP_PARSE_ERROR_SELF_CLOSING_NOT_ACKNOWLEDGED);
             selfClosingFlagAcknowledged = true;
         }
         
-        while (isEmitPending_) {
-            state_->read(this, reader_);
+        if (!isEmitPending_) {
+            discardPending();
+            
+            if (skipPending_) {
+                // whatever state the invoker chose for the element, its content isn't read
+                skipPending_ = false;
+                skipNested_ = !StringUtil::in(lastStartTagName_->ref(), kRawTextTags, arrayLength(kRawTextTags));
+                skipDepth_ = 0;
+                skippedPos_ = sourcePos();
+                skippedSize_ = 0;
+                state_ = internal::SkipContent::instance();
+            }
+            
+            // where to resume if the input runs out: the start of this read, or
+            // later on the last text state boundary with the characters gathered so far
+            TokeniserResumePoint resume;
+            resume.pos = reader_->pos();
+            resume.state = state_;
+            resume.chars = charCount();
+            resume.errors = errors_->size();
+            
+            if (runStates(&resume)) {
+                // errors found past the resume point will be found again
+                errors_->truncate(resume.errors);
+                discardPending();
+                recycle(emitPending_);
+                emitPending_ = NULL;
+                isEmitPending_ = false;
+                
+                truncateChars(resume.chars);
+                state_ = resume.state;
+                reader_->clearStarved();
+                reader_->seek(resume.pos);
+                
+                if (charCount() == 0) {
+                    collectDecodeErrors();
+                    return NULL;
+                }
+            }
         }
         
         Token* ret;
-        if (charBuffer_->size() > 0) {
-            ret = new (allocator_->malloc_t<CharacterToken>()) CharacterToken(charBuffer_->ref(), allocator_);
-            charBuffer_->clear();
+        if (charCount() > 0) {
+            CharacterToken* chars = static_cast<CharacterToken*>(takeSpare(CSOUP_TOKEN_CHARACTER));
+            if (chars == NULL) {
+                chars = CSOUP_NEW1(allocator_, CharacterToken, allocator_);
+            }
+            
+            if (spanBegin_ != NULL) {
+                // the tree builder is done with the token before the input can move
+                chars->setSpan(StringRef(spanBegin_, spanEnd_ - spanBegin_));
+                spanBegin_ = spanEnd_ = NULL;
+            } else {
+                chars->swapData(charBuffer_);
+                charBuffer_->clear();
+            }
+            
+            ret = chars;
+            ret->setSourcePos(charStart_);
+            charStart_ = sourcePos();
         } else {
             isEmitPending_ = false;
             ret = emitPending_;
             
             // note that JSOUP didn't do this; I just guess the implementation
             emitPending_ = NULL;
+            
+            // tokens the tree builder emits already carry their position
+            if (ret->sourcePos() == kNoSourcePos) {
+                ret->setSourcePos(tokenStart_);
+            }
+            
+            if (ret->isStartTagToken()) {
+                StartTagToken* tag = ret->asStartTagToken();
+                lastStartTagName_->clear();
+                lastStartTagName_->appendString(tag->tagName());
+                skipPending_ = skippedTagCount_ > 0 && !tag->selfClosing() &&
+                               StringUtil::in(tag->tagName(), skippedTags_, skippedTagCount_);
+            }
         }
         
+        endsSkip_ = skipEnded_;
+        skipEnded_ = false;
+        collectDecodeErrors();
         return ret;
     }
     
+    bool Tokeniser::runStates(TokeniserResumePoint* resume) {
+        while (!isEmitPending_) {
+            bool inText = state_->isText() && !hasPending();
+            if (inText) {
+                saveResumePoint(resume);
+            }
+            
+            state_->read(this, reader_);
+            
+            if (reader_->starved()) {
+                stepStarved(inText, resume);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    void Tokeniser::saveResumePoint(TokeniserResumePoint* resume) {
+        resume->pos = reader_->pos();
+        resume->state = state_;
+        resume->chars = charCount();
+        resume->errors = errors_->size();
+        
+        // whatever starts from here starts at this position
+        tokenStart_ = sourcePos();
+        if (resume->chars == 0) charStart_ = tokenStart_;
+    }
+    
+    void Tokeniser::stepStarved(bool inText, TokeniserResumePoint* resume) {
+        // a text state that ran into the end of the input only gathered complete
+        // characters; any other state may have acted on the cut
+        if (inText && state_ == resume->state && !isEmitPending_ && !hasPending()) {
+            resume->pos = reader_->pos();
+            resume->chars = charCount();
+            resume->errors = errors_->size();
+        }
+    }
+    
+    void Tokeniser::recycle(Token* token) {
+        if (token == NULL) return;
+        
+        Token** spare = &spare_[token->tokenType()];
+        if (*spare == NULL) {
+            *spare = token;
+        } else {
+            token->~Token();
+            allocator_->free(token);
+        }
+    }
+    
+    Token* Tokeniser::takeSpare(TokenTypeEnum type) {
+        Token* token = spare_[type];
+        if (token != NULL) {
+            spare_[type] = NULL;
+            token->reset();
+        }
+        return token;
+    }
+    
+    void Tokeniser::discardPending() {
+        recycle(tagPending_);       tagPending_     = NULL;
+        recycle(commentPending_);   commentPending_ = NULL;
+        recycle(doctypePending_);   doctypePending_ = NULL;
+    }
+    
     void Tokeniser::emit(Token* token) {
         // Need to be reconsidered;
 //        Token* candidates[] = {tagPending_, doctypePending_, commentPending_, lastStartTag_, emitPending_};
@@ -77,18 +241,70 @@ namespace csoup {
         
         CSOUP_ASSERT(emitPending_ == NULL);
         emitPending_ = token;
+        isEmitPending_ = true;
     }
     
     void Tokeniser::emit(const StringRef& str) {
+        if (str.size() == 0) return;
+        
+        if (charBuffer_->size() == 0) {
+            // runs the states consume straight from the input are kept where they are
+            StringRef input = reader_->input();
+            bool inInput = str.data() >= input.data() && str.data() + str.size() <= input.data() + input.size();
+            if (inInput && spanBegin_ == NULL) {
+                spanBegin_ = str.data();
+                spanEnd_ = str.data() + str.size();
+                return;
+            }
+            // literals the states emit for what they just consumed, like "</", match
+            // the input that follows, so they extend the slice as well
+            const CharType* inputEnd = input.data() + input.size();
+            if (spanBegin_ != NULL && (str.data() == spanEnd_ ||
+                (static_cast<size_t>(inputEnd - spanEnd_) >= str.size() &&
+                 std::memcmp(spanEnd_, str.data(), str.size()) == 0))) {
+                spanEnd_ += str.size();
+                return;
+            }
+            flushSpan();
+        }
         charBuffer_->appendString(str);
     }
     
     void Tokeniser::emit(int c) {
+        if (spanBegin_ != NULL && c >= 0 && c < 0x80 && spanEnd_ < reader_->input().data() + reader_->input().size() &&
+            *spanEnd_ == c) {
+            ++ spanEnd_;
+            return;
+        }
+        flushSpan();
         charBuffer_->append(c);
     }
     
+    size_t Tokeniser::charCount() const {
+        return spanBegin_ != NULL ? static_cast<size_t>(spanEnd_ - spanBegin_) : charBuffer_->size();
+    }
+    
+    void Tokeniser::truncateChars(size_t n) {
+        if (spanBegin_ != NULL) {
+            spanEnd_ = spanBegin_ + n;
+            if (n == 0) spanBegin_ = spanEnd_ = NULL;
+        } else {
+            charBuffer_->truncate(n);
+        }
+    }
+    
+    void Tokeniser::flushSpan() {
+        if (spanBegin_ != NULL) {
+            charBuffer_->appendString(StringRef(spanBegin_, spanEnd_ - spanBegin_));
+            spanBegin_ = spanEnd_ = NULL;
+        }
+    }
+    
     void Tokeniser::emitEOF() {
-        EOFToken* eof = new (allocator_->malloc_t<EOFToken>()) EOFToken();
+        Token* eof = takeSpare(CSOUP_TOKEN_EOF);
+        if (eof == NULL) {
+            eof = new (allocator_->malloc_t<EOFToken>()) EOFToken();
+        }
         emit(eof);
     }
     
@@ -102,6 +318,7 @@ namespace csoup {
     
     void Tokeniser::appendBufferedDataToEmitPendingString() {
         if (dataBuffer_ != NULL) {
+            flushSpan();
             charBuffer_->appendString(dataBuffer_->ref());
         }
     }
@@ -111,6 +328,11 @@ namespace csoup {
         tagPending_->appendTagName(append);
     }
     
+    void Tokeniser::appendTagNameLowercased(const StringRef& append) {
+        CSOUP_ASSERT(tagPending_ != NULL);
+        tagPending_->appendTagNameLowercased(append);
+    }
+    
     void Tokeniser::appendTagName(const int c) {
         CSOUP_ASSERT(tagPending_ != NULL);
         tagPending_->appendTagName(c);
@@ -159,69 +381,79 @@ namespace csoup {
             }
             
             if (buffer.size() == 0) {
-                characterReferenceError(StringRef("numeric reference with no numerals"));
+                characterReferenceError(CSOUP_PARSE_ERROR_REFERENCE_NO_NUMERALS);
                 reader_->rewindToMark();
                 return false;
             }
             
             if (!reader_->matchConsume(';')) {
-                characterReferenceError(StringRef("missing semicolon"));
+                characterReferenceError(CSOUP_PARSE_ERROR_REFERENCE_NO_SEMICOLON);
             }
             
-            int64_t charval = -1;
+            int64_t charval = 0;
             
             int base = isHexMode ? 16 : 10;
             for (size_t i = 0; i < buffer.size(); ++ i) {
-                charval = charval * base + (buffer.data()[i] - '0');
+                int digit = buffer.data()[i];
+                digit = std::isdigit(digit) ? digit - '0' : internal::asciiToLower(digit) - 'a' + 10;
+                charval = charval * base + digit;
                 
                 if (charval > (unsigned int)0xFFFFFFFF) {
-                    characterReferenceError(StringRef("value is overflow"));
+                    characterReferenceError(CSOUP_PARSE_ERROR_REFERENCE_OVERFLOW);
                     charval = -1;
                     break;
                 }
             }
             
             if (charval == -1 || (charval >= 0xD800 && charval <= 0xDFFF) || charval > 0x10FFFF) {
-                characterReferenceError("character outside of valid range");
+                characterReferenceError(CSOUP_PARSE_ERROR_REFERENCE_OUT_OF_RANGE);
                 output->append(replacementChar_);
             } else {
                 // TODO: We must check if charval is an valid utf8 codepoint
                 output->append(static_cast<int>(charval));
             }
         } else {
-            readReferenceName(&buffer);
-            buffer.append('\0');
-            
-            bool looksLegit = reader_->matches(';');
-            bool found = (Entities::isBaseNamedEntity(buffer.data()) ||
-                          (Entities::isNamedEntity(buffer.data()) && looksLegit));
-            
-            if (!found) {
-                reader_->rewindToMark();
-                if (looksLegit) {
-                    characterReferenceError("invalid named referenece");
+            // the longest entity name at the reader, in one walk of the entity trie
+            EntityMatch match;
+            if (!reader_->consumeNamedReference(&match)) {
+                // only "&" followed by alphanumerics and ';' is an error
+                for (int c = reader_->peek(); internal::isAsciiAlpha(c) || (c >= '0' && c <= '9'); c = reader_->peek()) {
+                    reader_->advance();
                 }
-                
+                if (reader_->matches(';')) {
+                    characterReferenceError(CSOUP_PARSE_ERROR_REFERENCE_UNKNOWN_NAME);
+                }
+                reader_->rewindToMark();
                 return false;
             }
             
+            // for compatibility "&amp=" and "&ampx" in attribute values stay as they are
             int c = reader_->peek();
-            if (inAttribute && (std::isalpha(c) || std::isdigit(c) || c == '-' || c == '-' || c == '_')) {
+            if (!match.semicolon && inAttribute && (c == '=' || internal::isAsciiAlpha(c) || (c >= '0' && c <= '9'))) {
                 reader_->rewindToMark();
                 return false;
             }
             
-            if (!reader_->matchConsume(';')) {
-                characterReferenceError("missing semicolon"); // missing semi
+            if (!match.semicolon) {
+                characterReferenceError(CSOUP_PARSE_ERROR_REFERENCE_NO_SEMICOLON); // missing semi
+            }
+            output->append(match.codePoints[0]);
+            if (match.codePoints[1] != 0) {
+                output->append(match.codePoints[1]);
             }
-            output->append(Entities::getCharacterByName(buffer.data()));
         }
         
         return true;
     }
     
     TagToken* Tokeniser::createTagPending(bool start) {
-        CSOUP_ASSERT(tagPending_ == NULL);
+        // an end tag that turned out to be text may have left one behind
+        recycle(tagPending_);
+        tagPending_ = static_cast<TagToken*>(takeSpare(start ? CSOUP_TOKEN_START_TAG : CSOUP_TOKEN_END_TAG));
+        if (tagPending_ != NULL) {
+            return tagPending_;
+        }
+        
         if (start) {
             tagPending_ = new (allocator_->malloc_t<StartTagToken>()) StartTagToken(allocator_);
         } else {
@@ -239,7 +471,11 @@ namespace csoup {
     }
     
     void Tokeniser::createCommentPending() {
-        commentPending_ = new (allocator_->malloc_t<CommentToken>()) CommentToken(allocator_);
+        recycle(commentPending_);
+        commentPending_ = static_cast<CommentToken*>(takeSpare(CSOUP_TOKEN_COMMENT));
+        if (commentPending_ == NULL) {
+            commentPending_ = new (allocator_->malloc_t<CommentToken>()) CommentToken(allocator_);
+        }
     }
     
     void Tokeniser::emitCommentPending() {
@@ -248,7 +484,11 @@ namespace csoup {
     }
     
     void Tokeniser::createDoctypePending() {
-        doctypePending_ = new (allocator_->malloc_t<DoctypeToken>()) DoctypeToken(allocator_);
+        recycle(doctypePending_);
+        doctypePending_ = static_cast<DoctypeToken*>(takeSpare(CSOUP_TOKEN_DOCTYPE));
+        if (doctypePending_ == NULL) {
+            doctypePending_ = new (allocator_->malloc_t<DoctypeToken>()) DoctypeToken(allocator_);
+        }
     }
     
     void Tokeniser::emitDoctypePending() {
@@ -266,37 +506,75 @@ namespace csoup {
         new (dataBuffer_) StringBuffer(allocator_);
     }
     bool Tokeniser::isAppropriateEndTagToken() {
-        if (lastStartTag_ == NULL) return false;
-        return internal::strEqualsIgnoreCase(tagPending_->tagName(), lastStartTag_->tagName());
+        if (lastStartTagName_->size() == 0) return false;
+        return internal::strEqualsIgnoreCase(tagPending_->tagName(), lastStartTagName_->ref());
+    }
+    
+    StringRef Tokeniser::skippedContent() const {
+        size_t base = lineIndex_->base();
+        if (skippedPos_ < base) return StringRef("");
+        return StringRef(reader_->input().data() + (skippedPos_ - base), skippedSize_);
     }
     
     StringRef Tokeniser::appropriateEndTagName() {
-        if (lastStartTag_ == NULL) {
-            return StringRef("");
-        }
-        
-        return lastStartTag_->tagName();
+        return lastStartTagName_->ref();
     }
     
-    void Tokeniser::error(internal::TokeniserState* state) {
-        //errors_->
+#if CSOUP_PARSE_ERRORS
+    void Tokeniser::addError(ParseErrorEnum code) {
+        // the line index is only touched here, never while tokenising
+        size_t pos = sourcePos();
+        size_t line, column;
+        locate(pos, &line, &column);
+        int character = code == CSOUP_PARSE_ERROR_UNEXPECTED_CHARACTER ? reader_->peek() : -1;
+        new (errors_->appendError()) ParseError(code, pos, line, column, character);
     }
-    void Tokeniser::eofError(internal::TokeniserState* state) {
+    
+    void Tokeniser::collectDecodeErrors() {
+        for (int i = 0; i < CSOUP_DECODE_ERROR_KIND_COUNT; ++ i) {
+            DecodeErrorEnum kind = static_cast<DecodeErrorEnum>(i);
+            size_t count = reader_->decodeErrorCount(kind);
+            if (count != decodeErrorsSeen_[i]) {
+                errors_->countDecodeErrors(kind, count - decodeErrorsSeen_[i]);
+                decodeErrorsSeen_[i] = count;
+            }
+        }
         
+        for (int i = 0; i < CSOUP_DECODE_ERROR_KIND_COUNT; ++ i) {
+            DecodeErrorEnum kind = static_cast<DecodeErrorEnum>(i);
+            for (size_t j = 0; j < reader_->decodeErrorLogSize(kind); ++ j) {
+                ParseError* error = errors_->appendDecodeError(kind);
+                if (error == NULL) break;
+                
+                size_t pos = reader_->decodeErrorLogAt(kind, j);
+                size_t line, column;
+                lineIndex_->locate(reader_->input(), pos, &line, &column);
+                new (error) ParseError(parseErrorForDecodeError(kind), lineIndex_->base() + pos, line, column);
+            }
+        }
+        reader_->clearDecodeErrorLog();
     }
+#endif
     
-    void Tokeniser::characterReferenceError(const StringRef& message) {
-        
+    size_t Tokeniser::sourcePos() const {
+        return lineIndex_->base() + reader_->pos();
     }
-    void Tokeniser::error(const StringRef& errorMsg) {
-        
+    
+    void Tokeniser::locate(size_t sourcePos, size_t* line, size_t* column) {
+        CSOUP_ASSERT(sourcePos >= lineIndex_->base());
+        lineIndex_->locate(reader_->input(), sourcePos - lineIndex_->base(), line, column);
+    }
+    
+    void Tokeniser::inputDropped(size_t n) {
+        lineIndex_->discard(reader_->input(), n);
     }
     
     void Tokeniser::readHexSequence(StringBuffer *buffer) {
         int c = reader_->peek();
         while (std::isxdigit(c)) {
             buffer->append(c);
-            c = reader_->next();
+            reader_->advance();
+            c = reader_->peek();
         }
     }
     
@@ -304,20 +582,8 @@ namespace csoup {
         int c = reader_->peek();
         while (std::isdigit(c)) {
             buffer->append(c);
-            c = reader_->next();
-        }
-    }
-    
-    void Tokeniser::readReferenceName(csoup::StringBuffer *output) {
-        int c = reader_->peek();
-        while (std::isalpha(c)) {
-            output->append(c);
-            c = reader_->next();
-        }
-        
-        while (std::isdigit(c)) {
-            output->append(c);
-            c = reader_->next();
+            reader_->advance();
+            c = reader_->peek();
         }
     }
 }
\ No newline at end of file
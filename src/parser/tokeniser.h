@@ -10,42 +10,83 @@
 #ifndef CSOUP_TOKENISER_H_
 #define CSOUP_TOKENISER_H_
 
+#include "parseerrorlist.h"
+#include "token.h"
+
 namespace csoup {
     // Some class declarations
     namespace internal {
         class TokeniserState;
+        class LineIndex;
     }
     
     class CharacterReader;
-    class ParseErrorList;
-    class Token;
     class Allocator;
     class StringBuffer;
     class Tag;
-    class TagToken;
-    class StartTagToken;
-    class DoctypeToken;
-    class CommentToken;
     class StringRef;
     
+    // Where Tokeniser::read() resumes when a non-final reader runs out of input.
+    struct TokeniserResumePoint {
+        size_t pos;
+        internal::TokeniserState* state;
+        size_t chars;   // characters gathered so far
+        size_t errors;  // errors reported so far
+    };
+    
     class Tokeniser {
     public:
         Tokeniser(CharacterReader* reader, ParseErrorList* errorList, Allocator* allocator);
         ~Tokeniser();
         
-        // The invoker must destroy the returned token!!
+        // The invoker must destroy the returned token, or hand it back with recycle()!!
+        // Returns NULL when the reader is not final and ran out of input before a
+        // token was complete; the tokeniser is rolled back to where that token
+        // started and read() can be called again once more input was fed in.
         Token* read();
         
+        // Takes back a token read() returned once the invoker is done with it. One
+        // token of each type is kept and reset for a later read(), so its buffers
+        // keep their capacity instead of being allocated again for every token.
+        void recycle(Token* token);
+        
         
         // this is not consistent with our philosogy
         // need to be reconsidered
         void emit(Token* token);
         
+        // Characters that are a slice of the reader's input are not copied while
+        // they follow each other; the next character token refers to them in place.
         void emit(const StringRef& str);
         void emit(int c);
         
         void emitEOF();
         
+        // Start tags named in names (lower case) that aren't self-closing have their content
+        // consumed without producing any tokens, whatever state the invoker switches to for
+        // it; read() goes on with the end tag that closes the element. All but raw text and
+        // RCDATA elements may nest. The content isn't tokenised, so its end tag inside a
+        // comment or attribute value ends it early. names must outlive the tokeniser; none
+        // (the default) skips nothing.
+        void setSkippedTags(const StringRef* names, size_t count) {
+            skippedTags_ = names;
+            skippedTagCount_ = count;
+        }
+        
+        // Whether the token read() returned last follows the content of a skipped element,
+        // i.e. is its end tag or EOF. skippedPos() and skippedContent() then describe it.
+        bool endsSkippedContent() const {
+            return endsSkip_;
+        }
+        
+        size_t skippedPos() const {
+            return skippedPos_;
+        }
+        
+        // the content skipped last as a slice of the reader's input, empty if some of it
+        // has been dropped (see inputDropped())
+        StringRef skippedContent() const;
+        
         // user can't deconstruct state!
         internal::TokeniserState& state() {
             return *state_;
@@ -79,11 +120,38 @@ namespace csoup {
         
         StringRef appropriateEndTagName();
         
-        void error(internal::TokeniserState* state);
-        void eofError(internal::TokeniserState* state);
+#if CSOUP_PARSE_ERRORS
+        void error(internal::TokeniserState*) {
+            if (errors_->notFull()) addError(CSOUP_PARSE_ERROR_UNEXPECTED_CHARACTER);
+        }
+        
+        void eofError(internal::TokeniserState*) {
+            if (errors_->notFull()) addError(CSOUP_PARSE_ERROR_UNEXPECTED_EOF);
+        }
+        
+        void characterReferenceError(ParseErrorEnum code) {
+            if (errors_->notFull()) addError(code);
+        }
+        
+        void error(ParseErrorEnum code) {
+            if (errors_->notFull()) addError(code);
+        }
+#else
+        void error(internal::TokeniserState*) {}
+        void eofError(internal::TokeniserState*) {}
+        void characterReferenceError(ParseErrorEnum) {}
+        void error(ParseErrorEnum) {}
+#endif
+        
+        // Offset of the reader in the whole input, including input dropped with inputDropped().
+        size_t sourcePos() const;
         
-        void characterReferenceError(const StringRef& message);
-        void error(const StringRef& errorMsg);
+        // 1-based line and column of a source position that hasn't been dropped.
+        void locate(size_t sourcePos, size_t* line, size_t* column);
+        
+        // Must be called before the first n bytes of the reader's input are dropped,
+        // so that positions and lines keep counting from the start of the input.
+        void inputDropped(size_t n);
         
         bool currentNodeInHtmlNS() {
             return true;
@@ -98,6 +166,7 @@ namespace csoup {
         
         void appendTagName(const StringRef& append);
         void appendTagName(const int c);
+        void appendTagNameLowercased(const StringRef& append);
         
         void appendDataBuffer(const StringRef& append);
         void appendDataBuffer(const int c);
@@ -111,10 +180,43 @@ namespace csoup {
         
         static const unsigned int replacementChar_ = 0xFFFD;
     private:
+        friend class internal::TokeniserState;
+        
+        // Steps through states until a token is pending or the reader starves;
+        // returns true in the latter case.
+        bool runStates(TokeniserResumePoint* resume);
+        
+        // Bookkeeping of runStates(): before a step in a text state, and after a
+        // step that starved the reader.
+        void saveResumePoint(TokeniserResumePoint* resume);
+        void stepStarved(bool inText, TokeniserResumePoint* resume);
+        
+        // a recycled token of the type, reset, or NULL if there is none
+        Token* takeSpare(TokenTypeEnum type);
+        
+        // drops tag/comment/doctype tokens left half built
+        void discardPending();
+        bool hasPending() const {
+            return tagPending_ != NULL || commentPending_ != NULL || doctypePending_ != NULL;
+        }
+        
+        // pending characters, whether held as a slice of the input or in charBuffer_
+        size_t charCount() const;
+        void truncateChars(size_t n);
+        // copies the pending input slice into charBuffer_ before anything else is added
+        void flushSpan();
+        
+#if CSOUP_PARSE_ERRORS
+        void addError(ParseErrorEnum code);
+        
+        // moves what the reader logged and counted into the error list
+        void collectDecodeErrors();
+#else
+        void collectDecodeErrors() {}
+#endif
         
         void readHexSequence(StringBuffer* output);
         void readDigitSequence(StringBuffer* output);
-        void readReferenceName(StringBuffer* output);
 
         Allocator* allocator_;
         CharacterReader* reader_;
@@ -123,14 +225,32 @@ namespace csoup {
         Token* emitPending_;
         bool isEmitPending_;
         StringBuffer* charBuffer_;
+        const CharType* spanBegin_; // pending characters still in the input, when charBuffer_ is empty
+        const CharType* spanEnd_;
         StringBuffer* dataBuffer_;
         
         TagToken* tagPending_;
         DoctypeToken* doctypePending_;
         CommentToken* commentPending_;
-        StartTagToken* lastStartTag_;
+        StringBuffer* lastStartTagName_;
+        Token* spare_[kTokenTypeCount]; // tokens handed back with recycle()
+        
+        internal::LineIndex* lineIndex_;
+        size_t charStart_;  // source position of the first char in charBuffer_
+        size_t tokenStart_; // source position where the pending token started
+        size_t decodeErrorsSeen_[CSOUP_DECODE_ERROR_KIND_COUNT]; // reader counts already added to errors_
         
         bool selfClosingFlagAcknowledged;
+        
+        const StringRef* skippedTags_;
+        size_t skippedTagCount_;
+        bool skipPending_;  // the start tag read() returned last is skipped
+        bool skipNested_;   // elements of the same name may nest in the one skipped
+        size_t skipDepth_;  // and are that deep
+        size_t skippedPos_;
+        size_t skippedSize_;
+        bool skipEnded_;    // a skip ended since the last token was returned
+        bool endsSkip_;
     };
 }
 
@@ -24,13 +24,10 @@ namespace csoup {
     const int TokeniserState::eof_              = CharacterReader::eof_;
     
     void TokeniserState::handleDataEndTag(csoup::Tokeniser *t, csoup::CharacterReader *r, csoup::internal::TokeniserState *elseTransition) {
-        if (isalpha(r->peek())) {
-            StringBuffer name(t->allocator());
-            appendUntilNotLetter(t, r, &name);
-            t->appendDataBuffer(name.ref());
-        
-            name.tolower();
-            t->appendTagName(name.ref());
+        if (internal::isAsciiAlpha(r->peek())) {
+            StringRef name = r->consumeLetterSequence();
+            t->appendDataBuffer(name);
+            t->appendTagNameLowercased(name);
             return ;
         }
         
@@ -68,7 +65,7 @@ namespace csoup {
     }
     
     void TokeniserState::handleDataDoubleEscapeTag(csoup::Tokeniser *t, csoup::CharacterReader *r, csoup::internal::TokeniserState *primary, csoup::internal::TokeniserState *fallback) {
-        if (std::isalpha(r->peek())) {
+        if (internal::isAsciiAlpha(r->peek())) {
             StringBuffer name(t->allocator());
             appendUntilNotLetter(t, r, &name);
             
@@ -102,89 +99,101 @@ namespace csoup {
         }
     }
     
-    size_t TokeniserState::emitUntil(Tokeniser* t, CharacterReader* reader, CharType* endTerms, const size_t arrSize) {
-        int c = reader->peek();
+    size_t TokeniserState::emitUntil(Tokeniser* t, CharacterReader* reader, const ByteClassTable& terms) {
         size_t read = 0;
         
-        while (c != CharacterReader::eof_) {
-            for (size_t i = 0; i < arrSize; ++ i) {
-                if (c == endTerms[i]) {
-                    goto EMIT_UNTIL_OUTER;
-                }
+        for (;;) {
+            StringRef run = reader->consumeToAny(terms);
+            if (run.size() > 0) {
+                read += run.size();
+                t->emit(run);
             }
             
+            // the run stopped at a terminator, EOF, or a character that had to be decoded
+            int c = reader->peek();
+            if (c == CharacterReader::eof_ || terms.isTerminator(c)) break;
+            
             read ++;
             t->emit(c);
-            c = reader->next();
+            reader->advance();
         }
-    EMIT_UNTIL_OUTER:
+        
         return read;
     }
     
+    size_t TokeniserState::emitRawText(Tokeniser* t, CharacterReader* reader, bool references, bool escapes) {
+        StringRef run = reader->consumeRawText(t->appropriateEndTagName(), references, escapes);
+        if (run.size() > 0) {
+            t->emit(run);
+        }
+        return run.size();
+    }
+    
+    bool TokeniserState::skipToEndTag(Tokeniser* t, CharacterReader* reader) {
+        if (!reader->consumeToEndTag(t->appropriateEndTagName(), t->skipNested_, &t->skipDepth_) &&
+            !reader->isFinal()) {
+            return false;
+        }
+        
+        t->skippedSize_ = t->sourcePos() - t->skippedPos_;
+        t->skipEnded_ = true;
+        return true;
+    }
+    
     size_t TokeniserState::lowercasedAppendUntil(Tokeniser* t, CharacterReader* reader,
-                                                 StringBuffer* buffer, CharType* endTerms, const size_t arrSize) {
-        int c = reader->peek();
+                                                 StringBuffer* buffer, const ByteClassTable& terms) {
         size_t read = 0;
         
-        while (c != CharacterReader::eof_) {
-            for (size_t i = 0; i < arrSize; ++ i) {
-                if (c == endTerms[i]) {
-                    goto LOWERCASED_APPEND_UNTIL;
-                }
+        for (;;) {
+            StringRef run = reader->consumeToAny(terms);
+            if (run.size() > 0) {
+                read += run.size();
+                buffer->appendLowercased(run);
             }
             
+            int c = reader->peek();
+            if (c == CharacterReader::eof_ || terms.isTerminator(c)) break;
+            
             read ++;
-            buffer->append(std::tolower(c));
-            c = reader->next();
+            buffer->append(c);
+            reader->advance();
         }
         
-    LOWERCASED_APPEND_UNTIL:
         return read;
     }
     
     size_t TokeniserState::lowercasedAppendUntilNotLetter(Tokeniser *t, CharacterReader *reader, StringBuffer *buffer) {
-        int c = reader->peek();
-        size_t read = 0;
+        StringRef letters = reader->consumeLetterSequence();
+        buffer->appendLowercased(letters);
         
-        while (std::isalpha(c)) {
-            read ++;
-            buffer->append(std::tolower(c));
-            c = reader->next();
-        }
-        
-        return read;
+        return letters.size();
     }
     
     size_t TokeniserState::appendUntilNotLetter(Tokeniser *t, CharacterReader *reader, StringBuffer *buffer) {
-        int c = reader->peek();
-        size_t read = 0;
-        
-        while (std::isalpha(c)) {
-            read ++;
-            buffer->append(c);
-            c = reader->next();
-        }
+        StringRef letters = reader->consumeLetterSequence();
+        buffer->appendString(letters);
         
-        return read;
+        return letters.size();
     }
     
-    size_t TokeniserState::appendUntil(csoup::Tokeniser *t, csoup::CharacterReader *reader, csoup::StringBuffer *buffer, CharType* endTerms, const size_t arrSize) {
-        int c = reader->peek();
+    size_t TokeniserState::appendUntil(csoup::Tokeniser *t, csoup::CharacterReader *reader, csoup::StringBuffer *buffer, const ByteClassTable& terms) {
         size_t read = 0;
         
-        while (c != CharacterReader::eof_) {
-            for (size_t i = 0; i < arrSize; ++ i) {
-                if (c == endTerms[i]) {
-                    goto APPEND_UNTIL_OUTER;
-                }
+        for (;;) {
+            StringRef run = reader->consumeToAny(terms);
+            if (run.size() > 0) {
+                read += run.size();
+                buffer->appendString(run);
             }
             
+            int c = reader->peek();
+            if (c == CharacterReader::eof_ || terms.isTerminator(c)) break;
+            
             read ++;
             buffer->append(c);
-            c = reader->next();
+            reader->advance();
         }
         
-    APPEND_UNTIL_OUTER:
         return read;
     }
     
@@ -205,8 +214,9 @@ namespace csoup {
                 t->emitEOF();
                 break;
             default:
-                CharType term[] = {'&', '<', nullChar_};
-                emitUntil(t, reader, term, sizeof(term) / sizeof(*term));
+                static const CharType term[] = {'&', '<', nullChar_};
+                static const ByteClassTable termTable(term, arrayLength(term));
+                emitUntil(t, reader, termTable);
                 break;
         }
     }
@@ -243,8 +253,11 @@ namespace csoup {
                 t->emitEOF();
                 break;
             default:
-                CharType term[] = {'&', '<', nullChar_};
-                emitUntil(t, reader, term, arrayLength(term));
+                if (emitRawText(t, reader, true, false) == 0) {
+                    static const CharType term[] = {'&', '<', nullChar_};
+                    static const ByteClassTable termTable(term, arrayLength(term));
+                    emitUntil(t, reader, termTable);
+                }
                 break;
         }
     }
@@ -276,8 +289,11 @@ namespace csoup {
                 t->emitEOF();
                 break;
             default:
-                CharType term[] = {'<', nullChar_};
-                emitUntil(t, reader, term, arrayLength(term));
+                if (emitRawText(t, reader, false, false) == 0) {
+                    static const CharType term[] = {'<', nullChar_};
+                    static const ByteClassTable termTable(term, arrayLength(term));
+                    emitUntil(t, reader, termTable);
+                }
                 break;
         }
     }
@@ -297,8 +313,12 @@ namespace csoup {
                 break;
                 
             default:
-                CharType term[] = {'<', nullChar_};
-                emitUntil(t, reader, term, arrayLength(term));
+                // "<!" may start an escape, which the states below handle
+                if (emitRawText(t, reader, false, true) == 0) {
+                    static const CharType term[] = {'<', nullChar_};
+                    static const ByteClassTable termTable(term, arrayLength(term));
+                    emitUntil(t, reader, termTable);
+                }
                 break;
         }
     }
@@ -314,8 +334,9 @@ namespace csoup {
                 t->emitEOF();
                 break;
             default:
-                CharType term[] = {nullChar_};
-                emitUntil(t, reader, term, arrayLength(term));
+                static const CharType term[] = {nullChar_};
+                static const ByteClassTable termTable(term, arrayLength(term));
+                emitUntil(t, reader, termTable);
                 break;
         }
     }
@@ -333,7 +354,7 @@ namespace csoup {
                 t->advanceTransition(BogusComment::instance());
                 break;
             default:
-                if (std::isalpha(reader->peek())) {
+                if (internal::isAsciiAlpha(reader->peek())) {
                     t->createTagPending(true);
                     t->transition(TagName::instance());
                 } else {
@@ -350,7 +371,7 @@ namespace csoup {
             t->eofError(this);
             t->emit("</");
             t->transition(Data::instance());
-        } else if (std::isalpha(reader->peek())) {
+        } else if (internal::isAsciiAlpha(reader->peek())) {
             t->createTagPending(false);
             t->transition(TagName::instance());
         } else if (reader->matches('>')) {
@@ -365,11 +386,30 @@ namespace csoup {
     // from < or </ in data, will have start or end tag pending
     void TagName::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
         // previous TagOpen state did NOT consume, will have a letter char in current
-        StringBuffer tagName(t->allocator());
-        CharType terms[] = {'\t', '\n', '\r', '\f', ' ', '/', '>', nullChar_};
-        lowercasedAppendUntil(t, reader, &tagName, terms, arrayLength(terms));
-    
-        t->appendTagName(tagName.ref());
+        static const CharType terms[] = {'\t', '\n', '\r', '\f', ' ', '/', '>', nullChar_};
+        static const ByteClassTable termsTable(terms, arrayLength(terms));
+        TagToken* tag = t->tagPending();
+        
+        if (!tag->hasTagName()) {
+            // usually the whole name is one ASCII run, hashed as it is read, so that a
+            // known name is neither copied nor looked at again
+            uint32_t hash;
+            StringRef name = reader->consumeTagName(termsTable, &hash);
+            int next = reader->peek();
+            if (next != nullChar_ && termsTable.isTerminator(next)) {
+                tag->setTagNameRead(name, hash);
+            } else {
+                tag->appendTagNameLowercased(name);
+            }
+        }
+        
+        int c = reader->peek();
+        if (c != eof_ && !termsTable.isTerminator(c)) {
+            // the rest of a name that isn't all ASCII, or was cut by a NUL or the input
+            StringBuffer tagName(t->allocator());
+            lowercasedAppendUntil(t, reader, &tagName, termsTable);
+            t->appendTagName(tagName.ref());
+        }
         
         switch (reader->next()) {
             case '\t':
@@ -410,10 +450,10 @@ namespace csoup {
     }
     
     void RCDATAEndTagOpen::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
-        if (std::isalpha(reader->peek())) {
+        if (internal::isAsciiAlpha(reader->peek())) {
             t->createTagPending(false);
-            t->appendTagName(std::tolower(reader->peek()));
-            t->appendDataBuffer(std::tolower(reader->peek()));
+            t->appendTagName(internal::asciiToLower(reader->peek()));
+            t->appendDataBuffer(internal::asciiToLower(reader->peek()));
             t->advanceTransition(RCDATAEndTagName::instance());
         } else {
             t->emit("</");
@@ -422,15 +462,10 @@ namespace csoup {
     }
     
     void RCDATAEndTagName::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
-        if (std::isalpha(reader->peek())) {
-            StringBuffer name(t->allocator());
-            appendUntilNotLetter(t, reader, &name);
-        
-            t->appendDataBuffer(name.ref());
-            
-            name.tolower();
-            t->appendTagName(name.ref());
-            
+        if (internal::isAsciiAlpha(reader->peek())) {
+            StringRef name = reader->consumeLetterSequence();
+            t->appendDataBuffer(name);
+            t->appendTagNameLowercased(name);
             return;
         }
         
@@ -486,7 +521,7 @@ namespace csoup {
     }
     
     void RawtextEndTagOpen::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
-        if (std::isalpha(reader->peek())) {
+        if (internal::isAsciiAlpha(reader->peek())) {
             t->createTagPending(false);
             t->transition(RawtextEndTagName::instance());
         } else {
@@ -517,7 +552,7 @@ namespace csoup {
     }
     
     void ScriptDataEndTagOpen::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
-        if (std::isalpha(reader->peek())) {
+        if (internal::isAsciiAlpha(reader->peek())) {
             t->createTagPending(false);
             t->transition(ScriptDataEndTagName::instance());
         } else {
@@ -569,8 +604,9 @@ namespace csoup {
                 t->emit(replacementChar_);
                 break;
             default:
-                CharType terms[] = {'-', '<', nullChar_};
-                emitUntil(t, reader, terms, arrayLength(terms));
+                static const CharType terms[] = {'-', '<', nullChar_};
+                static const ByteClassTable termsTable(terms, arrayLength(terms));
+                emitUntil(t, reader, termsTable);
                 break;
         }
     }
@@ -641,9 +677,9 @@ namespace csoup {
         }
     }
     void ScriptDataEscapedLessthanSign::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
-        if (std::isalpha(reader->peek())) {
+        if (internal::isAsciiAlpha(reader->peek())) {
             t->createTempBuffer();
-            t->appendDataBuffer(std::tolower(reader->peek()));
+            t->appendDataBuffer(internal::asciiToLower(reader->peek()));
             t->emit('<');
             t->emit(reader->peek());
             t->advanceTransition(ScriptDataDoubleEscapeStart::instance());
@@ -659,9 +695,9 @@ namespace csoup {
         }
     }
     void ScriptDataEscapedEndTagOpen::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
-        if (std::isalpha(reader->peek())) {
+        if (internal::isAsciiAlpha(reader->peek())) {
             t->createTagPending(false);
-            t->appendTagName(std::tolower(reader->peek()));
+            t->appendTagName(internal::asciiToLower(reader->peek()));
             t->appendDataBuffer(reader->peek());
             t->advanceTransition(ScriptDataEscapedEndTagName::instance());
             
@@ -701,8 +737,9 @@ namespace csoup {
                 
                 break;
             default:
-                CharType term[] = {'-', '<', nullChar_};
-                emitUntil(t, reader, term, arrayLength(term));
+                static const CharType term[] = {'-', '<', nullChar_};
+                static const ByteClassTable termTable(term, arrayLength(term));
+                emitUntil(t, reader, termTable);
 
                 break;
         }
@@ -834,11 +871,19 @@ namespace csoup {
     }
     // from before attribute name
     void AttributeName::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
-        StringBuffer name(t->allocator());
-        CharType terms[] = {'\t', '\n', '\r', '\f', ' ', '/', '=', '>', nullChar_, '"', '\'', '<'};
-        lowercasedAppendUntil(t, reader, &name, terms, arrayLength(terms));
+        static const CharType terms[] = {'\t', '\n', '\r', '\f', ' ', '/', '=', '>', nullChar_, '"', '\'', '<'};
+        static const ByteClassTable termsTable(terms, arrayLength(terms));
         
-        t->tagPending()->appendAttributeName(name.ref());
+        // straight into the pending name; there are no known attribute names to resolve
+        for (;;) {
+            t->tagPending()->appendAttributeNameLowercased(reader->consumeToAny(termsTable));
+            
+            int c = reader->peek();
+            if (c == eof_ || termsTable.isTerminator(c)) break;
+            
+            t->tagPending()->appendAttributeName(c);
+            reader->advance();
+        }
         
         int c = reader->next();
         switch (c) {
@@ -986,8 +1031,9 @@ namespace csoup {
     }
     void AttributeValue_doubleQuoted::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
         StringBuffer value(t->allocator());
-        CharType terms[] = {'"', '&', nullChar_};
-        appendUntil(t, reader, &value, terms, arrayLength(terms));
+        static const CharType terms[] = {'"', '&', nullChar_};
+        static const ByteClassTable termsTable(terms, arrayLength(terms));
+        appendUntil(t, reader, &value, termsTable);
         
         if (value.size() > 0)
             t->tagPending()->appendAttributeValue(value.ref());
@@ -1024,8 +1070,9 @@ namespace csoup {
     }
     void AttributeValue_singleQuoted::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
         StringBuffer value(t->allocator());
-        CharType terms[] = {'\'', '&', nullChar_};
-        appendUntil(t, reader, &value, terms, arrayLength(terms));
+        static const CharType terms[] = {'\'', '&', nullChar_};
+        static const ByteClassTable termsTable(terms, arrayLength(terms));
+        appendUntil(t, reader, &value, termsTable);
         
         if (value.size() > 0)
             t->tagPending()->appendAttributeValue(value.ref());
@@ -1061,8 +1108,9 @@ namespace csoup {
     }
     void AttributeValue_unquoted::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
         StringBuffer value(t->allocator());
-        CharType terms[] = {'\t', '\n', '\r', '\f', ' ', '&', '>', nullChar_, '"', '\'', '<', '=', '`'};
-        appendUntil(t, reader, &value, terms, arrayLength(terms));
+        static const CharType terms[] = {'\t', '\n', '\r', '\f', ' ', '&', '>', nullChar_, '"', '\'', '<', '=', '`'};
+        static const ByteClassTable termsTable(terms, arrayLength(terms));
+        appendUntil(t, reader, &value, termsTable);
         
         if (value.size() > 0)
             t->tagPending()->appendAttributeValue(value.ref());
@@ -1177,8 +1225,9 @@ namespace csoup {
         comment->setBogus(true);
         
         StringBuffer value(t->allocator());
-        CharType terms[] = {'>'};
-        appendUntil(t, reader, &value, terms, arrayLength(terms));
+        static const CharType terms[] = {'>'};
+        static const ByteClassTable termsTable(terms, arrayLength(terms));
+        appendUntil(t, reader, &value, termsTable);
 
         comment->append(value.ref());
         // todo: replace nullChar_ with replaceChar
@@ -1288,8 +1337,9 @@ namespace csoup {
                 break;
             default: {
                 StringBuffer data(t->allocator());
-                CharType term[] = {'-', nullChar_};
-                appendUntil(t, reader, &data, term, arrayLength(term));
+                static const CharType term[] = {'-', nullChar_};
+                static const ByteClassTable termTable(term, arrayLength(term));
+                appendUntil(t, reader, &data, termTable);
                 t->commentPending()->append(data.ref());
             }
         }
@@ -1421,7 +1471,7 @@ namespace csoup {
         }
     }
     void BeforeDoctypeName::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
-        if (std::isalpha(reader->peek())) {
+        if (internal::isAsciiAlpha(reader->peek())) {
             t->createDoctypePending();
             t->transition(DoctypeName::instance());
             
@@ -1458,7 +1508,7 @@ namespace csoup {
         }
     }
     void DoctypeName::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
-        if (std::isalpha(reader->peek())) {
+        if (internal::isAsciiAlpha(reader->peek())) {
             StringBuffer name(t->allocator());
             lowercasedAppendUntilNotLetter(t, reader, &name);
             
@@ -1936,6 +1986,13 @@ namespace csoup {
                 break;
         }
     }
+    // content of an element named in Tokeniser::setSkippedTags(), left to its end tag
+    void SkipContent::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
+        if (skipToEndTag(t, reader)) {
+            t->transition(Data::instance());
+        }
+    }
+    
     void CdataSection::read(csoup::Tokeniser *t, csoup::CharacterReader *reader) {
         StringBuffer data(t->allocator());
         reader->consumeTo("]]>", &data);
@@ -1944,4 +2001,3 @@ namespace csoup {
         t->transition(Data::instance());
     }
 }
-
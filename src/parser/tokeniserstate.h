@@ -14,37 +14,144 @@ namespace csoup {
     class CharacterReader;
     class Allocator;
     class StringBuffer;
+    class ByteClassTable;
     
     namespace internal {
     
+        // All tokeniser states, in one list so that their classes and ids are generated from it.
+#define CSOUP_TOKENISER_STATES(V) \
+        V(Data) \
+        V(CharacterReferenceInData) \
+        V(Rcdata) \
+        V(CharacterReferenceInRcdata) \
+        V(RawText) \
+        V(ScriptData) \
+        V(PlainText) \
+        V(SkipContent) \
+        V(TagOpen) \
+        V(EndTagOpen) \
+        V(TagName) \
+        V(RcdataLessthanSign) \
+        V(RCDATAEndTagOpen) \
+        V(RCDATAEndTagName) \
+        V(RawtextLessthanSign) \
+        V(RawtextEndTagOpen) \
+        V(RawtextEndTagName) \
+        V(ScriptDataLessthanSign) \
+        V(ScriptDataEndTagOpen) \
+        V(ScriptDataEndTagName) \
+        V(ScriptDataEscapeStart) \
+        V(ScriptDataEscapeStartDash) \
+        V(ScriptDataEscaped) \
+        V(ScriptDataEscapedDash) \
+        V(ScriptDataEscapedDashDash) \
+        V(ScriptDataEscapedLessthanSign) \
+        V(ScriptDataEscapedEndTagOpen) \
+        V(ScriptDataEscapedEndTagName) \
+        V(ScriptDataDoubleEscapeStart) \
+        V(ScriptDataDoubleEscaped) \
+        V(ScriptDataDoubleEscapedDash) \
+        V(ScriptDataDoubleEscapedDashDash) \
+        V(ScriptDataDoubleEscapedLessthanSign) \
+        V(ScriptDataDoubleEscapeEnd) \
+        V(BeforeAttributeName) \
+        V(AttributeName) \
+        V(AfterAttributeName) \
+        V(BeforeAttributeValue) \
+        V(AttributeValue_doubleQuoted) \
+        V(AttributeValue_singleQuoted) \
+        V(AttributeValue_unquoted) \
+        V(AfterAttributeValue_quoted) \
+        V(SelfClosingStartTag) \
+        V(BogusComment) \
+        V(MarkupDeclarationOpen) \
+        V(CommentStart) \
+        V(CommentStartDash) \
+        V(Comment) \
+        V(CommentEndDash) \
+        V(CommentEnd) \
+        V(CommentEndBang) \
+        V(Doctype) \
+        V(BeforeDoctypeName) \
+        V(DoctypeName) \
+        V(AfterDoctypeName) \
+        V(AfterDoctypePublicKeyword) \
+        V(BeforeDoctypePublicIdentifier) \
+        V(DoctypePublicIdentifier_doubleQuoted) \
+        V(DoctypePublicIdentifier_singleQuoted) \
+        V(AfterDoctypePublicIdentifier) \
+        V(BetweenDoctypePublicAndSystemIdentifiers) \
+        V(AfterDoctypeSystemKeyword) \
+        V(BeforeDoctypeSystemIdentifier) \
+        V(DoctypeSystemIdentifier_doubleQuoted) \
+        V(DoctypeSystemIdentifier_singleQuoted) \
+        V(AfterDoctypeSystemIdentifier) \
+        V(BogusDoctype) \
+        V(CdataSection)
+
+#define CSOUP_TOKENISER_STATE_ID(StateName) CSOUP_TOKENISER_STATE_##StateName,
+        typedef enum {
+            CSOUP_TOKENISER_STATES(CSOUP_TOKENISER_STATE_ID)
+            CSOUP_TOKENISER_STATE_COUNT
+        } TokeniserStateEnum;
+#undef CSOUP_TOKENISER_STATE_ID
+        
+        // A state reads from the reader at most up to the next state change.
         class TokeniserState {
         public:
+            TokeniserState(TokeniserStateEnum id) : id_(id) {
+            }
+            
             virtual void read(Tokeniser* t, CharacterReader* reader) = 0;
             
+            TokeniserStateEnum id() const {
+                return id_;
+            }
+            
+            // the states that only gather characters
+            bool isText() const {
+                return id_ == CSOUP_TOKENISER_STATE_Data || id_ == CSOUP_TOKENISER_STATE_Rcdata ||
+                       id_ == CSOUP_TOKENISER_STATE_RawText || id_ == CSOUP_TOKENISER_STATE_ScriptData ||
+                       id_ == CSOUP_TOKENISER_STATE_PlainText || id_ == CSOUP_TOKENISER_STATE_SkipContent;
+            }
+            
         protected:
             static void handleDataEndTag(Tokeniser* t, CharacterReader* r, TokeniserState* elseTransition);
             
             static void handleDataDoubleEscapeTag(Tokeniser* t, CharacterReader* r, TokeniserState* primary, TokeniserState* fallback);
             
-            static size_t emitUntil(Tokeniser* t, CharacterReader* reader, CharType* arr,  const size_t n);
+            static size_t emitUntil(Tokeniser* t, CharacterReader* reader, const ByteClassTable& terms);
+            
+            // Fast path of the Rcdata, RawText and ScriptData states: emits the text up to the
+            // appropriate end tag as one run, see CharacterReader::consumeRawText().
+            static size_t emitRawText(Tokeniser* t, CharacterReader* reader, bool references, bool escapes);
             
-            static size_t lowercasedAppendUntil(Tokeniser* t, CharacterReader* reader, StringBuffer* buffer, CharType* terms, const size_t n);
+            // Consumes the content of a skipped element (see Tokeniser::setSkippedTags()); true
+            // once the reader is at its end tag or the end of the input.
+            static bool skipToEndTag(Tokeniser* t, CharacterReader* reader);
+            
+            static size_t lowercasedAppendUntil(Tokeniser* t, CharacterReader* reader, StringBuffer* buffer, const ByteClassTable& terms);
             
             static size_t lowercasedAppendUntilNotLetter(Tokeniser* t, CharacterReader*    reader, StringBuffer* buffer);
             
             static size_t appendUntilNotLetter(Tokeniser *t, CharacterReader *reader, StringBuffer *buffer);
             
-            static size_t appendUntil(Tokeniser* t, CharacterReader* reader, StringBuffer* buffer, CharType* terms, const size_t n);
+            static size_t appendUntil(Tokeniser* t, CharacterReader* reader, StringBuffer* buffer, const ByteClassTable& terms);
             
             static const int nullChar_;
             static const int replacementChar_;
             static const CharType* replacementStr_;
             static const int eof_;
+            
+        private:
+            TokeniserStateEnum id_;
         };
         
 #define CSOUP_REGISTER_TOKENISER_STATE(StateName) \
     class StateName : public TokeniserState { \
     public: \
+        StateName() : TokeniserState(CSOUP_TOKENISER_STATE_##StateName) { \
+        } \
         void read(Tokeniser* t, CharacterReader* reader); \
         static StateName* instance() { \
             static StateName globalInstance; \
@@ -52,73 +159,7 @@ namespace csoup {
         }\
     };
         
-        CSOUP_REGISTER_TOKENISER_STATE(Data)
-        CSOUP_REGISTER_TOKENISER_STATE(CharacterReferenceInData)
-        CSOUP_REGISTER_TOKENISER_STATE(Rcdata)
-        CSOUP_REGISTER_TOKENISER_STATE(CharacterReferenceInRcdata)
-        CSOUP_REGISTER_TOKENISER_STATE(RawText)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptData)
-        CSOUP_REGISTER_TOKENISER_STATE(PlainText);
-        CSOUP_REGISTER_TOKENISER_STATE(TagOpen)
-        CSOUP_REGISTER_TOKENISER_STATE(EndTagOpen)
-        CSOUP_REGISTER_TOKENISER_STATE(TagName)
-        CSOUP_REGISTER_TOKENISER_STATE(RcdataLessthanSign)
-        CSOUP_REGISTER_TOKENISER_STATE(RCDATAEndTagOpen)
-        CSOUP_REGISTER_TOKENISER_STATE(RCDATAEndTagName)
-        CSOUP_REGISTER_TOKENISER_STATE(RawtextLessthanSign)
-        CSOUP_REGISTER_TOKENISER_STATE(RawtextEndTagOpen)
-        CSOUP_REGISTER_TOKENISER_STATE(RawtextEndTagName)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataLessthanSign)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataEndTagOpen)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataEndTagName)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataEscapeStart)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataEscapeStartDash)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataEscaped)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataEscapedDash)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataEscapedDashDash)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataEscapedLessthanSign)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataEscapedEndTagOpen)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataEscapedEndTagName)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataDoubleEscapeStart)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataDoubleEscaped)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataDoubleEscapedDash)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataDoubleEscapedDashDash)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataDoubleEscapedLessthanSign)
-        CSOUP_REGISTER_TOKENISER_STATE(ScriptDataDoubleEscapeEnd)
-        CSOUP_REGISTER_TOKENISER_STATE(BeforeAttributeName)
-        CSOUP_REGISTER_TOKENISER_STATE(AttributeName)
-        CSOUP_REGISTER_TOKENISER_STATE(AfterAttributeName)
-        CSOUP_REGISTER_TOKENISER_STATE(BeforeAttributeValue)
-        CSOUP_REGISTER_TOKENISER_STATE(AttributeValue_doubleQuoted)
-        CSOUP_REGISTER_TOKENISER_STATE(AttributeValue_singleQuoted)
-        CSOUP_REGISTER_TOKENISER_STATE(AttributeValue_unquoted)
-        CSOUP_REGISTER_TOKENISER_STATE(AfterAttributeValue_quoted)
-        CSOUP_REGISTER_TOKENISER_STATE(SelfClosingStartTag)
-        CSOUP_REGISTER_TOKENISER_STATE(BogusComment)
-        CSOUP_REGISTER_TOKENISER_STATE(MarkupDeclarationOpen)
-        CSOUP_REGISTER_TOKENISER_STATE(CommentStart)
-        CSOUP_REGISTER_TOKENISER_STATE(CommentStartDash)
-        CSOUP_REGISTER_TOKENISER_STATE(Comment)
-        CSOUP_REGISTER_TOKENISER_STATE(CommentEndDash)
-        CSOUP_REGISTER_TOKENISER_STATE(CommentEnd)
-        CSOUP_REGISTER_TOKENISER_STATE(CommentEndBang)
-        CSOUP_REGISTER_TOKENISER_STATE(Doctype)
-        CSOUP_REGISTER_TOKENISER_STATE(BeforeDoctypeName)
-        CSOUP_REGISTER_TOKENISER_STATE(DoctypeName)
-        CSOUP_REGISTER_TOKENISER_STATE(AfterDoctypeName)
-        CSOUP_REGISTER_TOKENISER_STATE(AfterDoctypePublicKeyword)
-        CSOUP_REGISTER_TOKENISER_STATE(BeforeDoctypePublicIdentifier)
-        CSOUP_REGISTER_TOKENISER_STATE(DoctypePublicIdentifier_doubleQuoted)
-        CSOUP_REGISTER_TOKENISER_STATE(DoctypePublicIdentifier_singleQuoted)
-        CSOUP_REGISTER_TOKENISER_STATE(AfterDoctypePublicIdentifier)
-        CSOUP_REGISTER_TOKENISER_STATE(BetweenDoctypePublicAndSystemIdentifiers)
-        CSOUP_REGISTER_TOKENISER_STATE(AfterDoctypeSystemKeyword)
-        CSOUP_REGISTER_TOKENISER_STATE(BeforeDoctypeSystemIdentifier)
-        CSOUP_REGISTER_TOKENISER_STATE(DoctypeSystemIdentifier_doubleQuoted)
-        CSOUP_REGISTER_TOKENISER_STATE(DoctypeSystemIdentifier_singleQuoted)
-        CSOUP_REGISTER_TOKENISER_STATE(AfterDoctypeSystemIdentifier)
-        CSOUP_REGISTER_TOKENISER_STATE(BogusDoctype)
-        CSOUP_REGISTER_TOKENISER_STATE(CdataSection)
+        CSOUP_TOKENISER_STATES(CSOUP_REGISTER_TOKENISER_STATE)
 
 #undef CSOUP_REGISTER_TOKENISER_STATE
     }
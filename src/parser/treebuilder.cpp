@@ -10,9 +10,13 @@
 #include "../util/stringref.h"
 #include "../util/stringbuffer.h"
 #include "../util/csoup_string.h"
+#include "../util/mappedfile.h"
 #include "../internal/list.h"
+#include "../internal/strscan.h"
+#include "../internal/structuralindex.h"
 #include "../nodes/document.h"
 #include "characterreader.h"
+#include "openelementstack.h"
 #include "parseerror.h"
 #include "parseerrorlist.h"
 #include "token.h"
@@ -22,18 +26,21 @@
 namespace csoup {
     TreeBuilder::TreeBuilder() :
     allocator_(NULL), reader_(NULL), tokeniser_(NULL), stack_(NULL), currentToken_(NULL),
-    doc_(NULL), errors_(NULL) {
+    doc_(NULL), errors_(NULL), baseUri_(NULL), input_(NULL), charset_(CSOUP_CHARSET_UNKNOWN),
+    normaliseNewlines_(false), pendingCR_(false), inputPinned_(false), keepsInputSpans_(false),
+    sourceFile_(NULL), useStructuralIndex_(false), structuralIndex_(NULL), skippedTags_(NULL), skippedTagCount_(0) {
         
     }
     
     void TreeBuilder::initialiseParse(const StringRef& input, const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator) {
         freeResources();
         
-        CSOUP_ASSERT(input.size() > 0 && input.data() != NULL);
+        CSOUP_ASSERT(input.data() != NULL);
         CSOUP_ASSERT(baseUri.size() > 0 && baseUri.data() != NULL);
         
         // Don't destroy this
         errors_ = errors;
+        keepsInputSpans_ = false;
         
         if (allocator == NULL) {
             // if invoked didn't give an allocator, you should pass NULL to Document's construtor
@@ -50,12 +57,122 @@ namespace csoup {
         
         reader_ = new (allocator->malloc_t<CharacterReader>()) CharacterReader(input);
         tokeniser_ = new (allocator->malloc_t<Tokeniser>()) Tokeniser(reader_, errors, allocator);
-        stack_ = new (allocator->malloc_t< internal::Vector<Element*> >()) internal::Vector<Element*>(4, allocator);
+        tokeniser_->setSkippedTags(skippedTags_, skippedTagCount_);
+        stack_ = new (allocator->malloc_t<internal::OpenElementStack>()) internal::OpenElementStack(allocator);
         baseUri_ = new (allocator->malloc_t< String>()) String(baseUri, allocator);
         allocator_ = allocator;
         currentToken_ = NULL;
     }
     
+    Document* TreeBuilder::parse(const StringRef& input, const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator) {
+        size_t bomLength;
+        CharsetEnum charset = charsetFromBom(input, &bomLength);
+        if (charset == CSOUP_CHARSET_UNKNOWN) {
+            charset = charset_ != CSOUP_CHARSET_UNKNOWN ? charset_ : sniffCharset(input, &bomLength);
+        }
+        
+        initialiseParse(input, baseUri, errors, allocator);
+        doc_->setCharset(charset);
+        
+        StringRef body(input.data() + bomLength, input.size() - bomLength);
+        const char* bodyEnd = body.data() + body.size();
+        bool hasCR = normaliseNewlines_ && internal::findByte(body.data(), bodyEnd, '\r') != bodyEnd;
+        
+        if (charset == CSOUP_CHARSET_UTF8 && !hasCR) {
+            // no copy, the reader just starts after the byte order mark
+            reader_->reset(input, bomLength, true);
+            if (sourceFile_ != NULL) {
+                // the mapping moves into the document but stays where it is
+                doc_->adoptSource(sourceFile_);
+            }
+            keepsInputSpans_ = inputPinned_ || sourceFile_ != NULL;
+        } else {
+            StringBuffer* decoded = CSOUP_NEW1(allocator_, StringBuffer, allocator_);
+            transcodeToUtf8(charset, body, decoded);
+            if (normaliseNewlines_) {
+                decoded->normaliseNewlines(0);
+            }
+            doc_->adoptSource(decoded);
+            reader_->reset(decoded->ref(), 0, true);
+            keepsInputSpans_ = true;
+        }
+        
+        if (useStructuralIndex_) {
+            structuralIndex_ = CSOUP_NEW1(allocator_, internal::StructuralIndex, allocator_);
+            structuralIndex_->build(reader_->input());
+            reader_->setStructuralIndex(structuralIndex_);
+        }
+        
+        runParser();
+        
+        // the parse state comes from the document's allocator, which may go with it
+        Document* doc = doc_;
+        freeResources();
+        return doc;
+    }
+    
+    Document* TreeBuilder::parseFile(const char* path, const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator) {
+        CSOUP_ASSERT(path != NULL);
+        
+        MappedFile file;
+        if (!file.open(path)) {
+            return NULL;
+        }
+        
+        // parse() hands the mapping to the document unless the input gets copied
+        sourceFile_ = &file;
+        Document* doc = parse(file.ref(), baseUri, errors, allocator);
+        sourceFile_ = NULL;
+        
+        return doc;
+    }
+    
+    void TreeBuilder::beginParse(const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator) {
+        // the reader starts over an empty, non-final input
+        initialiseParse(StringRef(""), baseUri, errors, allocator);
+        input_ = new (allocator_->malloc_t<StringBuffer>()) StringBuffer(allocator_);
+        pendingCR_ = false;
+        // feed() drops and moves the input, nothing may refer to it (skipped content included)
+        keepsInputSpans_ = false;
+        reader_->reset(input_->ref(), 0, false);
+    }
+    
+    void TreeBuilder::feed(const StringRef& chunk) {
+        CSOUP_ASSERT(input_ != NULL);
+        
+        // nothing refers to input before the reader, drop it once it is half the buffer
+        size_t pos = reader_->pos();
+        if (pos > 0 && pos >= input_->size() / 2) {
+            tokeniser_->inputDropped(pos);
+            input_->erase(0, pos);
+            pos = 0;
+        }
+        
+        size_t appended = input_->size();
+        input_->appendString(chunk);
+        if (normaliseNewlines_ && chunk.size() > 0) {
+            // a CR at the end of the last chunk was already turned into LF
+            if (pendingCR_ && chunk.data()[0] == '\n') {
+                input_->erase(appended, 1);
+            }
+            pendingCR_ = chunk.data()[chunk.size() - 1] == '\r';
+            input_->normaliseNewlines(appended);
+        }
+        reader_->reset(input_->ref(), pos, false);
+        runParser();
+    }
+    
+    Document* TreeBuilder::finishParse() {
+        CSOUP_ASSERT(input_ != NULL);
+        
+        reader_->reset(input_->ref(), reader_->pos(), true);
+        runParser();
+        
+        Document* doc = doc_;
+        freeResources();
+        return doc;
+    }
+    
     TreeBuilder::~TreeBuilder() {
         freeResources();
     }
@@ -67,9 +184,9 @@ namespace csoup {
         allocator_->deconstructAndFree(tokeniser_);         tokeniser_      = NULL;
         allocator_->deconstructAndFree(stack_);             stack_          = NULL;
         allocator_->deconstructAndFree(baseUri_);            baseUri_        = NULL;
-        if (currentToken_) {
-            allocator_->deconstructAndFree(currentToken_);  currentToken_   = NULL;
-        }
+        allocator_->deconstructAndFree(input_);             input_          = NULL;
+        destroy(&structuralIndex_, allocator_);
+        currentToken_ = NULL;
         
         // Don't destroy errors_! It's allocator outside treebuilder.
         
@@ -81,11 +198,23 @@ namespace csoup {
     void TreeBuilder::runParser() {
         while (true) {
             Token* token = tokeniser_->read();
+            if (token == NULL) {
+                // out of input, wait for the next chunk
+                break;
+            }
+            
+            if (tokeniser_->endsSkippedContent() && keepsInputSpans_ && stack_->size() > 0) {
+                // nothing was inserted since the start tag of the skipped element
+                Element* element = currentElement();
+                if (element->tagName().equals(tokeniser_->appropriateEndTagName())) {
+                    element->setSkippedContent(tokeniser_->skippedContent());
+                }
+            }
             process(token);
             
             bool isEnd = token->tokenType() == CSOUP_TOKEN_EOF;
-            token->~Token();
-            tokeniser_->allocator()->free(token);
+            currentToken_ = NULL;
+            tokeniser_->recycle(token);
             
             if (isEnd)
                 break;
@@ -98,7 +227,7 @@ namespace csoup {
     }
     
     Element* TreeBuilder::currentElement() {
-        return *stack_->back();
+        return stack_->top();
     }
     
     StringRef TreeBuilder::baseUri() const {
@@ -9,6 +9,7 @@
 #ifndef CSOUP_TREEBUILDER_H_
 #define CSOUP_TREEBUILDER_H_
 #include "../util/stringref.h"
+#include "charset.h"
 
 namespace csoup {
     class String;
@@ -19,6 +20,8 @@ namespace csoup {
     class Tokeniser;
     class ParseErrorList;
     class Token;
+    class StringBuffer;
+    class MappedFile;
 
     
     namespace internal {
@@ -26,6 +29,8 @@ namespace csoup {
         class Vector;
         
         class TokeniserState;
+        class StructuralIndex;
+        class OpenElementStack;
     }
     
     class TreeBuilder {
@@ -34,16 +39,67 @@ namespace csoup {
         virtual ~TreeBuilder();
         
         // errors should never be NULL
-        virtual Document* parse(const StringRef& input, const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator) {
-            initialiseParse(input, baseUri, errors, allocator);
-            runParser();
-            
-            return doc_;
+        // The charset is sniffed from the input (see sniffCharset()) unless it was set
+        // with setCharset(). UTF-8 input is read in place; anything else is transcoded
+        // to UTF-8 first, and the document keeps the transcoded copy.
+        virtual Document* parse(const StringRef& input, const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator);
+        
+        // Forces the charset of the input of parse() and parseFile(); a byte order mark
+        // still overrides it. CSOUP_CHARSET_UNKNOWN (the default) sniffs it.
+        void setCharset(CharsetEnum charset) {
+            charset_ = charset;
+        }
+        
+        // Turns CR LF and CR into LF in one pass over the input before tokenising, so
+        // the reader only ever sees LF. Input that is read in place and holds a CR is
+        // copied first; transcoded and push-style input is rewritten where it is.
+        // Off by default.
+        void setNormaliseNewlines(bool normalise) {
+            normaliseNewlines_ = normalise;
+        }
+        
+        // Promises that the input given to parse() outlives the returned Document, so
+        // text nodes can refer to runs of it instead of copying them. Transcoded,
+        // normalised and parseFile() input is kept by the document and is referred
+        // to anyway; push-style input never is. Off by default.
+        void setInputPinned(bool pinned) {
+            inputPinned_ = pinned;
+        }
+        
+        // Classifies the input of parse() and parseFile() in one vectorised pass before
+        // tokenising, so the tokeniser skips from one markup byte to the next instead of
+        // testing every byte (see internal::StructuralIndex). Costs a byte of memory
+        // per byte of input while parsing. Push-style input is never indexed. Off by default.
+        void setStructuralIndex(bool enabled) {
+            useStructuralIndex_ = enabled;
         }
         
+        // Elements named in names (lower case) get no children: the tokeniser consumes
+        // their content without reading it, see Tokeniser::setSkippedTags(). When the
+        // document keeps its input (see setInputPinned()), the element refers to the
+        // skipped content, see Element::skippedContent(). names must outlive the parse.
+        void setSkippedTags(const StringRef* names, size_t count) {
+            skippedTags_ = names;
+            skippedTagCount_ = count;
+        }
+        
+        // Parses the file at path straight from a read-only mapping of it; the returned
+        // Document owns the mapping. Returns NULL if the file can't be read.
+        Document* parseFile(const char* path, const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator);
+        
+        // Push-style parsing: beginParse(), then feed() the UTF-8 input in chunks of any
+        // size as it arrives, then finishParse(). A chunk may end inside a tag or a UTF-8
+        // sequence; the parser stops at the last complete token and resumes there.
+        // Input that has been tokenised is dropped, so only the unfinished tail is buffered.
+        virtual void beginParse(const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator);
+        
+        void feed(const StringRef& chunk);
+        
+        Document* finishParse();
+        
         void setTokeniserState(internal::TokeniserState* state);
         
-        internal::Vector<Element*>* stack() {
+        internal::OpenElementStack* stack() {
             return stack_;
         }
 
@@ -67,18 +123,30 @@ namespace csoup {
         // these are resources needed to be destroied
         CharacterReader* reader_;
         Tokeniser* tokeniser_;
-        internal::Vector<Element*>* stack_; // the stack of open elements
+        internal::OpenElementStack* stack_; // the stack of open elements
         Token* currentToken_; // currentToken is used only for error tracking.
         
         // don't destroy these two guy!
         Document* doc_; // current doc we are building into
         ParseErrorList* errors_; // null when not tracking errors
         String* baseUri_;
+        StringBuffer* input_; // buffered input of a push-style parse
+        CharsetEnum charset_;
+        bool normaliseNewlines_;
+        bool pendingCR_; // the last chunk fed ended with a CR
+        bool inputPinned_;
+        bool keepsInputSpans_; // the reader's input lives as long as the document
+        MappedFile* sourceFile_; // the file parseFile() is parsing, adopted by the document
+        bool useStructuralIndex_;
+        internal::StructuralIndex* structuralIndex_; // over the reader's input, while parse() runs
+        const StringRef* skippedTags_;
+        size_t skippedTagCount_;
         
         void initialiseParse(const StringRef& input, const StringRef& baseUri, ParseErrorList* errors, Allocator* allocator);
         
         void freeResources();
         
+        // processes tokens until EOF, or until a non-final reader runs out of input
         void runParser();
     };
 }
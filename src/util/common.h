@@ -167,11 +167,16 @@
 /*! \ingroup CSOUP_CONFIG
     \param x pointer to align
 
-    Some machines require strict data alignment. Currently the default uses 4 bytes
-    alignment. User can customize by defining the CSOUP_ALIGN function macro.,
+    Some machines require strict data alignment. The default aligns to the size of a
+    pointer, 8 bytes on 64-bit platforms and 4 bytes otherwise. User can customize
+    by defining the CSOUP_ALIGN function macro.
 */
 #ifndef CSOUP_ALIGN
-#define CSOUP_ALIGN(x) ((x + 3u) & ~3u)
+#if CSOUP_64BIT
+#define CSOUP_ALIGN(x) (((x) + static_cast<size_t>(7u)) & ~static_cast<size_t>(7u))
+#else
+#define CSOUP_ALIGN(x) (((x) + 3u) & ~3u)
+#endif
 #endif
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -274,6 +279,19 @@ namespace csoup {
 #define CSOUP_ASSERT(x) assert(x)
 #endif // CSOUP_ASSERT
 
+///////////////////////////////////////////////////////////////////////////////
+// CSOUP_PARSE_ERRORS
+
+//! Whether the parser reports parse errors.
+/*! \ingroup CSOUP_CONFIG
+    Defaults to 1. Define CSOUP_PARSE_ERRORS to 0 to compile the error paths of
+    the tokeniser and tree builder out: every error call becomes an empty inline
+    function and a ParseErrorList passed to the parser stays empty.
+*/
+#ifndef CSOUP_PARSE_ERRORS
+#define CSOUP_PARSE_ERRORS 1
+#endif // CSOUP_PARSE_ERRORS
+
 ///////////////////////////////////////////////////////////////////////////////
 // CSOUP_STATIC_ASSERT
 
@@ -453,6 +471,9 @@ namespace csoup {
     size_t arrayLength(T (&arr)[N]) {
         return N;
     }
+    
+    // Source position of tokens and nodes that weren't read from the input
+    const size_t kNoSourcePos = static_cast<size_t>(-1);
 }
 
 
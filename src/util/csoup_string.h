@@ -48,6 +48,17 @@ public:
         copyString(str.data(), str.size(), allocator);
     }
     
+    //! Refers to str without copying it; str must outlive the String.
+    explicit String(const StringRef& str) : type_(CSOUP_CONST_STRING) {
+        data_.ls_.str_          = str.data();
+        data_.ls_.length_       = str.size();
+        data_.ls_.allocator_    = NULL;
+    }
+    
+    bool isConst() const {
+        return type_ == CSOUP_CONST_STRING;
+    }
+    
     ~String() {
         if (type_ == CSOUP_LONG_STRING) {
             data_.ls_.allocator_->free(data_.ls_.str_);
@@ -81,7 +92,7 @@ public:
 
     Allocator* allocator() {
         CSOUP_ASSERT(type_ != CSOUP_UNDEFINED_STRING);
-        if (type_ == CSOUP_SHORT_STRING)    return globalDumbAllocator();
+        if (type_ != CSOUP_LONG_STRING)     return globalDumbAllocator();
         else                                return data_.ls_.allocator_;
     }
     
@@ -122,7 +133,7 @@ private:
         }
     }
     
-    enum StringTypeEnum { CSOUP_SHORT_STRING, CSOUP_LONG_STRING, CSOUP_UNDEFINED_STRING};
+    enum StringTypeEnum { CSOUP_SHORT_STRING, CSOUP_LONG_STRING, CSOUP_CONST_STRING, CSOUP_UNDEFINED_STRING};
     
     struct LongString {
         const CharType* str_; //!< plain CharType pointer
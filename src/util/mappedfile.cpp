@@ -0,0 +1,115 @@
+//
+//  mappedfile.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include "mappedfile.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CSOUP_HAS_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace csoup {
+    namespace {
+        const CharType emptyData[] = "";
+    }
+
+#ifdef CSOUP_HAS_MMAP
+    bool MappedFile::open(const char* path) {
+        close();
+
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            ::close(fd);
+            return false;
+        }
+
+        if (st.st_size == 0) {
+            // mmap() refuses empty lengths
+            ::close(fd);
+            data_ = emptyData;
+            return true;
+        }
+
+        size_t size = static_cast<size_t>(st.st_size);
+        void* addr = ::mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // the mapping keeps its own reference to the file
+        ::close(fd);
+        if (addr == MAP_FAILED) return false;
+
+        ::posix_madvise(addr, size, POSIX_MADV_SEQUENTIAL);
+
+        data_ = static_cast<const CharType*>(addr);
+        size_ = size;
+        mapped_ = true;
+        return true;
+    }
+
+    void MappedFile::close() {
+        if (mapped_) {
+            ::munmap(const_cast<CharType*>(data_), size_);
+        } else if (data_ != NULL && data_ != emptyData) {
+            std::free(const_cast<CharType*>(data_));
+        }
+
+        data_ = NULL;
+        size_ = 0;
+        mapped_ = false;
+    }
+#else
+    bool MappedFile::open(const char* path) {
+        close();
+
+        std::FILE* fp = std::fopen(path, "rb");
+        if (fp == NULL) return false;
+
+        size_t capacity = 0;
+        CharType* buffer = NULL;
+        for (;;) {
+            if (size_ == capacity) {
+                capacity = capacity ? capacity * 2 : 65536;
+                CharType* grown = static_cast<CharType*>(std::realloc(buffer, capacity));
+                if (grown == NULL) break;
+                buffer = grown;
+            }
+
+            size_t n = std::fread(buffer + size_, 1, capacity - size_, fp);
+            if (n == 0) break;
+            size_ += n;
+        }
+
+        bool ok = !std::ferror(fp) && size_ < capacity;
+        std::fclose(fp);
+        if (!ok) {
+            std::free(buffer);
+            size_ = 0;
+            return false;
+        }
+
+        data_ = buffer;
+        return true;
+    }
+
+    void MappedFile::close() {
+        if (data_ != NULL && data_ != emptyData) {
+            std::free(const_cast<CharType*>(data_));
+        }
+
+        data_ = NULL;
+        size_ = 0;
+        mapped_ = false;
+    }
+#endif
+}
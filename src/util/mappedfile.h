@@ -0,0 +1,64 @@
+//
+//  mappedfile.h
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#ifndef CSOUP_MAPPEDFILE_H_
+#define CSOUP_MAPPEDFILE_H_
+
+#include "common.h"
+#include "stringref.h"
+
+namespace csoup {
+    // A read-only view of a whole file. Where mmap is available the file is mapped
+    // with sequential-access advice, so the parser reads the page cache directly;
+    // elsewhere it is read into a heap buffer.
+    class MappedFile {
+    public:
+        MappedFile() : data_(NULL), size_(0), mapped_(false) {
+        }
+
+        ~MappedFile() {
+            close();
+        }
+
+        // Returns false if the file can't be opened or mapped; the object stays empty.
+        bool open(const char* path);
+
+        void close();
+
+        bool isOpen() const {
+            return data_ != NULL;
+        }
+
+        StringRef ref() const {
+            CSOUP_ASSERT(isOpen());
+            return StringRef(data_, size_);
+        }
+
+        size_t size() const {
+            return size_;
+        }
+
+        // Hands the view over to another object, e.g. from a local to the Document
+        // that keeps the input alive.
+        void swap(MappedFile& other) {
+            const CharType* data = data_;   data_ = other.data_;        other.data_ = data;
+            size_t size = size_;            size_ = other.size_;        other.size_ = size;
+            bool mapped = mapped_;          mapped_ = other.mapped_;    other.mapped_ = mapped;
+        }
+
+    private:
+        MappedFile(const MappedFile&);
+        MappedFile& operator=(const MappedFile&);
+
+        const CharType* data_;
+        size_t size_;
+        bool mapped_; // false when data_ is a heap copy or the empty string
+    };
+}
+
+#endif // CSOUP_MAPPEDFILE_H_
@@ -7,11 +7,12 @@
 //
 
 #include "stringbuffer.h"
+#include "../internal/strscan.h"
 
 namespace csoup {
     void StringBuffer::ensureExtraSize(size_t extraSize) {
         size_t newLength = length_ + extraSize;
-        size_t newCapacity = capacity_;
+        size_t newCapacity = capacity_ == 0 ? kInitialCapacity : capacity_;
         
         while (newCapacity < newLength) {
             newCapacity *= 2;
@@ -29,6 +30,12 @@ namespace csoup {
         length_ += len;
     }
     
+    void StringBuffer::appendLowercased(const StringRef& str) {
+        ensureExtraSize(str.size());
+        internal::lowerCopy(str_ + length_, str.data(), str.size());
+        length_ += str.size();
+    }
+    
     void StringBuffer::append(int c) {
         int numBytes, prefix;
         if (c <= 0x7f) {
@@ -52,14 +59,15 @@ namespace csoup {
     }
     
     void StringBuffer::tolower() {
-        for (size_t i = 0; i < length_; ++ i) {
-            str_[i] = std::tolower(str_[i]);
-        }
+        internal::lowerCopy(str_, str_, length_);
+    }
+    
+    void StringBuffer::normaliseNewlines(size_t pos) {
+        CSOUP_ASSERT(pos <= length_);
+        length_ = pos + internal::normaliseNewlines(str_ + pos, length_ - pos);
     }
     
     void StringBuffer::toupper() {
-        for (size_t i = 0; i < length_; ++ i) {
-            str_[i] = std::toupper(str_[i]);
-        }
+        internal::upperCopy(str_, str_, length_);
     }
 }
\ No newline at end of file
@@ -36,12 +36,26 @@ namespace csoup {
             length_ = 0;
         }
         
+        // drops everything after the first length bytes
+        void truncate(size_t length) {
+            CSOUP_ASSERT(length <= length_);
+            length_ = length;
+        }
+        
+        // removes count bytes starting at pos
+        void erase(size_t pos, size_t count) {
+            CSOUP_ASSERT(pos + count <= length_);
+            if (count == 0) return;
+            std::memmove(str_ + pos, str_ + pos + count, sizeof(CharType) * (length_ - pos - count));
+            length_ -= count;
+        }
+        
         const char* data() const {
             return str_ == NULL ? "" : str_;
         }
         
         StringRef ref() const {
-            return StringRef(str_, length_);
+            return StringRef(data(), length_);
         }
         
         size_t size() const {
@@ -54,7 +68,7 @@ namespace csoup {
         
         void reserve(size_t expectedSize) {
             if (expectedSize > capacity_) {
-                ensureExtraSize(expectedSize - capacity_);
+                ensureExtraSize(expectedSize - length_);
             }
         }
         
@@ -70,13 +84,29 @@ namespace csoup {
             appendString(str.data(), str.size());
         }
         
+        // appends str with ASCII letters lowercased
+        void appendLowercased(const StringRef& str);
+        
         void tolower();
         void toupper();
         
+        // rewrites CR LF and lone CR from pos on as LF
+        void normaliseNewlines(size_t pos);
+        
+        // both buffers must use the same allocator
+        void swap(StringBuffer& other) {
+            CSOUP_ASSERT(allocator_ == other.allocator_);
+            CharType* str = str_;       str_ = other.str_;              other.str_ = str;
+            size_t capacity = capacity_; capacity_ = other.capacity_;   other.capacity_ = capacity;
+            size_t length = length_;    length_ = other.length_;        other.length_ = length;
+        }
+        
         Allocator* allocator() {
             return allocator_;
         }
     private:
+        static const size_t kInitialCapacity = 16;
+        
         void ensureExtraSize(size_t extraSize);
         
         CharType* str_;
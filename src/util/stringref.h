@@ -17,7 +17,7 @@ namespace csoup {
         
         template<size_t N>
         StringRef(const CharType (&str)[N]) CSOUP_NOEXCEPT
-        : data_(NULL), length_(N-1) {
+        : data_(str), length_(N-1) {
         }
         
         explicit StringRef(const CharType* str)
@@ -0,0 +1,154 @@
+//
+//  characterreader_test.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include <string>
+#include "gtest/gtest/gtest.h"
+#include "parser/characterreader.h"
+#include "internal/strscan.h"
+#include "internal/structuralindex.h"
+#include "util/stringbuffer.h"
+#include "util/allocators.h"
+
+using namespace csoup;
+
+TEST(CharacterReaderTest, NextIndexOfAndConsumeTo) {
+    CrtAllocator allocator;
+    StringBuffer buffer(&allocator);
+
+    CharacterReader reader(StringRef("<![CDATA[ a ] b ]] c ]]> tail"));
+    EXPECT_EQ(0u, reader.nextIndexOf('<'));
+    EXPECT_EQ(21u, reader.nextIndexOf(StringRef("]]>")));
+    EXPECT_TRUE(reader.matchConsume(StringRef("<![CDATA[")));
+
+    reader.consumeTo(StringRef("]]>"), &buffer);
+    EXPECT_TRUE(buffer.ref().equals(StringRef(" a ] b ]] c ")));
+    EXPECT_TRUE(reader.matchConsume(StringRef("]]>")));
+    EXPECT_EQ(' ', reader.peek());
+
+    EXPECT_EQ(29u, reader.nextIndexOf(StringRef("]]>")));
+    buffer.clear();
+    reader.consumeTo(StringRef("]]>"), &buffer);
+    EXPECT_TRUE(buffer.ref().equals(StringRef(" tail")));
+    EXPECT_TRUE(reader.empty());
+}
+
+TEST(CharacterReaderTest, DecodeCodePoints) {
+    CharacterReader reader(StringRef("a\xC3\xA9\r\n\xE4\xBD\xA0\r\xF0\x9F\x98\x80\xFF" "b\xE4\xBD"));
+    EXPECT_EQ('a', reader.next());
+    EXPECT_EQ(0xE9, reader.next());
+    EXPECT_EQ('\n', reader.next());
+    EXPECT_EQ(0x4F60, reader.next());
+    EXPECT_EQ('\n', reader.next());
+    EXPECT_EQ(0x1F600, reader.next());
+    EXPECT_EQ(0xFFFD, reader.next());
+    EXPECT_EQ('b', reader.next());
+    EXPECT_EQ(0xFFFD, reader.next());
+    EXPECT_TRUE(reader.empty());
+    EXPECT_EQ(-1, reader.next());
+    
+    EXPECT_EQ(1u, reader.decodeErrorCount(CSOUP_DECODE_ERROR_INVALID_SEQUENCE));
+    EXPECT_EQ(1u, reader.decodeErrorCount(CSOUP_DECODE_ERROR_TRUNCATED));
+    // reading the same bytes again doesn't count them twice
+    reader.seek(0);
+    while (reader.next() != -1) {}
+    EXPECT_EQ(1u, reader.decodeErrorCount(CSOUP_DECODE_ERROR_INVALID_SEQUENCE));
+}
+
+TEST(CharacterReaderTest, ConsumeToAny) {
+    const CharType terms[] = {'&', '<', '\0'};
+    ByteClassTable table(terms, arrayLength(terms));
+    
+    CharacterReader reader(StringRef("caf\xC3\xA9 \xE4\xBD\xA0<b>x\r\ny\xC2\x85z&amp;"));
+    StringRef run = reader.consumeToAny(table);
+    EXPECT_TRUE(run.equals(StringRef("caf\xC3\xA9 \xE4\xBD\xA0")));
+    EXPECT_EQ('<', reader.peek());
+    
+    reader.advance();
+    EXPECT_TRUE(reader.consumeLetterSequence().equals(StringRef("b")));
+    EXPECT_EQ('>', reader.next());
+    
+    // CR and the C1 control U+0085 are not copied as is
+    EXPECT_TRUE(reader.consumeToAny(table).equals(StringRef("x")));
+    EXPECT_EQ('\n', reader.next());
+    EXPECT_TRUE(reader.consumeToAny(table).equals(StringRef("y")));
+    EXPECT_EQ(0xFFFD, reader.next());
+    EXPECT_TRUE(reader.consumeToAny(table).equals(StringRef("z")));
+    EXPECT_TRUE(table.isTerminator(reader.peek()));
+    EXPECT_EQ(0u, reader.consumeToAny(table).size());
+}
+
+TEST(CharacterReaderTest, ConsumeToAnyIndexed) {
+    const CharType terms[] = {'\t', '\n', '\r', '\f', ' ', '/', '>', '\0'};
+    ByteClassTable table(terms, arrayLength(terms));
+    
+    // stops on both sides of the block boundaries, and bytes of the table's groups
+    // ('-' shares one with '/') that are runs for it
+    std::string input;
+    for (size_t i = 0; i < 300; ++ i) {
+        const char* pieces[] = {"abc", "-", "d/e", "\xC3\xA9", " ", "x\ry", "f>", "\x01", "\xFF"};
+        input += pieces[(i * 7) % arrayLength(pieces)];
+        input.append(i % 70, 'z');
+    }
+    
+    CrtAllocator allocator;
+    internal::StructuralIndex index(&allocator);
+    index.build(StringRef(input.data(), input.size()));
+    
+    CharacterReader plain(StringRef(input.data(), input.size()));
+    CharacterReader indexed(StringRef(input.data(), input.size()));
+    indexed.setStructuralIndex(&index);
+    
+    while (!plain.empty()) {
+        StringRef expected = plain.consumeToAny(table);
+        StringRef run = indexed.consumeToAny(table);
+        ASSERT_EQ(expected.data(), run.data());
+        ASSERT_EQ(expected.size(), run.size());
+        ASSERT_EQ(plain.next(), indexed.next());
+    }
+    EXPECT_TRUE(indexed.empty());
+}
+
+TEST(CharacterReaderTest, CaseFolding) {
+    // the kernels are tested in strscan_test.cpp
+    for (int i = 0; i < 256; ++ i) {
+        int expectLower = (i >= 'A' && i <= 'Z') ? i + 32 : i;
+        EXPECT_EQ(expectLower, internal::kAsciiLowerTable[i]) << i;
+    }
+    
+    EXPECT_EQ(internal::hashIgnoreCase("Content-Type", 12), internal::hashIgnoreCase("content-type", 12));
+    EXPECT_NE(internal::hashIgnoreCase("content-type", 12), internal::hashIgnoreCase("content-typf", 12));
+    
+    CharacterReader reader(StringRef("<!doctype HTML>"));
+    reader.advance();
+    reader.advance();
+    EXPECT_TRUE(reader.matchConsumeIgnoreCase(StringRef("DOCTYPE")));
+    EXPECT_FALSE(reader.matchesIgnoreCase(StringRef(" htmx")));
+    EXPECT_TRUE(reader.matchesIgnoreCase(StringRef(" html")));
+}
+
+TEST(CharacterReaderTest, NormaliseNewlines) {
+    // CRLF runs across the vector block sizes, read back through the reader
+    std::string crlf, lf;
+    for (int i = 0; i < 50; ++ i) {
+        crlf += std::string(i % 37, 'x') + "\r\n";
+        lf += std::string(i % 37, 'x') + "\n";
+    }
+    CrtAllocator allocator;
+    StringBuffer buffer(&allocator);
+    buffer.appendString("keep\r\n", 6);
+    buffer.appendString(crlf.data(), crlf.size());
+    buffer.normaliseNewlines(6);
+    EXPECT_EQ("keep\r\n" + lf, std::string(buffer.data(), buffer.size()));
+    
+    CharacterReader raw(StringRef(crlf.data(), crlf.size()));
+    CharacterReader normalised(StringRef(buffer.data() + 6, buffer.size() - 6));
+    while (!raw.empty()) {
+        EXPECT_EQ(raw.next(), normalised.next());
+    }
+    EXPECT_TRUE(normalised.empty());
+}
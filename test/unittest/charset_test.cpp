@@ -0,0 +1,98 @@
+//
+//  charset_test.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include <string>
+#include "gtest/gtest/gtest.h"
+#include "parser/charset.h"
+#include "util/stringbuffer.h"
+#include "util/allocators.h"
+
+using namespace csoup;
+
+namespace {
+    CharsetEnum sniff(const std::string& input, size_t* bomLength = NULL) {
+        size_t n;
+        CharsetEnum charset = sniffCharset(StringRef(input.data(), input.size()), &n);
+        if (bomLength) *bomLength = n;
+        return charset;
+    }
+
+    std::string transcode(CharsetEnum charset, const std::string& input) {
+        CrtAllocator allocator;
+        StringBuffer out(&allocator);
+        transcodeToUtf8(charset, StringRef(input.data(), input.size()), &out);
+        return std::string(out.data(), out.size());
+    }
+
+    std::string utf16(const std::string& ascii, bool bigEndian) {
+        std::string out;
+        for (size_t i = 0; i < ascii.size(); ++ i) {
+            out += bigEndian ? '\0' : ascii[i];
+            out += bigEndian ? ascii[i] : '\0';
+        }
+        return out;
+    }
+}
+
+TEST(CharsetTest, Labels) {
+    EXPECT_EQ(CSOUP_CHARSET_UTF8, charsetForLabel(StringRef(" UTF-8 ")));
+    EXPECT_EQ(CSOUP_CHARSET_WINDOWS_1252, charsetForLabel(StringRef("ISO-8859-1")));
+    EXPECT_EQ(CSOUP_CHARSET_WINDOWS_1252, charsetForLabel(StringRef("us-ascii")));
+    EXPECT_EQ(CSOUP_CHARSET_UTF16BE, charsetForLabel(StringRef("utf-16be")));
+    EXPECT_EQ(CSOUP_CHARSET_UNKNOWN, charsetForLabel(StringRef("shift_jis")));
+}
+
+TEST(CharsetTest, Sniff) {
+    size_t bomLength;
+    EXPECT_EQ(CSOUP_CHARSET_UTF8, sniff("\xEF\xBB\xBF<p>", &bomLength));
+    EXPECT_EQ(3u, bomLength);
+    EXPECT_EQ(CSOUP_CHARSET_UTF16LE, sniff("\xFF\xFE<\0", &bomLength));
+    EXPECT_EQ(2u, bomLength);
+    EXPECT_EQ(CSOUP_CHARSET_UTF16BE, sniff("\xFE\xFF\0<"));
+
+    EXPECT_EQ(CSOUP_CHARSET_UTF8, sniff("<p>no declaration</p>", &bomLength));
+    EXPECT_EQ(0u, bomLength);
+    EXPECT_EQ(CSOUP_CHARSET_WINDOWS_1252, sniff("<html><head><META CHARSET=\"latin1\">"));
+    EXPECT_EQ(CSOUP_CHARSET_WINDOWS_1252,
+              sniff("<meta http-equiv='Content-Type' content='text/html; charset=windows-1252'>"));
+    // content without the pragma doesn't count
+    EXPECT_EQ(CSOUP_CHARSET_UTF8, sniff("<meta content='text/html; charset=windows-1252'>"));
+    // neither do declarations in comments or attribute values
+    EXPECT_EQ(CSOUP_CHARSET_UTF8, sniff("<!-- <meta charset=latin1> --><a title='<meta charset=latin1>'>"));
+    // a UTF-16 declaration in an ASCII-compatible document means UTF-8
+    EXPECT_EQ(CSOUP_CHARSET_UTF8, sniff("<meta charset=utf-16>"));
+
+    // only the first kPrescanLength bytes are looked at
+    EXPECT_EQ(CSOUP_CHARSET_UTF8, sniff(std::string(kPrescanLength, ' ') + "<meta charset=latin1>"));
+}
+
+TEST(CharsetTest, SingleByte) {
+    EXPECT_EQ("caf\xC3\xA9 \xE2\x82\xAC \xC2\x81", transcode(CSOUP_CHARSET_WINDOWS_1252, "caf\xE9 \x80 \x81"));
+    EXPECT_EQ("caf\xC3\xA9 \xC2\x80", transcode(CSOUP_CHARSET_ISO_8859_1, "caf\xE9 \x80"));
+
+    std::string ascii(100, 'a');
+    EXPECT_EQ(ascii, transcode(CSOUP_CHARSET_WINDOWS_1252, ascii));
+}
+
+TEST(CharsetTest, Utf16) {
+    // ASCII runs of every length around the vector block sizes, then a non-ASCII unit
+    for (size_t len = 0; len < 70; ++ len) {
+        std::string ascii;
+        for (size_t i = 0; i < len; ++ i) ascii += static_cast<char>('a' + i % 26);
+
+        EXPECT_EQ(ascii + "\xC3\xA9", transcode(CSOUP_CHARSET_UTF16LE, utf16(ascii, false) + std::string("\xE9\x00", 2)));
+        EXPECT_EQ(ascii + "\xC3\xA9", transcode(CSOUP_CHARSET_UTF16BE, utf16(ascii, true) + std::string("\x00\xE9", 2)));
+    }
+
+    // U+4F60, a surrogate pair for U+1F600, then an unpaired low surrogate and an odd byte
+    std::string be("\x4F\x60\xD8\x3D\xDE\x00\xDC\x00\x00", 9);
+    EXPECT_EQ("\xE4\xBD\xA0\xF0\x9F\x98\x80\xEF\xBF\xBD\xEF\xBF\xBD", transcode(CSOUP_CHARSET_UTF16BE, be));
+
+    // a high surrogate at the very end
+    EXPECT_EQ("a\xEF\xBF\xBD", transcode(CSOUP_CHARSET_UTF16LE, std::string("a\0\x3D\xD8", 4)));
+}
@@ -6,3 +6,45 @@
 #include "nodes/element.h"
 #include "util/allocators.h"
 
+#include "nodes/document.h"
+#include "nodes/formelement.h"
+
+using namespace csoup;
+
+TEST(ElementTest, UnknownTagNames)
+{
+    Document doc("http://example.com/");
+    Document other("http://example.com/");
+    
+    // names Tag doesn't know get the document's own tags
+    Element* foo = new (doc.allocator()->malloc_t<Element>()) Element(&doc, "foo", doc.baseUri(), doc.allocator());
+    doc.appendNode(foo);
+    EXPECT_TRUE(foo->tagName().equals("foo"));
+    EXPECT_EQ(CSOUP_TAG_UNKNOWN, foo->tagId());
+    EXPECT_EQ(doc.internTag("foo"), foo->tag());
+    EXPECT_NE(other.internTag("foo"), foo->tag());
+    
+    Element* div = new (doc.allocator()->malloc_t<Element>()) Element(&doc, "div", doc.baseUri(), doc.allocator());
+    doc.appendNode(div);
+    EXPECT_EQ(Tag::valueOf(CSOUP_TAG_DIV), div->tag());
+    
+    // so do the elements made under one in the document
+    Element* bar = doc.appendElement("bar");
+    Element* baz = foo->insertElement(0, "baz");
+    EXPECT_TRUE(bar->tagName().equals("bar"));
+    EXPECT_EQ(doc.internTag("bar"), bar->tag());
+    EXPECT_TRUE(baz->tagName().equals("baz"));
+    EXPECT_EQ(doc.internTag("baz"), baz->tag());
+    EXPECT_EQ(foo, baz->parentNode());
+    
+    baz->setTagName("qux");
+    EXPECT_TRUE(baz->tagName().equals("qux"));
+    EXPECT_EQ(doc.internTag("qux"), baz->tag());
+    baz->setTagName("span");
+    EXPECT_EQ(Tag::valueOf(CSOUP_TAG_SPAN), baz->tag());
+    
+    FormElement* form = new (other.allocator()->malloc_t<FormElement>()) FormElement(&other, "x-form", other.baseUri(), other.allocator());
+    other.appendNode(form);
+    EXPECT_EQ(other.internTag("x-form"), form->tag());
+    EXPECT_EQ(CSOUP_NODE_FORMELEMENT, form->type());
+}
@@ -0,0 +1,524 @@
+//
+//  htmltreebuilder_test.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include <algorithm>
+#include <pthread.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "gtest/gtest/gtest.h"
+#include "parser/htmltreebuilder.h"
+#include "parser/parseerrorlist.h"
+#include "nodes/document.h"
+#include "nodes/element.h"
+#include "nodes/textnode.h"
+#include "nodes/datanode.h"
+#include "nodes/comment.h"
+#include "util/allocators.h"
+
+using namespace csoup;
+
+namespace {
+    void describe(Node* node, std::string* out) {
+        switch (node->type()) {
+            case CSOUP_NODE_TEXT: {
+                StringRef text = static_cast<TextNode*>(node)->wholeText();
+                out->append(text.data(), text.size());
+                break;
+            }
+            case CSOUP_NODE_CDATA: {
+                StringRef data = static_cast<DataNode*>(node)->wholeData();
+                out->append(data.data(), data.size());
+                break;
+            }
+            case CSOUP_NODE_COMMENT: {
+                StringRef comment = static_cast<CommentNode*>(node)->comment();
+                out->append("<!--").append(comment.data(), comment.size()).append("-->");
+                break;
+            }
+            default: {
+                Element* element = static_cast<Element*>(node);
+                StringRef name = element->tagName();
+                out->append("<").append(name.data(), name.size());
+                for (size_t i = 0; element->attributes() && i < element->attributes()->size(); ++ i) {
+                    const Attribute* attr = element->attributes()->get(i);
+                    out->append(" ").append(attr->key().data(), attr->key().size());
+                    out->append("=").append(attr->value().data(), attr->value().size());
+                }
+                out->append(">");
+                for (size_t i = 0; i < element->childNodeSize(); ++ i) {
+                    describe(element->childNode(i), out);
+                }
+                out->append("</").append(name.data(), name.size()).append(">");
+                break;
+            }
+        }
+    }
+
+    Element* bodyOf(Document* doc) {
+        Element* html = static_cast<Element*>(doc->childNode(0));
+        return static_cast<Element*>(html->childNode(html->childNodeSize() - 1));
+    }
+
+    // The children of the document, or of its body with bodyOnly.
+    std::string describe(Document* doc, bool bodyOnly = true) {
+        Element* root = bodyOnly ? bodyOf(doc) : doc;
+
+        std::string out;
+        for (size_t i = 0; i < root->childNodeSize(); ++ i) {
+            describe(root->childNode(i), &out);
+        }
+        return out;
+    }
+
+    // Parses input fed in chunks of chunkSize bytes (all at once if 0).
+    std::string parse(const std::string& input, size_t chunkSize = 0, bool bodyOnly = true) {
+        CrtAllocator allocator;
+        ParseErrorList errors(16, &allocator);
+        HtmlTreeBuilder builder(&allocator);
+        Document* doc = NULL;
+        if (chunkSize == 0) {
+            doc = builder.parse(StringRef(input.data(), input.size()), "http://example.com/", &errors, NULL);
+        } else {
+            builder.beginParse("http://example.com/", &errors, NULL);
+            for (size_t pos = 0; pos < input.size(); pos += chunkSize) {
+                builder.feed(StringRef(input.data() + pos, std::min(chunkSize, input.size() - pos)));
+            }
+            doc = builder.finishParse();
+        }
+
+        std::string out = describe(doc, bodyOnly);
+        delete doc;
+        return out;
+    }
+
+    // The first text node under node in document order, or NULL.
+    TextNode* firstText(Node* node) {
+        if (node->type() == CSOUP_NODE_TEXT) return static_cast<TextNode*>(node);
+        if (node->type() != CSOUP_NODE_ELEMENT && node->type() != CSOUP_NODE_DOCUMENT) return NULL;
+
+        Element* element = static_cast<Element*>(node);
+        for (size_t i = 0; i < element->childNodeSize(); ++ i) {
+            TextNode* text = firstText(element->childNode(i));
+            if (text != NULL) return text;
+        }
+        return NULL;
+    }
+
+    bool refersInto(const StringRef& ref, const StringRef& input) {
+        return ref.data() >= input.data() && ref.data() + ref.size() <= input.data() + input.size();
+    }
+
+    std::string writeTempFile(const std::string& content) {
+        char path[] = "/tmp/csoup_treebuilder_XXXXXX";
+        int fd = mkstemp(path);
+        std::FILE* fp = fdopen(fd, "wb");
+        std::fwrite(content.data(), 1, content.size(), fp);
+        std::fclose(fp);
+        return path;
+    }
+}
+
+TEST(HtmlTreeBuilderTest, Documents) {
+    EXPECT_EQ("<html><head></head><body><p>hi</p></body></html>", parse("<p>hi</p>", 0, false));
+    EXPECT_EQ("<html><head><title>A & B</title><script>if (a<b) x();</script></head>"
+              "<body class=x><!-- c --><div id=a>one<br></br>two</div></body></html>",
+              parse("<!DOCTYPE html><html><head><title>A &amp; B</title><script>if (a<b) x();</script></head>"
+                    "<body class=x><!-- c --><div id=\"a\">one<br/>two</div></body></html>", 0, false));
+    EXPECT_EQ("<textarea>a<b</textarea><plaintext><p>x</plaintext>", parse("<textarea>a&lt;b</textarea><plaintext><p>x"));
+}
+
+TEST(HtmlTreeBuilderTest, ChunkedInputMatchesWholeInput) {
+    const char* inputs[] = {
+        "<p>hi</p>",
+        "<!DOCTYPE html><html><head><title>A &amp; B</title><style>p { color: red }</style></head>"
+            "<body><!-- c --><div id=\"a\" class='b c'>one<br/>two &lt; three</div></body></html>",
+        "<ul><li>one<li>two</ul><p>text with a long run of characters, more than a chunk</p>",
+        "<table><tr><td>1<td>2</table><select><option>a<option>b</select>",
+        "<p>a<b>b<i>c</b>d</i>e<script>var s = '</p>';</script>"
+    };
+
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++ i) {
+        std::string whole = parse(inputs[i], 0, false);
+        for (size_t chunkSize = 1; chunkSize <= 8; ++ chunkSize) {
+            EXPECT_EQ(whole, parse(inputs[i], chunkSize, false)) << inputs[i] << ", chunks of " << chunkSize;
+        }
+    }
+}
+
+TEST(HtmlTreeBuilderTest, Tables) {
+    EXPECT_EQ("<table><caption>c</caption><colgroup><col></col></colgroup><thead><tr><th>h</th></tr></thead>"
+              "<tbody><tr><td>1</td><td>2</td></tr></tbody></table>",
+              parse("<table><caption>c</caption><colgroup><col></colgroup><thead><tr><th>h</thead><tr><td>1<td>2</tr></table>"));
+    // missing table parts are implied
+    EXPECT_EQ("<table><tbody><tr><td>x</td></tr></tbody></table>", parse("<table><td>x</table>"));
+    EXPECT_EQ("<table><tbody><tr><td><table><tbody><tr><td>in</td></tr></tbody></table>out</td></tr></tbody></table>",
+              parse("<table><tr><td><table><tr><td>in</table>out</td></tr></table>"));
+    // elements out of place in a table are fostered before it
+    EXPECT_EQ("<p>x</p><table><tbody><tr><td>1</td></tr></tbody></table>", parse("<table><tr><td>1</td></tr><p>x</table>"));
+    EXPECT_EQ("<div><b>x</b><table><tbody><tr><td>1</td></tr></tbody></table></div>",
+              parse("<div><table><b>x</b><tr><td>1</table></div>"));
+}
+
+TEST(HtmlTreeBuilderTest, Select) {
+    EXPECT_EQ("<select><option>a</option><optgroup label=g><option>b</option></optgroup></select>",
+              parse("<select><option>a<optgroup label=g><option>b</optgroup></select>"));
+    EXPECT_EQ("<select><option>a</option><option>b</option><optgroup><option>c</option></optgroup></select>",
+              parse("<select><option>a<option>b<optgroup><option>c</select>"));
+    // a nested select closes the open one; other tags are dropped
+    EXPECT_EQ("<select><option>a</option></select>b", parse("<select><option>a<select>b"));
+    EXPECT_EQ("<select>x<option>y</option></select>", parse("<select><p>x<option>y</select>"));
+    // the end of the cell closes a select in it
+    EXPECT_EQ("<table><tbody><tr><td><select><option>a</option></select></td><td>b</td></tr></tbody></table>",
+              parse("<table><tr><td><select><option>a</td><td>b</table>"));
+}
+
+TEST(HtmlTreeBuilderTest, FormattingElements) {
+    // the adoption agency moves the content of the furthest block into a clone
+    EXPECT_EQ("<b>1</b><p><b>2</b>3</p>", parse("<b>1<p>2</b>3</p>"));
+    EXPECT_EQ("<a href=x>1</a><div><a href=x>2</a>3</div>", parse("<a href=x>1<div>2</a>3</div>"));
+    // misnested and unclosed formatting elements are reconstructed
+    EXPECT_EQ("<b><i>x</i></b><i>y</i>", parse("<b><i>x</b>y</i>"));
+    EXPECT_EQ("<p>a<b>b<i>c</i></b><i>d</i>e</p>", parse("<p>a<b>b<i>c</b>d</i>e"));
+    EXPECT_EQ("<p><b>x</b></p><p><b>y</b></p>", parse("<p><b>x<p>y"));
+    // a table cell is a marker, the end tag can't close the b outside
+    EXPECT_EQ("<b>x<table><tbody><tr><td>yz</td></tr></tbody></table></b>", parse("<b>x<table><td>y</b>z</table>"));
+}
+
+TEST(HtmlTreeBuilderTest, ImpliedEndTags) {
+    EXPECT_EQ("<p>one</p><p>two</p><div>three</div>", parse("<p>one<p>two<div>three"));
+    EXPECT_EQ("<ul><li>a</li><li>b</li></ul>", parse("<ul><li>a<li>b</ul>"));
+    EXPECT_EQ("<dl><dt>a</dt><dd>b</dd><dt>c</dt></dl>", parse("<dl><dt>a<dd>b<dt>c</dl>"));
+    EXPECT_EQ("<ruby>a<rb>b</rb><rt>c</rt><rp>d</rp></ruby>", parse("<ruby>a<rb>b<rt>c<rp>d</ruby>"));
+    EXPECT_EQ("<h1>a</h1><h2>b</h2>c", parse("<h1>a<h2>b</h1>c"));
+    // a stray end tag of p opens an empty one
+    EXPECT_EQ("<p>a</p><p></p>b", parse("<p>a</p></p>b"));
+}
+
+TEST(HtmlTreeBuilderTest, Scopes) {
+    CrtAllocator allocator;
+    ParseErrorList errors(16, &allocator);
+    HtmlTreeBuilder builder(&allocator);
+
+    // the stack stays open while the parse isn't finished
+    builder.beginParse("http://example.com/", &errors, NULL);
+    builder.feed("<div>");
+    EXPECT_FALSE(builder.inScope(CSOUP_TAG_P));
+    EXPECT_FALSE(builder.inButtonScope(CSOUP_TAG_P));
+    EXPECT_FALSE(builder.inTableScope(CSOUP_TAG_TD));
+    EXPECT_TRUE(builder.inScope(CSOUP_TAG_DIV));
+
+    // a p under a button is open but outside button scope
+    builder.feed("<p><button>");
+    EXPECT_TRUE(builder.inScope(CSOUP_TAG_P));
+    EXPECT_FALSE(builder.inButtonScope(CSOUP_TAG_P));
+    EXPECT_TRUE(builder.inButtonScope(CSOUP_TAG_BUTTON));
+    EXPECT_TRUE(builder.inListItemScope(CSOUP_TAG_P));
+
+    // a table bounds every scope, the cell bounds all but table scope
+    builder.feed("<table><tr><td><ul><li>");
+    EXPECT_FALSE(builder.inScope(CSOUP_TAG_P));
+    EXPECT_FALSE(builder.inTableScope(CSOUP_TAG_P));
+    EXPECT_FALSE(builder.inScope(CSOUP_TAG_TR));
+    EXPECT_TRUE(builder.inTableScope(CSOUP_TAG_TR));
+    EXPECT_TRUE(builder.inTableScope(CSOUP_TAG_TD));
+    EXPECT_TRUE(builder.inScope(CSOUP_TAG_LI));
+    EXPECT_TRUE(builder.inListItemScope(CSOUP_TAG_LI));
+    EXPECT_FALSE(builder.inListItemScope(CSOUP_TAG_TD));
+
+    const TagIdEnum cells[] = {CSOUP_TAG_TD, CSOUP_TAG_TH};
+    EXPECT_TRUE(builder.inScope(cells, 2));
+
+    delete builder.finishParse();
+}
+
+TEST(HtmlTreeBuilderTest, DeepUnclosedMarkup) {
+    const size_t depth = 1000;
+    std::string divs, bs, expected;
+    for (size_t i = 0; i < depth; ++ i) {
+        divs += "<div>";
+        bs += "<span><b>";
+    }
+
+    // closed at the end of the input
+    for (size_t i = 0; i < depth; ++ i) expected += "<div>";
+    expected += "x";
+    for (size_t i = 0; i < depth; ++ i) expected += "</div>";
+    EXPECT_EQ(expected, parse(divs + "x"));
+    EXPECT_EQ(expected, parse(divs + "x", 7));
+
+    // one end tag closes every element above its own; of the unclosed b's only
+    // the last three are reconstructed for the text after it
+    expected = "<div>";
+    for (size_t i = 0; i < depth; ++ i) expected += "<span><b>";
+    for (size_t i = 0; i < depth; ++ i) expected += "</b></span>";
+    expected += "</div><b><b><b>y</b></b></b>";
+    EXPECT_EQ(expected, parse("<div>" + bs + "</div>y"));
+
+    // a p end tag closes the deep p, the unclosed ones inside it don't leak out
+    expected = "<p>";
+    for (size_t i = 0; i < depth; ++ i) expected += "<span>";
+    expected += "a";
+    for (size_t i = 0; i < depth; ++ i) expected += "</span>";
+    expected += "</p>z";
+    std::string spans;
+    for (size_t i = 0; i < depth; ++ i) spans += "<span>";
+    EXPECT_EQ(expected, parse("<p>" + spans + "a</p>z"));
+}
+
+TEST(HtmlTreeBuilderTest, ParseFile) {
+    CrtAllocator allocator;
+    ParseErrorList errors(16, &allocator);
+    HtmlTreeBuilder builder(&allocator);
+
+    EXPECT_TRUE(builder.parseFile("/tmp/csoup_no_such_file", "http://example.com/", &errors, NULL) == NULL);
+
+    // UTF-8 is read from the mapping, which the document then owns
+    std::string content = "<p>caf\xC3\xA9 au lait</p>";
+    std::string path = writeTempFile(content);
+    Document* doc = builder.parseFile(path.c_str(), "http://example.com/", &errors, NULL);
+    std::remove(path.c_str());
+    ASSERT_TRUE(doc != NULL);
+    EXPECT_EQ(CSOUP_CHARSET_UTF8, doc->charset());
+    EXPECT_TRUE(doc->source().equals(StringRef(content.data(), content.size())));
+    TextNode* text = firstText(doc);
+    ASSERT_TRUE(text != NULL);
+    EXPECT_TRUE(text->wholeText().equals("caf\xC3\xA9 au lait"));
+    EXPECT_TRUE(refersInto(text->wholeText(), doc->source()));
+    EXPECT_EQ("<p>caf\xC3\xA9 au lait</p>", describe(doc));
+    delete doc;
+
+    // other charsets are transcoded, the document keeps the UTF-8 copy
+    content = "<meta charset=windows-1252><p>caf\xE9</p>";
+    path = writeTempFile(content);
+    doc = builder.parseFile(path.c_str(), "http://example.com/", &errors, NULL);
+    std::remove(path.c_str());
+    ASSERT_TRUE(doc != NULL);
+    EXPECT_EQ(CSOUP_CHARSET_WINDOWS_1252, doc->charset());
+    EXPECT_TRUE(doc->source().equals("<meta charset=windows-1252><p>caf\xC3\xA9</p>"));
+    text = firstText(doc);
+    ASSERT_TRUE(text != NULL);
+    EXPECT_TRUE(text->wholeText().equals("caf\xC3\xA9"));
+    EXPECT_TRUE(refersInto(text->wholeText(), doc->source()));
+    delete doc;
+
+    // so is UTF-8 with CRs to normalise
+    content = "<pre>a\r\nb\rc</pre>";
+    path = writeTempFile(content);
+    builder.setNormaliseNewlines(true);
+    doc = builder.parseFile(path.c_str(), "http://example.com/", &errors, NULL);
+    builder.setNormaliseNewlines(false);
+    std::remove(path.c_str());
+    ASSERT_TRUE(doc != NULL);
+    EXPECT_EQ(CSOUP_CHARSET_UTF8, doc->charset());
+    EXPECT_TRUE(doc->source().equals("<pre>a\nb\nc</pre>"));
+    text = firstText(doc);
+    ASSERT_TRUE(text != NULL);
+    EXPECT_TRUE(text->wholeText().equals("a\nb\nc"));
+    EXPECT_TRUE(refersInto(text->wholeText(), doc->source()));
+    delete doc;
+}
+
+TEST(HtmlTreeBuilderTest, TextRefersToKeptInput) {
+    CrtAllocator allocator;
+    ParseErrorList errors(16, &allocator);
+    HtmlTreeBuilder builder(&allocator);
+    const std::string input = "<p>some text</p>";
+    StringRef ref(input.data(), input.size());
+
+    // copied unless the caller pins the input
+    Document* doc = builder.parse(ref, "http://example.com/", &errors, NULL);
+    TextNode* text = firstText(doc);
+    ASSERT_TRUE(text != NULL);
+    EXPECT_TRUE(text->wholeText().equals("some text"));
+    EXPECT_FALSE(refersInto(text->wholeText(), ref));
+    delete doc;
+
+    builder.setInputPinned(true);
+    doc = builder.parse(ref, "http://example.com/", &errors, NULL);
+    text = firstText(doc);
+    ASSERT_TRUE(text != NULL);
+    EXPECT_TRUE(text->wholeText().equals("some text"));
+    EXPECT_TRUE(refersInto(text->wholeText(), ref));
+    delete doc;
+
+    // input the document adopted is referred to, pinned or not
+    builder.setInputPinned(false);
+    builder.setCharset(CSOUP_CHARSET_ISO_8859_1);
+    doc = builder.parse(ref, "http://example.com/", &errors, NULL);
+    builder.setCharset(CSOUP_CHARSET_UNKNOWN);
+    text = firstText(doc);
+    ASSERT_TRUE(text != NULL);
+    EXPECT_TRUE(text->wholeText().equals("some text"));
+    EXPECT_FALSE(refersInto(text->wholeText(), ref));
+    EXPECT_TRUE(refersInto(text->wholeText(), doc->source()));
+    delete doc;
+
+    // pushed input is dropped as it is parsed, so its text is always copied
+    builder.setInputPinned(true);
+    builder.beginParse("http://example.com/", &errors, NULL);
+    builder.feed(StringRef(input.data(), 8));
+    builder.feed(StringRef(input.data() + 8, input.size() - 8));
+    for (int i = 0; i < 100; ++ i) {
+        builder.feed("<b>padding</b>");
+    }
+    doc = builder.finishParse();
+    builder.setInputPinned(false);
+    EXPECT_EQ(0u, doc->source().size());
+    text = firstText(doc);
+    ASSERT_TRUE(text != NULL);
+    EXPECT_TRUE(text->wholeText().equals("some text"));
+    EXPECT_FALSE(refersInto(text->wholeText(), ref));
+    delete doc;
+}
+
+TEST(HtmlTreeBuilderTest, SkippedContent) {
+    CrtAllocator allocator;
+    ParseErrorList errors(16, &allocator);
+    HtmlTreeBuilder builder(&allocator);
+    const StringRef skipped[] = {"script", "div"};
+    builder.setSkippedTags(skipped, arrayLength(skipped));
+    const std::string input = "<span>a<script>if (a<b) x();</script><div>b<div>c</div>d</div>e</span>";
+    StringRef ref(input.data(), input.size());
+
+    // skipped elements get no children, and refer to their content when the input is kept
+    builder.setInputPinned(true);
+    Document* doc = builder.parse(ref, "http://example.com/", &errors, NULL);
+    EXPECT_EQ("<span>a<script></script><div></div>e</span>", describe(doc));
+    Element* span = static_cast<Element*>(bodyOf(doc)->childNode(0));
+    Element* script = static_cast<Element*>(span->childNode(1));
+    Element* div = static_cast<Element*>(span->childNode(2));
+    EXPECT_TRUE(script->skippedContent().equals("if (a<b) x();"));
+    EXPECT_TRUE(refersInto(script->skippedContent(), ref));
+    EXPECT_TRUE(div->skippedContent().equals("b<div>c</div>d"));
+    EXPECT_TRUE(refersInto(div->skippedContent(), ref));
+    delete doc;
+
+    builder.setInputPinned(false);
+    doc = builder.parse(ref, "http://example.com/", &errors, NULL);
+    EXPECT_EQ("<span>a<script></script><div></div>e</span>", describe(doc));
+    span = static_cast<Element*>(bodyOf(doc)->childNode(0));
+    EXPECT_EQ(0u, static_cast<Element*>(span->childNode(1))->skippedContent().size());
+    delete doc;
+
+    // pushed input is dropped as it is parsed, even pinned it isn't referred to
+    builder.setInputPinned(true);
+    builder.beginParse("http://example.com/", &errors, NULL);
+    for (size_t pos = 0; pos < input.size(); pos += 5) {
+        builder.feed(StringRef(input.data() + pos, std::min<size_t>(5, input.size() - pos)));
+    }
+    doc = builder.finishParse();
+    builder.setInputPinned(false);
+    EXPECT_EQ("<span>a<script></script><div></div>e</span>", describe(doc));
+    span = static_cast<Element*>(bodyOf(doc)->childNode(0));
+    EXPECT_EQ(0u, static_cast<Element*>(span->childNode(1))->skippedContent().size());
+    EXPECT_EQ(0u, static_cast<Element*>(span->childNode(2))->skippedContent().size());
+    delete doc;
+}
+
+TEST(HtmlTreeBuilderTest, NormaliseNewlines) {
+    CrtAllocator allocator;
+    ParseErrorList errors(16, &allocator);
+    HtmlTreeBuilder builder(&allocator);
+    builder.setNormaliseNewlines(true);
+    const std::string input = "<pre>a\r\nb\rc\r\r\nd</pre><p title=\"x\r\ny\">e\r</p>";
+
+    Document* doc = builder.parse(StringRef(input.data(), input.size()), "http://example.com/", &errors, NULL);
+    const std::string expected = "<pre>a\nb\nc\n\nd</pre><p title=x\ny>e\n</p>";
+    std::string out = describe(doc);
+    EXPECT_EQ(expected, out);
+    EXPECT_EQ(std::string::npos, out.find('\r'));
+    delete doc;
+
+    // a CR LF split between two chunks is still one newline
+    const char* chunks[] = {"<pre>a\r", "\nb\r", "c\r", "\r", "\nd</pre><p title=\"x\r", "\ny\">e\r", "</p>"};
+    builder.beginParse("http://example.com/", &errors, NULL);
+    for (size_t i = 0; i < arrayLength(chunks); ++ i) {
+        builder.feed(StringRef(chunks[i], std::strlen(chunks[i])));
+    }
+    doc = builder.finishParse();
+    EXPECT_EQ(expected, describe(doc));
+    delete doc;
+
+    for (size_t chunkSize = 1; chunkSize <= 4; ++ chunkSize) {
+        builder.beginParse("http://example.com/", &errors, NULL);
+        for (size_t pos = 0; pos < input.size(); pos += chunkSize) {
+            builder.feed(StringRef(input.data() + pos, std::min(chunkSize, input.size() - pos)));
+        }
+        doc = builder.finishParse();
+        EXPECT_EQ(expected, describe(doc)) << "chunks of " << chunkSize;
+        delete doc;
+    }
+}
+
+TEST(HtmlTreeBuilderTest, SelfClosingTagsStayInTheirDocument) {
+    CrtAllocator allocator;
+    ParseErrorList errors(16, &allocator);
+    HtmlTreeBuilder builder(&allocator);
+
+    Document* first = builder.parse("<div/><foo/>", "http://example.com/", &errors, NULL);
+    Document* second = builder.parse("<foo>x</foo><div/>", "http://example.com/", &errors, NULL);
+    EXPECT_EQ("<div></div><foo></foo>", describe(first));
+    EXPECT_EQ("<foo>x</foo><div></div>", describe(second));
+
+    // a known tag isn't changed by a self-closing start tag
+    Element* div = static_cast<Element*>(bodyOf(first)->childNode(0));
+    EXPECT_EQ(Tag::valueOf(CSOUP_TAG_DIV), div->tag());
+    EXPECT_FALSE(Tag::valueOf(CSOUP_TAG_DIV)->selfClosing());
+
+    // each document has its own foo, only the first one self closes
+    Element* foo1 = static_cast<Element*>(bodyOf(first)->childNode(1));
+    Element* foo2 = static_cast<Element*>(bodyOf(second)->childNode(0));
+    EXPECT_TRUE(foo1->tag() != foo2->tag());
+    EXPECT_EQ(first->internTag("foo"), foo1->tag());
+    EXPECT_EQ(second->internTag("foo"), foo2->tag());
+    EXPECT_TRUE(foo1->tag()->selfClosing());
+    EXPECT_FALSE(foo2->tag()->selfClosing());
+
+    delete first;
+    delete second;
+    EXPECT_FALSE(Tag::valueOf(CSOUP_TAG_DIV)->selfClosing());
+}
+
+namespace {
+    // Parses documents that mark their own foo self closing, and counts the ones
+    // that come out wrong.
+    void* parseSelfClosingTags(void* failures) {
+        CrtAllocator allocator;
+        ParseErrorList errors(16, &allocator);
+        HtmlTreeBuilder builder(&allocator);
+
+        for (int i = 0; i < 200; ++ i) {
+            bool selfClose = i % 2 == 0;
+            StringRef input = selfClose ? StringRef("<div/><foo/>x") : StringRef("<foo>x</foo><div/>");
+            Document* doc = builder.parse(input, "http://example.com/", &errors, NULL);
+            std::string expected = selfClose ? "<div></div><foo></foo>x" : "<foo>x</foo><div></div>";
+            if (describe(doc) != expected || doc->internTag("foo")->selfClosing() != selfClose ||
+                Tag::valueOf(CSOUP_TAG_DIV)->selfClosing()) {
+                ++ *static_cast<int*>(failures);
+            }
+            delete doc;
+        }
+        return NULL;
+    }
+}
+
+TEST(HtmlTreeBuilderTest, ConcurrentParses) {
+    const int kThreads = 8;
+    pthread_t threads[kThreads];
+    int failures[kThreads] = {0};
+
+    for (int i = 0; i < kThreads; ++ i) {
+        ASSERT_EQ(0, pthread_create(&threads[i], NULL, parseSelfClosingTags, &failures[i]));
+    }
+    for (int i = 0; i < kThreads; ++ i) {
+        pthread_join(threads[i], NULL);
+        EXPECT_EQ(0, failures[i]) << "thread " << i;
+    }
+}
@@ -0,0 +1,60 @@
+//
+//  mappedfile_test.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include <cstdio>
+#include <string>
+#include "gtest/gtest/gtest.h"
+#include "util/mappedfile.h"
+#include "parser/characterreader.h"
+
+using namespace csoup;
+
+namespace {
+    std::string writeTempFile(const std::string& content) {
+        char path[] = "/tmp/csoup_mappedfile_XXXXXX";
+        int fd = mkstemp(path);
+        std::FILE* fp = fdopen(fd, "wb");
+        std::fwrite(content.data(), 1, content.size(), fp);
+        std::fclose(fp);
+        return path;
+    }
+}
+
+TEST(MappedFileTest, OpenAndRead) {
+    std::string content = "<p>caf\xC3\xA9</p>";
+    for (int i = 0; i < 1000; ++ i) content += "<b>x</b>";
+    std::string path = writeTempFile(content);
+    
+    MappedFile file;
+    EXPECT_TRUE(file.open(path.c_str()));
+    EXPECT_EQ(content.size(), file.size());
+    EXPECT_TRUE(file.ref().equals(StringRef(content.data(), content.size())));
+    
+    CharacterReader reader(file.ref());
+    EXPECT_EQ('<', reader.next());
+    EXPECT_EQ(8u, reader.nextIndexOf(StringRef("</p>")));
+    
+    MappedFile other;
+    other.swap(file);
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_EQ(content.size(), other.size());
+    other.close();
+    EXPECT_FALSE(other.isOpen());
+    std::remove(path.c_str());
+}
+
+TEST(MappedFileTest, EmptyAndMissingFiles) {
+    std::string path = writeTempFile("");
+    MappedFile file;
+    EXPECT_TRUE(file.open(path.c_str()));
+    EXPECT_EQ(0u, file.ref().size());
+    std::remove(path.c_str());
+    
+    EXPECT_FALSE(file.open("/nonexistent/csoup/file.html"));
+    EXPECT_FALSE(file.isOpen());
+}
@@ -0,0 +1,154 @@
+#include "gtest/gtest/gtest.h"
+#include "parser/openelementstack.h"
+#include "nodes/document.h"
+#include "nodes/element.h"
+#include "util/allocators.h"
+
+using namespace csoup;
+
+namespace {
+    // Checks the counts of the stack against its elements.
+    void expectCountsInStep(const internal::OpenElementStack& stack) {
+        size_t counts[CSOUP_TAG_COUNT] = {0};
+        for (size_t i = 0; i < stack.size(); ++ i) {
+            EXPECT_EQ(stack.at(i)->tagId(), stack.idAt(i));
+            ++ counts[stack.at(i)->tagId()];
+        }
+        for (int id = 0; id < CSOUP_TAG_COUNT; ++ id) {
+            EXPECT_EQ(counts[id], stack.count(static_cast<TagIdEnum>(id))) << "tag id " << id;
+        }
+    }
+}
+
+TEST(OpenElementStackTest, CountsInStep)
+{
+    CrtAllocator allocator;
+    Document doc("http://example.com/", &allocator);
+    Element html(Tag::valueOf(CSOUP_TAG_HTML), "http://example.com/", &allocator);
+    Element body(Tag::valueOf(CSOUP_TAG_BODY), "http://example.com/", &allocator);
+    Element div(Tag::valueOf(CSOUP_TAG_DIV), "http://example.com/", &allocator);
+    Element div2(Tag::valueOf(CSOUP_TAG_DIV), "http://example.com/", &allocator);
+    Element p(Tag::valueOf(CSOUP_TAG_P), "http://example.com/", &allocator);
+    Element foo(doc.internTag("foo"), "http://example.com/", &allocator);
+    Element bar(doc.internTag("bar"), "http://example.com/", &allocator);
+
+    internal::OpenElementStack stack(&allocator);
+    EXPECT_TRUE(stack.empty());
+    expectCountsInStep(stack);
+
+    stack.push(&html);
+    stack.push(&body);
+    stack.push(&div);
+    stack.push(&foo);
+    stack.push(&div2);
+    EXPECT_EQ(5u, stack.size());
+    EXPECT_EQ(&html, stack.bottom());
+    EXPECT_EQ(&div2, stack.top());
+    EXPECT_EQ(2u, stack.count(CSOUP_TAG_DIV));
+    EXPECT_EQ(1u, stack.count(CSOUP_TAG_UNKNOWN));
+    expectCountsInStep(stack);
+
+    EXPECT_EQ(&div2, stack.pop());
+    EXPECT_EQ(1u, stack.count(CSOUP_TAG_DIV));
+    expectCountsInStep(stack);
+
+    // html body p div foo bar
+    stack.insert(2, &p);
+    stack.insert(100, &bar);
+    EXPECT_EQ(&p, stack.at(2));
+    EXPECT_EQ(&bar, stack.top());
+    EXPECT_EQ(2u, stack.count(CSOUP_TAG_UNKNOWN));
+    expectCountsInStep(stack);
+
+    // html body p foo bar
+    stack.remove(3);
+    EXPECT_EQ(0u, stack.count(CSOUP_TAG_DIV));
+    EXPECT_EQ(&foo, stack.at(3));
+    expectCountsInStep(stack);
+
+    // html body div foo bar
+    stack.replace(2, &div);
+    EXPECT_EQ(0u, stack.count(CSOUP_TAG_P));
+    EXPECT_EQ(1u, stack.count(CSOUP_TAG_DIV));
+    stack.replace(4, &p);
+    EXPECT_EQ(1u, stack.count(CSOUP_TAG_UNKNOWN));
+    expectCountsInStep(stack);
+
+    stack.truncate(2);
+    EXPECT_EQ(2u, stack.size());
+    EXPECT_EQ(&body, stack.top());
+    EXPECT_EQ(0u, stack.count(CSOUP_TAG_DIV));
+    EXPECT_EQ(0u, stack.count(CSOUP_TAG_UNKNOWN));
+    expectCountsInStep(stack);
+
+    stack.clear();
+    EXPECT_TRUE(stack.empty());
+    expectCountsInStep(stack);
+}
+
+TEST(OpenElementStackTest, Grows)
+{
+    CrtAllocator allocator;
+    Element html(Tag::valueOf(CSOUP_TAG_HTML), "http://example.com/", &allocator);
+    Element div(Tag::valueOf(CSOUP_TAG_DIV), "http://example.com/", &allocator);
+    Element p(Tag::valueOf(CSOUP_TAG_P), "http://example.com/", &allocator);
+
+    internal::OpenElementStack stack(&allocator);
+    stack.push(&html);
+    for (size_t i = 0; i < 1000; ++ i) {
+        stack.push(&div);
+        stack.insert(1, &p);
+    }
+    EXPECT_EQ(2001u, stack.size());
+    EXPECT_EQ(1000u, stack.count(CSOUP_TAG_DIV));
+    EXPECT_EQ(1000u, stack.count(CSOUP_TAG_P));
+    EXPECT_EQ(&p, stack.at(1000));
+    EXPECT_EQ(&div, stack.at(1001));
+    expectCountsInStep(stack);
+
+    stack.truncate(1);
+    EXPECT_EQ(&html, stack.top());
+    expectCountsInStep(stack);
+}
+
+TEST(OpenElementStackTest, LastIndexOf)
+{
+    CrtAllocator allocator;
+    Element html(Tag::valueOf(CSOUP_TAG_HTML), "http://example.com/", &allocator);
+    Element table(Tag::valueOf(CSOUP_TAG_TABLE), "http://example.com/", &allocator);
+    Element tr(Tag::valueOf(CSOUP_TAG_TR), "http://example.com/", &allocator);
+    Element td(Tag::valueOf(CSOUP_TAG_TD), "http://example.com/", &allocator);
+    Element th(Tag::valueOf(CSOUP_TAG_TH), "http://example.com/", &allocator);
+    Element div(Tag::valueOf(CSOUP_TAG_DIV), "http://example.com/", &allocator);
+
+    internal::OpenElementStack stack(&allocator);
+    const TagIdEnum cells[] = {CSOUP_TAG_TD, CSOUP_TAG_TH};
+    EXPECT_EQ(0u, stack.lastIndexOf(cells, 2));
+
+    // html table tr td div th div
+    stack.push(&html);
+    stack.push(&table);
+    stack.push(&tr);
+    stack.push(&td);
+    stack.push(&div);
+    stack.push(&th);
+    stack.push(&div);
+
+    EXPECT_EQ(5u, stack.lastIndexOf(cells, 2));
+    EXPECT_EQ(3u, stack.lastIndexOf(cells, 1));
+    EXPECT_EQ(6u, stack.lastIndexOf(CSOUP_TAG_DIV));
+    EXPECT_EQ(0u, stack.lastIndexOf(CSOUP_TAG_HTML));
+    EXPECT_EQ(stack.size(), stack.lastIndexOf(CSOUP_TAG_P));
+    EXPECT_EQ(stack.size(), stack.lastIndexOf(cells, 0));
+
+    const TagIdEnum rows[] = {CSOUP_TAG_TBODY, CSOUP_TAG_TR, CSOUP_TAG_TABLE};
+    EXPECT_EQ(2u, stack.lastIndexOf(rows, 3));
+
+    // the topmost after the stack changes
+    stack.remove(5);
+    EXPECT_EQ(3u, stack.lastIndexOf(cells, 2));
+    stack.replace(3, &th);
+    EXPECT_EQ(3u, stack.lastIndexOf(cells + 1, 1));
+    stack.truncate(3);
+    EXPECT_EQ(stack.size(), stack.lastIndexOf(cells, 2));
+}
@@ -0,0 +1,134 @@
+//
+//  saxparser_test.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include <string>
+#include "gtest/gtest/gtest.h"
+#include "parser/saxparser.h"
+#include "parser/parseerrorlist.h"
+#include "nodes/attributes.h"
+#include "util/allocators.h"
+
+using namespace csoup;
+
+namespace {
+    class Recorder : public SaxHandler {
+    public:
+        Recorder() : parser(NULL), stopAt(-1) {}
+
+        void startTag(const StringRef& name, const Attributes* attributes, bool selfClosing, size_t sourcePos) {
+            out.append("<").append(name.data(), name.size());
+            for (size_t i = 0; attributes && i < attributes->size(); ++ i) {
+                const Attribute* attr = attributes->get(i);
+                out.append(" ").append(attr->key().data(), attr->key().size());
+                out.append("=").append(attr->value().data(), attr->value().size());
+            }
+            out.append(selfClosing ? "/>" : ">");
+            if (name.equals(StringRef("a")) && stopAt-- == 0) parser->stop();
+        }
+
+        void endTag(const StringRef& name, size_t sourcePos) {
+            out.append(sourcePos == kNoSourcePos ? "<~/" : "</").append(name.data(), name.size()).append(">");
+        }
+
+        void text(const StringRef& data, size_t sourcePos) {
+            out.append(data.data(), data.size());
+        }
+
+        void comment(const StringRef& data, size_t sourcePos) {
+            out.append("<!--").append(data.data(), data.size()).append("-->");
+        }
+
+        void doctype(const StringRef& name, const StringRef& publicIdentifier,
+                     const StringRef& systemIdentifier, bool forceQuirks) {
+            out.append("<!DOCTYPE ").append(name.data(), name.size()).append(">");
+        }
+
+        void skippedContent(const StringRef& content, size_t sourcePos) {
+            out.append("{").append(content.data(), content.size()).append("}");
+        }
+
+        void endDocument() {
+            out.append("$");
+        }
+
+        std::string out;
+        SaxParser* parser;
+        int stopAt;
+    };
+
+    std::string events(const std::string& input, SaxModeEnum mode, bool indexed = false,
+                       const StringRef* skippedTags = NULL, size_t skippedTagCount = 0) {
+        CrtAllocator allocator;
+        Recorder recorder;
+        SaxParser parser(&recorder, &allocator);
+        parser.setMode(mode);
+        parser.setStructuralIndex(indexed);
+        parser.setSkippedTags(skippedTags, skippedTagCount);
+        parser.parse(StringRef(input.data(), input.size()), NULL);
+        return recorder.out;
+    }
+}
+
+TEST(SaxParserTest, Tokens) {
+    EXPECT_EQ("<!DOCTYPE html><p class=x>a &amp b<!-- c --></p></q>$",
+              events("<!DOCTYPE html><P class=x>a &amp;amp b<!-- c --></p></q>", CSOUP_SAX_TOKENS));
+    // raw text elements are read the way the tree builder reads them
+    EXPECT_EQ("<script>if (a<b) x = '</p>';</script><title><b>&</title>$",
+              events("<script>if (a<b) x = '</p>';</script><title><b>&amp;</title>", CSOUP_SAX_TOKENS));
+}
+
+TEST(SaxParserTest, Balanced) {
+    // implied ends are marked with '~'
+    EXPECT_EQ("<ul><li>a<~/li><li>b<br/><~/br></li></ul>$",
+              events("<ul><li>a<li>b<br/></li></ul>", CSOUP_SAX_BALANCED));
+    EXPECT_EQ("<p>one<~/p><div>two<b>three<~/b></div>$",
+              events("<p>one<div>two<b>three</div></span>", CSOUP_SAX_BALANCED));
+    EXPECT_EQ("<table><tr><td>1<~/td><td>2<~/td><~/tr><tr><th>3</th><~/tr></table>$",
+              events("<table><tr><td>1<td>2<tr><th>3</th></table>", CSOUP_SAX_BALANCED));
+    EXPECT_EQ("<p></p><body><h1>x<~/h1><h2>y<~/h2><~/body>$",
+              events("</p><body><h1>x<h2>y</body>", CSOUP_SAX_BALANCED));
+}
+
+TEST(SaxParserTest, Stop) {
+    CrtAllocator allocator;
+    Recorder recorder;
+    SaxParser parser(&recorder, &allocator);
+    recorder.parser = &parser;
+    recorder.stopAt = 1;
+
+    std::string input = "<a href=1>x</a><a href=2>y</a><a href=3>z</a>";
+    EXPECT_FALSE(parser.parse(StringRef(input.data(), input.size()), NULL));
+    EXPECT_EQ("<a href=1>x</a><a href=2>", recorder.out);
+}
+
+TEST(SaxParserTest, StructuralIndex) {
+    std::string input = "<!DOCTYPE html><html><head><title>T &amp; T</title>"
+                        "<style>p > a { color: red }</style></head><body class=\"main page\" data-x='1'>\r\n";
+    for (int i = 0; i < 40; ++ i) {
+        input += "<p id=p";
+        input += static_cast<char>('0' + i % 10);
+        input += " title=\"caf\xC3\xA9 &lt;\">Some text, with - dashes / slashes &copy; and \xE4\xBD\xA0\xE5\xA5\xBD</p>";
+        input.append(i, ' ');
+        input += "<!-- comment --><script>if (a < b && c > d) x = '</p>';</script><br/>\r";
+    }
+    input += "<textarea>a<b>&amp;</textarea></body></html>";
+    
+    EXPECT_EQ(events(input, CSOUP_SAX_TOKENS), events(input, CSOUP_SAX_TOKENS, true));
+    EXPECT_EQ(events(input, CSOUP_SAX_BALANCED), events(input, CSOUP_SAX_BALANCED, true));
+}
+
+TEST(SaxParserTest, SkippedTags) {
+    const StringRef skipped[] = {"script", "style", "template"};
+    EXPECT_EQ("<p>a<script>{if (a<b) x = '</p>';}</script><style>{}</style>b</p>$",
+              events("<p>a<script>if (a<b) x = '</p>';</script><style></style>b</p>", CSOUP_SAX_TOKENS, false,
+                     skipped, arrayLength(skipped)));
+    // a skipped element left open runs to the end
+    EXPECT_EQ("<div><template>{<template><p>x</template></div>}<~/template><~/div>$",
+              events("<div><template><template><p>x</template></div>", CSOUP_SAX_BALANCED, true,
+                     skipped, arrayLength(skipped)));
+}
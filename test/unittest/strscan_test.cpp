@@ -0,0 +1,256 @@
+//
+//  strscan_test.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include <string>
+#include <algorithm>
+#include "gtest/gtest/gtest.h"
+#include "internal/strscan.h"
+
+using namespace csoup;
+
+namespace {
+    // Steps through the kernel sets the CPU runs, scalar first, and switches back to the
+    // one picked at startup when done:
+    //     for (KernelLevels levels; levels.next(); ) { ... }
+    class KernelLevels {
+    public:
+        KernelLevels() : initial_(internal::scanKernelName()), next_(0) {
+        }
+
+        ~KernelLevels() {
+            internal::setScanKernels(initial_);
+        }
+
+        bool next() {
+            static const char* const names[] = {"scalar", "sse2", "avx2"};
+            while (next_ < arrayLength(names)) {
+                if (internal::setScanKernels(names[next_ ++])) return true;
+            }
+            return false;
+        }
+
+    private:
+        const char* initial_;
+        size_t next_;
+    };
+
+    // text as UTF-16 code units of either byte order
+    std::string utf16(const std::string& text, bool bigEndian) {
+        std::string out;
+        for (size_t i = 0; i < text.size(); ++ i) {
+            char hi = text[i] == '\x01' ? '\x01' : '\0';   // \x01 stands for U+0100
+            char lo = text[i] == '\x01' ? '\0' : text[i];
+            out += bigEndian ? hi : lo;
+            out += bigEndian ? lo : hi;
+        }
+        return out;
+    }
+}
+
+TEST(StrScanTest, KernelLevels) {
+    const std::string initial = internal::scanKernelName();
+    EXPECT_FALSE(internal::setScanKernels("neon"));
+    EXPECT_EQ(initial, internal::scanKernelName());
+
+    size_t levels = 0;
+    for (KernelLevels l; l.next(); ) {
+        if (levels == 0) EXPECT_STREQ("scalar", internal::scanKernelName());
+        ++ levels;
+    }
+    EXPECT_LE(1u, levels);
+    EXPECT_EQ(initial, internal::scanKernelName());
+}
+
+TEST(StrScanTest, FindByte) {
+    for (KernelLevels levels; levels.next(); ) {
+        SCOPED_TRACE(internal::scanKernelName());
+        // lengths around the 16/32 byte block sizes of the vector kernels
+        for (size_t len = 1; len < 100; ++ len) {
+            for (size_t at = 0; at < len; ++ at) {
+                std::string s(len, 'a');
+                s[at] = '<';
+                if (at + 1 < len) s[len - 1] = '<';
+                EXPECT_EQ(s.data() + at, internal::findByte(s.data(), s.data() + len, '<'));
+            }
+            std::string none(len, 'a');
+            EXPECT_EQ(none.data() + len, internal::findByte(none.data(), none.data() + len, '<'));
+        }
+    }
+}
+
+TEST(StrScanTest, FindSubstring) {
+    const char needle[] = "-->";
+    for (KernelLevels levels; levels.next(); ) {
+        SCOPED_TRACE(internal::scanKernelName());
+        for (size_t len = 3; len < 100; ++ len) {
+            for (size_t at = 0; at + 3 <= len; ++ at) {
+                std::string s(len, '-');
+                s.replace(at, 3, needle);
+                // decoys that share the anchors but not the middle byte
+                if (at > 4) s.replace(0, 3, "-x>");
+                const char* found = internal::findSubstring(s.data(), s.data() + len, needle, 3);
+                EXPECT_EQ(s.find(needle), static_cast<size_t>(found - s.data()));
+            }
+            std::string none(len, '-');
+            EXPECT_EQ(none.data() + len, internal::findSubstring(none.data(), none.data() + len, needle, 3));
+        }
+    }
+}
+
+TEST(StrScanTest, FindNonAscii) {
+    for (KernelLevels levels; levels.next(); ) {
+        SCOPED_TRACE(internal::scanKernelName());
+        for (size_t len = 1; len < 100; ++ len) {
+            for (size_t at = 0; at < len; ++ at) {
+                std::string s(len, '\x7F');
+                s[at] = static_cast<char>(0x80 + at);
+                EXPECT_EQ(s.data() + at, internal::findNonAscii(s.data(), s.data() + len));
+            }
+            std::string none(len, 'a');
+            EXPECT_EQ(none.data() + len, internal::findNonAscii(none.data(), none.data() + len));
+        }
+    }
+}
+
+TEST(StrScanTest, FindControlOrNonAscii) {
+    for (KernelLevels levels; levels.next(); ) {
+        SCOPED_TRACE(internal::scanKernelName());
+        // every byte value, at every offset within the blocks
+        for (int b = 0; b < 256; ++ b) {
+            bool stops = (b < 0x20 && b != '\t' && b != '\n' && b != '\f') || b >= 0x7F;
+            for (size_t at = 0; at < 40; ++ at) {
+                std::string s(70, 'a');
+                s[at] = static_cast<char>(b);
+                const char* found = internal::findControlOrNonAscii(s.data(), s.data() + s.size());
+                EXPECT_EQ(stops ? s.data() + at : s.data() + s.size(), found) << "byte " << b << " at " << at;
+            }
+        }
+    }
+}
+
+TEST(StrScanTest, CountByte) {
+    for (KernelLevels levels; levels.next(); ) {
+        SCOPED_TRACE(internal::scanKernelName());
+        for (size_t len = 1; len < 100; ++ len) {
+            std::string s(len, 'x');
+            for (size_t i = len % 3; i < len; i += len % 7 + 1) s[i] = '\n';
+            EXPECT_EQ(static_cast<size_t>(std::count(s.begin(), s.end(), '\n')),
+                      internal::countByte(s.data(), s.data() + len, '\n')) << "length " << len;
+        }
+    }
+}
+
+TEST(StrScanTest, ValidUtf8Prefix) {
+    const char valid[] = "a\xC3\xA9\xE4\xBD\xA0\xF0\x9F\x98\x80z";
+    const char overlong[] = "ab\xC0\xAF";
+    const char surrogate[] = "ab\xED\xA0\x80";
+    const char tooLarge[] = "ab\xF4\x90\x80\x80";
+    for (KernelLevels levels; levels.next(); ) {
+        SCOPED_TRACE(internal::scanKernelName());
+        EXPECT_EQ(valid + sizeof(valid) - 1, internal::validUtf8Prefix(valid, valid + sizeof(valid) - 1));
+        // truncated sequence at the end of the range
+        EXPECT_EQ(valid + 6, internal::validUtf8Prefix(valid, valid + 8));
+
+        EXPECT_EQ(overlong + 2, internal::validUtf8Prefix(overlong, overlong + 4));
+        EXPECT_EQ(surrogate + 2, internal::validUtf8Prefix(surrogate, surrogate + 5));
+        EXPECT_EQ(tooLarge + 2, internal::validUtf8Prefix(tooLarge, tooLarge + 6));
+
+        // a bad sequence past the ASCII blocks the vector kernels skip
+        std::string s = std::string(37, 'a') + "\xC3\xA9" + std::string(40, 'b') + "\xC0\xAF";
+        EXPECT_EQ(s.data() + 79, internal::validUtf8Prefix(s.data(), s.data() + s.size()));
+    }
+}
+
+TEST(StrScanTest, CaseFolding) {
+    // every byte value, so the range edges ('@', '[', '`', '{') and bytes >= 0x80
+    // go through the vector kernels too
+    std::string all;
+    for (int i = 0; i < 256; ++ i) all += static_cast<char>(i);
+
+    for (KernelLevels levels; levels.next(); ) {
+        SCOPED_TRACE(internal::scanKernelName());
+        std::string lower(all.size(), '\0'), upper(all.size(), '\0');
+        internal::lowerCopy(&lower[0], all.data(), all.size());
+        internal::upperCopy(&upper[0], all.data(), all.size());
+        for (int i = 0; i < 256; ++ i) {
+            int expectLower = (i >= 'A' && i <= 'Z') ? i + 32 : i;
+            int expectUpper = (i >= 'a' && i <= 'z') ? i - 32 : i;
+            EXPECT_EQ(expectLower, static_cast<unsigned char>(lower[i])) << i;
+            EXPECT_EQ(expectUpper, static_cast<unsigned char>(upper[i])) << i;
+        }
+
+        EXPECT_EQ(0, internal::compareIgnoreCase(lower.data(), upper.data(), all.size()));
+        EXPECT_NE(0, internal::compareIgnoreCase("\xC3\xA9", "\xC3\x89", 2));
+        for (size_t len = 1; len < 100; ++ len) {
+            std::string a(len, 'x'), b(len, 'X');
+            EXPECT_EQ(0, internal::compareIgnoreCase(a.data(), b.data(), len));
+            b[len - 1] = 'Y';
+            EXPECT_GT(0, internal::compareIgnoreCase(a.data(), b.data(), len));
+            EXPECT_LT(0, internal::compareIgnoreCase(b.data(), a.data(), len));
+        }
+    }
+}
+
+TEST(StrScanTest, NormaliseNewlines) {
+    const char* cases[][2] = {
+        { "", "" },
+        { "no newlines", "no newlines" },
+        { "a\r\nb\rc\n\rd\r\r\ne\r", "a\nb\nc\n\nd\n\ne\n" },
+        { "\r\n\r\n", "\n\n" }
+    };
+
+    // CRLF runs across the vector block sizes
+    std::string crlf, lf;
+    for (int i = 0; i < 50; ++ i) {
+        crlf += std::string(i % 37, 'x') + "\r\n";
+        lf += std::string(i % 37, 'x') + "\n";
+    }
+
+    for (KernelLevels levels; levels.next(); ) {
+        SCOPED_TRACE(internal::scanKernelName());
+        for (size_t i = 0; i < arrayLength(cases); ++ i) {
+            std::string s(cases[i][0]);
+            s.resize(internal::normaliseNewlines(&s[0], s.size()));
+            EXPECT_EQ(cases[i][1], s);
+        }
+
+        std::string s(crlf);
+        s.resize(internal::normaliseNewlines(&s[0], s.size()));
+        EXPECT_EQ(lf, s);
+    }
+}
+
+TEST(StrScanTest, NarrowAsciiUtf16) {
+    for (KernelLevels levels; levels.next(); ) {
+        SCOPED_TRACE(internal::scanKernelName());
+        for (int bigEndian = 0; bigEndian < 2; ++ bigEndian) {
+            for (size_t len = 1; len < 70; ++ len) {
+                std::string text;
+                for (size_t i = 0; i < len; ++ i) text += static_cast<char>('a' + i % 26);
+
+                std::string dst(len, '\0');
+                std::string units = utf16(text, bigEndian != 0);
+                EXPECT_EQ(len, internal::narrowAsciiUtf16(units.data(), len, bigEndian != 0, &dst[0]));
+                EXPECT_EQ(text, dst);
+
+                // a unit outside ASCII in either byte stops it
+                for (size_t at = 0; at < len; at += 5) {
+                    for (int k = 0; k < 2; ++ k) {
+                        std::string stop(text);
+                        stop[at] = k == 0 ? '\x80' : '\x01';
+                        units = utf16(stop, bigEndian != 0);
+                        std::fill(dst.begin(), dst.end(), '\0');
+                        EXPECT_EQ(at, internal::narrowAsciiUtf16(units.data(), len, bigEndian != 0, &dst[0]))
+                            << "length " << len << " at " << at;
+                        EXPECT_EQ(text.substr(0, at), dst.substr(0, at));
+                    }
+                }
+            }
+        }
+    }
+}
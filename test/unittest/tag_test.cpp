@@ -0,0 +1,73 @@
+#include <cstring>
+#include "gtest/gtest/gtest.h"
+#include "nodes/tag.h"
+#include "nodes/tagtable.h"
+#include "util/allocators.h"
+
+using namespace csoup;
+
+TEST(TagTest, IdOf)
+{
+    for (int id = CSOUP_TAG_UNKNOWN + 1; id < CSOUP_TAG_COUNT; ++ id) {
+        const internal::TagTableEntry& entry = internal::kTagTable[id];
+        StringRef name(entry.name, entry.length);
+        EXPECT_EQ(id, Tag::idOf(name)) << entry.name;
+        
+        const Tag* tag = Tag::valueOf(name);
+        ASSERT_TRUE(tag != NULL);
+        EXPECT_EQ(tag, Tag::valueOf(static_cast<TagIdEnum>(id)));
+        EXPECT_TRUE(tag->tagName().equals(name));
+    }
+    
+    EXPECT_EQ(CSOUP_TAG_UNKNOWN, Tag::idOf(""));
+    EXPECT_EQ(CSOUP_TAG_UNKNOWN, Tag::idOf("DIV"));
+    EXPECT_EQ(CSOUP_TAG_UNKNOWN, Tag::idOf("di"));
+    EXPECT_EQ(CSOUP_TAG_UNKNOWN, Tag::idOf("divs"));
+    EXPECT_EQ(CSOUP_TAG_UNKNOWN, Tag::idOf("blockquotes"));
+    EXPECT_EQ(CSOUP_TAG_UNKNOWN, Tag::idOf("foo"));
+    EXPECT_TRUE(Tag::valueOf("foo") == NULL);
+    
+    EXPECT_TRUE(Tag::valueOf("div")->block());
+    EXPECT_TRUE(Tag::valueOf("span")->inlineTag());
+    EXPECT_TRUE(Tag::valueOf("img")->empty());
+    EXPECT_TRUE(Tag::valueOf("textarea")->formSubmittable());
+}
+
+TEST(TagTest, TreeBuilderCategories)
+{
+    EXPECT_TRUE((Tag::valueOf("table")->flags() & CSOUP_TAG_FLAG_SCOPE) != 0);
+    EXPECT_TRUE((Tag::valueOf("table")->flags() & CSOUP_TAG_FLAG_TABLE_SCOPE) != 0);
+    EXPECT_TRUE((Tag::valueOf("td")->flags() & CSOUP_TAG_FLAG_TABLE_SCOPE) == 0);
+    EXPECT_TRUE((Tag::valueOf("ul")->flags() & CSOUP_TAG_FLAG_LIST_SCOPE) != 0);
+    EXPECT_TRUE((Tag::valueOf("ul")->flags() & CSOUP_TAG_FLAG_SCOPE) == 0);
+    EXPECT_TRUE((Tag::valueOf("p")->flags() & (CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_IMPLIED_END)) ==
+                (CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_IMPLIED_END));
+    EXPECT_TRUE((Tag::valueOf("option")->flags() & CSOUP_TAG_FLAG_SELECT_SCOPE) != 0);
+    EXPECT_TRUE((Tag::valueOf("span")->flags() & CSOUP_TAG_FLAG_SPECIAL) == 0);
+    
+    CrtAllocator allocator;
+    UnknownTagSet unknown(&allocator);
+    EXPECT_TRUE((unknown.valueOf("foo")->flags() & (CSOUP_TAG_FLAG_SPECIAL | CSOUP_TAG_FLAG_SCOPE)) == 0);
+}
+
+TEST(TagTest, UnknownTags)
+{
+    CrtAllocator allocator;
+    UnknownTagSet first(&allocator);
+    UnknownTagSet second(&allocator);
+    
+    EXPECT_EQ(Tag::valueOf("p"), first.valueOf("p"));
+    
+    char name[] = "foo";
+    const Tag* foo = first.valueOf(StringRef(name, 3));
+    std::strcpy(name, "bar");
+    EXPECT_TRUE(foo->tagName().equals("foo"));
+    EXPECT_FALSE(foo->isKnownTag());
+    EXPECT_TRUE(foo->formatAsBlock());
+    EXPECT_EQ(foo, first.valueOf("foo"));
+    EXPECT_NE(foo, first.valueOf("bar"));
+    
+    first.setSelfClosing(foo);
+    EXPECT_TRUE(foo->selfClosing());
+    EXPECT_FALSE(second.valueOf("foo")->selfClosing());
+}
@@ -0,0 +1,458 @@
+//
+//  tokeniser_test.cpp
+//  csoup
+//
+//  Created by mac on 12/20/14.
+//  Copyright (c) 2014 windpls. All rights reserved.
+//
+
+#include <cstring>
+#include <string>
+#include "gtest/gtest/gtest.h"
+#include "parser/characterreader.h"
+#include "parser/tokeniser.h"
+#include "parser/token.h"
+#include "parser/tokeniserstate.h"
+#include "parser/parseerrorlist.h"
+#include "util/stringbuffer.h"
+#include "util/allocators.h"
+#include "internal/lineindex.h"
+
+using namespace csoup;
+
+namespace {
+    void describe(Token* token, std::string* out) {
+        switch (token->tokenType()) {
+            case CSOUP_TOKEN_START_TAG: {
+                StartTagToken* tag = token->asStartTagToken();
+                out->append("<").append(tag->tagName().data(), tag->tagName().size());
+                for (size_t i = 0; tag->attributes() && i < tag->attributes()->size(); ++ i) {
+                    const Attribute* attr = tag->attributes()->get(i);
+                    out->append(" ").append(attr->key().data(), attr->key().size());
+                    out->append("=").append(attr->value().data(), attr->value().size());
+                }
+                out->append(">");
+                break;
+            }
+            case CSOUP_TOKEN_END_TAG:
+                out->append("</").append(token->asEndTagToken()->tagName().data(), token->asEndTagToken()->tagName().size());
+                out->append(">");
+                break;
+            case CSOUP_TOKEN_COMMENT:
+                out->append("<!--").append(token->asCommentToken()->data().data(), token->asCommentToken()->data().size());
+                out->append("-->");
+                break;
+            case CSOUP_TOKEN_CHARACTER:
+                out->append(token->asCharacterToken()->data().data(), token->asCharacterToken()->data().size());
+                break;
+            case CSOUP_TOKEN_DOCTYPE:
+                out->append("<!DOCTYPE ").append(token->asDoctypeToken()->name().data(), token->asDoctypeToken()->name().size());
+                out->append(">");
+                break;
+            case CSOUP_TOKEN_EOF:
+                out->append("EOF");
+                break;
+        }
+    }
+
+    // the state the tree builder reads the content of an element in, or NULL
+    internal::TokeniserState* contentState(Token* token) {
+        if (!token->isStartTagToken()) return NULL;
+        StringRef name = token->asStartTagToken()->tagName();
+        if (name.equals(StringRef("title")) || name.equals(StringRef("textarea"))) return internal::Rcdata::instance();
+        if (name.equals(StringRef("style")) || name.equals(StringRef("xmp"))) return internal::RawText::instance();
+        if (name.equals(StringRef("script"))) return internal::ScriptData::instance();
+        return NULL;
+    }
+
+    // Tokenises input fed in chunks of chunkSize bytes (all at once if 0). With
+    // contentStates the tokeniser switches states after start tags like the tree builder.
+    // Skipped content shows as {content}.
+    std::string tokenise(const std::string& input, size_t chunkSize, bool contentStates = false,
+                         const StringRef* skippedTags = NULL, size_t skippedTagCount = 0) {
+        CrtAllocator allocator;
+        ParseErrorList errors(16, &allocator);
+        StringBuffer buffer(&allocator);
+        CharacterReader reader(buffer.ref(), chunkSize == 0);
+        Tokeniser tokeniser(&reader, &errors, &allocator);
+        tokeniser.setSkippedTags(skippedTags, skippedTagCount);
+
+        std::string out;
+        size_t fed = 0;
+        if (chunkSize == 0) {
+            buffer.appendString(input.data(), input.size());
+            reader.reset(buffer.ref(), 0, true);
+            fed = input.size();
+        }
+
+        for (;;) {
+            Token* token = tokeniser.read();
+            if (token == NULL) {
+                size_t n = std::min(chunkSize, input.size() - fed);
+                buffer.appendString(input.data() + fed, n);
+                fed += n;
+                reader.reset(buffer.ref(), reader.pos(), fed == input.size());
+                continue;
+            }
+
+            if (tokeniser.endsSkippedContent()) {
+                StringRef skipped = tokeniser.skippedContent();
+                out.append("{").append(skipped.data(), skipped.size()).append("}");
+            }
+            describe(token, &out);
+            if (contentStates && contentState(token) != NULL) {
+                tokeniser.transition(contentState(token));
+            }
+            bool isEnd = token->isEOFToken();
+            allocator.deconstructAndFree(token);
+            if (isEnd) break;
+        }
+
+        return out;
+    }
+}
+
+TEST(TokeniserTest, Tokens) {
+    EXPECT_EQ("<p>Hello <b class=x id=y>world</b><!-- hi -->EOF",
+              tokenise("<P>Hello <b CLASS=\"x\" id='y'>world</b><!-- hi -->", 0));
+    EXPECT_EQ("<title>a <b></title>EOF", tokenise("<title>a <b></title>", 0));
+}
+
+TEST(TokeniserTest, ChunkedInputMatchesWholeInput) {
+    const std::string input = "<!DOCTYPE html><html><head><title>T&amp;T</title></head>\r\n"
+                              "<body class=\"main page\"><p>caf\xC3\xA9 \xE4\xBD\xA0\xE5\xA5\xBD</p>"
+                              "<!-- note --><script>if (a < b) x = '</p>';</script>x\r\ny</body></html>";
+    const std::string whole = tokenise(input, 0);
+
+    for (size_t chunkSize = 1; chunkSize < 20; ++ chunkSize) {
+        EXPECT_EQ(whole, tokenise(input, chunkSize)) << "chunk size " << chunkSize;
+    }
+}
+
+TEST(TokeniserTest, NamedReferences) {
+    // the longest name wins, with or without the ';' where the spec allows that
+    EXPECT_EQ("\xC2\xACit; \xC2\xAC\xE2\x88\x89 &x & &zzz;EOF",
+              tokenise("&notit; &not&notin; &ampx &amp &zzz;", 0));
+    // some entities are two code points
+    EXPECT_EQ("\xE2\x89\x82\xCC\xB8 \xE2\x8A\x8A\xEF\xB8\x80" "EOF", tokenise("&NotEqualTilde; &varsubsetneq;", 0));
+    // in attribute values a name without ';' followed by '=' or an alphanumeric isn't one
+    EXPECT_EQ("<a href=?a=1&amp=2&copy3 title=& \xC2\xA9>EOF", tokenise("<a href='?a=1&amp=2&copy3' title='&amp; &copy'>", 0));
+    
+    const std::string input = "<p title='&NotEqualTilde;'>&notin &NotEqualTilde; &amp;&lt&gtx</p>";
+    const std::string whole = tokenise(input, 0);
+    for (size_t chunkSize = 1; chunkSize < 8; ++ chunkSize) {
+        EXPECT_EQ(whole, tokenise(input, chunkSize)) << "chunk size " << chunkSize;
+    }
+}
+
+TEST(TokeniserTest, RawTextElements) {
+    // the end tag is matched ignoring case, and only when a terminator follows its name
+    EXPECT_EQ("<script>if (a</b) x = '</scriptx>' + \"</scr\";</script>EOF",
+              tokenise("<script>if (a</b) x = '</scriptx>' + \"</scr\";</SCRIPT >", 0, true));
+    EXPECT_EQ("<style>p > a { content: '\xE4\xBD\xA0' }</style><p>EOF",
+              tokenise("<style>p > a { content: '\xE4\xBD\xA0' }</style/><p>", 0, true));
+    // references in RCDATA, NUL, CR and controls still go through the state machine
+    const char controls[] = "<title>a &amp; b</title><textarea>x\r\ny\0z\x01</textarea>";
+    EXPECT_EQ("<title>a & b</title><textarea>x\ny\xEF\xBF\xBDz\xEF\xBF\xBD</textarea>EOF",
+              tokenise(std::string(controls, sizeof(controls) - 1), 0, true));
+    // so do escapes in scripts
+    EXPECT_EQ("<script><!--<script></script>--></script>EOF",
+              tokenise("<script><!--<script></script>--></script>", 0, true));
+    // an unclosed element runs to the end
+    EXPECT_EQ("<script>a < b </scr EOF", tokenise("<script>a < b </scr ", 0, true));
+    
+    std::string input = "<title>T&amp;T</title><script>";
+    for (int i = 0; i < 50; ++ i) {
+        input += "for (var i = 0; i < n; i++) { s += '</' + 'p>' + \"caf\xC3\xA9\"; }\r\n";
+    }
+    input += "</script ><style>a{}</style><textarea>x</TEXTAREA>";
+    const std::string whole = tokenise(input, 0, true);
+    for (size_t chunkSize = 1; chunkSize < 12; ++ chunkSize) {
+        EXPECT_EQ(whole, tokenise(input, chunkSize, true)) << "chunk size " << chunkSize;
+    }
+}
+
+TEST(TokeniserTest, SkippedTags) {
+    const StringRef skipped[] = {"script", "svg", "noscript"};
+    std::string input = "<p>a<script>if (a<b) x = '<script></scrip';</script>b<svg/>";
+    input += "<svg><svg><g/></svg><text>\xE4\xBD\xA0</text></SVG ><noscript><img src=x>";
+    const std::string expected = "<p>a<script>{if (a<b) x = '<script></scrip';}</script>b<svg>"
+                                 "<svg>{<svg><g/></svg><text>\xE4\xBD\xA0</text>}</svg>"
+                                 "<noscript>{<img src=x>}EOF";
+    EXPECT_EQ(expected, tokenise(input, 0, true, skipped, arrayLength(skipped)));
+    for (size_t chunkSize = 1; chunkSize < 12; ++ chunkSize) {
+        EXPECT_EQ(expected, tokenise(input, chunkSize, true, skipped, arrayLength(skipped))) << "chunk size " << chunkSize;
+    }
+}
+
+TEST(TokeniserTest, MixedMarkupChunked) {
+    const char* inputs[] = {
+        "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.0//EN\" 'about:legacy'><html lang=en>",
+        "<p class=a id = \"b\" data-x='c' disabled/>text &amp; &#x41;&#66; &notanentity; <br/>",
+        "<!-- c --><!----><!--->--><!x><?pi?></ p><a =b><a b=>c</a",
+        "<script>var s = '<!--<script>x</script>-->'; if (a<b) {}</script><style>p>a{}</style>",
+        "<textarea><b>&lt;</textarea><title>x</tit</title><plaintext>a<b>&amp;",
+        "<![CDATA[ x ]]><svg><![CDATA[y]]></svg>"
+    };
+    
+    for (size_t i = 0; i < arrayLength(inputs); ++ i) {
+        std::string input(inputs[i]);
+        EXPECT_EQ(tokenise(input, 0), tokenise(input, 3)) << input;
+    }
+}
+
+TEST(TokeniserTest, RecycledTokens) {
+    const std::string input = "<!DOCTYPE html><p class=a id=b>one</p><!-- c --><p>two &amp; three</p>"
+                              "<br/><p title=x>four</p><!-- d --></body>";
+    
+    CrtAllocator allocator;
+    ParseErrorList errors(16, &allocator);
+    CharacterReader reader(StringRef(input.data(), input.size()));
+    Tokeniser tokeniser(&reader, &errors, &allocator);
+    
+    std::string out;
+    Token* firstStartTag = NULL;
+    for (;;) {
+        Token* token = tokeniser.read();
+        describe(token, &out);
+        if (token->isStartTagToken()) {
+            // every start tag after the first reuses it
+            if (firstStartTag == NULL) firstStartTag = token;
+            EXPECT_EQ(firstStartTag, token);
+            EXPECT_NE(kNoSourcePos, token->sourcePos());
+        }
+        bool isEnd = token->isEOFToken();
+        tokeniser.recycle(token);
+        if (isEnd) break;
+    }
+    
+    // nothing carries over from the last use of a token
+    EXPECT_EQ(tokenise(input, 0), out);
+}
+
+TEST(TokeniserTest, TagIds) {
+    const std::string input = "<DIV><foo-bar><Table><tr></Div></foo-bar><br/><P CLASS=x><caf\xC3\xA9>";
+    const TagIdEnum ids[] = {CSOUP_TAG_DIV, CSOUP_TAG_UNKNOWN, CSOUP_TAG_TABLE, CSOUP_TAG_TR,
+                             CSOUP_TAG_DIV, CSOUP_TAG_UNKNOWN, CSOUP_TAG_BR, CSOUP_TAG_P, CSOUP_TAG_UNKNOWN};
+    const char* names[] = {"div", "foo-bar", "table", "tr", "div", "foo-bar", "br", "p", "caf\xC3\xA9"};
+    
+    CrtAllocator allocator;
+    ParseErrorList errors(16, &allocator);
+    CharacterReader reader(StringRef(input.data(), input.size()));
+    Tokeniser tokeniser(&reader, &errors, &allocator);
+    
+    size_t i = 0;
+    for (;;) {
+        Token* token = tokeniser.read();
+        if (token->isStartTagToken() || token->isEndTagToken()) {
+            TagToken* tag = static_cast<TagToken*>(token);
+            ASSERT_LT(i, arrayLength(ids));
+            EXPECT_TRUE(tag->tagName().equals(StringRef(names[i], std::strlen(names[i])))) << names[i];
+            EXPECT_EQ(ids[i ++], tag->tagId());
+            if (tag->tagId() == CSOUP_TAG_P) {
+                EXPECT_TRUE(tag->attribute("class").equals("x"));
+            }
+        }
+        bool isEnd = token->isEOFToken();
+        tokeniser.recycle(token);
+        if (isEnd) break;
+    }
+    EXPECT_EQ(arrayLength(ids), i);
+}
+
+TEST(TokeniserTest, ErrorPositions) {
+    CrtAllocator allocator;
+    ParseErrorList errors(16, &allocator);
+    CharacterReader reader(StringRef("<p>\nline two\n  caf\xC3\xA9 &#xZZ; <a =x>\n"));
+    Tokeniser tokeniser(&reader, &errors, &allocator);
+    
+    Token* token;
+    do {
+        token = tokeniser.read();
+        if (token->isTagToken() && token->asTagToken()->tagName().equals(StringRef("a"))) {
+            EXPECT_EQ(28u, token->sourcePos());
+        }
+        bool isEnd = token->isEOFToken();
+        allocator.deconstructAndFree(token);
+        if (isEnd) break;
+    } while (true);
+    
+    ASSERT_EQ(2u, errors.size());
+    // "&#x" with no digits, reported after the "x"; columns count code points
+    EXPECT_EQ(3u, errors.get(0)->line());
+    EXPECT_EQ(11u, errors.get(0)->column());
+    // '=' at the start of an attribute name, reported after it
+    EXPECT_EQ(3u, errors.get(1)->line());
+    EXPECT_EQ(19u, errors.get(1)->column());
+    
+    // messages are looked up from the codes
+    EXPECT_EQ(CSOUP_PARSE_ERROR_REFERENCE_NO_NUMERALS, errors.get(0)->code());
+    EXPECT_TRUE(errors.get(0)->errorMessage().equals(
+        StringRef("Invalid character reference: numeric reference with no numerals")));
+    EXPECT_EQ(CSOUP_PARSE_ERROR_UNEXPECTED_CHARACTER, errors.get(1)->code());
+    StringBuffer message(&allocator);
+    errors.get(1)->appendMessage(&message);
+    EXPECT_TRUE(message.ref().equals(StringRef("Unexpected character 'x' in input")));
+}
+
+TEST(TokeniserTest, LineIndex) {
+    std::string input;
+    for (int i = 0; i < 3000; ++ i) {
+        input += (i % 7 == 0) ? "\xE4\xBD\xA0\n" : "abc ";
+    }
+    
+    CrtAllocator allocator;
+    internal::LineIndex index(&allocator);
+    StringRef ref(input.data(), input.size());
+    
+    size_t line = 1, column = 1;
+    for (size_t pos = 0; pos < input.size(); ++ pos) {
+        size_t l, c;
+        index.locate(ref, pos, &l, &c);
+        EXPECT_EQ(line, l);
+        EXPECT_EQ(column, c);
+        if (input[pos] == '\n') {
+            ++ line;
+            column = 1;
+        } else if ((input[pos] & 0xC0) != 0x80) {
+            ++ column;
+        }
+    }
+    
+    size_t l, c;
+    index.discard(ref, 5000);
+    index.locate(StringRef(input.data() + 5000, input.size() - 5000), 3000, &l, &c);
+    size_t expectL, expectC;
+    internal::LineIndex fresh(&allocator);
+    fresh.locate(ref, 8000, &expectL, &expectC);
+    EXPECT_EQ(expectL, l);
+    EXPECT_EQ(expectC, c);
+}
+
+TEST(TokeniserTest, LineIndexCarriageReturns) {
+    CrtAllocator allocator;
+    size_t l, c;
+    
+    // old Mac line breaks
+    const char* cr = "a\rb\r\rc";
+    internal::LineIndex index(&allocator);
+    index.locate(StringRef(cr), 2, &l, &c);
+    EXPECT_EQ(2u, l);
+    EXPECT_EQ(1u, c);
+    index.locate(StringRef(cr), 5, &l, &c);
+    EXPECT_EQ(4u, l);
+    EXPECT_EQ(1u, c);
+    
+    // lone CRs, CR LFs and LFs, with a CR LF across the first block boundary
+    std::string input;
+    const char* lines[] = {"ab\r", "c\r\n", "\xE4\xBD\xA0\n", "d "};
+    for (int i = 0; input.size() < 3 * internal::LineIndex::kBlockSize; ++ i) {
+        input += lines[i % 4];
+    }
+    input[internal::LineIndex::kBlockSize - 1] = '\r';
+    input[internal::LineIndex::kBlockSize] = '\n';
+    input.resize(3 * internal::LineIndex::kBlockSize);
+    input[input.size() - 1] = '\r';
+    
+    index.clear();
+    StringRef ref(input.data(), input.size());
+    size_t line = 1, column = 1;
+    for (size_t pos = 0; pos <= input.size(); ++ pos) {
+        index.locate(ref, pos, &l, &c);
+        EXPECT_EQ(line, l) << pos;
+        EXPECT_EQ(column, c) << pos;
+        if (pos == input.size()) break;
+        
+        if (input[pos] == '\n' || (input[pos] == '\r' && (pos + 1 == input.size() || input[pos + 1] != '\n'))) {
+            ++ line;
+            column = 1;
+        } else if ((input[pos] & 0xC0) != 0x80) {
+            ++ column;
+        }
+    }
+    
+    // a CR LF split where the input was dropped
+    const size_t split = internal::LineIndex::kBlockSize + 10;
+    input[split - 1] = '\r';
+    input[split] = '\n';
+    internal::LineIndex fresh(&allocator);
+    index.clear();
+    index.discard(StringRef(input.data(), split), split);
+    StringRef rest(input.data() + split, input.size() - split);
+    for (size_t pos = 1; pos <= rest.size(); pos += 97) {
+        size_t expectL, expectC;
+        fresh.locate(ref, split + pos, &expectL, &expectC);
+        index.locate(rest, pos, &l, &c);
+        EXPECT_EQ(expectL, l) << pos;
+        EXPECT_EQ(expectC, c) << pos;
+    }
+}
+
+TEST(TokeniserTest, DecodeErrors) {
+    std::string input = "<p>";
+    for (int i = 0; i < 100; ++ i) input += "a\xFF";
+    input += "\n\x01</p>\xE4\xBD";
+    
+    for (size_t maxSize = 0; maxSize <= 16; maxSize += 16) {
+        CrtAllocator allocator;
+        ParseErrorList errors(maxSize, &allocator);
+        errors.setMaxDecodeErrors(3);
+        CharacterReader reader(StringRef(input.data(), input.size()));
+        Tokeniser tokeniser(&reader, &errors, &allocator);
+        
+        for (;;) {
+            Token* token = tokeniser.read();
+            bool isEnd = token->isEOFToken();
+            allocator.deconstructAndFree(token);
+            if (isEnd) break;
+        }
+        
+        EXPECT_EQ(100u, errors.decodeErrorCount(CSOUP_DECODE_ERROR_INVALID_SEQUENCE));
+        EXPECT_EQ(1u, errors.decodeErrorCount(CSOUP_DECODE_ERROR_INVALID_CODE_POINT));
+        EXPECT_EQ(1u, errors.decodeErrorCount(CSOUP_DECODE_ERROR_TRUNCATED));
+        
+        if (maxSize == 0) {
+            EXPECT_EQ(0u, errors.size());
+            continue;
+        }
+        
+        EXPECT_EQ(3u, errors.listedDecodeErrorCount(CSOUP_DECODE_ERROR_INVALID_SEQUENCE));
+        EXPECT_EQ(5u, errors.size());
+        EXPECT_EQ(4, errors.get(0)->pos());
+        EXPECT_EQ(1u, errors.get(0)->line());
+        EXPECT_EQ(5u, errors.get(0)->column());
+        EXPECT_EQ(2u, errors.get(3)->line());
+        EXPECT_EQ(2u, errors.get(4)->line());
+    }
+}
+
+TEST(TokeniserTest, InputSpans) {
+    CrtAllocator allocator;
+    ParseErrorList errors(16, &allocator);
+    const std::string input = "<p>plain text</p>a &amp; b<b>x\r\ny</b>1 < 2";
+    CharacterReader reader(StringRef(input.data(), input.size()));
+    Tokeniser tokeniser(&reader, &errors, &allocator);
+    
+    std::string spans, copies;
+    for (;;) {
+        Token* token = tokeniser.read();
+        if (token->isCharacterToken()) {
+            CharacterToken* c = token->asCharacterToken();
+            std::string data(c->data().data(), c->data().size());
+            if (c->isInputSpan()) {
+                EXPECT_TRUE(c->data().data() >= input.data() && c->data().data() + c->data().size() <= input.data() + input.size());
+                spans += data + "|";
+            } else {
+                copies += data + "|";
+            }
+        }
+        bool isEnd = token->isEOFToken();
+        allocator.deconstructAndFree(token);
+        if (isEnd) break;
+    }
+    
+    // runs holding a character reference or a CR are copied, the rest aren't; a
+    // '<' that starts no tag is emitted by itself but still matches the input
+    EXPECT_EQ("plain text|1 < 2|", spans);
+    EXPECT_EQ("a & b|x\ny|", copies);
+}
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+#
+# Generates src/nodes/entitytrie.h, the trie of HTML named character references
+# that Entities walks, from the WHATWG list as shipped with Python
+# (html.entities.html5). Run it from the repository root:
+#
+#     python3 tools/gen_entity_trie.py > src/nodes/entitytrie.h
+
+import html.entities
+
+HEADER = """//
+//  entitytrie.h
+//  csoup
+//
+//  Generated by tools/gen_entity_trie.py from the WHATWG named character
+//  references; don't edit.
+//
+
+#ifndef CSOUP_ENTITYTRIE_H_
+#define CSOUP_ENTITYTRIE_H_
+
+#include "../util/common.h"
+
+namespace csoup {
+    namespace internal {
+        // One node per name prefix, in breadth first order so that the children of
+        // a node are next to each other, sorted by label.
+        struct EntityTrieNode {
+            uint8_t label;          // byte on the edge into the node
+            uint8_t childCount;
+            uint16_t firstChild;    // index of the first child
+            uint16_t value;         // 1 + index in kEntityCodePoints of the name ending here, 0 if none
+        };
+"""
+
+FOOTER = """    } // namespace internal
+} // namespace csoup
+
+#endif // CSOUP_ENTITYTRIE_H_"""
+
+
+def main():
+    names = html.entities.html5
+
+    # build the trie as nested dicts, then number the nodes breadth first
+    root = {}
+    for name in names:
+        node = root
+        for c in name.encode('ascii'):
+            node = node.setdefault(c, {})
+        node[None] = name
+
+    order = [(None, root)]
+    i = 0
+    while i < len(order):
+        node = order[i][1]
+        for label in sorted(k for k in node if k is not None):
+            order.append((label, node[label]))
+        i += 1
+
+    index = {}
+    for n, (label, node) in enumerate(order):
+        index[id(node)] = n
+    assert len(order) < 1 << 16
+
+    values = []
+    rows = []
+    for label, node in order:
+        children = sorted(k for k in node if k is not None)
+        first = index[id(node[children[0]])] if children else 0
+        value = 0
+        if None in node:
+            values.append([ord(c) for c in names[node[None]]])
+            value = len(values)
+        rows.append((label or 0, len(children), first, value))
+
+    out = [HEADER]
+    out.append("        const size_t kEntityTrieSize = %d;\n" % len(rows))
+    out.append("        const EntityTrieNode kEntityTrie[kEntityTrieSize] = {")
+    line = "           "
+    for row in rows:
+        label = "'%c'" % row[0] if row[0] else "0"
+        item = " {%s, %d, %d, %d}," % ((label,) + row[1:])
+        if len(line) + len(item) > 116:
+            out.append(line)
+            line = "           "
+        line += item
+    out.append(line)
+    out.append("        };\n")
+
+    out.append("        // code points of each entity; the second is 0 for entities of one code point")
+    out.append("        const int kEntityCodePoints[%d][2] = {" % len(values))
+    line = "           "
+    for v in values:
+        item = " {0x%X, 0x%X}," % (v[0], v[1] if len(v) > 1 else 0)
+        if len(line) + len(item) > 116:
+            out.append(line)
+            line = "           "
+        line += item
+    out.append(line)
+    out.append("        };")
+    out.append(FOOTER)
+    print("\n".join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,353 @@
+#!/usr/bin/env python3
+#
+# Generates the table of known HTML tags: src/nodes/tagid.h, the TagIdEnum every
+# known tag name maps to, and src/nodes/tagtable.h, their names, properties and
+# the perfect hash Tag::idOf() looks them up with, and src/parser/tagsets.h, the
+# groups of tags the tree builder tests for as TagSet constants. Run it from the
+# repository root:
+#
+#     python3 tools/gen_tag_table.py ids > src/nodes/tagid.h
+#     python3 tools/gen_tag_table.py table > src/nodes/tagtable.h
+#     python3 tools/gen_tag_table.py sets > src/parser/tagsets.h
+
+import sys
+
+# prepped from http://www.w3.org/TR/REC-html40/sgml/dtd.html and other sources
+BLOCK_TAGS = """
+    html head body frameset script noscript style meta link title frame noframes section nav aside hgroup
+    header footer p h1 h2 h3 h4 h5 h6 ul ol pre div blockquote hr address figure figcaption form fieldset
+    ins del s dl dt dd li table caption thead tfoot tbody colgroup col tr th td video audio canvas details
+    menu plaintext template article main svg math center
+""".split()
+INLINE_TAGS = """
+    object base font tt i b u big small em strong dfn code samp kbd var cite abbr time acronym mark ruby rt
+    rp a img br wbr map q sub sup bdo iframe embed span input select textarea label button optgroup option
+    legend datalist keygen output progress meter area param source track summary command device basefont
+    bgsound menuitem
+""".split()
+# named by the tree builder but in neither list; they get the properties of unknown tags
+OTHER_TAGS = """
+    applet dir image isindex listing marquee nobr noembed strike xmp
+""".split()
+EMPTY_TAGS = """
+    meta link base frame img br wbr embed hr input keygen col command device area basefont bgsound menuitem
+    param source track
+""".split()
+FORMAT_AS_INLINE_TAGS = """
+    title a p h1 h2 h3 h4 h5 h6 pre address li th td script style ins del s
+""".split()
+# script is not here as it is a data node, which always preserve whitespace
+PRESERVE_WHITESPACE_TAGS = "pre plaintext title textarea".split()
+FORM_LISTED_TAGS = "button fieldset input keygen object output select textarea".split()
+FORM_SUBMIT_TAGS = "input keygen object select textarea".split()
+
+# categories of the HTML tree builder, see HtmlTreeBuilder::inSpecificScope()
+SPECIAL_TAGS = """
+    address applet area article aside base basefont bgsound blockquote body br button caption center col colgroup
+    command dd details dir div dl dt embed fieldset figcaption figure footer form frame frameset h1 h2 h3 h4 h5 h6
+    head header hgroup hr html iframe img input isindex li link listing marquee menu meta nav noembed noframes
+    noscript object ol p param plaintext pre script section select style summary table tbody td textarea tfoot th
+    thead title tr ul wbr xmp
+""".split()
+SCOPE_TAGS = "applet caption html table td th marquee object".split()
+LIST_SCOPE_TAGS = "ol ul".split()
+BUTTON_SCOPE_TAGS = "button".split()
+TABLE_SCOPE_TAGS = "html table".split()
+SELECT_SCOPE_TAGS = "optgroup option".split()
+IMPLIED_END_TAGS = "dd dt li option optgroup p rp rt".split()
+
+# TagFlagEnum, in bit order
+FLAGS = [
+    ("BLOCK", "block or inline"),
+    ("FORMAT_AS_BLOCK", "should be formatted as a block"),
+    ("CAN_CONTAIN_BLOCK", "can hold block level tags"),
+    ("CAN_CONTAIN_INLINE", "only pcdata if not"),
+    ("EMPTY", "can hold nothing, e.g. img"),
+    ("PRESERVE_WHITESPACE", "for pre, textarea, script etc"),
+    ("FORM_LISTED", "a control that appears in forms: input, textarea, output etc"),
+    ("FORM_SUBMIT", "a control that can be submitted in a form: input etc"),
+    ("SPECIAL", "in the special category of the tree builder"),
+    ("SCOPE", "ends the search of a scope: html, table, td etc"),
+    ("LIST_SCOPE", "also ends the search of list item scope: ol, ul"),
+    ("BUTTON_SCOPE", "also ends the search of button scope: button"),
+    ("TABLE_SCOPE", "ends the search of table scope: html, table"),
+    ("SELECT_SCOPE", "doesn't end the search of select scope: optgroup, option"),
+    ("IMPLIED_END", "closed by generating implied end tags: dd, li, p etc"),
+]
+
+# HtmlTreeBuilder's own, in the order they are declared
+BUILDER_TAG_SETS = [
+    ("TagsScriptStyle", "script style"),
+    ("TagsRcdata", "textarea title"),
+    ("TagsRawText", "iframe noembed noframes style xmp"),
+]
+
+# HtmlTreeBuilderState::Constants, in the order they are declared
+TAG_SETS = [
+    ("InBodyStartToHead", "base basefont bgsound command link meta noframes script style title"),
+    ("InBodyStartPClosers", """address article aside blockquote center details dir div dl fieldset figcaption figure
+                             footer header hgroup menu nav ol p section summary ul"""),
+    ("Headings", "h1 h2 h3 h4 h5 h6"),
+    ("InBodyStartPreListing", "pre listing"),
+    ("InBodyStartLiBreakers", "address div p"),
+    ("DdDt", "dd dt"),
+    ("Formatters", "b big code em font i s small strike strong tt u"),
+    ("InBodyStartApplets", "applet marquee object"),
+    ("InBodyStartEmptyFormatters", "area br embed img keygen wbr"),
+    ("InBodyStartMedia", "param source track"),
+    ("InBodyStartOptions", "optgroup option"),
+    ("InBodyStartRuby", "rp rt"),
+    ("InBodyStartDrop", "caption col colgroup frame head tbody td tfoot th thead tr"),
+    ("InBodyEndClosers", """address article aside blockquote button center details dir div dl fieldset figcaption
+                          figure footer header hgroup listing menu nav ol pre section summary ul"""),
+    ("InBodyEndAdoptionFormatters", "a b big code em font i nobr s small strike strong tt u"),
+    ("InBodyEndTableFosters", "table tbody tfoot thead tr"),
+]
+
+HASH_BASIS = 0x811C9DC5
+HASH_PRIME = 0x01000193
+SLOT_BITS = 8       # 256 slots
+BUCKET_BITS = 7     # 128 displacements
+
+
+def flags_of(name):
+    flags = set()
+    if name in BLOCK_TAGS:
+        flags |= {"BLOCK", "FORMAT_AS_BLOCK", "CAN_CONTAIN_BLOCK"}
+    elif name in INLINE_TAGS:
+        pass
+    else:
+        flags |= {"FORMAT_AS_BLOCK", "CAN_CONTAIN_BLOCK"}
+    flags.add("CAN_CONTAIN_INLINE")
+    if name in EMPTY_TAGS:
+        flags -= {"CAN_CONTAIN_BLOCK", "CAN_CONTAIN_INLINE"}
+        flags.add("EMPTY")
+    if name in FORMAT_AS_INLINE_TAGS:
+        flags.discard("FORMAT_AS_BLOCK")
+    if name in PRESERVE_WHITESPACE_TAGS:
+        flags.add("PRESERVE_WHITESPACE")
+    if name in FORM_LISTED_TAGS:
+        flags.add("FORM_LISTED")
+    if name in FORM_SUBMIT_TAGS:
+        flags.add("FORM_SUBMIT")
+    for flag, tags in (("SPECIAL", SPECIAL_TAGS), ("SCOPE", SCOPE_TAGS), ("LIST_SCOPE", LIST_SCOPE_TAGS),
+                       ("BUTTON_SCOPE", BUTTON_SCOPE_TAGS), ("TABLE_SCOPE", TABLE_SCOPE_TAGS),
+                       ("SELECT_SCOPE", SELECT_SCOPE_TAGS), ("IMPLIED_END", IMPLIED_END_TAGS)):
+        if name in tags:
+            flags.add(flag)
+    return flags
+
+
+def tag_hash(name):
+    h = HASH_BASIS
+    for c in name.encode('ascii'):
+        h = ((h ^ c) * HASH_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def bucket_of(h):
+    return h >> (32 - BUCKET_BITS)
+
+
+def slot_of(h, displacement):
+    return ((h >> (32 - BUCKET_BITS - SLOT_BITS)) + displacement) & ((1 << SLOT_BITS) - 1)
+
+
+def perfect_hash(names):
+    """Displacement per bucket of the top hash bits, so that the bits below them plus
+    the displacement of their bucket give every name a slot of its own. FNV-1a only
+    mixes upwards, so the low bits are left alone."""
+    slots = [None] * (1 << SLOT_BITS)
+    buckets = {}
+    for name in names:
+        buckets.setdefault(bucket_of(tag_hash(name)), []).append(name)
+    displacements = [0] * (1 << BUCKET_BITS)
+    for bucket, members in sorted(buckets.items(), key=lambda item: -len(item[1])):
+        for d in range(1 << SLOT_BITS):
+            wanted = [slot_of(tag_hash(n), d) for n in members]
+            if len(set(wanted)) == len(wanted) and all(slots[s] is None for s in wanted):
+                for n, s in zip(members, wanted):
+                    slots[s] = n
+                displacements[bucket] = d
+                break
+        else:
+            sys.exit("no displacement for bucket %d" % bucket)
+    return slots, displacements
+
+
+def enum_name(name):
+    return "CSOUP_TAG_" + name.upper()
+
+
+def known_names():
+    names = []
+    for name in BLOCK_TAGS + INLINE_TAGS + OTHER_TAGS:
+        if name not in names:
+            names.append(name)
+    return sorted(names)
+
+
+def wrap(items, indent):
+    lines = []
+    line = indent
+    for item in items:
+        if len(line) + len(item) + 1 > 116:
+            lines.append(line.rstrip())
+            line = indent
+        line += item + " "
+    lines.append(line.rstrip())
+    return lines
+
+
+def print_ids(names):
+    out = ["""//
+//  tagid.h
+//  csoup
+//
+//  Generated by tools/gen_tag_table.py; don't edit.
+//
+
+#ifndef CSOUP_TAGID_H_
+#define CSOUP_TAGID_H_
+
+#include "../util/common.h"
+
+namespace csoup {
+    // Known tags in name order, see Tag::idOf(). CSOUP_TAG_UNKNOWN stands for every
+    // other name.
+    typedef enum {
+        CSOUP_TAG_UNKNOWN,"""]
+    out += wrap(["%s," % enum_name(n) for n in names], "        ")
+    out.append("""        CSOUP_TAG_COUNT
+    } TagIdEnum;
+
+    // Properties of a tag, see Tag.
+    typedef enum {""")
+    for i, (flag, comment) in enumerate(FLAGS):
+        out.append("        %s = 1 << %d,%s// %s" % ("CSOUP_TAG_FLAG_" + flag, i,
+                   " " * (24 - len(flag) - len(str(i))), comment))
+    out[-1] = out[-1].replace(",", " ", 1)
+    out.append("""    } TagFlagEnum;
+
+    namespace internal {
+        // FNV-1a over the lower case name, see Tag::idOf() and Tag::hashName()""")
+    out.append("        const uint32_t kTagHashBasis = 0x%08X;" % HASH_BASIS)
+    out.append("        const uint32_t kTagHashPrime = 0x%08X;" % HASH_PRIME)
+    out.append("""    } // namespace internal
+} // namespace csoup
+
+#endif // CSOUP_TAGID_H_""")
+    print("\n".join(out))
+
+
+def print_table(names):
+    slots, displacements = perfect_hash(names)
+    ids = dict((n, i + 1) for i, n in enumerate(names))
+
+    out = ["""//
+//  tagtable.h
+//  csoup
+//
+//  Generated by tools/gen_tag_table.py; don't edit.
+//
+
+#ifndef CSOUP_TAGTABLE_H_
+#define CSOUP_TAGTABLE_H_
+
+#include "../util/common.h"
+#include "tagid.h"
+
+namespace csoup {
+    namespace internal {
+        struct TagTableEntry {
+            const char* name;
+            uint8_t length;
+            uint32_t flags;         // TagFlagEnum bits
+        };
+"""]
+    out.append("        const size_t kTagNameMaxLength = %d;" % max(len(n) for n in names))
+    out.append("        const int kTagSlotBits = %d;" % SLOT_BITS)
+    out.append("        const int kTagBucketBits = %d;" % BUCKET_BITS)
+    out.append("")
+    out.append("        // indexed by TagIdEnum")
+    out.append("        const TagTableEntry kTagTable[CSOUP_TAG_COUNT] = {")
+    rows = ['{"", 0, 0},']
+    for n in names:
+        flags = flags_of(n)
+        bits = " | ".join("CSOUP_TAG_FLAG_" + f for f, _ in FLAGS if f in flags) or "0"
+        rows.append('{"%s", %d, %s},' % (n, len(n), bits))
+    out += ["            " + r for r in rows]
+    out.append("        };")
+    out.append("")
+    out.append("        // by the top kTagBucketBits of the hash, added to the kTagSlotBits below them")
+    out.append("        const uint8_t kTagDisplacements[1 << kTagBucketBits] = {")
+    out += wrap(["%d," % d for d in displacements], "            ")
+    out.append("        };")
+    out.append("")
+    out.append("        // the tag id of each slot, CSOUP_TAG_UNKNOWN for unused ones")
+    out.append("        const uint8_t kTagSlots[1 << kTagSlotBits] = {")
+    out += wrap(["%d," % (ids[s] if s else 0) for s in slots], "            ")
+    out.append("        };")
+    out.append("""    } // namespace internal
+} // namespace csoup
+
+#endif // CSOUP_TAGTABLE_H_""")
+    print("\n".join(out))
+
+
+def print_sets(names):
+    ids = dict((n, i + 1) for i, n in enumerate(names))
+    words = (len(names) + 1 + 63) // 64
+
+    out = ["""//
+//  tagsets.h
+//  csoup
+//
+//  Generated by tools/gen_tag_table.py; don't edit.
+//
+//  Defines the TagSet constants of HtmlTreeBuilder and HtmlTreeBuilderState;
+//  htmltreebuilderstate.cpp includes it once.
+//
+
+#ifndef CSOUP_TAGSETS_H_
+#define CSOUP_TAGSETS_H_
+
+#include "htmltreebuilder.h"
+#include "htmltreebuilderstate.h"
+
+namespace csoup {"""]
+    sets = [("HtmlTreeBuilder::" + name, members) for name, members in BUILDER_TAG_SETS]
+    sets += [("HtmlTreeBuilderState::Constants::" + name, members) for name, members in TAG_SETS]
+    for name, members in sets:
+        members = members.split()
+        for m in members:
+            assert m in ids, m
+        bits = [0] * words
+        for m in members:
+            bits[ids[m] // 64] |= 1 << (ids[m] % 64)
+        out += wrap(members, "    // ")
+        out.append("    const TagSet %s = {{" % name)
+        out += ["        CSOUP_UINT64_C2(0x%08X, 0x%08X)," % (b >> 32, b & 0xFFFFFFFF) for b in bits]
+        out[-1] = out[-1].rstrip(",")
+        out.append("    }};")
+    out.append("""} // namespace csoup
+
+#endif // CSOUP_TAGSETS_H_""")
+    print("\n".join(out))
+
+
+def main():
+    names = known_names()
+    assert len(names) < 256
+    if len(sys.argv) != 2 or sys.argv[1] not in ("ids", "table", "sets"):
+        sys.exit("usage: gen_tag_table.py ids|table|sets")
+    if sys.argv[1] == "ids":
+        print_ids(names)
+    elif sys.argv[1] == "table":
+        print_table(names)
+    else:
+        print_sets(names)
+
+
+if __name__ == '__main__':
+    main()